@@ -26,11 +26,22 @@ namespace u8lib::internal
 		const int max_width = width;
 		const auto first = value.data();
 		const auto last = first + value.size();
+		constexpr auto max_int = std::numeric_limits<int>::max();
+
+		// ascii is one column per code unit, except CR LF which is a single grapheme. The code unit after the
+		// prefix must be ascii too, a combining mark would join the last grapheme
+		if (value.size() <= static_cast<size_t>(max_int)) {
+			const size_t count = max_width >= 0 ? std::min(value.size(), static_cast<size_t>(max_width)) : value.size();
+			const size_t check_size = std::min(value.size(), count + 1);
+			if (utf8_ascii_prefix(first, check_size) == check_size && !std::char_traits<char8_t>::find(first, count, u8'\r')) {
+				width = static_cast<int>(count);
+				return first + count;
+			}
+		}
+
 		msvc::_Measure_string_prefix_iterator_utf pfx_iter(first, last);
 		int estimated_width = 0; // the estimated width of [first, pfx_iter)
 
-		constexpr auto max_int = std::numeric_limits<int>::max();
-
 		while (pfx_iter != std::default_sentinel) {
 			if (estimated_width == max_width && max_width >= 0) {
 				// We're at our maximum length
@@ -0,0 +1,195 @@
+#include "pch.hpp"
+
+#include <u8lib/mapped_text.hpp>
+#include <u8lib/transcoder.hpp>
+
+#include <bit>
+#include <cstring>
+#include <utility>
+
+#if U8LIB_WIN32
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace u8lib
+{
+	namespace
+	{
+		// transcode the mapped code units chunk by chunk, the transcoder carries sequences cut between chunks
+		template<typename From>
+		void transcode_mapping(const uint8_t* data, size_t size, bool big_endian, u8string& out) {
+			constexpr size_t kChunkSize = 2048;
+			constexpr size_t kMaxExpansion = sizeof(From) == 2 ? 3 : 4;
+			const bool swap = big_endian != (std::endian::native == std::endian::big);
+
+			From units[kChunkSize];
+			char8_t buffer[kChunkSize * kMaxExpansion];
+			utf_transcoder<From, char8_t> transcoder;
+
+			const size_t count = size / sizeof(From);
+			// exact for ascii text, at most one reallocation step short otherwise
+			out.reserve(count);
+			for (size_t index = 0; index < count; index += kChunkSize) {
+				const size_t chunk = std::min(kChunkSize, count - index);
+				std::memcpy(units, data + index * sizeof(From), chunk * sizeof(From));
+				if (swap) {
+					for (size_t i = 0; i < chunk; ++i) {
+						units[i] = static_cast<From>(std::byteswap(static_cast<std::conditional_t<sizeof(From) == 2, uint16_t, uint32_t>>(units[i])));
+					}
+				}
+				const auto [read, written] = transcoder.transcode(std::span<const From>(units, chunk), std::span<char8_t>(buffer));
+				assert(read == chunk && "buffer holds the worst case expansion");
+				out.append(u8string_view(buffer, written));
+			}
+			const size_t written = transcoder.finish(std::span<char8_t>(buffer));
+			out.append(u8string_view(buffer, written));
+
+			// trailing bytes short of a code unit
+			if (size % sizeof(From)) {
+				out.append(u8string_view(u8"\uFFFD"));
+			}
+		}
+	}
+
+	// ctor & dtor
+	mapped_text::mapped_text(mapped_text&& other) noexcept
+		: data_(std::exchange(other.data_, nullptr))
+		, size_(std::exchange(other.size_, 0))
+		, bom_(std::exchange(other.bom_, {text_encoding::utf8, 0}))
+		, is_open_(std::exchange(other.is_open_, false))
+		, transcoded_(std::exchange(other.transcoded_, false))
+		, text_(std::move(other.text_)) {
+	}
+
+	mapped_text& mapped_text::operator=(mapped_text&& other) noexcept {
+		if (this != &other) {
+			close();
+			data_ = std::exchange(other.data_, nullptr);
+			size_ = std::exchange(other.size_, 0);
+			bom_ = std::exchange(other.bom_, {text_encoding::utf8, 0});
+			is_open_ = std::exchange(other.is_open_, false);
+			transcoded_ = std::exchange(other.transcoded_, false);
+			text_ = std::move(other.text_);
+		}
+		return *this;
+	}
+
+	// open & close
+	bool mapped_text::open(const char8_t* filename) {
+		close();
+
+#if U8LIB_WIN32
+		const u8string_view name(filename);
+		std::u16string wide_name(utf8_to_utf16_size(name.data(), name.size()), u'\0');
+		utf8_to_utf16(name.data(), name.size(), wide_name.data());
+
+		HANDLE file = CreateFileW(reinterpret_cast<LPCWSTR>(wide_name.c_str()), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		                          OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+		LARGE_INTEGER file_size;
+		if (!GetFileSizeEx(file, &file_size) || static_cast<uint64_t>(file_size.QuadPart) > SIZE_MAX) {
+			CloseHandle(file);
+			return false;
+		}
+
+		// an empty file cannot be mapped, it is open with empty text
+		if (file_size.QuadPart) {
+			HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (!mapping) {
+				CloseHandle(file);
+				return false;
+			}
+			const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(mapping);
+			if (!view) {
+				CloseHandle(file);
+				return false;
+			}
+			data_ = static_cast<const uint8_t*>(view);
+			size_ = static_cast<size_type>(file_size.QuadPart);
+		}
+		// the view keeps the mapping and the file alive after their handles are closed
+		CloseHandle(file);
+#else
+		const int fd = ::open(reinterpret_cast<const char*>(filename), O_RDONLY | O_CLOEXEC);
+		if (fd < 0) {
+			return false;
+		}
+		struct stat st;
+		if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || static_cast<uint64_t>(st.st_size) > SIZE_MAX) {
+			::close(fd);
+			return false;
+		}
+
+		// an empty file cannot be mapped, it is open with empty text
+		if (st.st_size) {
+			void* view = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			if (view == MAP_FAILED) {
+				::close(fd);
+				return false;
+			}
+			data_ = static_cast<const uint8_t*>(view);
+			size_ = static_cast<size_type>(st.st_size);
+		}
+		// the mapping stays valid after its descriptor is closed
+		::close(fd);
+#endif
+
+		bom_ = sniff_bom(data_, size_);
+		is_open_ = true;
+		return true;
+	}
+
+	void mapped_text::close() noexcept {
+		if (data_) {
+#if U8LIB_WIN32
+			UnmapViewOfFile(data_);
+#else
+			::munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+		}
+		data_ = nullptr;
+		size_ = 0;
+		bom_ = {text_encoding::utf8, 0};
+		is_open_ = false;
+		transcoded_ = false;
+		// release() keeps the heap buffer, swapping in an empty string frees it
+		text_ = u8string{};
+	}
+
+	// text
+	u8string_view mapped_text::text() const {
+		if (bom_.encoding == text_encoding::utf8) {
+			return size_ ? u8string_view(reinterpret_cast<const char8_t*>(data_) + bom_.size, size_ - bom_.size) : u8string_view();
+		}
+		if (!transcoded_) {
+			_transcode();
+			transcoded_ = true;
+		}
+		return text_;
+	}
+
+	void mapped_text::_transcode() const {
+		const uint8_t* const first = data_ + bom_.size;
+		const size_type size = size_ - bom_.size;
+		switch (bom_.encoding) {
+			case text_encoding::utf16le:
+			case text_encoding::utf16be:
+				transcode_mapping<char16_t>(first, size, bom_.encoding == text_encoding::utf16be, text_);
+				break;
+			case text_encoding::utf32le:
+			case text_encoding::utf32be:
+				transcode_mapping<char32_t>(first, size, bom_.encoding == text_encoding::utf32be, text_);
+				break;
+			default:
+				break;
+		}
+	}
+}
@@ -0,0 +1,101 @@
+#include "pch.hpp"
+
+#include <u8lib/multi_searcher.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace u8lib
+{
+	multi_searcher::multi_searcher(std::span<const u8string_view> patterns) {
+		// trie in insertion order first, children as (byte, state) pairs
+		struct trie_state {
+			std::vector<std::pair<char8_t, uint32_t>> children;
+			std::vector<uint32_t> patterns;
+		};
+		std::vector<trie_state> trie(1);
+		pattern_sizes_.reserve(patterns.size());
+		for (size_type pattern = 0; pattern < patterns.size(); ++pattern) {
+			const u8string_view each = patterns[pattern];
+			pattern_sizes_.push_back(each.size());
+			if (each.empty()) {
+				continue;
+			}
+			max_pattern_size_ = (std::max)(max_pattern_size_, each.size());
+
+			uint32_t current = 0;
+			for (const char8_t byte : each.view()) {
+				auto& children = trie[current].children;
+				auto found = std::find_if(children.begin(), children.end(), [byte](const auto& child) {
+					return child.first == byte;
+				});
+				if (found != children.end()) {
+					current = found->second;
+				} else {
+					const auto added = static_cast<uint32_t>(trie.size());
+					children.emplace_back(byte, added);
+					trie.emplace_back();
+					current = added;
+				}
+			}
+			trie[current].patterns.push_back(static_cast<uint32_t>(pattern));
+		}
+
+		// renumber breadth first with children by byte, so shallow states come first and the dense ones are a prefix
+		std::vector<uint32_t> order{0};
+		std::vector<uint32_t> renumbered(trie.size());
+		std::vector<size_type> depths{0};
+		order.reserve(trie.size());
+		depths.reserve(trie.size());
+		for (size_type i = 0; i < order.size(); ++i) {
+			auto& children = trie[order[i]].children;
+			std::sort(children.begin(), children.end());
+			renumbered[order[i]] = static_cast<uint32_t>(i);
+			for (const auto& child : children) {
+				order.push_back(child.second);
+				depths.push_back(depths[i] + 1);
+			}
+		}
+		dense_states_ = static_cast<size_type>(std::find_if(depths.begin(), depths.end(), [](size_type depth) {
+			return depth >= kDenseDepth;
+		}) - depths.begin());
+
+		// edges and patterns in the new numbering
+		states_.resize(order.size());
+		for (size_type i = 0; i < order.size(); ++i) {
+			const trie_state& old = trie[order[i]];
+			state& each = states_[i];
+			each.edge_begin = static_cast<uint32_t>(edge_bytes_.size());
+			each.edge_count = static_cast<uint32_t>(old.children.size());
+			for (const auto& child : old.children) {
+				edge_bytes_.push_back(child.first);
+				edge_targets_.push_back(renumbered[child.second]);
+			}
+			each.pattern_begin = static_cast<uint32_t>(state_patterns_.size());
+			each.pattern_count = static_cast<uint32_t>(old.patterns.size());
+			state_patterns_.insert(state_patterns_.end(), old.patterns.begin(), old.patterns.end());
+		}
+
+		// failure links and dense rows breadth first, every state the failure of a state points to is shallower and
+		// already complete
+		dense_.resize(dense_states_ * 256);
+		for (size_type i = 0; i < states_.size(); ++i) {
+			state& each = states_[i];
+			const auto id = static_cast<uint32_t>(i);
+			if (i < dense_states_) {
+				uint32_t* row = dense_.data() + i * 256;
+				for (size_type byte = 0; byte < 256; ++byte) {
+					row[byte] = i == 0 ? 0 : next(each.failure, static_cast<char8_t>(byte));
+				}
+				for (uint32_t edge = 0; edge < each.edge_count; ++edge) {
+					row[edge_bytes_[each.edge_begin + edge]] = edge_targets_[each.edge_begin + edge];
+				}
+			}
+			for (uint32_t edge = 0; edge < each.edge_count; ++edge) {
+				state& child = states_[edge_targets_[each.edge_begin + edge]];
+				child.failure = i == 0 ? 0 : next(each.failure, edge_bytes_[each.edge_begin + edge]);
+			}
+			each.output = each.pattern_count != 0 ? id : states_[each.failure].output;
+		}
+	}
+}
@@ -0,0 +1,41 @@
+#include "pch.hpp"
+
+#include <u8lib/search.hpp>
+
+#include "simd/byte_set.hpp"
+#include "simd/search.hpp"
+
+namespace u8lib::internal
+{
+	size_t utf8_find_simd(const char8_t* seq, size_t size, const char8_t* needle, size_t needle_size) noexcept {
+#if U8LIB_SIMD_SSE2
+		return simd::utf8_find(seq, size, needle, needle_size);
+#else
+		return utf8_find_scalar(seq, size, needle, needle_size);
+#endif
+	}
+
+	size_t utf8_rfind_simd(const char8_t* seq, size_t size, const char8_t* needle, size_t needle_size) noexcept {
+#if U8LIB_SIMD_SSE2
+		return simd::utf8_rfind(seq, size, needle, needle_size);
+#else
+		return utf8_rfind_scalar(seq, size, needle, needle_size);
+#endif
+	}
+
+	size_t utf8_find_byte_set_simd(const char8_t* seq, size_t size, const char8_t* set, size_t set_size, bool member) noexcept {
+#if U8LIB_SIMD_SSE42
+		return simd::utf8_find_byte_set(seq, size, set, set_size, member);
+#else
+		return utf8_find_byte_set_scalar(seq, size, set, set_size, member);
+#endif
+	}
+
+	size_t utf8_rfind_byte_set_simd(const char8_t* seq, size_t size, const char8_t* set, size_t set_size, bool member) noexcept {
+#if U8LIB_SIMD_SSE42
+		return simd::utf8_rfind_byte_set(seq, size, set, set_size, member);
+#else
+		return utf8_rfind_byte_set_scalar(seq, size, set, set_size, member);
+#endif
+	}
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "simd.hpp"
+
+#include <u8lib/search.hpp>
+
+// byte set membership by nibbles, row[low nibble] holds one bit per high nibble, the rows for high nibbles 0-7 and
+// 8-15 are separate tables picked by the top bit of the byte
+namespace u8lib::simd
+{
+#if U8LIB_SIMD_SSE42
+	struct byte_set_rows {
+		__m128i low;
+		__m128i high;
+	};
+
+	inline byte_set_rows make_byte_set_rows(const char8_t* set, size_t set_size) noexcept {
+		alignas(16) uint8_t low[16] = {};
+		alignas(16) uint8_t high[16] = {};
+		for (size_t i = 0; i < set_size; ++i) {
+			const uint8_t byte = set[i];
+			(byte & 0x80 ? high : low)[byte & 0x0F] |= static_cast<uint8_t>(1u << ((byte >> 4) & 7));
+		}
+		return {
+			_mm_load_si128(reinterpret_cast<const __m128i*>(low)),
+			_mm_load_si128(reinterpret_cast<const __m128i*>(high)),
+		};
+	}
+
+	// one bit per byte of block, set if the byte is a member
+	inline uint32_t byte_set_members(__m128i block, const byte_set_rows& rows) noexcept {
+		const __m128i nibble = _mm_set1_epi8(0x0F);
+		const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+		const __m128i low_nibbles = _mm_and_si128(block, nibble);
+		const __m128i high_nibbles = _mm_and_si128(_mm_srli_epi16(block, 4), nibble);
+		const __m128i row = _mm_blendv_epi8(_mm_shuffle_epi8(rows.low, low_nibbles), _mm_shuffle_epi8(rows.high, low_nibbles), block);
+		const __m128i bit = _mm_shuffle_epi8(bits, high_nibbles);
+		return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(row, bit), bit)));
+	}
+
+#	if U8LIB_SIMD_AVX2
+	// pshufb works per 128-bit lane, so the rows are repeated in both
+	inline uint32_t byte_set_members(__m256i block, const byte_set_rows& rows) noexcept {
+		const __m256i nibble = _mm256_set1_epi8(0x0F);
+		const __m256i bits = _mm256_broadcastsi128_si256(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128));
+		const __m256i low_rows = _mm256_broadcastsi128_si256(rows.low);
+		const __m256i high_rows = _mm256_broadcastsi128_si256(rows.high);
+		const __m256i low_nibbles = _mm256_and_si256(block, nibble);
+		const __m256i high_nibbles = _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble);
+		const __m256i row = _mm256_blendv_epi8(_mm256_shuffle_epi8(low_rows, low_nibbles), _mm256_shuffle_epi8(high_rows, low_nibbles), block);
+		const __m256i bit = _mm256_shuffle_epi8(bits, high_nibbles);
+		return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit)));
+	}
+#	endif
+
+	// 16 <= size, the last block overlaps the one before instead of a scalar tail
+	inline size_t utf8_find_byte_set(const char8_t* seq, size_t size, const char8_t* set, size_t set_size, bool member) noexcept {
+		const byte_set_rows rows = make_byte_set_rows(set, set_size);
+		const uint32_t flip = member ? 0 : 0xFFFFFFFF;
+
+		size_t i = 0;
+#	if U8LIB_SIMD_AVX2
+		for (; i + 32 <= size; i += 32) {
+			const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(seq + i));
+			if (const uint32_t found = byte_set_members(block, rows) ^ flip) {
+				return i + static_cast<size_t>(std::countr_zero(found));
+			}
+		}
+#	endif
+		for (; i + 16 <= size; i += 16) {
+			const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(seq + i));
+			if (const uint32_t found = (byte_set_members(block, rows) ^ flip) & 0xFFFF) {
+				return i + static_cast<size_t>(std::countr_zero(found));
+			}
+		}
+		if (i < size) {
+			// the bytes before i are known not to be found
+			const size_t start = size - 16;
+			const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(seq + start));
+			const uint32_t found = (byte_set_members(block, rows) ^ flip) & (0xFFFFu << (i - start) & 0xFFFF);
+			if (found) {
+				return start + static_cast<size_t>(std::countr_zero(found));
+			}
+		}
+		return internal::kSearchNpos;
+	}
+
+	// 16 <= size, blocks from the end and the first block overlapping the one after
+	inline size_t utf8_rfind_byte_set(const char8_t* seq, size_t size, const char8_t* set, size_t set_size, bool member) noexcept {
+		const byte_set_rows rows = make_byte_set_rows(set, set_size);
+		const uint32_t flip = member ? 0 : 0xFFFFFFFF;
+
+		// bytes from end on are known not to be found
+		size_t end = size;
+#	if U8LIB_SIMD_AVX2
+		for (; end >= 32; end -= 32) {
+			const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(seq + end - 32));
+			if (const uint32_t found = byte_set_members(block, rows) ^ flip) {
+				return end - 1 - static_cast<size_t>(std::countl_zero(found));
+			}
+		}
+#	endif
+		for (; end >= 16; end -= 16) {
+			const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(seq + end - 16));
+			if (const uint32_t found = (byte_set_members(block, rows) ^ flip) & 0xFFFF) {
+				return end - 16 + 31 - static_cast<size_t>(std::countl_zero(found));
+			}
+		}
+		if (end > 0) {
+			const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(seq));
+			const uint32_t found = (byte_set_members(block, rows) ^ flip) & ((1u << end) - 1);
+			if (found) {
+				return 31 - static_cast<size_t>(std::countl_zero(found));
+			}
+		}
+		return internal::kSearchNpos;
+	}
+#endif
+}
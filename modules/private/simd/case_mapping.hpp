@@ -0,0 +1,43 @@
+#pragma once
+
+#include "simd.hpp"
+
+// ascii case mapping, a letter flips bit 0x20. bytes above 0x7F are negative as signed bytes and never fall in the
+// letter range, so they are copied
+namespace u8lib::simd
+{
+	template<bool StopAtNonAscii>
+	size_t ascii_case_map_scalar(const char8_t* seq, size_t size, char8_t* dst, char8_t first) noexcept {
+		size_t i = 0;
+		for (; i < size; ++i) {
+			const char8_t ch = seq[i];
+			if (StopAtNonAscii && !is_ascii(ch)) {
+				break;
+			}
+			dst[i] = static_cast<uint8_t>(ch - first) < 26 ? static_cast<char8_t>(ch ^ 0x20) : ch;
+		}
+		return i;
+	}
+
+	// first: 'A' to lower case, 'a' to upper case. StopAtNonAscii: return at the first byte above 0x7F, its block is
+	// stored all the same, so dst must have room for size code units either way
+	// return: code units converted
+	template<typename V, bool StopAtNonAscii>
+	size_t ascii_case_map(const char8_t* seq, size_t size, char8_t* dst, char8_t first) noexcept {
+		const V below = V::splat(static_cast<uint8_t>(first - 1));
+		const V above = V::splat(static_cast<uint8_t>(first + 26));
+		const V flip = V::splat(0x20);
+		size_t i = 0;
+		for (; i + V::size <= size; i += V::size) {
+			const V block = V::load(seq + i);
+			const V letters = block.signed_gt(below) & above.signed_gt(block);
+			(block ^ (letters & flip)).store(dst + i);
+			if constexpr (StopAtNonAscii) {
+				if (const uint32_t non_ascii = block.movemask()) {
+					return i + static_cast<size_t>(std::countr_zero(non_ascii));
+				}
+			}
+		}
+		return i + ascii_case_map_scalar<StopAtNonAscii>(seq + i, size - i, dst + i, first);
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "simd.hpp"
+
+// every ascii code unit is a grapheme cluster of its own but CR LF, so an ascii run holds as many clusters as code
+// units less its CR LF pairs
+namespace u8lib::simd
+{
+	inline size_t count_crlf_scalar(const char8_t* seq, size_t size) noexcept {
+		size_t result = 0;
+		for (size_t i = 1; i < size; ++i) {
+			result += seq[i - 1] == u8'\r' && seq[i] == u8'\n';
+		}
+		return result;
+	}
+
+	template<typename V>
+	size_t count_crlf(const char8_t* seq, size_t size) noexcept {
+		const V cr = V::splat(u8'\r');
+		const V lf = V::splat(u8'\n');
+		size_t result = 0;
+		// CR in the last lane of the previous block
+		uint32_t carry = 0;
+		size_t i = 0;
+		for (; i + V::size <= size; i += V::size) {
+			const V block = V::load(seq + i);
+			const uint32_t cr_mask = (block == cr).movemask();
+			const uint32_t lf_mask = (block == lf).movemask();
+			result += static_cast<size_t>(std::popcount(cr_mask & lf_mask >> 1)) + (carry & lf_mask);
+			carry = cr_mask >> (V::size - 1);
+		}
+		// the scalar tail starts one code unit early to see a pair across the last block
+		return result + (i ? count_crlf_scalar(seq + i - 1, size - i + 1) : count_crlf_scalar(seq, size));
+	}
+}
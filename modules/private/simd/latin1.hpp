@@ -0,0 +1,140 @@
+#pragma once
+
+#include "simd.hpp"
+
+#include <u8lib/transcode.hpp>
+
+#include <array>
+
+// latin-1/windows-1252 <=> utf-8, bytes above 0x7F are widened to their 2-byte form in 16-bit lanes, then a
+// shuffle picked by the high-bit mask of 8 input bytes drops the unused byte of every ascii lane.
+// windows-1252 blocks holding a byte of 0x80-0x9F go through the scalar table lookup.
+namespace u8lib::simd
+{
+	// bytes 0x80-0x9F, the only ones windows-1252 maps differently from latin-1
+	template<typename V>
+	bool has_c1(V block) {
+		return ((block & V::splat(0xE0)) == V::splat(0x80)).any();
+	}
+
+	template<typename V>
+	size_t latin1_to_utf8_size(const char* seq, size_t size) noexcept {
+		size_t result = 0;
+		size_t i = 0;
+		for (; i + V::size <= size; i += V::size) {
+			result += V::size + std::popcount(V::load(seq + i).movemask());
+		}
+		return result + internal::latin1_to_utf8_size_scalar(seq + i, size - i);
+	}
+
+	template<typename V>
+	size_t cp1252_to_utf8_size(const char* seq, size_t size) noexcept {
+		size_t result = 0;
+		size_t i = 0;
+		for (; i + V::size <= size; i += V::size) {
+			const V block = V::load(seq + i);
+			result += has_c1(block) ? internal::cp1252_to_utf8_size_scalar(seq + i, V::size) : V::size + std::popcount(block.movemask());
+		}
+		return result + internal::cp1252_to_utf8_size_scalar(seq + i, size - i);
+	}
+
+	template<typename V>
+	size_t utf8_to_latin1(const char8_t* seq, size_t size, char* dst, char replacement) noexcept {
+		size_t i = 0;
+		size_t written = 0;
+		// only an ascii block is stored whole, it is V::size code units of output for sure. dst may hold no more than
+		// utf8_to_utf32_size(seq, size) code units, so a block with multibyte sequences only copies its ascii prefix
+		while (i + V::size <= size) {
+			const V block = V::load(seq + i);
+			const uint32_t non_ascii = block.movemask();
+			if (!non_ascii) {
+				block.store(dst + written);
+				i += V::size;
+				written += V::size;
+				continue;
+			}
+
+			const auto prefix = static_cast<size_t>(std::countr_zero(non_ascii));
+			std::memcpy(dst + written, seq + i, prefix);
+			i += prefix;
+			written += prefix;
+			// decode until the next ascii byte, then retry the vector path
+			while (i < size && !is_ascii(seq[i])) {
+				char32_t ch;
+				const auto [next, is_usv] = decode_utf(seq + i, seq + size, ch);
+				dst[written++] = is_usv && ch <= 0xFF ? static_cast<char>(ch) : replacement;
+				i = static_cast<size_t>(next - seq);
+			}
+		}
+		return written + internal::utf8_to_latin1_scalar(seq + i, size - i, dst + written, replacement);
+	}
+
+#if U8LIB_SIMD_SSE42
+	struct latin1_expand_entry {
+		alignas(16) uint8_t shuffle[16];
+		uint8_t size;
+	};
+
+	// index: high-bit mask of 8 input bytes, lane i holds the lead byte at 2i and the trailing byte at 2i + 1
+	inline constexpr auto latin1_expand_table = [] {
+		std::array<latin1_expand_entry, 256> table{};
+		for (uint32_t index = 0; index < 256; ++index) {
+			auto& entry = table[index];
+			uint8_t pos = 0;
+			for (uint8_t lane = 0; lane < 8; ++lane) {
+				entry.shuffle[pos++] = lane * 2;
+				if (index >> lane & 1) {
+					entry.shuffle[pos++] = lane * 2 + 1;
+				}
+			}
+			entry.size = pos;
+			for (; pos < 16; ++pos) {
+				entry.shuffle[pos] = 0x80;
+			}
+		}
+		return table;
+	}();
+
+	// expand the low 8 bytes of block, mask holds their high bits, always stores 16 bytes
+	inline size_t latin1_expand_8(__m128i block, uint32_t mask, char8_t* dst) {
+		const __m128i ch = _mm_cvtepu8_epi16(block);
+		const __m128i lead = _mm_or_si128(_mm_srli_epi16(ch, 6), _mm_set1_epi16(0xC0));
+		const __m128i trail = _mm_slli_epi16(_mm_or_si128(_mm_and_si128(ch, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80)), 8);
+		const __m128i units = _mm_blendv_epi8(_mm_or_si128(lead, trail), ch, _mm_cmplt_epi16(ch, _mm_set1_epi16(0x80)));
+
+		const auto& entry = latin1_expand_table[mask];
+		const __m128i shuffle = _mm_load_si128(reinterpret_cast<const __m128i*>(entry.shuffle));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_shuffle_epi8(units, shuffle));
+		return entry.size;
+	}
+
+	// with_c1: whether bytes 0x80-0x9F are windows-1252 and need the table
+	template<bool with_c1>
+	size_t latin1_to_utf8(const char* seq, size_t size, char8_t* dst) noexcept {
+		char8_t* const dst_begin = dst;
+		size_t i = 0;
+		// every byte yields at least one code unit, so keeping 8 bytes ahead makes room for the 16-byte stores
+		for (; i + 16 + 8 <= size; i += 16) {
+			const u8x16 block = u8x16::load(seq + i);
+			const uint32_t mask = block.movemask();
+			if (!mask) {
+				block.store(dst);
+				dst += 16;
+				continue;
+			}
+			if (with_c1 && has_c1(block)) {
+				dst += internal::cp1252_to_utf8_scalar(seq + i, 16, dst);
+				continue;
+			}
+			dst += latin1_expand_8(block.value, mask & 0xFF, dst);
+			dst += latin1_expand_8(_mm_unpackhi_epi64(block.value, block.value), mask >> 8, dst);
+		}
+		if constexpr (with_c1) {
+			dst += internal::cp1252_to_utf8_scalar(seq + i, size - i, dst);
+		} else {
+			dst += internal::latin1_to_utf8_scalar(seq + i, size - i, dst);
+		}
+		return static_cast<size_t>(dst - dst_begin);
+	}
+#endif
+}
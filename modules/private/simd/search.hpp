@@ -0,0 +1,109 @@
+#pragma once
+
+#include "simd.hpp"
+
+#include <u8lib/search.hpp>
+
+// substring search, a candidate must match the first and the last byte of the needle, both are compared for a whole
+// block at once and only the candidates left are compared in full
+namespace u8lib::simd
+{
+#if U8LIB_SIMD_SSE2
+	// 2 <= needle_size <= size
+	inline size_t utf8_find(const char8_t* seq, size_t size, const char8_t* needle, size_t needle_size) noexcept {
+		const size_t last = needle_size - 1;
+		// the ends are known to match
+		auto matches = [&](size_t index) {
+			return std::memcmp(seq + index + 1, needle + 1, needle_size - 2) == 0;
+		};
+
+		size_t i = 0;
+#	if U8LIB_SIMD_AVX2
+		const __m256i first_32 = _mm256_set1_epi8(static_cast<char>(needle[0]));
+		const __m256i last_32 = _mm256_set1_epi8(static_cast<char>(needle[last]));
+		for (; i + last + 32 <= size; i += 32) {
+			const __m256i heads = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(seq + i));
+			const __m256i tails = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(seq + i + last));
+			const __m256i candidates = _mm256_and_si256(_mm256_cmpeq_epi8(first_32, heads), _mm256_cmpeq_epi8(last_32, tails));
+			for (auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(candidates)); mask; mask &= mask - 1) {
+				const size_t index = i + static_cast<size_t>(std::countr_zero(mask));
+				if (matches(index)) {
+					return index;
+				}
+			}
+		}
+#	endif
+		const __m128i first_16 = _mm_set1_epi8(static_cast<char>(needle[0]));
+		const __m128i last_16 = _mm_set1_epi8(static_cast<char>(needle[last]));
+		for (; i + last + 16 <= size; i += 16) {
+			const __m128i heads = _mm_loadu_si128(reinterpret_cast<const __m128i*>(seq + i));
+			const __m128i tails = _mm_loadu_si128(reinterpret_cast<const __m128i*>(seq + i + last));
+			const __m128i candidates = _mm_and_si128(_mm_cmpeq_epi8(first_16, heads), _mm_cmpeq_epi8(last_16, tails));
+			for (auto mask = static_cast<uint32_t>(_mm_movemask_epi8(candidates)); mask; mask &= mask - 1) {
+				const size_t index = i + static_cast<size_t>(std::countr_zero(mask));
+				if (matches(index)) {
+					return index;
+				}
+			}
+		}
+
+		// fewer than 16 candidates left
+		for (; i + last < size; ++i) {
+			if (seq[i] == needle[0] && seq[i + last] == needle[last] && matches(i)) {
+				return i;
+			}
+		}
+		return internal::kSearchNpos;
+	}
+
+	// 2 <= needle_size <= size, the same filter walking blocks from the end, the highest candidate first
+	inline size_t utf8_rfind(const char8_t* seq, size_t size, const char8_t* needle, size_t needle_size) noexcept {
+		const size_t last = needle_size - 1;
+		auto matches = [&](size_t index) {
+			return std::memcmp(seq + index + 1, needle + 1, needle_size - 2) == 0;
+		};
+
+		// candidates left are below end
+		size_t end = size - last;
+#	if U8LIB_SIMD_AVX2
+		const __m256i first_32 = _mm256_set1_epi8(static_cast<char>(needle[0]));
+		const __m256i last_32 = _mm256_set1_epi8(static_cast<char>(needle[last]));
+		for (; end >= 32; end -= 32) {
+			const __m256i heads = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(seq + end - 32));
+			const __m256i tails = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(seq + end - 32 + last));
+			const __m256i candidates = _mm256_and_si256(_mm256_cmpeq_epi8(first_32, heads), _mm256_cmpeq_epi8(last_32, tails));
+			for (auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(candidates)); mask;) {
+				const int bit = 31 - std::countl_zero(mask);
+				if (matches(end - 32 + static_cast<size_t>(bit))) {
+					return end - 32 + static_cast<size_t>(bit);
+				}
+				mask ^= 1u << bit;
+			}
+		}
+#	endif
+		const __m128i first_16 = _mm_set1_epi8(static_cast<char>(needle[0]));
+		const __m128i last_16 = _mm_set1_epi8(static_cast<char>(needle[last]));
+		for (; end >= 16; end -= 16) {
+			const __m128i heads = _mm_loadu_si128(reinterpret_cast<const __m128i*>(seq + end - 16));
+			const __m128i tails = _mm_loadu_si128(reinterpret_cast<const __m128i*>(seq + end - 16 + last));
+			const __m128i candidates = _mm_and_si128(_mm_cmpeq_epi8(first_16, heads), _mm_cmpeq_epi8(last_16, tails));
+			for (auto mask = static_cast<uint32_t>(_mm_movemask_epi8(candidates)); mask;) {
+				const int bit = 31 - std::countl_zero(mask);
+				if (matches(end - 16 + static_cast<size_t>(bit))) {
+					return end - 16 + static_cast<size_t>(bit);
+				}
+				mask ^= 1u << bit;
+			}
+		}
+
+		// fewer than 16 candidates left
+		for (; end > 0; --end) {
+			const size_t i = end - 1;
+			if (seq[i] == needle[0] && seq[i + last] == needle[last] && matches(i)) {
+				return i;
+			}
+		}
+		return internal::kSearchNpos;
+	}
+#endif
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+// Kernels are selected at compile time from the target instruction set, so build with
+// -mavx2 / -msse4.2 (or /arch:AVX2 for msvc) to enable the wider paths.
+#if defined(__AVX2__)
+#	define U8LIB_SIMD_AVX2 1
+#else
+#	define U8LIB_SIMD_AVX2 0
+#endif
+
+// msvc doesn't define __SSE4_2__, /arch:AVX and above imply it
+#if defined(__SSE4_2__) || defined(__AVX__)
+#	define U8LIB_SIMD_SSE42 1
+#else
+#	define U8LIB_SIMD_SSE42 0
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define U8LIB_SIMD_SSE2 1
+#else
+#	define U8LIB_SIMD_SSE2 0
+#endif
+
+#if U8LIB_SIMD_SSE2
+#	include <immintrin.h>
+#endif
+
+namespace u8lib::simd
+{
+	constexpr bool is_ascii(char8_t ch) {
+		return ch < 0x80;
+	}
+
+	constexpr bool is_continuation(char8_t ch) {
+		return (ch & 0xC0) == 0x80;
+	}
+
+#if U8LIB_SIMD_SSE42
+	struct u8x16 {
+		static constexpr size_t size = 16;
+
+		__m128i value;
+
+		static u8x16 load(const void* ptr) { return {_mm_loadu_si128(static_cast<const __m128i*>(ptr))}; }
+		static u8x16 zero() { return {_mm_setzero_si128()}; }
+		static u8x16 splat(uint8_t v) { return {_mm_set1_epi8(static_cast<char>(v))}; }
+
+		// build a 16-entry table for lookup_16
+		static u8x16 repeat_16(
+			uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7,
+			uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15
+		) {
+			return {_mm_setr_epi8(v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15)};
+		}
+
+		void store(void* ptr) const { _mm_storeu_si128(static_cast<__m128i*>(ptr), value); }
+
+		u8x16 operator|(u8x16 rhs) const { return {_mm_or_si128(value, rhs.value)}; }
+		u8x16 operator&(u8x16 rhs) const { return {_mm_and_si128(value, rhs.value)}; }
+		u8x16 operator^(u8x16 rhs) const { return {_mm_xor_si128(value, rhs.value)}; }
+		u8x16& operator|=(u8x16 rhs) { return *this = *this | rhs; }
+
+		u8x16 operator==(u8x16 rhs) const { return {_mm_cmpeq_epi8(value, rhs.value)}; }
+		u8x16 saturating_sub(u8x16 rhs) const { return {_mm_subs_epu8(value, rhs.value)}; }
+		u8x16 max(u8x16 rhs) const { return {_mm_max_epu8(value, rhs.value)}; }
+		u8x16 min(u8x16 rhs) const { return {_mm_min_epu8(value, rhs.value)}; }
+		// 0xFF for each signed byte greater than rhs
+		u8x16 signed_gt(u8x16 rhs) const { return {_mm_cmpgt_epi8(value, rhs.value)}; }
+
+		u8x16 shr4() const { return {_mm_and_si128(_mm_srli_epi16(value, 4), _mm_set1_epi8(0x0F))}; }
+		u8x16 lookup_16(u8x16 table) const { return {_mm_shuffle_epi8(table.value, value)}; }
+
+		// bytes shifted in from the tail of the previous block: result[i] = concat(prev, this)[16 + i - N]
+		template<int N>
+		u8x16 prev(u8x16 prev_block) const { return {_mm_alignr_epi8(value, prev_block.value, 16 - N)}; }
+
+		uint32_t movemask() const { return static_cast<uint32_t>(_mm_movemask_epi8(value)); }
+		bool any() const { return !_mm_testz_si128(value, value); }
+		bool is_ascii() const { return movemask() == 0; }
+	};
+#endif
+
+#if U8LIB_SIMD_AVX2
+	struct u8x32 {
+		static constexpr size_t size = 32;
+
+		__m256i value;
+
+		static u8x32 load(const void* ptr) { return {_mm256_loadu_si256(static_cast<const __m256i*>(ptr))}; }
+		static u8x32 zero() { return {_mm256_setzero_si256()}; }
+		static u8x32 splat(uint8_t v) { return {_mm256_set1_epi8(static_cast<char>(v))}; }
+
+		static u8x32 repeat_16(
+			uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7,
+			uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15
+		) {
+			return {_mm256_setr_epi8(
+				v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+				v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15
+			)};
+		}
+
+		void store(void* ptr) const { _mm256_storeu_si256(static_cast<__m256i*>(ptr), value); }
+
+		u8x32 operator|(u8x32 rhs) const { return {_mm256_or_si256(value, rhs.value)}; }
+		u8x32 operator&(u8x32 rhs) const { return {_mm256_and_si256(value, rhs.value)}; }
+		u8x32 operator^(u8x32 rhs) const { return {_mm256_xor_si256(value, rhs.value)}; }
+		u8x32& operator|=(u8x32 rhs) { return *this = *this | rhs; }
+
+		u8x32 operator==(u8x32 rhs) const { return {_mm256_cmpeq_epi8(value, rhs.value)}; }
+		u8x32 saturating_sub(u8x32 rhs) const { return {_mm256_subs_epu8(value, rhs.value)}; }
+		u8x32 max(u8x32 rhs) const { return {_mm256_max_epu8(value, rhs.value)}; }
+		u8x32 min(u8x32 rhs) const { return {_mm256_min_epu8(value, rhs.value)}; }
+		u8x32 signed_gt(u8x32 rhs) const { return {_mm256_cmpgt_epi8(value, rhs.value)}; }
+
+		u8x32 shr4() const { return {_mm256_and_si256(_mm256_srli_epi16(value, 4), _mm256_set1_epi8(0x0F))}; }
+		// vpshufb works per 128-bit lane, so the table is repeated in both lanes by repeat_16
+		u8x32 lookup_16(u8x32 table) const { return {_mm256_shuffle_epi8(table.value, value)}; }
+
+		template<int N>
+		u8x32 prev(u8x32 prev_block) const {
+			return {_mm256_alignr_epi8(value, _mm256_permute2x128_si256(prev_block.value, value, 0x21), 16 - N)};
+		}
+
+		uint32_t movemask() const { return static_cast<uint32_t>(_mm256_movemask_epi8(value)); }
+		bool any() const { return !_mm256_testz_si256(value, value); }
+		bool is_ascii() const { return movemask() == 0; }
+	};
+#endif
+
+#if U8LIB_SIMD_AVX2
+	using native_u8 = u8x32;
+#	define U8LIB_SIMD_NATIVE 1
+#elif U8LIB_SIMD_SSE42
+	using native_u8 = u8x16;
+#	define U8LIB_SIMD_NATIVE 1
+#else
+#	define U8LIB_SIMD_NATIVE 0
+#endif
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "utf8_encode.hpp"
+#include "utf16_validate.hpp"
+
+#include <u8lib/transcode.hpp>
+
+// utf-16 => utf-8, blocks without surrogates are measured/encoded in vector registers, blocks with
+// surrogates are measured from their surrogate masks and encoded through utf16_decode, so pairing rules stay identical
+// to the scalar path
+namespace u8lib::simd
+{
+#if U8LIB_SIMD_SSE42
+	// consume code points from index until end is reached, a pair may run one unit past end
+	inline size_t utf16_to_utf8_size_step(const char16_t* seq, size_t size, size_t index, size_t end, size_t& result) noexcept {
+		while (index < end) {
+			char32_t ch;
+			index = utf16_decode(seq, size, index, ch);
+			result += utf8_seq_len(ch);
+		}
+		return index;
+	}
+
+	inline size_t utf16_to_utf8_step(const char16_t* seq, size_t size, size_t index, size_t end, char8_t*& dst) noexcept {
+		while (index < end) {
+			char32_t ch;
+			index = utf16_decode(seq, size, index, ch);
+			dst += utf8_encode(ch, dst);
+		}
+		return index;
+	}
+
+	inline size_t utf16_to_utf8_size(const char16_t* seq, size_t size) noexcept {
+		size_t result = 0;
+		size_t i = 0;
+#	if U8LIB_SIMD_AVX2
+		for (; i + 16 <= size;) {
+			const __m256i units = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(seq + i));
+			const __m256i high_bits = _mm256_and_si256(units, _mm256_set1_epi16(static_cast<short>(0xF800)));
+			size_t pairs = 0;
+			if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(high_bits, _mm256_set1_epi16(static_cast<short>(0xD800))))) {
+				const auto [leading, trailing] = utf16_surrogates(units);
+				if (leading >> 15) {
+					// the pair may end in the next block
+					i = utf16_to_utf8_size_step(seq, size, i, i + 16, result);
+					continue;
+				}
+				pairs = static_cast<size_t>(std::popcount(trailing & leading << 1));
+			}
+			// two mask bits per unit, a surrogate counts as 3 bytes like the U+FFFD of a lone one, a pair takes 4
+			const uint32_t one_byte = _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(units, _mm256_set1_epi16(static_cast<short>(0xFF80))), _mm256_setzero_si256()));
+			const uint32_t two_bytes = _mm256_movemask_epi8(_mm256_cmpeq_epi16(high_bits, _mm256_setzero_si256()));
+			result += 16 + (std::popcount(~one_byte) + std::popcount(~two_bytes)) / 2 - 2 * pairs;
+			i += 16;
+		}
+#	endif
+		for (; i + 8 <= size;) {
+			const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(seq + i));
+			const __m128i high_bits = _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xF800)));
+			size_t pairs = 0;
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(high_bits, _mm_set1_epi16(static_cast<short>(0xD800))))) {
+				const auto [leading, trailing] = utf16_surrogates(units);
+				if (leading >> 7) {
+					i = utf16_to_utf8_size_step(seq, size, i, i + 8, result);
+					continue;
+				}
+				pairs = static_cast<size_t>(std::popcount(trailing & leading << 1));
+			}
+			const uint32_t one_byte = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xFF80))), _mm_setzero_si128()));
+			const uint32_t two_bytes = _mm_movemask_epi8(_mm_cmpeq_epi16(high_bits, _mm_setzero_si128()));
+			result += 8 + (std::popcount(~one_byte & 0xFFFF) + std::popcount(~two_bytes & 0xFFFF)) / 2 - 2 * pairs;
+			i += 8;
+		}
+		utf16_to_utf8_size_step(seq, size, i, size, result);
+		return result;
+	}
+
+	inline size_t utf16_to_utf8(const char16_t* seq, size_t size, char8_t* dst) noexcept {
+		char8_t* const dst_begin = dst;
+		size_t i = 0;
+		// every unit yields at least one code unit, so keeping 16 units ahead makes room for the 16-byte stores
+		for (; i + 8 + 16 <= size;) {
+#	if U8LIB_SIMD_AVX2
+			const __m256i wide_units = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(seq + i));
+			if (_mm256_testz_si256(wide_units, _mm256_set1_epi16(static_cast<short>(0xFF80)))) {
+				const __m128i packed = _mm_packus_epi16(_mm256_castsi256_si128(wide_units), _mm256_extracti128_si256(wide_units, 1));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), packed);
+				dst += 16;
+				i += 16;
+				continue;
+			}
+#	endif
+			const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(seq + i));
+			if (_mm_testz_si128(units, _mm_set1_epi16(static_cast<short>(0xFF80)))) {
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(units, units));
+				dst += 8;
+				i += 8;
+				continue;
+			}
+			const __m128i high_bits = _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xF800)));
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(high_bits, _mm_set1_epi16(static_cast<short>(0xD800))))) {
+				i = utf16_to_utf8_step(seq, size, i, i + 8, dst);
+				continue;
+			}
+			dst += utf8_encode_4(_mm_cvtepu16_epi32(units), dst);
+			dst += utf8_encode_4(_mm_cvtepu16_epi32(_mm_srli_si128(units, 8)), dst);
+			i += 8;
+		}
+		utf16_to_utf8_step(seq, size, i, size, dst);
+		return static_cast<size_t>(dst - dst_begin);
+	}
+#endif
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "simd.hpp"
+
+#include <u8lib/transcode.hpp>
+
+// utf-16 surrogate pairing, a block is well-formed if its trailing surrogates are exactly the units after its leading
+// ones. a leading surrogate in the last lane is carried to the first lane of the next block
+namespace u8lib::simd
+{
+#if U8LIB_SIMD_SSE42
+	// one bit per unit
+	struct surrogate_masks {
+		uint32_t leading;
+		uint32_t trailing;
+	};
+
+	inline surrogate_masks utf16_surrogates(__m128i units) noexcept {
+		const __m128i high_bits = _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xFC00)));
+		const __m128i leading = _mm_cmpeq_epi16(high_bits, _mm_set1_epi16(static_cast<short>(0xD800)));
+		const __m128i trailing = _mm_cmpeq_epi16(high_bits, _mm_set1_epi16(static_cast<short>(0xDC00)));
+		// one byte per unit, leading surrogates in the low half
+		const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(leading, trailing)));
+		return {mask & 0xFF, mask >> 8};
+	}
+
+#	if U8LIB_SIMD_AVX2
+	inline surrogate_masks utf16_surrogates(__m256i units) noexcept {
+		const __m256i high_bits = _mm256_and_si256(units, _mm256_set1_epi16(static_cast<short>(0xFC00)));
+		const __m256i leading = _mm256_cmpeq_epi16(high_bits, _mm256_set1_epi16(static_cast<short>(0xD800)));
+		const __m256i trailing = _mm256_cmpeq_epi16(high_bits, _mm256_set1_epi16(static_cast<short>(0xDC00)));
+		// packs works per 128-bit lane, the qword shuffle puts the leading bytes in the low half
+		const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(leading, trailing), 0xD8);
+		const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(packed));
+		return {mask & 0xFFFF, mask >> 16};
+	}
+#	endif
+
+	inline size_t utf16_validate(const char16_t* seq, size_t size) noexcept {
+		size_t i = 0;
+		// the unit before i is a leading surrogate
+		uint32_t carry = 0;
+#	if U8LIB_SIMD_AVX2
+		for (; i + 16 <= size; i += 16) {
+			const auto [leading, trailing] = utf16_surrogates(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(seq + i)));
+			if (trailing != ((leading << 1 | carry) & 0xFFFF)) {
+				break; // the 8-unit blocks below stop at the same unit
+			}
+			carry = leading >> 15;
+		}
+#	endif
+		for (; i + 8 <= size; i += 8) {
+			const auto [leading, trailing] = utf16_surrogates(_mm_loadu_si128(reinterpret_cast<const __m128i*>(seq + i)));
+			if (trailing != ((leading << 1 | carry) & 0xFF)) {
+				break;
+			}
+			carry = leading >> 7;
+		}
+		// the rest, or the ill-formed block, is checked from the start of the pair split by the block edge
+		const size_t start = i - carry;
+		return start + internal::utf16_validate_scalar(seq + start, size - start);
+	}
+#endif
+}
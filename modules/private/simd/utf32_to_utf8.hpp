@@ -0,0 +1,62 @@
+#pragma once
+
+#include "utf8_encode.hpp"
+
+#include <u8lib/transcode.hpp>
+
+// utf-32 => utf-8, lanes are classified by output length in vector registers, surrogates and values
+// above U+10FFFF are blended to U+FFFD before measuring/encoding
+namespace u8lib::simd
+{
+#if U8LIB_SIMD_SSE42
+	inline __m128i utf32_replace_invalid(__m128i ch) {
+		const __m128i too_large = _mm_xor_si128(
+			_mm_cmpeq_epi32(_mm_max_epu32(ch, _mm_set1_epi32(0x10FFFF)), _mm_set1_epi32(0x10FFFF)),
+			_mm_set1_epi32(-1)
+		);
+		const __m128i surrogate = _mm_cmpeq_epi32(
+			_mm_and_si128(ch, _mm_set1_epi32(static_cast<int>(0xFFFFF800))),
+			_mm_set1_epi32(0xD800)
+		);
+		return _mm_blendv_epi8(ch, _mm_set1_epi32(0xFFFD), _mm_or_si128(too_large, surrogate));
+	}
+
+	// ch must hold scalar values
+	inline size_t utf32_utf8_size_4(__m128i ch) {
+		const int ge_2 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(ch, _mm_set1_epi32(0x7F))));
+		const int ge_3 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(ch, _mm_set1_epi32(0x7FF))));
+		const int ge_4 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(ch, _mm_set1_epi32(0xFFFF))));
+		return 4 + std::popcount(static_cast<uint32_t>(ge_2)) + std::popcount(static_cast<uint32_t>(ge_3)) + std::popcount(static_cast<uint32_t>(ge_4));
+	}
+
+	inline size_t utf32_to_utf8_size(const char32_t* seq, size_t size) noexcept {
+		size_t result = 0;
+		size_t i = 0;
+		for (; i + 4 <= size; i += 4) {
+			const __m128i ch = _mm_loadu_si128(reinterpret_cast<const __m128i*>(seq + i));
+			result += utf32_utf8_size_4(utf32_replace_invalid(ch));
+		}
+		return result + internal::utf32_to_utf8_size_scalar(seq + i, size - i);
+	}
+
+	inline size_t utf32_to_utf8(const char32_t* seq, size_t size, char8_t* dst) noexcept {
+		char8_t* const dst_begin = dst;
+		size_t i = 0;
+		// every code point yields at least one code unit, so keeping 16 code points ahead makes room for the 16-byte stores
+		for (; i + 8 + 16 <= size; i += 8) {
+			const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(seq + i));
+			const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(seq + i + 4));
+			if (_mm_testz_si128(_mm_or_si128(low, high), _mm_set1_epi32(~0x7F))) {
+				const __m128i words = _mm_packus_epi32(low, high);
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(words, words));
+				dst += 8;
+				continue;
+			}
+			dst += utf8_encode_4(utf32_replace_invalid(low), dst);
+			dst += utf8_encode_4(utf32_replace_invalid(high), dst);
+		}
+		dst += internal::utf32_to_utf8_scalar(seq + i, size - i, dst);
+		return static_cast<size_t>(dst - dst_begin);
+	}
+#endif
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "utf8_validate.hpp"
+
+#include <algorithm>
+
+// utf-8 => utf-16/utf-32, well-formed runs found by the validator are measured with byte class
+// popcounts, ascii runs are widened in vector registers, everything else goes through decode_utf
+namespace u8lib::simd
+{
+#if U8LIB_SIMD_NATIVE
+	// seq must be well-formed, return: code points in seq
+	template<typename V>
+	size_t utf8_count_code_points(const char8_t* seq, size_t size) noexcept {
+		size_t result = 0;
+		size_t i = 0;
+		for (; i + V::size <= size; i += V::size) {
+			// every byte except 10xxxxxx starts a code point
+			const V input = V::load(seq + i);
+			result += std::popcount(input.signed_gt(V::splat(0xBF)).movemask());
+		}
+		for (; i < size; ++i) {
+			result += !is_continuation(seq[i]);
+		}
+		return result;
+	}
+
+	// seq must be well-formed, return: utf-16 code units for seq
+	template<typename V>
+	size_t utf8_count_utf16(const char8_t* seq, size_t size) noexcept {
+		size_t result = 0;
+		size_t i = 0;
+		for (; i + V::size <= size; i += V::size) {
+			// 4-byte sequences need a surrogate pair
+			const V input = V::load(seq + i);
+			result += std::popcount(input.signed_gt(V::splat(0xBF)).movemask());
+			result += std::popcount((input.max(V::splat(0xF0)) == input).movemask());
+		}
+		for (; i < size; ++i) {
+			result += !is_continuation(seq[i]) + (seq[i] >= 0xF0);
+		}
+		return result;
+	}
+
+	// counted runs are split at every ill-formed subpart, which takes one U+FFFD
+	template<typename V, typename Count>
+	size_t utf8_count_with_replacement(const char8_t* seq, size_t size, Count&& count) noexcept {
+		size_t result = 0;
+		const char8_t* first = seq;
+		const char8_t* const last = seq + size;
+		while (first != last) {
+			const size_t valid_size = utf8_validate<V>(first, static_cast<size_t>(last - first));
+			result += count(first, valid_size);
+			first += valid_size;
+			if (first != last) {
+				char32_t ch;
+				first = decode_utf(first, last, ch).next_ptr_;
+				++result;
+			}
+		}
+		return result;
+	}
+
+	template<typename V>
+	size_t utf8_to_utf16_size(const char8_t* seq, size_t size) noexcept {
+		return utf8_count_with_replacement<V>(seq, size, utf8_count_utf16<V>);
+	}
+
+	template<typename V>
+	size_t utf8_to_utf32_size(const char8_t* seq, size_t size) noexcept {
+		return utf8_count_with_replacement<V>(seq, size, utf8_count_code_points<V>);
+	}
+
+	// utf8_walk_scalar over well-formed runs: every sequence head is one step, so steps are counted 64 bytes at
+	// a time with popcount and only the block holding the last step is walked by hand
+	template<typename V>
+	size_t utf8_walk(const char8_t* seq, size_t size, size_t end, size_t max_count, size_t& index) noexcept {
+		// bounds the validation done ahead of end / max_count
+		constexpr size_t kChunkSize = 4096;
+		constexpr size_t kBlockSize = 64;
+
+		size_t count = 0;
+		while (index < end && count < max_count) {
+			// sequences starting before end finish before end + 3, and max_count code points take at most 4x bytes
+			size_t chunk = std::min({size - index, end - index + 3, kChunkSize});
+			if (max_count - count < kChunkSize / 4) {
+				chunk = std::min(chunk, (max_count - count) * 4);
+			}
+			const size_t valid_end = index + utf8_validate<V>(seq + index, chunk);
+			if (valid_end == index) {
+				// ill-formed at index, take one step like the cursor does
+				count += internal::utf8_walk_scalar(seq, size, end, 1, index);
+				continue;
+			}
+
+			const size_t count_end = std::min(valid_end, end);
+			size_t i = index;
+			for (; i + kBlockSize <= count_end; i += kBlockSize) {
+				uint64_t heads = 0;
+				for (size_t k = 0; k < kBlockSize; k += V::size) {
+					// every byte except 10xxxxxx starts a code point
+					const V input = V::load(seq + i + k);
+					heads |= static_cast<uint64_t>(input.signed_gt(V::splat(0xBF)).movemask()) << k;
+				}
+				const size_t block_count = static_cast<size_t>(std::popcount(heads));
+				if (block_count >= max_count - count) {
+					break;
+				}
+				count += block_count;
+			}
+
+			// the last sequence counted may run past i, skip its tail to get back to a head
+			while (i < valid_end && is_continuation(seq[i])) {
+				++i;
+			}
+			index = i;
+			count += internal::utf8_walk_scalar(seq, size, count_end, max_count - count, index);
+		}
+		return count;
+	}
+
+	inline size_t utf8_to_utf16(const char8_t* seq, size_t size, char16_t* dst) noexcept {
+		char16_t* const dst_begin = dst;
+		const char8_t* first = seq;
+		const char8_t* const last = seq + size;
+		while (first != last) {
+			// dst holds one code unit for each ascii byte, so an ascii block can be stored whole
+			if (last - first >= 16) {
+				const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+				const uint32_t non_ascii = _mm_movemask_epi8(input);
+				if (!non_ascii) {
+#	if U8LIB_SIMD_AVX2
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_cvtepu8_epi16(input));
+#	else
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_cvtepu8_epi16(input));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), _mm_cvtepu8_epi16(_mm_srli_si128(input, 8)));
+#	endif
+					first += 16;
+					dst += 16;
+					continue;
+				}
+				for (int i = std::countr_zero(non_ascii); i > 0; --i) {
+					*dst++ = *first++;
+				}
+			}
+
+			// decode until the next ascii byte, then retry the vector path
+			do {
+				char32_t ch;
+				first = decode_utf(first, last, ch).next_ptr_;
+				dst += utf16_encode(ch, dst);
+			} while (first != last && !is_ascii(*first));
+		}
+		return static_cast<size_t>(dst - dst_begin);
+	}
+
+	inline size_t utf8_to_utf32(const char8_t* seq, size_t size, char32_t* dst) noexcept {
+		char32_t* const dst_begin = dst;
+		const char8_t* first = seq;
+		const char8_t* const last = seq + size;
+		while (first != last) {
+			if (last - first >= 16) {
+				const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+				const uint32_t non_ascii = _mm_movemask_epi8(input);
+				if (!non_ascii) {
+#	if U8LIB_SIMD_AVX2
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_cvtepu8_epi32(input));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(input, 8)));
+#	else
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_cvtepu8_epi32(input));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4), _mm_cvtepu8_epi32(_mm_srli_si128(input, 4)));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), _mm_cvtepu8_epi32(_mm_srli_si128(input, 8)));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 12), _mm_cvtepu8_epi32(_mm_srli_si128(input, 12)));
+#	endif
+					first += 16;
+					dst += 16;
+					continue;
+				}
+				for (int i = std::countr_zero(non_ascii); i > 0; --i) {
+					*dst++ = *first++;
+				}
+			}
+
+			do {
+				first = decode_utf(first, last, *dst++).next_ptr_;
+			} while (first != last && !is_ascii(*first));
+		}
+		return static_cast<size_t>(dst - dst_begin);
+	}
+#endif
+}
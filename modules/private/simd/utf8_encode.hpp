@@ -0,0 +1,72 @@
+#pragma once
+
+#include "simd.hpp"
+
+#include <array>
+
+// Shared utf-8 encoder for four 32-bit code points: every lane is expanded to its full 4-byte form
+// (stored back to front), then a shuffle picked by the four sequence lengths packs the used bytes.
+namespace u8lib::simd
+{
+#if U8LIB_SIMD_SSE42
+	struct utf8_pack_entry {
+		alignas(16) uint8_t shuffle[16];
+		uint8_t size;
+	};
+
+	// index: 2 bits per lane holding (sequence length - 1)
+	inline constexpr auto utf8_pack_table = [] {
+		std::array<utf8_pack_entry, 256> table{};
+		for (uint32_t index = 0; index < 256; ++index) {
+			auto& entry = table[index];
+			uint8_t pos = 0;
+			for (uint8_t lane = 0; lane < 4; ++lane) {
+				const uint8_t len = ((index >> (lane * 2)) & 3) + 1;
+				for (uint8_t i = 0; i < len; ++i) {
+					entry.shuffle[pos++] = lane * 4 + len - 1 - i;
+				}
+			}
+			entry.size = pos;
+			for (; pos < 16; ++pos) {
+				entry.shuffle[pos] = 0x80;
+			}
+		}
+		return table;
+	}();
+
+	// 4-bit lane mask => one bit per 2-bit table field
+	inline constexpr uint8_t utf8_pack_spread[16] = {
+		0x00, 0x01, 0x04, 0x05, 0x10, 0x11, 0x14, 0x15, 0x40, 0x41, 0x44, 0x45, 0x50, 0x51, 0x54, 0x55
+	};
+
+	// lanes must hold unicode scalar values, always stores 16 bytes to dst
+	// return: code units of valid output
+	inline size_t utf8_encode_4(__m128i ch, char8_t* dst) {
+		const __m128i ge_2 = _mm_cmpgt_epi32(ch, _mm_set1_epi32(0x7F));
+		const __m128i ge_3 = _mm_cmpgt_epi32(ch, _mm_set1_epi32(0x7FF));
+		const __m128i ge_4 = _mm_cmpgt_epi32(ch, _mm_set1_epi32(0xFFFF));
+
+		// 10xxxxxx for every 6-bit group, byte 0 holds the last code unit
+		__m128i bytes = _mm_and_si128(ch, _mm_set1_epi32(0x3F));
+		bytes = _mm_or_si128(bytes, _mm_and_si128(_mm_slli_epi32(ch, 2), _mm_set1_epi32(0x3F00)));
+		bytes = _mm_or_si128(bytes, _mm_and_si128(_mm_slli_epi32(ch, 4), _mm_set1_epi32(0x3F0000)));
+		bytes = _mm_or_si128(bytes, _mm_and_si128(_mm_slli_epi32(ch, 6), _mm_set1_epi32(0x3F000000)));
+		bytes = _mm_or_si128(bytes, _mm_set1_epi32(static_cast<int>(0x80808080)));
+
+		// turn the top used group into a lead byte: 110xxxxx / 1110xxxx / 11110xxx
+		__m128i lead = _mm_and_si128(_mm_andnot_si128(ge_3, ge_2), _mm_set1_epi32(0x4000));
+		lead = _mm_or_si128(lead, _mm_and_si128(_mm_andnot_si128(ge_4, ge_3), _mm_set1_epi32(0x600000)));
+		lead = _mm_or_si128(lead, _mm_and_si128(ge_4, _mm_set1_epi32(0x70000000)));
+		bytes = _mm_blendv_epi8(ch, _mm_or_si128(bytes, lead), ge_2);
+
+		const uint32_t index =
+			utf8_pack_spread[_mm_movemask_ps(_mm_castsi128_ps(ge_2))] +
+			utf8_pack_spread[_mm_movemask_ps(_mm_castsi128_ps(ge_3))] +
+			utf8_pack_spread[_mm_movemask_ps(_mm_castsi128_ps(ge_4))];
+		const auto& entry = utf8_pack_table[index];
+		const __m128i packed = _mm_shuffle_epi8(bytes, _mm_load_si128(reinterpret_cast<const __m128i*>(entry.shuffle)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), packed);
+		return entry.size;
+	}
+#endif
+}
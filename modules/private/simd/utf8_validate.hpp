@@ -0,0 +1,175 @@
+#pragma once
+
+#include "simd.hpp"
+
+#include <u8lib/transcode.hpp>
+
+// Range-check validation after "Validating UTF-8 In Less Than One Instruction Per Byte" (Keiser & Lemire).
+// Every byte pair is classified through three nibble lookups, the remaining 3/4-byte continuation
+// requirements are checked against the bytes two and three positions back.
+namespace u8lib::simd
+{
+#if U8LIB_SIMD_NATIVE
+	template<typename V>
+	struct utf8_checker {
+		static constexpr uint8_t TOO_SHORT = 1 << 0;      // 11______ 0_______ / 11______ 11______
+		static constexpr uint8_t TOO_LONG = 1 << 1;       // 0_______ 10______
+		static constexpr uint8_t OVERLONG_3 = 1 << 2;     // 11100000 100_____
+		static constexpr uint8_t TOO_LARGE = 1 << 3;      // 11110100 1001____ ... 11111___ 101_____
+		static constexpr uint8_t SURROGATE = 1 << 4;      // 11101101 101_____
+		static constexpr uint8_t OVERLONG_2 = 1 << 5;     // 1100000_ 10______
+		static constexpr uint8_t TOO_LARGE_1000 = 1 << 6; // 11110101 1000____ ... 11111___ 1000____
+		static constexpr uint8_t OVERLONG_4 = 1 << 6;     // 11110000 1000____
+		static constexpr uint8_t TWO_CONTS = 1 << 7;      // 10______ 10______
+		static constexpr uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+		V error = V::zero();
+		V prev_input = V::zero();
+		V prev_incomplete = V::zero();
+
+		static V check_special_cases(V input, V prev1) {
+			const V byte_1_high = prev1.shr4().lookup_16(V::repeat_16(
+				// 0_______ ________
+				TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+				TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+				// 10______ ________
+				TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+				// 1100____ ________
+				TOO_SHORT | OVERLONG_2,
+				// 1101____ ________
+				TOO_SHORT,
+				// 1110____ ________
+				TOO_SHORT | OVERLONG_3 | SURROGATE,
+				// 1111____ ________
+				TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+			));
+			const V byte_1_low = (prev1 & V::splat(0x0F)).lookup_16(V::repeat_16(
+				// ____0000 ________
+				CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+				// ____0001 ________
+				CARRY | OVERLONG_2,
+				// ____001_ ________
+				CARRY,
+				CARRY,
+				// ____0100 ________
+				CARRY | TOO_LARGE,
+				// ____0101 ________
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				// ____011_ ________
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				// ____1___ ________
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				// ____1101 ________
+				CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000
+			));
+			const V byte_2_high = input.shr4().lookup_16(V::repeat_16(
+				// ________ 0_______
+				TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+				TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+				// ________ 1000____
+				TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+				// ________ 1001____
+				TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+				// ________ 101_____
+				TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+				TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+				// ________ 11______
+				TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+			));
+			return byte_1_high & byte_1_low & byte_2_high;
+		}
+
+		static V check_multibyte_lengths(V input, V prev_input, V special_cases) {
+			// top bit set where a 3/4-byte lead sits two/three bytes back
+			const V prev2 = input.template prev<2>(prev_input);
+			const V prev3 = input.template prev<3>(prev_input);
+			const V is_third_byte = prev2.saturating_sub(V::splat(0xE0 - 0x80));
+			const V is_fourth_byte = prev3.saturating_sub(V::splat(0xF0 - 0x80));
+			const V must_be_2_3_continuation = (is_third_byte | is_fourth_byte) & V::splat(0x80);
+			return must_be_2_3_continuation ^ special_cases;
+		}
+
+		// non-zero if the block ends inside a multibyte sequence
+		static V is_incomplete(V input) {
+			static constexpr uint8_t max_array[32] = {
+				0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+				0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+			};
+			return input.saturating_sub(V::load(max_array + 32 - V::size));
+		}
+
+		void check_block(V input) {
+			if (input.is_ascii()) {
+				error |= prev_incomplete;
+			} else {
+				const V prev1 = input.template prev<1>(prev_input);
+				const V special_cases = check_special_cases(input, prev1);
+				error |= check_multibyte_lengths(input, prev_input, special_cases);
+				prev_incomplete = is_incomplete(input);
+			}
+			prev_input = input;
+		}
+	};
+
+	template<typename V>
+	size_t utf8_ascii_prefix(const char8_t* seq, size_t size) noexcept {
+		size_t i = 0;
+		for (; i + V::size <= size; i += V::size) {
+			if (const uint32_t non_ascii = V::load(seq + i).movemask()) {
+				return i + static_cast<size_t>(std::countr_zero(non_ascii));
+			}
+		}
+		return i + internal::utf8_ascii_prefix_scalar(seq + i, size - i);
+	}
+
+	// the vector pass only tells which block broke, rewind to the last sequence head before it and let
+	// the scalar decoder find the exact offset
+	inline size_t utf8_validate_rewind(const char8_t* seq, size_t size, size_t block_start) noexcept {
+		size_t head = block_start;
+		for (size_t back = 1; back <= 3 && back <= block_start; ++back) {
+			const char8_t ch = seq[block_start - back];
+			if (ch >= 0xC0) {
+				head = block_start - back;
+				break;
+			}
+			if (is_ascii(ch)) {
+				break;
+			}
+		}
+		return head + internal::utf8_validate_scalar(seq + head, size - head);
+	}
+
+	template<typename V>
+	size_t utf8_validate(const char8_t* seq, size_t size) noexcept {
+		utf8_checker<V> checker;
+		size_t pos = 0;
+		for (; pos + V::size <= size; pos += V::size) {
+			checker.check_block(V::load(seq + pos));
+			if (checker.error.any()) {
+				return utf8_validate_rewind(seq, size, pos);
+			}
+		}
+
+		if (pos < size) {
+			// zero padding is ascii, so a sequence truncated by the end of input is reported as too short
+			alignas(32) char8_t tail[V::size] = {};
+			std::memcpy(tail, seq + pos, size - pos);
+			checker.check_block(V::load(tail));
+		} else {
+			checker.error |= checker.prev_incomplete;
+		}
+
+		if (checker.error.any()) {
+			return utf8_validate_rewind(seq, size, pos);
+		}
+		return size;
+	}
+#endif
+}
@@ -39,6 +39,12 @@ namespace u8lib
 		void reset() const noexcept {
 			std::memset(str->buffer_, 0, u8string::SSOBufferSize);
 			str->sso_flag_ = 1;
+			str->ascii_flag_ = 1;
+		}
+
+		// writable data() drops the flag, so mutations read it first and set it last
+		void set_ascii(bool value) const noexcept {
+			str->ascii_flag_ = value;
 		}
 
 		void set_size(size_type value) const noexcept {
@@ -55,8 +61,9 @@ namespace u8lib
 			deallocate(str->data_, str->capacity_ + 1);
 		}
 
+		// return: whether a new buffer was allocated
 		template<typename Getter, typename Fn>
-		void reserve(Getter&& getter, size_type count, Fn&& func) {
+		bool reserve(Getter&& getter, size_type count, Fn&& func) {
 			if (count > str->capacity()) {
 				auto new_sz = std::forward<Getter>(getter)(count + 1);
 				pointer new_memory = allocator_type::allocate(new_sz);
@@ -69,18 +76,54 @@ namespace u8lib
 				str->data_ = new_memory;
 				str->capacity_ = new_sz - 1;
 				str->sso_flag_ = 0;
+				return true;
 			}
+			return false;
 		}
 
+		// worst-case reservation can leave most of a fresh heap buffer unused, move the text into
+		// a fitting buffer (or back into sso) when more than half of the capacity is slack
+		template<typename Getter>
+		void shrink_slack(Getter&& getter) {
+			const size_type sz = str->size();
+			if (str->is_sso() || sz > str->capacity_ / 2) {
+				return;
+			}
+
+			if (sz <= u8string::SSOCapacity) {
+				pointer old_memory = str->data_;
+				const size_type old_capacity = str->capacity_;
+				reset();
+				traits_type::copy(str->sso_data_, old_memory, sz);
+				set_size(sz);
+				deallocate(old_memory, old_capacity + 1);
+				return;
+			}
+
+			const auto new_sz = std::forward<Getter>(getter)(sz + 1);
+			if (new_sz > str->capacity_) {
+				return;
+			}
+			pointer new_memory = allocate(new_sz);
+			traits_type::copy(new_memory, str->data_, sz + 1);
+			deallocate(str->data_, str->capacity_ + 1);
+			str->data_ = new_memory;
+			str->capacity_ = new_sz - 1;
+		}
+
+		// func writes at most len code units and returns the count written
 		template<typename Fn>
 		void insert(size_type index, size_type len, Fn&& func) {
-			const auto at_least_capacity = str->size() + len;
+			const auto sz = str->size();
+			const auto at_least_capacity = sz + len;
+			size_type written;
+			bool grown = false;
 			if (at_least_capacity > str->capacity()) {
 				const auto new_sz = policy_type::get_grow(at_least_capacity + 1);
 				pointer new_memory = allocate(new_sz);
 				traits_type::move(new_memory, str->data(), index);
-				traits_type::move(new_memory + index + len, str->data() + index, str->size() - index + 1);
-				std::forward<Fn>(func)(new_memory + index);
+				traits_type::move(new_memory + index + len, str->data() + index, sz - index + 1);
+				written = std::forward<Fn>(func)(new_memory + index);
 
 				if (str->is_heap()) {
 					deallocate(str->data(), str->capacity_ + 1);
@@ -89,19 +132,77 @@ namespace u8lib
 				str->data_ = new_memory;
 				str->capacity_ = new_sz - 1;
 				str->sso_flag_ = 0;
+				grown = true;
+			} else {
+				traits_type::move(str->data() + index + len, str->data() + index, sz - index + 1);
+				written = std::forward<Fn>(func)(str->data() + index);
+			}
+
+			assert(written <= len);
+			if (written < len) {
+				// close the gap left by an upper bound estimate
+				traits_type::move(str->data() + index + written, str->data() + index + len, sz - index + 1);
+			}
+			set_size(sz + written);
+			if (grown) {
+				shrink_slack(policy_type::get_grow);
+			}
+		}
+
+		// text is the transcoded input, input_len the input length in code units
+		template<typename Char>
+		static bool is_ascii_text(const char8_t* text, size_type written, size_type input_len) noexcept {
+			if constexpr (sizeof(Char) == sizeof(char8_t)) {
+				return u8lib::utf8_is_ascii(text, written);
 			} else {
-				traits_type::move(str->data() + index + len, str->data() + index, str->size() - index + 1);
-				std::forward<Fn>(func)(str->data() + index);
+				// every non-ascii code unit widens to more than one byte
+				return written == input_len;
 			}
-			set_size(at_least_capacity);
 		}
 
+		// small transcodes go through the stack so that short text lands in sso without a heap round trip
+		static constexpr size_type kStackTranscodeSize = 256;
+
 		template<typename Char>
 		u8string& do_assign(const Char* ptr, size_t len) {
-			size_type utf8_len = u8lib::text_size(ptr, len);
-			this->reserve(policy_type::get_reserve, utf8_len, [](pointer) {});
-			u8lib::parse_to_utf8(ptr, len, str->data());
-			set_size(utf8_len);
+			const size_type max_len = u8lib::max_text_size<Char>(len);
+			if constexpr (sizeof(Char) != sizeof(char8_t)) {
+				if (max_len > str->capacity() && max_len <= kStackTranscodeSize) {
+					char8_t buffer[kStackTranscodeSize];
+					return do_assign(buffer, u8lib::parse_to_utf8(ptr, len, buffer));
+				}
+			}
+
+			// single pass: transcode into the worst case size, then fix up size and slack
+			const bool grown = this->reserve(policy_type::get_reserve, max_len, [](pointer) {});
+			const size_type written = u8lib::parse_to_utf8(ptr, len, str->data());
+			set_size(written);
+			if (grown) {
+				shrink_slack(policy_type::get_reserve);
+			}
+			set_ascii(is_ascii_text<Char>(str->data(), written, len));
+			return *str;
+		}
+
+		// func writes at most max_len code units and returns the count written, every input code unit
+		// that is not ascii widens to more than one byte
+		template<typename Fn>
+		u8string& do_assign_transcoded(size_type input_len, size_type max_len, Fn&& func) {
+			if (max_len > str->capacity() && max_len <= kStackTranscodeSize) {
+				char8_t buffer[kStackTranscodeSize];
+				const size_type written = std::forward<Fn>(func)(buffer);
+				do_assign(buffer, written);
+				set_ascii(written == input_len);
+				return *str;
+			}
+
+			const bool grown = this->reserve(policy_type::get_reserve, max_len, [](pointer) {});
+			const size_type written = std::forward<Fn>(func)(str->data());
+			set_size(written);
+			if (grown) {
+				shrink_slack(policy_type::get_reserve);
+			}
+			set_ascii(written == input_len);
 			return *str;
 		}
 
@@ -109,27 +210,73 @@ namespace u8lib
 		u8string& do_insert(size_type index, View view) {
 			assert(index <= str->size());
 
-			auto utf8_len = u8lib::text_size(view.data(), view.size());
-			this->insert(index, utf8_len, [&](pointer ptr) {
-				u8lib::parse_to_utf8(view.data(), view.size(), ptr);
+			using Char = typename View::value_type;
+			const size_type max_len = u8lib::max_text_size<Char>(view.size());
+			if constexpr (sizeof(Char) != sizeof(char8_t)) {
+				if (max_len <= kStackTranscodeSize) {
+					char8_t buffer[kStackTranscodeSize];
+					return do_insert(index, u8string_view{buffer, u8lib::parse_to_utf8(view.data(), view.size(), buffer)});
+				}
+			}
+
+			const bool was_ascii = str->is_ascii();
+			size_type written = 0;
+			this->insert(index, max_len, [&](pointer ptr) {
+				return written = u8lib::parse_to_utf8(view.data(), view.size(), ptr);
 			});
+			set_ascii(was_ascii && is_ascii_text<Char>(str->data() + index, written, view.size()));
 			return *str;
 		}
 
 		template<typename View>
 		u8string& do_append(View view) {
-			auto sz = str->size();
-			size_type new_sz = sz + u8lib::text_size(view.data(), view.size());
-			this->reserve(policy_type::get_grow, new_sz, [&](pointer ptr) {
+			using Char = typename View::value_type;
+			const size_type sz = str->size();
+			const size_type max_len = u8lib::max_text_size<Char>(view.size());
+			if constexpr (sizeof(Char) != sizeof(char8_t)) {
+				if (sz + max_len > str->capacity() && max_len <= kStackTranscodeSize) {
+					char8_t buffer[kStackTranscodeSize];
+					return do_append(u8string_view{buffer, u8lib::parse_to_utf8(view.data(), view.size(), buffer)});
+				}
+			}
+
+			const bool was_ascii = str->is_ascii();
+			const bool grown = this->reserve(policy_type::get_grow, sz + max_len, [&](pointer ptr) {
 				traits_type::move(ptr, str->data(), sz);
 			});
-			u8lib::parse_to_utf8(view.data(), view.size(), str->data() + sz);
-			set_size(new_sz);
+			const size_type written = u8lib::parse_to_utf8(view.data(), view.size(), str->data() + sz);
+			set_size(sz + written);
+			if (grown) {
+				shrink_slack(policy_type::get_grow);
+			}
+			set_ascii(was_ascii && is_ascii_text<Char>(str->data() + sz, written, view.size()));
 			return *str;
 		}
 	};
 }
 
+// 8-bit encodings
+namespace u8lib
+{
+	u8string u8string::from_latin1(const char* str, size_type count) {
+		u8string result;
+		StringHelper helper(&result);
+		helper.do_assign_transcoded(count, count * 2, [&](char8_t* dst) {
+			return u8lib::latin1_to_utf8(str, count, dst);
+		});
+		return result;
+	}
+
+	u8string u8string::from_cp1252(const char* str, size_type count) {
+		u8string result;
+		StringHelper helper(&result);
+		helper.do_assign_transcoded(count, count * 3, [&](char8_t* dst) {
+			return u8lib::cp1252_to_utf8(str, count, dst);
+		});
+		return result;
+	}
+}
+
 // ctor & dtor
 namespace u8lib
 {
@@ -140,9 +287,11 @@ namespace u8lib
 
 	u8string::u8string(size_type count, value_type ch) {
 		StringHelper helper(this);
+		helper.reset();
 		helper.reserve(policy_type::get_reserve, count, [](pointer) {});
 		std::uninitialized_fill_n(data(), count, ch);
 		helper.set_size(count);
+		helper.set_ascii(ch < 0x80);
 	}
 
 	u8string::u8string(u8string&& rhs) noexcept {
@@ -211,9 +360,12 @@ namespace u8lib
 		assert(index <= size());
 
 		StringHelper helper(this);
+		const bool was_ascii = is_ascii();
 		helper.insert(index, count, [&](pointer ptr) {
 			std::uninitialized_fill_n(ptr, count, ch);
+			return count;
 		});
+		helper.set_ascii(was_ascii && (!count || ch < 0x80));
 		return *this;
 	}
 
@@ -237,11 +389,13 @@ namespace u8lib
 
 		auto sz = size();
 		size_type new_sz = sz + count;
+		const bool was_ascii = is_ascii();
 		helper.reserve(policy_type::get_grow, new_sz, [&](pointer ptr) {
 			traits_type::move(ptr, data(), sz);
 		});
 		std::uninitialized_fill_n(data() + sz, count, ch);
 		helper.set_size(new_sz);
+		helper.set_ascii(was_ascii && (!count || ch < 0x80));
 		return *this;
 	}
 
@@ -267,6 +421,7 @@ namespace u8lib
 	u8string& u8string::clear() noexcept {
 		StringHelper helper(this);
 		helper.set_size(0);
+		helper.set_ascii(true);
 		return *this;
 	}
 
@@ -282,9 +437,11 @@ namespace u8lib
 		assert(is_valid_index(index));
 
 		StringHelper helper(this);
+		const bool was_ascii = is_ascii();
 		auto v_end = std::min(count, size() - index);
 		traits_type::move(data() + index, data() + index + v_end, size() - index - v_end);
 		helper.set_size(size() - v_end);
+		helper.set_ascii(was_ascii);
 		return *this;
 	}
 }
@@ -296,6 +453,8 @@ namespace u8lib
 		assert(pos + count <= size());
 
 		StringHelper helper(this);
+		// cstr may point into this string, check it before moving anything
+		const bool ascii = is_ascii() && utf8_is_ascii(cstr, count2);
 		auto at_least_capacity = size() + count2 - count;
 		if (at_least_capacity > capacity()) {
 			auto new_sz = policy_type::get_grow(at_least_capacity + 1);
@@ -317,6 +476,97 @@ namespace u8lib
 		}
 
 		helper.set_size(at_least_capacity);
+		helper.set_ascii(ascii);
+		return *this;
+	}
+}
+
+// validate
+namespace u8lib
+{
+	u8string& u8string::sanitize() {
+		if (is_ascii()) {
+			return *this;
+		}
+
+		const size_type sz = size();
+		const size_type valid_size = utf8_validate(c_str(), sz);
+		if (valid_size == sz) {
+			return *this;
+		}
+
+		// single pass: U+FFFD is wider than most of the subparts it replaces, so repair into a new buffer of the worst
+		// case size behind the valid prefix, every subpart is at least one code unit, then fix up size and slack
+		const size_type max_size = valid_size + (sz - valid_size) * 3;
+		u8string result;
+		StringHelper helper(&result);
+		helper.reserve(policy_type::get_reserve, max_size, [](pointer) {});
+		pointer dst = result.data();
+		traits_type::copy(dst, c_str(), valid_size);
+		const size_type written = utf8_sanitize(c_str() + valid_size, sz - valid_size, dst + valid_size);
+		helper.set_size(valid_size + written);
+		helper.shrink_slack(policy_type::get_reserve);
+		helper.set_ascii(false);
+		swap(result);
+		return *this;
+	}
+}
+
+// normalization
+namespace u8lib
+{
+	u8string& u8string::normalize(normalization_form form) {
+		if (is_normalized(form)) {
+			return *this;
+		}
+
+		u8string result;
+		utf8_normalize(c_str(), size(), form, result);
+		swap(result);
+		return *this;
+	}
+}
+
+// case mapping
+namespace u8lib
+{
+	u8string& u8string::to_lower() {
+		if (is_ascii()) {
+			StringHelper helper(this);
+			ascii_to_lower(c_str(), size(), data());
+			helper.set_ascii(true);
+			return *this;
+		}
+
+		u8string result;
+		utf8_to_lower(c_str(), size(), result);
+		swap(result);
+		return *this;
+	}
+
+	u8string& u8string::to_upper() {
+		if (is_ascii()) {
+			StringHelper helper(this);
+			ascii_to_upper(c_str(), size(), data());
+			helper.set_ascii(true);
+			return *this;
+		}
+
+		u8string result;
+		utf8_to_upper(c_str(), size(), result);
+		swap(result);
+		return *this;
+	}
+
+	u8string& u8string::case_fold() {
+		// ascii folds like it lowers
+		if (is_ascii()) {
+			return to_lower();
+		}
+
+		u8string result;
+		utf8_case_fold(c_str(), size(), result);
+		swap(result);
 		return *this;
 	}
 }
@@ -326,31 +576,38 @@ namespace u8lib
 {
 	void u8string::reserve(size_type new_cap) {
 		StringHelper helper(this);
+		const bool was_ascii = is_ascii();
 		helper.reserve(policy_type::get_reserve, new_cap, [&](pointer ptr) {
 			// '\0'
 			traits_type::move(ptr, data(), size() + 1);
 		});
+		helper.set_ascii(was_ascii);
 	}
 
 	void u8string::resize(size_type count) {
 		StringHelper helper(this);
 
 		const auto sz = size();
+		const bool was_ascii = is_ascii();
 		reserve(count);
 		if (sz < count) {
-			std::uninitialized_default_construct_n(data() + sz, count);
+			std::uninitialized_default_construct_n(data() + sz, count - sz);
 		}
 		helper.set_size(count);
+		// grown code units are left uninitialized
+		helper.set_ascii(was_ascii && count <= sz);
 	}
 
 	void u8string::resize(size_type count, value_type ch) {
 		StringHelper helper(this);
 
 		const auto sz = size();
+		const bool was_ascii = is_ascii();
 		reserve(count);
 		if (sz < count) {
-			std::uninitialized_fill_n(data() + sz, count, ch);
+			std::uninitialized_fill_n(data() + sz, count - sz, ch);
 		}
 		helper.set_size(count);
+		helper.set_ascii(was_ascii && (count <= sz || ch < 0x80));
 	}
 }
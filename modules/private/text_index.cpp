@@ -0,0 +1,51 @@
+#include "pch.hpp"
+
+#include <u8lib/text_index.hpp>
+
+#include <algorithm>
+
+namespace u8lib
+{
+	void u8text_index::build() const {
+		if (is_built()) {
+			return;
+		}
+
+		// code point 0 always starts at 0, so a built index is never empty
+		const auto* seq = text_.data();
+		const size_type size = text_.size();
+		size_type index = 0;
+		samples_.reserve(size / stride_ + 1);
+		samples_.push_back(0);
+		text_length_ = 0;
+		while (index < size) {
+			text_length_ += utf8_walk(seq, size, size, stride_, index);
+			if (index < size) {
+				samples_.push_back(index);
+			}
+		}
+	}
+
+	u8text_index::size_type u8text_index::buffer_index_to_text(size_type index) const {
+		assert(index < text_.size() && "undefined behavior accessing out of text");
+		build();
+
+		// last sample at or before index
+		const auto it = std::upper_bound(samples_.begin(), samples_.end(), index) - 1;
+		size_type cur_idx = *it;
+		const auto sample = static_cast<size_type>(it - samples_.begin());
+		return sample * stride_ + utf8_walk(text_.data(), text_.size(), index + 1, SIZE_MAX, cur_idx) - 1;
+	}
+
+	u8text_index::size_type u8text_index::text_index_to_buffer(size_type index) const {
+		build();
+		assert(index <= text_length_ && "invalid code point index");
+		if (index == text_length_) {
+			return text_.size();
+		}
+
+		size_type cur_idx = samples_[index / stride_];
+		utf8_walk(text_.data(), text_.size(), text_.size(), index % stride_, cur_idx);
+		return cur_idx;
+	}
+}
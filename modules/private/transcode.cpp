@@ -0,0 +1,149 @@
+#include "pch.hpp"
+
+#include <u8lib/transcode.hpp>
+
+#include "simd/utf8_validate.hpp"
+#include "simd/utf8_decode.hpp"
+#include "simd/utf16_to_utf8.hpp"
+#include "simd/utf16_validate.hpp"
+#include "simd/utf32_to_utf8.hpp"
+#include "simd/latin1.hpp"
+
+namespace u8lib::internal
+{
+	size_t utf8_ascii_prefix_simd(const char8_t* seq, size_t size) noexcept {
+#if U8LIB_SIMD_NATIVE
+		return simd::utf8_ascii_prefix<simd::native_u8>(seq, size);
+#else
+		return utf8_ascii_prefix_scalar(seq, size);
+#endif
+	}
+
+	size_t utf8_validate_simd(const char8_t* seq, size_t size) noexcept {
+#if U8LIB_SIMD_NATIVE
+		return simd::utf8_validate<simd::native_u8>(seq, size);
+#else
+		return utf8_validate_scalar(seq, size);
+#endif
+	}
+
+	size_t utf8_to_utf16_size_simd(const char8_t* seq, size_t size) noexcept {
+#if U8LIB_SIMD_NATIVE
+		return simd::utf8_to_utf16_size<simd::native_u8>(seq, size);
+#else
+		return utf8_to_utf16_size_scalar(seq, size);
+#endif
+	}
+
+	size_t utf8_to_utf16_simd(const char8_t* seq, size_t size, char16_t* dst) noexcept {
+#if U8LIB_SIMD_NATIVE
+		return simd::utf8_to_utf16(seq, size, dst);
+#else
+		return utf8_to_utf16_scalar(seq, size, dst);
+#endif
+	}
+
+	size_t utf8_to_utf32_size_simd(const char8_t* seq, size_t size) noexcept {
+#if U8LIB_SIMD_NATIVE
+		return simd::utf8_to_utf32_size<simd::native_u8>(seq, size);
+#else
+		return utf8_to_utf32_size_scalar(seq, size);
+#endif
+	}
+
+	size_t utf8_to_utf32_simd(const char8_t* seq, size_t size, char32_t* dst) noexcept {
+#if U8LIB_SIMD_NATIVE
+		return simd::utf8_to_utf32(seq, size, dst);
+#else
+		return utf8_to_utf32_scalar(seq, size, dst);
+#endif
+	}
+
+	size_t utf8_walk_simd(const char8_t* seq, size_t size, size_t end, size_t max_count, size_t& index) noexcept {
+#if U8LIB_SIMD_NATIVE
+		return simd::utf8_walk<simd::native_u8>(seq, size, end, max_count, index);
+#else
+		return utf8_walk_scalar(seq, size, end, max_count, index);
+#endif
+	}
+
+	size_t utf16_validate_simd(const char16_t* seq, size_t size) noexcept {
+#if U8LIB_SIMD_SSE42
+		return simd::utf16_validate(seq, size);
+#else
+		return utf16_validate_scalar(seq, size);
+#endif
+	}
+
+	size_t utf16_to_utf8_size_simd(const char16_t* seq, size_t size) noexcept {
+#if U8LIB_SIMD_SSE42
+		return simd::utf16_to_utf8_size(seq, size);
+#else
+		return utf16_to_utf8_size_scalar(seq, size);
+#endif
+	}
+
+	size_t utf16_to_utf8_simd(const char16_t* seq, size_t size, char8_t* dst) noexcept {
+#if U8LIB_SIMD_SSE42
+		return simd::utf16_to_utf8(seq, size, dst);
+#else
+		return utf16_to_utf8_scalar(seq, size, dst);
+#endif
+	}
+
+	size_t utf32_to_utf8_size_simd(const char32_t* seq, size_t size) noexcept {
+#if U8LIB_SIMD_SSE42
+		return simd::utf32_to_utf8_size(seq, size);
+#else
+		return utf32_to_utf8_size_scalar(seq, size);
+#endif
+	}
+
+	size_t utf32_to_utf8_simd(const char32_t* seq, size_t size, char8_t* dst) noexcept {
+#if U8LIB_SIMD_SSE42
+		return simd::utf32_to_utf8(seq, size, dst);
+#else
+		return utf32_to_utf8_scalar(seq, size, dst);
+#endif
+	}
+
+	size_t latin1_to_utf8_size_simd(const char* seq, size_t size) noexcept {
+#if U8LIB_SIMD_NATIVE
+		return simd::latin1_to_utf8_size<simd::native_u8>(seq, size);
+#else
+		return latin1_to_utf8_size_scalar(seq, size);
+#endif
+	}
+
+	size_t latin1_to_utf8_simd(const char* seq, size_t size, char8_t* dst) noexcept {
+#if U8LIB_SIMD_SSE42
+		return simd::latin1_to_utf8<false>(seq, size, dst);
+#else
+		return latin1_to_utf8_scalar(seq, size, dst);
+#endif
+	}
+
+	size_t utf8_to_latin1_simd(const char8_t* seq, size_t size, char* dst, char replacement) noexcept {
+#if U8LIB_SIMD_NATIVE
+		return simd::utf8_to_latin1<simd::native_u8>(seq, size, dst, replacement);
+#else
+		return utf8_to_latin1_scalar(seq, size, dst, replacement);
+#endif
+	}
+
+	size_t cp1252_to_utf8_size_simd(const char* seq, size_t size) noexcept {
+#if U8LIB_SIMD_NATIVE
+		return simd::cp1252_to_utf8_size<simd::native_u8>(seq, size);
+#else
+		return cp1252_to_utf8_size_scalar(seq, size);
+#endif
+	}
+
+	size_t cp1252_to_utf8_simd(const char* seq, size_t size, char8_t* dst) noexcept {
+#if U8LIB_SIMD_SSE42
+		return simd::latin1_to_utf8<true>(seq, size, dst);
+#else
+		return cp1252_to_utf8_scalar(seq, size, dst);
+#endif
+	}
+}
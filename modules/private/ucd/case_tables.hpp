@@ -0,0 +1,480 @@
+#pragma once
+
+// Generated by tools/ucd/gen_ucd_tables.cpp from ICU 72.1 (Unicode 15.0), do not edit.
+
+#include "ucd_table.hpp"
+
+namespace u8lib::ucd
+{
+	// utf-8 size of a mapped code point is at most kMaxCaseMappingExpansion times its own
+	inline constexpr size_t kMaxCaseMappingExpansion = 3;
+
+	// record of the deltas below, records from kFirstFullCaseFolding on fold to more than one code point
+	inline constexpr two_stage_table<uint16_t, 6, 1958, 4288> kCaseMappingIndex{
+		0x0,
+		{
+		0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xa, 0x0, 0x0, 0xb, 0xc, 0xd, 0xe, 0xf, 0x10, 0x11, 0x12,
+		0x13, 0x14, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x15, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x0, 0x0, 0x1a, 0x1b, 0x0, 0x1c, 0x1c, 0x1d, 0x1c, 0x1e, 0x1f, 0x20, 0x21,
+		0x0, 0x0, 0x0, 0x0, 0x22, 0x23, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x25, 0x26, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0x28, 0x1c, 0x29, 0x2a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0x2c, 0x0, 0x2d, 0x2e, 0x2f, 0x30, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x32, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x34, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x37, 0x38, 0x39, 0x0, 0x3a, 0x3b, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x3c, 0x3d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x41, 0x42
+		},
+		{
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+		0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+		0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+		0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+		0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+		0x1, 0x1, 0x1, 0xb2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+		0x2, 0x2, 0x2, 0x2, 0x2, 0x0, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x4, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6,
+		0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6,
+		0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0xb3, 0x7, 0x5, 0x6,
+		0x5, 0x6, 0x5, 0x6, 0x0, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0xb4,
+		0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6,
+		0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6,
+		0x5, 0x6, 0x8, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x9, 0xa, 0xb, 0x5, 0x6, 0x5, 0x6, 0xc, 0x5, 0x6, 0xd, 0xd, 0x5,
+		0x6, 0x0, 0xe, 0xf, 0x10, 0x5, 0x6, 0xd, 0x11, 0x12, 0x13, 0x14, 0x5, 0x6, 0x15, 0x0, 0x13, 0x16, 0x17, 0x18,
+		0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x19, 0x5, 0x6, 0x19, 0x0, 0x0, 0x5, 0x6, 0x19, 0x5, 0x6, 0x1a, 0x1a, 0x5, 0x6,
+		0x5, 0x6, 0x1b, 0x5, 0x6, 0x0, 0x0, 0x5, 0x6, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x1e, 0x1f, 0x1d, 0x1e, 0x1f,
+		0x1d, 0x1e, 0x1f, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x20, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0xb5, 0x1d, 0x1e, 0x1f,
+		0x5, 0x6, 0x21, 0x22, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6,
+		0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6,
+		0x23, 0x0, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x24, 0x5, 0x6, 0x25, 0x26, 0x27, 0x27, 0x5, 0x6, 0x28, 0x29, 0x2a, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x0, 0x30, 0x30, 0x0, 0x31, 0x0, 0x32, 0x33, 0x0, 0x0,
+		0x0, 0x30, 0x34, 0x0, 0x35, 0x0, 0x36, 0x37, 0x0, 0x38, 0x39, 0x37, 0x3a, 0x3b, 0x0, 0x0, 0x39, 0x0, 0x3c, 0x3d,
+		0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x40, 0x0, 0x41, 0x40, 0x0, 0x0, 0x0, 0x42,
+		0x40, 0x43, 0x44, 0x44, 0x45, 0x0, 0x0, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x47, 0x48, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x6, 0x5, 0x6, 0x0,
+		0x0, 0x5, 0x6, 0x0, 0x0, 0x0, 0x17, 0x17, 0x17, 0x0, 0x4a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0x0, 0x4c, 0x4c,
+		0x4c, 0x0, 0x4d, 0x0, 0x4e, 0x4e, 0xb6, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+		0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x4f, 0x50, 0x50, 0x50, 0xb7, 0x2, 0x2, 0x2,
+		0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x51, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+		0x2, 0x2, 0x52, 0x53, 0x53, 0x54, 0x55, 0x56, 0x0, 0x0, 0x0, 0x57, 0x58, 0x59, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6,
+		0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5a, 0x5b, 0x5c,
+		0x5d, 0x5e, 0x5f, 0x0, 0x5, 0x6, 0x60, 0x5, 0x6, 0x0, 0x23, 0x23, 0x23, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+		0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+		0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+		0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+		0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+		0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x63, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6,
+		0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x64, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x0, 0x65, 0x65, 0x65,
+		0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+		0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+		0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+		0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x0, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x0,
+		0x0, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+		0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+		0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x0, 0x0, 0x68, 0x68, 0x68, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+		0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+		0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+		0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+		0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x0, 0x0, 0x6b, 0x6b,
+		0x6b, 0x6b, 0x6b, 0x6b, 0x0, 0x0, 0x6c, 0x6d, 0x6e, 0x6f, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+		0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+		0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x0, 0x0, 0x74, 0x74, 0x74, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x75, 0x0, 0x0, 0x0, 0x76, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x77, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0x78, 0x0, 0x0, 0xbe, 0x0, 0x5, 0x6,
+		0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6,
+		0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7a,
+		0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x0, 0x0, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x0,
+		0x0, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x79,
+		0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x79, 0x79,
+		0x79, 0x79, 0x0, 0x0, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x0, 0x0, 0xbf, 0x79, 0xc0, 0x79, 0xc1, 0x79, 0xc2,
+		0x79, 0x0, 0x7a, 0x0, 0x7a, 0x0, 0x7a, 0x0, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a,
+		0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f,
+		0x80, 0x80, 0x0, 0x0, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0, 0xd1,
+		0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0xe2, 0xe3,
+		0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef, 0xf0, 0xf1, 0xf2, 0x79, 0x79, 0xf3,
+		0xf4, 0xf5, 0x0, 0xf6, 0xf7, 0x7a, 0x7a, 0x81, 0x81, 0xf8, 0x0, 0x82, 0x0, 0x0, 0x0, 0xf9, 0xfa, 0xfb, 0x0,
+		0xfc, 0xfd, 0x83, 0x83, 0x83, 0x83, 0xfe, 0x0, 0x0, 0x0, 0x79, 0x79, 0xff, 0xb6, 0x0, 0x0, 0x100, 0x101, 0x7a,
+		0x7a, 0x84, 0x84, 0x0, 0x0, 0x0, 0x0, 0x79, 0x79, 0x102, 0xb7, 0x103, 0x5c, 0x104, 0x105, 0x7a, 0x7a, 0x85,
+		0x85, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x106, 0x107, 0x108, 0x0, 0x109, 0x10a, 0x86, 0x86, 0x87, 0x87, 0x10b, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0x0, 0x0, 0x0,
+		0x89, 0x8a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
+		0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,
+		0x8e, 0x8e, 0x8e, 0x8e, 0x0, 0x0, 0x0, 0x5, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
+		0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
+		0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+		0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+		0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+		0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+		0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5, 0x6, 0x91, 0x92, 0x93, 0x94,
+		0x95, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x96, 0x97, 0x98, 0x99, 0x0, 0x5, 0x6, 0x0, 0x5, 0x6, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x9a, 0x9a, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x5, 0x6, 0x5, 0x6, 0x0, 0x0, 0x0, 0x5, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b,
+		0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b,
+		0x9b, 0x9b, 0x9b, 0x9b, 0x0, 0x9b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x0, 0x0, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x6, 0x5, 0x6, 0x9c, 0x5,
+		0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x0, 0x0, 0x0, 0x5, 0x6, 0x9d, 0x0, 0x0, 0x5, 0x6, 0x5, 0x6, 0x9e,
+		0x0, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x9f,
+		0xa0, 0xa1, 0xa2, 0x9f, 0x0, 0xa3, 0xa4, 0xa5, 0xa6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6, 0x5, 0x6,
+		0x5, 0x6, 0x5, 0x6, 0xa7, 0xa8, 0xa9, 0x5, 0x6, 0x5, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x6, 0x0, 0x0, 0x0, 0x0,
+		0x5, 0x6, 0x5, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaa, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
+		0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
+		0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
+		0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
+		0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0x10c, 0x10d, 0x10e, 0x10f, 0x110, 0x111, 0x111, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x112, 0x113, 0x114, 0x115, 0x116, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+		0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+		0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
+		0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
+		0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad,
+		0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad,
+		0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
+		0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
+		0xac, 0xac, 0xac, 0x0, 0x0, 0x0, 0x0, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad,
+		0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad,
+		0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+		0xae, 0xae, 0xae, 0xae, 0xae, 0x0, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+		0xae, 0xae, 0x0, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x0, 0xae, 0xae, 0x0, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
+		0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0x0, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
+		0xaf, 0xaf, 0xaf, 0x0, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0x0, 0xaf, 0xaf, 0x0, 0x0, 0x0, 0x4d, 0x4d,
+		0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
+		0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
+		0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+		0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+		0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+		0x52, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+		0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+		0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+		0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+		0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x2,
+		0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+		0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+		0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+		0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+		0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+		0xb1, 0xb1, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+		}
+	};
+
+	inline constexpr size_t kFirstFullCaseFolding = 178;
+
+	// simple case mappings and simple case folding as code point deltas
+	inline constexpr int32_t kLowercaseDelta[279] = {
+		0x0, 0x20, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, -0x79, 0x0, 0x0, 0xd2, 0xce, 0xcd, 0x4f, 0xca, 0xcb, 0xcf, 0x0, 0xd3,
+		0xd1, 0x0, 0xd5, 0x0, 0xd6, 0xda, 0xd9, 0xdb, 0x0, 0x2, 0x1, 0x0, 0x0, -0x61, -0x38, -0x82, 0x2a2b, -0xa3,
+		0x2a28, 0x0, -0xc3, 0x45, 0x47, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x74, 0x26, 0x25, 0x40, 0x3f, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, -0x3c, 0x0, -0x7, 0x50, 0x0, 0xf, 0x0,
+		0x30, 0x0, 0x1c60, 0x0, 0x97d0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, -0xbc0, 0x0, 0x0, 0x0, 0x0,
+		0x0, -0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, -0x4a, 0x0, -0x56, -0x64, -0x70, -0x80, -0x7e, -0x1d5d, -0x20bf,
+		-0x2046, 0x1c, 0x0, 0x10, 0x0, 0x1a, 0x0, -0x29f7, -0xee6, -0x29e7, 0x0, 0x0, -0x2a1c, -0x29fd, -0x2a1f,
+		-0x2a1e, -0x2a3f, 0x0, -0x8a04, -0xa528, 0x0, -0xa544, -0xa54f, -0xa54b, -0xa541, -0xa512, -0xa52a, -0xa515,
+		0x3a0, -0x30, -0xa543, -0x8a38, 0x0, 0x0, 0x28, 0x0, 0x27, 0x0, 0x22, 0x0, 0x0, -0xc7, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, -0x1dbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, -0x8, -0x8, -0x8,
+		-0x8, -0x8, -0x8, -0x8, -0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, -0x8, -0x8, -0x8, -0x8, -0x8, -0x8, -0x8,
+		-0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, -0x8, -0x8, -0x8, -0x8, -0x8, -0x8, -0x8, -0x8, 0x0, 0x0, 0x0,
+		0x0, 0x0, -0x9, 0x0, 0x0, 0x0, 0x0, 0x0, -0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, -0x9,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+	};
+
+	inline constexpr int32_t kUppercaseDelta[279] = {
+		0x0, 0x0, -0x20, 0x2e7, 0x79, 0x0, -0x1, -0xe8, 0x0, -0x12c, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x61, 0x0,
+		0x0, 0xa3, 0x0, 0x82, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0, -0x1, -0x2, -0x4f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a3f,
+		0x0, 0x0, 0x0, 0x2a1f, 0x2a1c, 0x2a1e, -0xd2, -0xce, -0xcd, -0xca, -0xcb, 0xa54f, 0xa54b, -0xcf, 0xa528, 0xa544,
+		-0xd1, -0xd3, 0x29f7, 0xa541, 0x29fd, -0xd5, -0xd6, 0x29e7, -0xda, 0xa543, 0xa52a, -0x45, -0xd9, -0x47, -0xdb,
+		0xa515, 0xa512, 0x54, 0x0, 0x0, 0x0, 0x0, 0x0, -0x26, -0x25, -0x1f, -0x40, -0x3f, 0x0, -0x3e, -0x39, -0x2f,
+		-0x36, -0x8, -0x56, -0x50, 0x7, -0x74, 0x0, -0x60, 0x0, 0x0, -0x50, 0x0, -0xf, 0x0, -0x30, 0x0, 0xbc0, 0x0, 0x0,
+		-0x8, -0x186e, -0x186d, -0x1864, -0x1862, -0x1863, -0x185c, -0x1825, 0x89c2, 0x0, 0x8a04, 0xee6, 0x8a38, -0x3b,
+		0x8, 0x0, 0x4a, 0x56, 0x64, 0x80, 0x70, 0x7e, 0x0, -0x1c25, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, -0x1c,
+		0x0, -0x10, 0x0, -0x1a, 0x0, 0x0, 0x0, -0x2a2b, -0x2a28, 0x0, 0x0, 0x0, 0x0, 0x0, -0x1c60, 0x0, 0x0, 0x30, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, -0x3a0, -0x97d0, 0x0, -0x28, 0x0, -0x27, 0x0, -0x22, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+		0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+	};
+
+	inline constexpr int32_t kCaseFoldingDelta[279] = {
+		0x0, 0x20, 0x0, 0x307, 0x0, 0x1, 0x0, 0x0, -0x79, -0x10c, 0x0, 0xd2, 0xce, 0xcd, 0x4f, 0xca, 0xcb, 0xcf, 0x0,
+		0xd3, 0xd1, 0x0, 0xd5, 0x0, 0xd6, 0xda, 0xd9, 0xdb, 0x0, 0x2, 0x1, 0x0, 0x0, -0x61, -0x38, -0x82, 0x2a2b, -0xa3,
+		0x2a28, 0x0, -0xc3, 0x45, 0x47, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x74, 0x74, 0x26, 0x25, 0x40, 0x3f, 0x0,
+		0x0, 0x1, 0x0, 0x0, 0x8, -0x1e, -0x19, -0xf, -0x16, 0x0, -0x36, -0x30, 0x0, 0x0, -0x3c, -0x40, -0x7, 0x50, 0x0,
+		0xf, 0x0, 0x30, 0x0, 0x1c60, 0x0, 0x0, 0x0, -0x8, -0x184e, -0x184d, -0x1844, -0x1842, -0x1843, -0x183c, -0x1824,
+		0x89c3, -0xbc0, 0x0, 0x0, 0x0, -0x3a, 0x0, -0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, -0x4a, -0x1c05, -0x56, -0x64,
+		-0x70, -0x80, -0x7e, -0x1d5d, -0x20bf, -0x2046, 0x1c, 0x0, 0x10, 0x0, 0x1a, 0x0, -0x29f7, -0xee6, -0x29e7, 0x0,
+		0x0, -0x2a1c, -0x29fd, -0x2a1f, -0x2a1e, -0x2a3f, 0x0, -0x8a04, -0xa528, 0x0, -0xa544, -0xa54f, -0xa54b,
+		-0xa541, -0xa512, -0xa52a, -0xa515, 0x3a0, -0x30, -0xa543, -0x8a38, 0x0, -0x97d0, 0x28, 0x0, 0x27, 0x0, 0x22,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, -0x1dbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, -0x8, -0x8, -0x8, -0x8, -0x8, -0x8, -0x8, -0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		-0x8, -0x8, -0x8, -0x8, -0x8, -0x8, -0x8, -0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, -0x8, -0x8, -0x8, -0x8,
+		-0x8, -0x8, -0x8, -0x8, 0x0, 0x0, 0x0, 0x0, 0x0, -0x9, 0x0, 0x0, 0x0, 0x0, 0x0, -0x9, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, -0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+	};
+
+	// full case foldings of the records from kFirstFullCaseFolding on, padded with 0
+	inline constexpr char32_t kFullCaseFoldings[101][3] = {
+		{0x73, 0x73, 0x0},
+		{0x69, 0x307, 0x0},
+		{0x2bc, 0x6e, 0x0},
+		{0x6a, 0x30c, 0x0},
+		{0x3b9, 0x308, 0x301},
+		{0x3c5, 0x308, 0x301},
+		{0x565, 0x582, 0x0},
+		{0x68, 0x331, 0x0},
+		{0x74, 0x308, 0x0},
+		{0x77, 0x30a, 0x0},
+		{0x79, 0x30a, 0x0},
+		{0x61, 0x2be, 0x0},
+		{0x73, 0x73, 0x0},
+		{0x3c5, 0x313, 0x0},
+		{0x3c5, 0x313, 0x300},
+		{0x3c5, 0x313, 0x301},
+		{0x3c5, 0x313, 0x342},
+		{0x1f00, 0x3b9, 0x0},
+		{0x1f01, 0x3b9, 0x0},
+		{0x1f02, 0x3b9, 0x0},
+		{0x1f03, 0x3b9, 0x0},
+		{0x1f04, 0x3b9, 0x0},
+		{0x1f05, 0x3b9, 0x0},
+		{0x1f06, 0x3b9, 0x0},
+		{0x1f07, 0x3b9, 0x0},
+		{0x1f00, 0x3b9, 0x0},
+		{0x1f01, 0x3b9, 0x0},
+		{0x1f02, 0x3b9, 0x0},
+		{0x1f03, 0x3b9, 0x0},
+		{0x1f04, 0x3b9, 0x0},
+		{0x1f05, 0x3b9, 0x0},
+		{0x1f06, 0x3b9, 0x0},
+		{0x1f07, 0x3b9, 0x0},
+		{0x1f20, 0x3b9, 0x0},
+		{0x1f21, 0x3b9, 0x0},
+		{0x1f22, 0x3b9, 0x0},
+		{0x1f23, 0x3b9, 0x0},
+		{0x1f24, 0x3b9, 0x0},
+		{0x1f25, 0x3b9, 0x0},
+		{0x1f26, 0x3b9, 0x0},
+		{0x1f27, 0x3b9, 0x0},
+		{0x1f20, 0x3b9, 0x0},
+		{0x1f21, 0x3b9, 0x0},
+		{0x1f22, 0x3b9, 0x0},
+		{0x1f23, 0x3b9, 0x0},
+		{0x1f24, 0x3b9, 0x0},
+		{0x1f25, 0x3b9, 0x0},
+		{0x1f26, 0x3b9, 0x0},
+		{0x1f27, 0x3b9, 0x0},
+		{0x1f60, 0x3b9, 0x0},
+		{0x1f61, 0x3b9, 0x0},
+		{0x1f62, 0x3b9, 0x0},
+		{0x1f63, 0x3b9, 0x0},
+		{0x1f64, 0x3b9, 0x0},
+		{0x1f65, 0x3b9, 0x0},
+		{0x1f66, 0x3b9, 0x0},
+		{0x1f67, 0x3b9, 0x0},
+		{0x1f60, 0x3b9, 0x0},
+		{0x1f61, 0x3b9, 0x0},
+		{0x1f62, 0x3b9, 0x0},
+		{0x1f63, 0x3b9, 0x0},
+		{0x1f64, 0x3b9, 0x0},
+		{0x1f65, 0x3b9, 0x0},
+		{0x1f66, 0x3b9, 0x0},
+		{0x1f67, 0x3b9, 0x0},
+		{0x1f70, 0x3b9, 0x0},
+		{0x3b1, 0x3b9, 0x0},
+		{0x3ac, 0x3b9, 0x0},
+		{0x3b1, 0x342, 0x0},
+		{0x3b1, 0x342, 0x3b9},
+		{0x3b1, 0x3b9, 0x0},
+		{0x1f74, 0x3b9, 0x0},
+		{0x3b7, 0x3b9, 0x0},
+		{0x3ae, 0x3b9, 0x0},
+		{0x3b7, 0x342, 0x0},
+		{0x3b7, 0x342, 0x3b9},
+		{0x3b7, 0x3b9, 0x0},
+		{0x3b9, 0x308, 0x300},
+		{0x3b9, 0x342, 0x0},
+		{0x3b9, 0x308, 0x342},
+		{0x3c5, 0x308, 0x300},
+		{0x3c1, 0x313, 0x0},
+		{0x3c5, 0x342, 0x0},
+		{0x3c5, 0x308, 0x342},
+		{0x1f7c, 0x3b9, 0x0},
+		{0x3c9, 0x3b9, 0x0},
+		{0x3ce, 0x3b9, 0x0},
+		{0x3c9, 0x342, 0x0},
+		{0x3c9, 0x342, 0x3b9},
+		{0x3c9, 0x3b9, 0x0},
+		{0x66, 0x66, 0x0},
+		{0x66, 0x69, 0x0},
+		{0x66, 0x6c, 0x0},
+		{0x66, 0x66, 0x69},
+		{0x66, 0x66, 0x6c},
+		{0x73, 0x74, 0x0},
+		{0x574, 0x576, 0x0},
+		{0x574, 0x565, 0x0},
+		{0x574, 0x56b, 0x0},
+		{0x57e, 0x576, 0x0},
+		{0x574, 0x56d, 0x0},
+	};
+}
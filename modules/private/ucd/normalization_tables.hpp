@@ -0,0 +1,2788 @@
+#pragma once
+
+// Generated by tools/ucd/gen_ucd_tables.cpp from ICU 72.1 (Unicode 15.0), do not edit.
+
+#include "ucd_table.hpp"
+
+namespace u8lib::ucd
+{
+	// kNormalizationProps: bits 0-7 hold the canonical combining class, the others the quick check values
+	inline constexpr uint16_t kNfdNo = 0x100;
+	inline constexpr uint16_t kNfcNo = 0x200;
+	inline constexpr uint16_t kNfcMaybe = 0x400;
+	inline constexpr uint16_t kNfkdNo = 0x800;
+	inline constexpr uint16_t kNfkcNo = 0x1000;
+	inline constexpr uint16_t kNfkcMaybe = 0x2000;
+
+	inline constexpr two_stage_table<uint16_t, 5, 6097, 9120> kNormalizationProps{
+		0x0,
+		{
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x0, 0x8, 0x9, 0xa, 0xb, 0xc, 0x0, 0x0, 0x0, 0xd,
+		0xe, 0xf, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x0, 0x1d, 0x1e, 0x0,
+		0x0, 0x0, 0x0, 0x1f, 0x20, 0x21, 0x0, 0x22, 0x23, 0x24, 0x25, 0x0, 0x0, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x0, 0x0,
+		0x0, 0x0, 0x2b, 0x2c, 0x2d, 0x2e, 0x0, 0x2f, 0x0, 0x30, 0x31, 0x0, 0x32, 0x33, 0x0, 0x0, 0x34, 0x35, 0x36, 0x0,
+		0x37, 0x38, 0x0, 0x0, 0x39, 0x3a, 0x0, 0x0, 0x34, 0x3b, 0x0, 0x3c, 0x3d, 0x3e, 0x0, 0x0, 0x39, 0x3f, 0x0, 0x0,
+		0x39, 0x40, 0x0, 0x0, 0x41, 0x3e, 0x0, 0x0, 0x0, 0x42, 0x0, 0x0, 0x43, 0x44, 0x0, 0x0, 0x45, 0x46, 0x0, 0x47,
+		0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x0, 0x0, 0x4e, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x50, 0x0, 0x0, 0x0, 0x51, 0x0,
+		0x52, 0x53, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x54, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55,
+		0x56, 0x0, 0x0, 0x0, 0x0, 0x57, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58, 0x0, 0x0, 0x0, 0x59, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x5a, 0x0, 0x0, 0x5b, 0x0, 0x5c, 0x5d, 0x0, 0x5e, 0x5f, 0x60, 0x61, 0x0, 0x62, 0x0, 0x63, 0x0, 0x64,
+		0x0, 0x0, 0x0, 0x0, 0x65, 0x66, 0x0, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6e, 0x6e, 0x6e, 0x6f,
+		0x6e, 0x6e, 0x70, 0x71, 0x6e, 0x72, 0x73, 0x6e, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d,
+		0x7e, 0x7f, 0x80, 0x81, 0x6b, 0x82, 0x83, 0x84, 0x0, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x0, 0x8b, 0x0, 0x8c,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6b, 0x6b, 0x6b, 0x6b, 0x8d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8e, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x90, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x91, 0x0, 0x0, 0x0, 0x92, 0x0, 0x0, 0x0, 0x93, 0x0, 0x0, 0x0, 0x94,
+		0x0, 0x0, 0x0, 0x0, 0x95, 0x0, 0x0, 0x96, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x97, 0x0, 0x98, 0x99, 0x9a, 0x9b,
+		0x9c, 0x9a, 0x9b, 0x9d, 0x0, 0x9e, 0x6b, 0x6b, 0x9f, 0x0, 0x0, 0x0, 0xa0, 0x6b, 0xa1, 0xa0, 0x6b, 0x6b, 0x6b,
+		0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0xa2, 0xa3, 0x0, 0x0, 0xa4, 0x0, 0x0, 0x0, 0xa5, 0x0, 0x0, 0x0, 0xa6, 0xa7, 0xa8, 0x0, 0x0, 0x0, 0x0,
+		0xa9, 0xaa, 0x0, 0xab, 0xac, 0x0, 0x0, 0xad, 0xae, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0xb1, 0x0, 0x0,
+		0xb2, 0xb3, 0x0, 0x0, 0x0, 0x3a, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+		0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb5, 0xb5, 0xb5, 0xb5,
+		0xb5, 0xb5, 0xb5, 0xb5, 0xb6, 0xb7, 0xb5, 0xb8, 0xb5, 0xb5, 0xb9, 0x0, 0xba, 0xbb, 0xbc, 0x6b, 0x6b, 0xbd, 0xbe,
+		0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0xbf, 0xc0, 0x6b, 0xc1, 0x6b, 0xc2, 0xc3, 0xc4,
+		0xc5, 0xc6, 0xc7, 0x6b, 0x6b, 0x6b, 0xc8, 0xc9, 0x6b, 0x6b, 0x6b, 0x6b, 0xa0, 0xca, 0xcb, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0, 0x0,
+		0x0, 0xce, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd1, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd3, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0xd5, 0x0, 0xd6, 0x0, 0x0, 0xd7, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa7, 0xd9, 0xda, 0xdb, 0x0,
+		0x0, 0xdc, 0xdd, 0x0, 0xad, 0x0, 0x0, 0xde, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe0, 0x0, 0xe1, 0xe2,
+		0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0xe5, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe7, 0xe8, 0x0,
+		0x0, 0xe9, 0x0, 0x0, 0x0, 0xea, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0xed, 0xee, 0x0, 0x0, 0x0, 0x0, 0xae, 0x0, 0x56, 0xef, 0x0, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf1, 0x0, 0xf2, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf4,
+		0x0, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x6b, 0x6b, 0xfe, 0x6b, 0xff, 0x100, 0x101, 0x6b, 0x102, 0x103, 0x104, 0x6b, 0x6b,
+		0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x105, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x106,
+		0x6b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x107,
+		0x108, 0x6b, 0x109, 0x10a, 0x0, 0x0, 0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x10b, 0x0, 0x10c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10d, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10e, 0x0, 0x0, 0x0, 0x10f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x101, 0x110, 0x111, 0x112, 0x113, 0x114, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x115, 0x116, 0x117, 0x118, 0xa5, 0x0, 0x0, 0x0, 0x119, 0x11a,
+		0x11b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
+		0xb5, 0x11c
+		},
+		{
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0,
+		0x1800, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x1800,
+		0x0, 0x1800, 0x1800, 0x1800, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x0, 0x1800, 0x1800, 0x900, 0x900, 0x900, 0x900, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x1800, 0x1800, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x1800, 0x0, 0x0, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x1800, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x0,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x1800, 0x1800, 0x1800, 0x900,
+		0x900, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x24e6, 0x24e6, 0x24e6, 0x24e6, 0x24e6, 0xe6, 0x24e6, 0x24e6, 0x24e6, 0x24e6, 0x24e6,
+		0x24e6, 0x24e6, 0xe6, 0xe6, 0x24e6, 0xe6, 0x24e6, 0xe6, 0x24e6, 0x24e6, 0xe8, 0xdc, 0xdc, 0xdc, 0xdc, 0xe8,
+		0x24d8, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xca, 0xca, 0x24dc, 0x24dc, 0x24dc, 0x24dc, 0x24ca, 0x24ca, 0xdc, 0xdc,
+		0xdc, 0xdc, 0x24dc, 0x24dc, 0xdc, 0x24dc, 0x24dc, 0xdc, 0xdc, 0x1, 0x1, 0x1, 0x1, 0x2401, 0xdc, 0xdc, 0xdc,
+		0xdc, 0xe6, 0xe6, 0xe6, 0x1be6, 0x1be6, 0x24e6, 0x1be6, 0x1be6, 0x24f0, 0xe6, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6,
+		0xe6, 0xdc, 0xdc, 0x0, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe8, 0xdc, 0xdc, 0xe6, 0xe9, 0xea, 0xea,
+		0xe9, 0xea, 0xea, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0,
+		0x0, 0x0, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800,
+		0x1900, 0x900, 0x1b00, 0x900, 0x900, 0x900, 0x0, 0x900, 0x0, 0x900, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x1800, 0x1800,
+		0x1800, 0x1900, 0x1900, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x0, 0x0,
+		0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x0, 0x900, 0x0, 0x0, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0,
+		0x900, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x900, 0x900, 0x0, 0x900, 0x0, 0x0, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x900, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900,
+		0x0, 0x0, 0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x0, 0x0, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xe6, 0xde, 0xdc, 0xe6,
+		0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xde, 0xe4,
+		0xe6, 0xa, 0xb, 0xc, 0xd, 0xe, 0xf, 0x10, 0x11, 0x12, 0x13, 0x13, 0x14, 0x15, 0x16, 0x0, 0x17, 0x0, 0x18, 0x19,
+		0x0, 0xe6, 0xdc, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x1e, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0x1c, 0x1d,
+		0x1e, 0x1f, 0x20, 0x21, 0x22, 0x24e6, 0x24e6, 0x24dc, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6, 0xe6,
+		0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x0, 0x0, 0x0, 0x0,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+		0xe6, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6, 0x0, 0x0, 0xe6, 0xe6, 0x0, 0xdc, 0xe6, 0xe6, 0xdc, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xdc,
+		0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xe6, 0xdc, 0xdc, 0xe6, 0xdc, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6,
+		0xdc, 0xe6, 0xdc, 0xe6, 0xdc, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6,
+		0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6,
+		0xe6, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0xe6, 0xe6, 0xe6, 0x0, 0xe6, 0xe6, 0xe6,
+		0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0xdc, 0xdc, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xe6,
+		0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0xdc, 0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xdc,
+		0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0x1b, 0x1c, 0x1d, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xdc, 0xdc, 0xe6,
+		0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x900, 0x0, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2407, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0xe6, 0xdc, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x1b00, 0x1b00,
+		0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x2400, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2400,
+		0x0, 0x0, 0x0, 0x0, 0x1b00, 0x1b00, 0x0, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x0, 0x0, 0x1b00,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x1b00, 0x1b00, 0x0, 0x0, 0x1b00, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x0, 0x900, 0x900, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2400,
+		0x2400, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900,
+		0x900, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x54,
+		0x245b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x2400, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x0,
+		0x900, 0x900, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2400, 0x2400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x9, 0x0, 0x2400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x2409, 0x0, 0x0, 0x0, 0x0, 0x2400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x900, 0x900,
+		0x900, 0x2400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x1800, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x6b, 0x6b, 0x6b, 0x6b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x1800, 0x0, 0x0, 0x0, 0x0, 0x76, 0x76, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x7a, 0x7a, 0x7a, 0x7a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800,
+		0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0xdc, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x0, 0x0, 0x0, 0x0,
+		0x1b00, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x81, 0x82, 0x1b00, 0x84, 0x1b00, 0x1b00, 0x1800,
+		0x1b00, 0x1800, 0x82, 0x82, 0x82, 0x82, 0x0, 0x0, 0x82, 0x1b00, 0xe6, 0xe6, 0x9, 0x0, 0xe6, 0xe6, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x0, 0x0,
+		0x0, 0x0, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2400, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x7, 0x0, 0x9, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+		0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+		0x2400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2400,
+		0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+		0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xe6, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6,
+		0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0xdc, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc,
+		0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xdc, 0x0, 0xdc, 0xdc, 0xe6, 0xe6, 0xdc, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+		0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x900, 0x0, 0x900, 0x0, 0x900, 0x0, 0x900, 0x0, 0x0, 0x0, 0x900,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x2400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x900,
+		0x0, 0x0, 0x900, 0x900, 0x0, 0x900, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0xe6, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0x0, 0x1, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc,
+		0xdc, 0xe6, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0xe6, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+		0xdc, 0xe6, 0xe6, 0xea, 0xd6, 0xdc, 0xca, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+		0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+		0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe4, 0xe4, 0xdc, 0xda, 0xe6, 0xe9, 0xdc, 0xe6, 0xdc,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x1800, 0x1900, 0x0, 0x0, 0x0, 0x0, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x0, 0x900, 0x0, 0x900, 0x0, 0x900, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x1b00, 0x900, 0x1b00,
+		0x900, 0x1b00, 0x900, 0x1b00, 0x900, 0x1b00, 0x900, 0x1b00, 0x900, 0x1b00, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x900, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x1b00, 0x900, 0x1800, 0x1b00, 0x1800, 0x1800, 0x1900, 0x900,
+		0x900, 0x900, 0x0, 0x900, 0x900, 0x900, 0x1b00, 0x900, 0x1b00, 0x900, 0x1900, 0x1900, 0x1900, 0x900, 0x900,
+		0x900, 0x1b00, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x1b00, 0x0, 0x1900, 0x1900, 0x1900, 0x900, 0x900,
+		0x900, 0x1b00, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x1b00, 0x900, 0x1900, 0x1b00, 0x1b00, 0x0, 0x0,
+		0x900, 0x900, 0x900, 0x0, 0x900, 0x900, 0x900, 0x1b00, 0x900, 0x1b00, 0x900, 0x1b00, 0x1800, 0x0, 0x1b00,
+		0x1b00, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800,
+		0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x0, 0x1800,
+		0x1800, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x0,
+		0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0x1, 0x1, 0xe6, 0xe6, 0xe6, 0xe6, 0x1, 0x1, 0x1, 0xe6, 0xe6, 0x0,
+		0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x1, 0x1, 0xe6, 0xdc, 0xe6, 0x1, 0x1, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x0,
+		0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x0, 0x1800, 0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x1800,
+		0x0, 0x1800, 0x0, 0x1b00, 0x0, 0x1800, 0x0, 0x1b00, 0x1b00, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x0,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0,
+		0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x900, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x0, 0x900, 0x0, 0x0, 0x900, 0x0,
+		0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x900, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x900,
+		0x0, 0x0, 0x900, 0x900, 0x0, 0x0, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x0, 0x0, 0x900,
+		0x900, 0x0, 0x0, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x900,
+		0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x900,
+		0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x1b00, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b00,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+		0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+		0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0xda, 0xe4, 0xe8, 0xde, 0xe0, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x1800, 0x1800,
+		0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x900,
+		0x0, 0x900, 0x0, 0x900, 0x0, 0x900, 0x0, 0x900, 0x0, 0x900, 0x0, 0x900, 0x0, 0x900, 0x0, 0x900, 0x0, 0x900, 0x0,
+		0x900, 0x0, 0x0, 0x900, 0x0, 0x900, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x0, 0x900, 0x900,
+		0x0, 0x900, 0x900, 0x0, 0x900, 0x900, 0x0, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x2408, 0x2408, 0x1800,
+		0x1800, 0x0, 0x900, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x900, 0x0, 0x0, 0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x0, 0x900, 0x1800, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0,
+		0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x1800, 0x1800, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+		0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0xdc, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0xe6, 0xe6, 0xdc, 0x0, 0x0, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6,
+		0xe6, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x900, 0x900, 0x900, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00,
+		0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00,
+		0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00,
+		0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x0, 0x0, 0x1b00, 0x0,
+		0x1b00, 0x0, 0x0, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x0, 0x1b00,
+		0x0, 0x1b00, 0x0, 0x0, 0x1b00, 0x1b00, 0x0, 0x0, 0x0, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00,
+		0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00,
+		0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00,
+		0x1b00, 0x0, 0x0, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00,
+		0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00,
+		0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00,
+		0x1b00, 0x1b00, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x1b00, 0x1a, 0x1b00, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00,
+		0x0, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x0, 0x1b00, 0x0, 0x1b00, 0x1b00, 0x0, 0x1b00, 0x1b00, 0x0, 0x1b00,
+		0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x0, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x0,
+		0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6,
+		0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x1, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xdc,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0xdc, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0xdc, 0xe6,
+		0xe6, 0xe6, 0xdc, 0xe6, 0xdc, 0xdc, 0xdc, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0xe6, 0xdc, 0xe6, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x2407, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2400, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x900, 0x900, 0x0, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x0, 0x2400, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2400, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0,
+		0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+		0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x2400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2400, 0x900, 0x900, 0x2400, 0x900, 0x0, 0x0, 0x0,
+		0x9, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x2400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x900, 0x0, 0x0, 0x0, 0x9, 0x7, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x7, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x7, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2400, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x900, 0x0, 0x0, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x7, 0x0, 0x9, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x9,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00,
+		0x1b00, 0xd8, 0xd8, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0xe2, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc,
+		0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800,
+		0x1800, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x0,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x0,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0xe6, 0xe6, 0xe6, 0xe6,
+		0xe6, 0xe6, 0xe6, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+		0xe6, 0xe6, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0xe6, 0xe6, 0x0, 0xe6, 0xe6, 0xe6, 0xe6,
+		0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0xe8, 0xe8, 0xdc, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0xdc, 0xdc,
+		0xdc, 0xdc, 0xdc, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6,
+		0xe6, 0xe6, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x1800, 0x1800, 0x0, 0x1800, 0x0, 0x0, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x0, 0x1800, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x0, 0x1800, 0x0, 0x1800, 0x0, 0x1800, 0x1800, 0x1800,
+		0x0, 0x1800, 0x1800, 0x0, 0x1800, 0x0, 0x0, 0x1800, 0x0, 0x1800, 0x0, 0x1800, 0x0, 0x1800, 0x0, 0x1800, 0x0,
+		0x1800, 0x1800, 0x0, 0x1800, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800,
+		0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
+		0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1800, 0x1800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00,
+		0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00,
+		0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x1b00, 0x0, 0x0
+		}
+	};
+
+	// index of the full decomposition in kDecompositionPool, 0 if the code point maps to itself
+	// hangul syllables are left to the algorithmic decomposition
+	inline constexpr two_stage_table<uint16_t, 6, 3049, 5184> kCanonicalDecomposition{
+		0x0,
+		{
+		0x0, 0x0, 0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x0, 0x0, 0x0, 0x0, 0x7, 0x8, 0x9, 0xa, 0xb, 0x0, 0xc, 0x0, 0x0,
+		0x0, 0x0, 0xd, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x10, 0x0, 0x11, 0x12, 0x13, 0x0,
+		0x0, 0x0, 0x14, 0x15, 0x16, 0x0, 0x17, 0x0, 0x18, 0x0, 0x19, 0x0, 0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0x1c,
+		0x0, 0x1d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x1e, 0x1f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+		0x27, 0x28, 0x0, 0x0, 0x0, 0x29, 0x0, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x32, 0x33, 0x34, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c,
+		0x3d, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x0,
+		0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x41, 0x0, 0x0, 0x0, 0x0, 0x42, 0x0, 0x0, 0x0, 0x43, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x45, 0x46, 0x47, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+		0x50
+		},
+		{
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0x2a,
+		0x2d, 0x30, 0x33, 0x36, 0x0, 0x39, 0x3c, 0x3f, 0x42, 0x45, 0x48, 0x4b, 0x4e, 0x51, 0x0, 0x54, 0x57, 0x5a, 0x5d,
+		0x60, 0x63, 0x0, 0x0, 0x66, 0x69, 0x6c, 0x6f, 0x72, 0x0, 0x0, 0x75, 0x78, 0x7b, 0x7e, 0x81, 0x84, 0x0, 0x87,
+		0x8a, 0x8d, 0x90, 0x93, 0x96, 0x99, 0x9c, 0x9f, 0x0, 0xa2, 0xa5, 0xa8, 0xab, 0xae, 0xb1, 0x0, 0x0, 0xb4, 0xb7,
+		0xba, 0xbd, 0xc0, 0x0, 0xc3, 0xc6, 0xc9, 0xcc, 0xcf, 0xd2, 0xd5, 0xd8, 0xdb, 0xde, 0xe1, 0xe4, 0xe7, 0xea, 0xed,
+		0xf0, 0xf3, 0x0, 0x0, 0xf6, 0xf9, 0xfc, 0xff, 0x102, 0x105, 0x108, 0x10b, 0x10e, 0x111, 0x114, 0x117, 0x11a,
+		0x11d, 0x120, 0x123, 0x126, 0x129, 0x12c, 0x12f, 0x0, 0x0, 0x132, 0x135, 0x138, 0x13b, 0x13e, 0x141, 0x144,
+		0x147, 0x14a, 0x0, 0x0, 0x0, 0x153, 0x156, 0x159, 0x15c, 0x0, 0x15f, 0x162, 0x165, 0x168, 0x16b, 0x16e, 0x0,
+		0x0, 0x0, 0x0, 0x177, 0x17a, 0x17d, 0x180, 0x183, 0x186, 0x0, 0x0, 0x0, 0x18c, 0x18f, 0x192, 0x195, 0x198,
+		0x19b, 0x0, 0x0, 0x19e, 0x1a1, 0x1a4, 0x1a7, 0x1aa, 0x1ad, 0x1b0, 0x1b3, 0x1b6, 0x1b9, 0x1bc, 0x1bf, 0x1c2,
+		0x1c5, 0x1c8, 0x1cb, 0x1ce, 0x1d1, 0x0, 0x0, 0x1d4, 0x1d7, 0x1da, 0x1dd, 0x1e0, 0x1e3, 0x1e6, 0x1e9, 0x1ec,
+		0x1ef, 0x1f2, 0x1f5, 0x1f8, 0x1fb, 0x1fe, 0x201, 0x204, 0x207, 0x20a, 0x20d, 0x210, 0x213, 0x216, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21b, 0x21e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x221, 0x224, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x245, 0x248, 0x24b, 0x24e, 0x251, 0x254, 0x257, 0x25a,
+		0x25d, 0x261, 0x265, 0x269, 0x26d, 0x271, 0x275, 0x279, 0x0, 0x27d, 0x281, 0x285, 0x289, 0x28d, 0x290, 0x0, 0x0,
+		0x293, 0x296, 0x299, 0x29c, 0x29f, 0x2a2, 0x2a5, 0x2a9, 0x2ad, 0x2b0, 0x2b3, 0x0, 0x0, 0x0, 0x2bf, 0x2c2, 0x0,
+		0x0, 0x2c5, 0x2c8, 0x2cb, 0x2cf, 0x2d3, 0x2d6, 0x2d9, 0x2dc, 0x2df, 0x2e2, 0x2e5, 0x2e8, 0x2eb, 0x2ee, 0x2f1,
+		0x2f4, 0x2f7, 0x2fa, 0x2fd, 0x300, 0x303, 0x306, 0x309, 0x30c, 0x30f, 0x312, 0x315, 0x318, 0x31b, 0x31e, 0x321,
+		0x324, 0x327, 0x32a, 0x32d, 0x330, 0x0, 0x0, 0x333, 0x336, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x339, 0x33c, 0x33f,
+		0x342, 0x345, 0x349, 0x34d, 0x351, 0x355, 0x358, 0x35b, 0x35f, 0x363, 0x366, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x395, 0x397, 0x0, 0x399, 0x39b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x3a3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a5, 0x3ac, 0x3af, 0x3b1, 0x3b4, 0x3b7, 0x0, 0x3ba, 0x0, 0x3bd,
+		0x3c0, 0x3c3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c7, 0x3ca, 0x3cd, 0x3d0, 0x3d3, 0x3d6, 0x3d9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3dd, 0x3e0,
+		0x3e3, 0x3e6, 0x3e9, 0x0, 0x0, 0x0, 0x0, 0x3f2, 0x3f5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x408, 0x40b, 0x0, 0x40e, 0x0, 0x0, 0x0, 0x411, 0x0, 0x0, 0x0,
+		0x0, 0x414, 0x417, 0x41a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x41d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x423, 0x426, 0x0, 0x429, 0x0, 0x0, 0x0, 0x42c, 0x0, 0x0, 0x0, 0x0, 0x42f, 0x432, 0x435,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x438, 0x43b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x43e, 0x441, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x444, 0x447, 0x44a, 0x44d, 0x0, 0x0, 0x450, 0x453, 0x0, 0x0, 0x456, 0x459, 0x45c,
+		0x45f, 0x462, 0x465, 0x0, 0x0, 0x468, 0x46b, 0x46e, 0x471, 0x474, 0x477, 0x0, 0x0, 0x47a, 0x47d, 0x480, 0x483,
+		0x486, 0x489, 0x48c, 0x48f, 0x492, 0x495, 0x498, 0x49b, 0x0, 0x0, 0x49e, 0x4a1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a7, 0x4aa, 0x4ad, 0x4b0, 0x4b3, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x4c2, 0x0, 0x4c5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c8, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4cb, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x4ce, 0x0, 0x0, 0x4d1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x4d4, 0x4d7, 0x4da, 0x4dd, 0x4e0, 0x4e3, 0x4e6, 0x4e9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec, 0x4ef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f2, 0x4f5, 0x0, 0x4f8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4fb, 0x0, 0x0, 0x4fe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x501, 0x504, 0x507, 0x0, 0x0, 0x50a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x50d, 0x0, 0x0, 0x510, 0x513, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x516, 0x519, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x51c, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x51f, 0x522, 0x525, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x528, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x52b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x52e, 0x531, 0x0, 0x534, 0x537, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x53b, 0x53e, 0x541, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x544, 0x0, 0x547, 0x54a,
+		0x54e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x562, 0x0, 0x0, 0x0, 0x0, 0x565, 0x0, 0x0, 0x0, 0x0, 0x568, 0x0, 0x0, 0x0, 0x0, 0x56b, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x571,
+		0x0, 0x574, 0x577, 0x0, 0x57e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x585, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x588, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58b,
+		0x0, 0x0, 0x0, 0x0, 0x58e, 0x0, 0x0, 0x0, 0x0, 0x591, 0x0, 0x0, 0x0, 0x0, 0x594, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x597, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59f, 0x0, 0x5a2, 0x0,
+		0x5a5, 0x0, 0x5a8, 0x0, 0x5ab, 0x0, 0x0, 0x0, 0x5ae, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b1, 0x0, 0x5b4, 0x0, 0x0, 0x5b7, 0x5ba, 0x0, 0x5bd, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x668, 0x66b, 0x66e, 0x671, 0x674, 0x677, 0x67a, 0x67d,
+		0x680, 0x684, 0x688, 0x68b, 0x68e, 0x691, 0x694, 0x697, 0x69a, 0x69d, 0x6a0, 0x6a3, 0x6a6, 0x6aa, 0x6ae, 0x6b2,
+		0x6b6, 0x6b9, 0x6bc, 0x6bf, 0x6c2, 0x6c6, 0x6ca, 0x6cd, 0x6d0, 0x6d3, 0x6d6, 0x6d9, 0x6dc, 0x6df, 0x6e2, 0x6e5,
+		0x6e8, 0x6eb, 0x6ee, 0x6f1, 0x6f4, 0x6f7, 0x6fa, 0x6fe, 0x702, 0x705, 0x708, 0x70b, 0x70e, 0x711, 0x714, 0x717,
+		0x71a, 0x71e, 0x722, 0x725, 0x728, 0x72b, 0x72e, 0x731, 0x734, 0x737, 0x73a, 0x73d, 0x740, 0x743, 0x746, 0x749,
+		0x74c, 0x74f, 0x752, 0x755, 0x758, 0x75c, 0x760, 0x764, 0x768, 0x76c, 0x770, 0x774, 0x778, 0x77b, 0x77e, 0x781,
+		0x784, 0x787, 0x78a, 0x78d, 0x790, 0x794, 0x798, 0x79b, 0x79e, 0x7a1, 0x7a4, 0x7a7, 0x7aa, 0x7ae, 0x7b2, 0x7b6,
+		0x7ba, 0x7be, 0x7c2, 0x7c5, 0x7c8, 0x7cb, 0x7ce, 0x7d1, 0x7d4, 0x7d7, 0x7da, 0x7dd, 0x7e0, 0x7e3, 0x7e6, 0x7e9,
+		0x7ec, 0x7f0, 0x7f4, 0x7f8, 0x7fc, 0x7ff, 0x802, 0x805, 0x808, 0x80b, 0x80e, 0x811, 0x814, 0x817, 0x81a, 0x81d,
+		0x820, 0x823, 0x826, 0x829, 0x82c, 0x82f, 0x832, 0x835, 0x838, 0x83b, 0x83e, 0x841, 0x844, 0x847, 0x84a, 0x84d,
+		0x850, 0x853, 0x0, 0x859, 0x0, 0x0, 0x0, 0x0, 0x85c, 0x85f, 0x862, 0x865, 0x868, 0x86c, 0x870, 0x874, 0x878,
+		0x87c, 0x880, 0x884, 0x888, 0x88c, 0x890, 0x894, 0x898, 0x89c, 0x8a0, 0x8a4, 0x8a8, 0x8ac, 0x8b0, 0x8b4, 0x8b8,
+		0x8bb, 0x8be, 0x8c1, 0x8c4, 0x8c7, 0x8ca, 0x8ce, 0x8d2, 0x8d6, 0x8da, 0x8de, 0x8e2, 0x8e6, 0x8ea, 0x8ee, 0x8f2,
+		0x8f5, 0x8f8, 0x8fb, 0x8fe, 0x901, 0x904, 0x907, 0x90a, 0x90e, 0x912, 0x916, 0x91a, 0x91e, 0x922, 0x926, 0x92a,
+		0x92e, 0x932, 0x936, 0x93a, 0x93e, 0x942, 0x946, 0x94a, 0x94e, 0x952, 0x956, 0x95a, 0x95d, 0x960, 0x963, 0x966,
+		0x96a, 0x96e, 0x972, 0x976, 0x97a, 0x97e, 0x982, 0x986, 0x98a, 0x98e, 0x991, 0x994, 0x997, 0x99a, 0x99d, 0x9a0,
+		0x9a3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9a6, 0x9a9, 0x9ac, 0x9b0, 0x9b4, 0x9b8, 0x9bc, 0x9c0, 0x9c4, 0x9c7,
+		0x9ca, 0x9ce, 0x9d2, 0x9d6, 0x9da, 0x9de, 0x9e2, 0x9e5, 0x9e8, 0x9ec, 0x9f0, 0x9f4, 0x0, 0x0, 0x9f8, 0x9fb,
+		0x9fe, 0xa02, 0xa06, 0xa0a, 0x0, 0x0, 0xa0e, 0xa11, 0xa14, 0xa18, 0xa1c, 0xa20, 0xa24, 0xa28, 0xa2c, 0xa2f,
+		0xa32, 0xa36, 0xa3a, 0xa3e, 0xa42, 0xa46, 0xa4a, 0xa4d, 0xa50, 0xa54, 0xa58, 0xa5c, 0xa60, 0xa64, 0xa68, 0xa6b,
+		0xa6e, 0xa72, 0xa76, 0xa7a, 0xa7e, 0xa82, 0xa86, 0xa89, 0xa8c, 0xa90, 0xa94, 0xa98, 0x0, 0x0, 0xa9c, 0xa9f,
+		0xaa2, 0xaa6, 0xaaa, 0xaae, 0x0, 0x0, 0xab2, 0xab5, 0xab8, 0xabc, 0xac0, 0xac4, 0xac8, 0xacc, 0x0, 0xad0, 0x0,
+		0xad3, 0x0, 0xad7, 0x0, 0xadb, 0xadf, 0xae2, 0xae5, 0xae9, 0xaed, 0xaf1, 0xaf5, 0xaf9, 0xafd, 0xb00, 0xb03,
+		0xb07, 0xb0b, 0xb0f, 0xb13, 0xb17, 0xb1b, 0x3cd, 0xb1e, 0x3d0, 0xb21, 0x3d3, 0xb24, 0x3d6, 0xb27, 0x3e3, 0xb2a,
+		0x3e6, 0xb2d, 0x3e9, 0x0, 0x0, 0xb30, 0xb34, 0xb38, 0xb3d, 0xb42, 0xb47, 0xb4c, 0xb51, 0xb56, 0xb5a, 0xb5e,
+		0xb63, 0xb68, 0xb6d, 0xb72, 0xb77, 0xb7c, 0xb80, 0xb84, 0xb89, 0xb8e, 0xb93, 0xb98, 0xb9d, 0xba2, 0xba6, 0xbaa,
+		0xbaf, 0xbb4, 0xbb9, 0xbbe, 0xbc3, 0xbc8, 0xbcc, 0xbd0, 0xbd5, 0xbda, 0xbdf, 0xbe4, 0xbe9, 0xbee, 0xbf2, 0xbf6,
+		0xbfb, 0xc00, 0xc05, 0xc0a, 0xc0f, 0xc14, 0xc17, 0xc1a, 0xc1e, 0xc21, 0x0, 0xc25, 0xc28, 0xc2c, 0xc2f, 0xc32,
+		0x3ac, 0xc35, 0x0, 0xc3b, 0x0, 0x0, 0xc40, 0xc47, 0xc4b, 0xc4e, 0x0, 0xc52, 0xc55, 0xc59, 0x3b1, 0xc5c, 0x3b4,
+		0xc5f, 0xc62, 0xc69, 0xc70, 0xc77, 0xc7a, 0xc7d, 0x3c3, 0x0, 0x0, 0xc81, 0xc84, 0xc88, 0xc8b, 0xc8e, 0x3b7, 0x0,
+		0xc91, 0xc98, 0xc9f, 0xca6, 0xca9, 0xcac, 0x3d9, 0xcb0, 0xcb3, 0xcb6, 0xcb9, 0xcbd, 0xcc0, 0xcc3, 0x3bd, 0xcc6,
+		0xcc9, 0x3a5, 0xcd0, 0x0, 0x0, 0xcd2, 0xcd6, 0xcd9, 0x0, 0xcdd, 0xce0, 0xce4, 0x3ba, 0xce7, 0x3c0, 0xcea, 0xced,
+		0x0, 0x0, 0xcf2, 0xcf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd70, 0x0, 0x0, 0x0,
+		0x5d4, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0xe0e, 0xe11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0xe14, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe17, 0xe1a, 0xe1d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0xe20, 0x0, 0x0, 0x0, 0x0, 0xe23, 0x0, 0x0, 0xe26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe29, 0x0, 0xe2c, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe3d,
+		0x0, 0x0, 0xe40, 0x0, 0x0, 0xe43, 0x0, 0xe46, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe49, 0x0, 0xe4c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0xe4f, 0xe52, 0xe55, 0xe58, 0xe5b, 0x0, 0x0, 0xe5e, 0xe61, 0x0, 0x0, 0xe64, 0xe67, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0xe6a, 0xe6d, 0x0, 0x0, 0xe70, 0xe73, 0x0, 0x0, 0xe76, 0xe79, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0xe7c, 0xe7f, 0xe82, 0xe85, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe88, 0xe8b, 0xe8e, 0xe91, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0xe94, 0xe97, 0xe9a, 0xe9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea0,
+		0xea2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11a0, 0x0, 0x11a3, 0x0, 0x11a6, 0x0, 0x11a9, 0x0, 0x11ac,
+		0x0, 0x11af, 0x0, 0x11b2, 0x0, 0x11b5, 0x0, 0x11b8, 0x0, 0x11bb, 0x0, 0x11be, 0x0, 0x11c1, 0x0, 0x0, 0x11c4,
+		0x0, 0x11c7, 0x0, 0x11ca, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11cd, 0x11d0, 0x0, 0x11d3, 0x11d6, 0x0, 0x11d9,
+		0x11dc, 0x0, 0x11df, 0x11e2, 0x0, 0x11e5, 0x11e8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11eb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11f4,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11fa, 0x0, 0x11fd, 0x0, 0x1200, 0x0, 0x1203,
+		0x0, 0x1206, 0x0, 0x1209, 0x0, 0x120c, 0x0, 0x120f, 0x0, 0x1212, 0x0, 0x1215, 0x0, 0x1218, 0x0, 0x121b, 0x0,
+		0x0, 0x121e, 0x0, 0x1221, 0x0, 0x1224, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1227, 0x122a, 0x0, 0x122d, 0x1230, 0x0,
+		0x1233, 0x1236, 0x0, 0x1239, 0x123c, 0x0, 0x123f, 0x1242, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1245, 0x0, 0x0, 0x1248, 0x124b, 0x124e, 0x1251, 0x0,
+		0x0, 0x0, 0x1254, 0x0, 0x19d2, 0x19d4, 0x112a, 0x19d6, 0x19d8, 0x19da, 0x19dc, 0x1196, 0x1196, 0x19de, 0x113a,
+		0x19e0, 0x19e2, 0x19e4, 0x19e6, 0x19e8, 0x19ea, 0x19ec, 0x19ee, 0x19f0, 0x19f2, 0x19f4, 0x19f6, 0x19f8, 0x19fa,
+		0x19fc, 0x19fe, 0x1a00, 0x1a02, 0x1a04, 0x1a06, 0x1a08, 0x1a0a, 0x1a0c, 0x1a0e, 0x1a10, 0x1a12, 0x1a14, 0x1a16,
+		0x1a18, 0x1a1a, 0x1a1c, 0x1a1e, 0x1a20, 0x1a22, 0x1a24, 0x1a26, 0x1a28, 0x1a2a, 0x1a2c, 0x1a2e, 0x1a30, 0x10e6,
+		0x1a32, 0x1a34, 0x1a36, 0x1a38, 0x1a3a, 0x1a3c, 0x1a3e, 0x1a40, 0x1a42, 0x1a44, 0x1a46, 0x1178, 0x1a48, 0x1a4a,
+		0x1a4c, 0x1a4e, 0x1a50, 0x1a52, 0x1a54, 0x1a56, 0x1a58, 0x1a5a, 0x1a5c, 0x1a5e, 0x1a60, 0x1a62, 0x1a64, 0x1a66,
+		0x1a68, 0x1a6a, 0x1a6c, 0x1a6e, 0x1a70, 0x1a72, 0x1a74, 0x1a76, 0x1a78, 0x1a7a, 0x1a7c, 0x19f2, 0x1a7e, 0x1a80,
+		0x1a82, 0x1a84, 0x1a86, 0x1a88, 0x1a8a, 0x1a8c, 0x1a8e, 0x1a90, 0x1a92, 0x1a94, 0x1a96, 0x1a98, 0x1a9a, 0x1a9c,
+		0x1a9e, 0x1aa0, 0x1aa2, 0x1aa4, 0x112e, 0x1aa6, 0x1aa8, 0x1aaa, 0x1aac, 0x1aae, 0x1ab0, 0x1ab2, 0x1ab4, 0x1ab6,
+		0x1ab8, 0x1aba, 0x1abc, 0x1abe, 0x1ac0, 0x1ac2, 0x1038, 0x1ac4, 0x1ac6, 0x1ac8, 0x1aca, 0x1acc, 0x1ace, 0x1ad0,
+		0x1ad2, 0x1012, 0x1ad4, 0x1ad6, 0x1ad8, 0x1ada, 0x1adc, 0x1ade, 0x1ae0, 0x1ae2, 0x1ae4, 0x1ae6, 0x1ae8, 0x1aea,
+		0x1aec, 0x1aee, 0x1af0, 0x1af2, 0x1af4, 0x1af6, 0x1af8, 0x1afa, 0x1afc, 0x1afe, 0x1aa2, 0x1b00, 0x1b02, 0x1b04,
+		0x1b06, 0x1b08, 0x1b0a, 0x1b0c, 0x1b0e, 0x1a82, 0x1b10, 0x1b12, 0x1b14, 0x1b16, 0x1b18, 0x1b1a, 0x1b1c, 0x1b1e,
+		0x1b20, 0x1b22, 0x1b24, 0x1b26, 0x1b28, 0x1b2a, 0x1b2c, 0x1b2e, 0x1b30, 0x1b32, 0x1b34, 0x1b36, 0x19f2, 0x1b38,
+		0x1b3a, 0x1b3c, 0x1b3e, 0x1194, 0x1b40, 0x1b42, 0x1b44, 0x1b46, 0x1b48, 0x1b4a, 0x1b4c, 0x1b4e, 0x1b50, 0x1b52,
+		0x1b54, 0x1b56, 0x14bd, 0x1b58, 0x1b5a, 0x1b5c, 0x1b5e, 0x1b60, 0x1b62, 0x1b64, 0x1b66, 0x1b68, 0x1a86, 0x1b6a,
+		0x1b6c, 0x1b6e, 0x1b70, 0x1b72, 0x1b74, 0x1b76, 0x1b78, 0x1b7a, 0x1b7c, 0x1b7e, 0x1b80, 0x1b82, 0x1138, 0x1b84,
+		0x1b86, 0x1b88, 0x1b8a, 0x1b8c, 0x1b8e, 0x1b90, 0x1b92, 0x1b94, 0x1b96, 0x1b98, 0x1b9a, 0x1b9c, 0x10d6, 0x1b9e,
+		0x1ba0, 0x1ba2, 0x1ba4, 0x1ba6, 0x1ba8, 0x1baa, 0x1bac, 0x1bae, 0x1bb0, 0x1bb2, 0x1bb4, 0x1bb6, 0x1bb8, 0x1bba,
+		0x1bbc, 0x110c, 0x1bbe, 0x1112, 0x1bc0, 0x1bc2, 0x1bc4, 0x0, 0x0, 0x1bc6, 0x0, 0x1bc8, 0x0, 0x0, 0x1bca, 0x1bcc,
+		0x1bce, 0x1bd0, 0x1bd2, 0x1bd4, 0x1bd6, 0x1bd8, 0x1bda, 0x10e4, 0x0, 0x1bdc, 0x0, 0x1bde, 0x0, 0x0, 0x1be0,
+		0x1be2, 0x0, 0x0, 0x0, 0x1be4, 0x1be6, 0x1be8, 0x1bea, 0x1bec, 0x1bee, 0x1bf0, 0x1bf2, 0x1bf4, 0x1bf6, 0x1bf8,
+		0x1bfa, 0x1bfc, 0x1bfe, 0x1c00, 0x1c02, 0x1c04, 0x1c06, 0x1046, 0x1c08, 0x1c0a, 0x1c0c, 0x1c0e, 0x1c10, 0x1c12,
+		0x1c14, 0x1c16, 0x1c18, 0x1c1a, 0x1c1c, 0x1c1e, 0x1c20, 0x1c22, 0x1c24, 0x14c7, 0x1c26, 0x1c28, 0x1c2a, 0x1c2c,
+		0x14cf, 0x1c2e, 0x1c30, 0x1c32, 0x1c34, 0x1c36, 0x1aea, 0x1c38, 0x1c3a, 0x1c3c, 0x1c3e, 0x1c40, 0x1c42, 0x1c42,
+		0x1c44, 0x1c46, 0x1c48, 0x1c4a, 0x1c4c, 0x1c4e, 0x1c50, 0x1c52, 0x1be0, 0x1c54, 0x1c56, 0x1c58, 0x1c5a, 0x1c5c,
+		0x1c5e, 0x0, 0x0, 0x1c60, 0x1c62, 0x1c64, 0x1c66, 0x1c68, 0x1c6a, 0x1c6c, 0x1c6e, 0x1bfc, 0x1c70, 0x1c72,
+		0x1c74, 0x1bc6, 0x1c76, 0x1c78, 0x1c7a, 0x1c7c, 0x1c7e, 0x1c80, 0x1c82, 0x1c84, 0x1c86, 0x1c88, 0x1c8a, 0x1c8c,
+		0x1c0c, 0x1c8e, 0x1c0e, 0x1c90, 0x1c92, 0x1c94, 0x1c96, 0x1c98, 0x1bc8, 0x1a1c, 0x1c9a, 0x1c9c, 0x1088, 0x1aa4,
+		0x1b4a, 0x1c9e, 0x1ca0, 0x1c1c, 0x1ca2, 0x1c1e, 0x1ca4, 0x1ca6, 0x1ca8, 0x1bcc, 0x1caa, 0x1cac, 0x1cae, 0x1cb0,
+		0x1cb2, 0x1bce, 0x1cb4, 0x1cb6, 0x1cb8, 0x1cba, 0x1cbc, 0x1cbe, 0x1c36, 0x1cc0, 0x1cc2, 0x1aea, 0x1cc4, 0x1c3e,
+		0x1cc6, 0x1cc8, 0x1cca, 0x1ccc, 0x1cce, 0x1c48, 0x1cd0, 0x1bde, 0x1cd2, 0x1c4a, 0x1a7e, 0x1cd4, 0x1c4c, 0x1cd6,
+		0x1c50, 0x1cd8, 0x1cda, 0x1cdc, 0x1cde, 0x1ce0, 0x1c54, 0x1bd8, 0x1ce2, 0x1c56, 0x1ce4, 0x1c58, 0x1ce6, 0x1196,
+		0x1ce8, 0x1cea, 0x1cec, 0x1cee, 0x1cf0, 0x1cf2, 0x1cf4, 0x1cf6, 0x1cf8, 0x1cfa, 0x1cfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d21, 0x0, 0x1d24,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d35, 0x1d38, 0x1d3b, 0x1d3f, 0x1d43, 0x1d46, 0x1d49,
+		0x1d4c, 0x1d4f, 0x1d52, 0x1d55, 0x1d58, 0x1d5b, 0x0, 0x1d5e, 0x1d61, 0x1d64, 0x1d67, 0x1d6a, 0x0, 0x1d6d, 0x0,
+		0x1d70, 0x1d73, 0x0, 0x1d76, 0x1d79, 0x0, 0x1d7c, 0x1d7f, 0x1d82, 0x1d85, 0x1d88, 0x1d8b, 0x1d8e, 0x1d91,
+		0x1d94, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2333, 0x0, 0x2336, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2339, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x233c, 0x233f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2342, 0x2345, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2348, 0x234b, 0x0,
+		0x234e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2351, 0x2354, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2357, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x235a, 0x235d, 0x2360, 0x2364, 0x2368, 0x236c, 0x2370, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2374, 0x2377, 0x237a, 0x237e,
+		0x2382, 0x2386, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x253f, 0x2541, 0x2543, 0x2545, 0x2547, 0x1bf0, 0x2549, 0x254b, 0x254d, 0x254f, 0x1bf2, 0x2551, 0x2553, 0x2555,
+		0x1bf4, 0x2557, 0x2559, 0x255b, 0x255d, 0x255f, 0x2561, 0x24ed, 0x2563, 0x2565, 0x2567, 0x2569, 0x256b, 0x1c62,
+		0x256d, 0x100e, 0x256f, 0x2571, 0x2573, 0x2575, 0x2511, 0x2577, 0x2579, 0x1c6c, 0x1bf6, 0x1bf8, 0x1c6e, 0x257b,
+		0x257d, 0x1a8a, 0x257f, 0x1bfa, 0x2581, 0x2583, 0x2585, 0x2587, 0x2587, 0x2587, 0x2589, 0x258b, 0x258d, 0x258f,
+		0x2591, 0x2593, 0x2595, 0x2597, 0x2599, 0x259b, 0x259d, 0x259f, 0x25a1, 0x25a3, 0x25a5, 0x25a7, 0x25a9, 0x25ab,
+		0x25ab, 0x1c72, 0x25ad, 0x25af, 0x25b1, 0x25b3, 0x1bfe, 0x25b5, 0x25b7, 0x25b9, 0x1bae, 0x25bb, 0x25bd, 0x25bf,
+		0x25c1, 0x25c3, 0x25c5, 0x25c7, 0x25c9, 0x25cb, 0x25cd, 0x25cf, 0x25d1, 0x24df, 0x25d3, 0x25d5, 0x25d7, 0x25d9,
+		0x25db, 0x25dd, 0x25df, 0x25e1, 0x25e3, 0x25e5, 0x25e7, 0x25e9, 0x25eb, 0x25eb, 0x25ed, 0x25ef, 0x25f1, 0x1a82,
+		0x25f3, 0x25f5, 0x25f7, 0x25f9, 0x25fb, 0x1042, 0x25fd, 0x25ff, 0x1046, 0x2601, 0x2603, 0x2605, 0x2607, 0x2609,
+		0x260b, 0x260d, 0x260f, 0x2611, 0x2613, 0x2615, 0x2617, 0x2619, 0x261b, 0x261d, 0x261f, 0x2621, 0x2623, 0x2625,
+		0x2627, 0x2629, 0x1a1a, 0x262b, 0x105a, 0x262d, 0x262d, 0x262f, 0x2631, 0x2631, 0x2633, 0x2635, 0x2637, 0x2639,
+		0x263b, 0x263d, 0x263f, 0x2641, 0x2643, 0x2645, 0x2647, 0x2649, 0x264b, 0x1c08, 0x264d, 0x264f, 0x2651, 0x2653,
+		0x1c8a, 0x2653, 0x2655, 0x1c0c, 0x2657, 0x2659, 0x265b, 0x265d, 0x1c0e, 0x19e4, 0x265f, 0x2661, 0x2663, 0x2665,
+		0x2667, 0x2669, 0x266b, 0x266d, 0x266f, 0x2671, 0x2673, 0x2675, 0x2677, 0x2679, 0x267b, 0x267d, 0x267f, 0x2681,
+		0x2683, 0x2685, 0x2687, 0x2689, 0x1c10, 0x268b, 0x268d, 0x268f, 0x2691, 0x2693, 0x2695, 0x1c14, 0x2697, 0x2699,
+		0x269b, 0x269d, 0x269f, 0x26a1, 0x26a3, 0x26a5, 0x1a1c, 0x1c9a, 0x26a7, 0x26a9, 0x26ab, 0x26ad, 0x26af, 0x26b1,
+		0x26b3, 0x26b5, 0x1c16, 0x26b7, 0x26b9, 0x26bb, 0x26bd, 0x1cee, 0x26bf, 0x26c1, 0x26c3, 0x26c5, 0x26c7, 0x26c9,
+		0x26cb, 0x26cd, 0x26cf, 0x26d1, 0x26d3, 0x26d5, 0x26d7, 0x1aa4, 0x26d9, 0x26db, 0x26dd, 0x26df, 0x26e1, 0x26e3,
+		0x26e5, 0x26e7, 0x26e9, 0x26eb, 0x26ed, 0x1c18, 0x1b4a, 0x26ef, 0x26f1, 0x26f3, 0x26f5, 0x26f7, 0x26f9, 0x26fb,
+		0x26fd, 0x1ca0, 0x26ff, 0x2701, 0x2703, 0x2705, 0x2707, 0x2709, 0x270b, 0x270d, 0x1ca2, 0x270f, 0x2711, 0x2713,
+		0x2715, 0x2717, 0x2719, 0x271b, 0x271d, 0x271f, 0x2721, 0x2723, 0x2725, 0x1ca6, 0x2727, 0x2729, 0x272b, 0x272d,
+		0x272f, 0x2731, 0x2733, 0x2735, 0x2737, 0x2739, 0x273b, 0x273b, 0x273d, 0x273f, 0x1caa, 0x2741, 0x2743, 0x2745,
+		0x2747, 0x2749, 0x274b, 0x274d, 0x1a88, 0x274f, 0x2751, 0x2753, 0x2755, 0x2757, 0x2759, 0x275b, 0x1cb6, 0x275d,
+		0x275f, 0x2761, 0x2763, 0x2765, 0x2767, 0x2767, 0x1cb8, 0x1cf2, 0x2769, 0x276b, 0x276d, 0x276f, 0x2771, 0x1a3e,
+		0x1cbc, 0x2773, 0x2775, 0x1c2c, 0x2777, 0x2779, 0x1bd6, 0x277b, 0x277d, 0x1c32, 0x277f, 0x2781, 0x2783, 0x2785,
+		0x2785, 0x2787, 0x2789, 0x278b, 0x278d, 0x278f, 0x2791, 0x2793, 0x2795, 0x2797, 0x2799, 0x279b, 0x279d, 0x279f,
+		0x27a1, 0x27a3, 0x27a5, 0x27a7, 0x27a9, 0x27ab, 0x27ad, 0x27af, 0x27b1, 0x27b3, 0x27b5, 0x27b7, 0x27b9, 0x27bb,
+		0x1c3e, 0x27bd, 0x27bf, 0x27c1, 0x27c3, 0x27c5, 0x27c7, 0x27c9, 0x27cb, 0x27cd, 0x27cf, 0x27d1, 0x27d3, 0x27d5,
+		0x27d7, 0x27d9, 0x27db, 0x262f, 0x27dd, 0x27df, 0x27e1, 0x27e3, 0x27e5, 0x27e7, 0x27e9, 0x27eb, 0x27ed, 0x27ef,
+		0x27f1, 0x27f3, 0x1aaa, 0x27f5, 0x27f7, 0x27f9, 0x27fb, 0x27fd, 0x27ff, 0x1c44, 0x2801, 0x2803, 0x2805, 0x2807,
+		0x2809, 0x280b, 0x280d, 0x280f, 0x2811, 0x2813, 0x2815, 0x2817, 0x2819, 0x281b, 0x281d, 0x281f, 0x2821, 0x2823,
+		0x2825, 0x2827, 0x1a34, 0x2829, 0x282b, 0x282d, 0x282f, 0x2831, 0x2833, 0x1cca, 0x2835, 0x2837, 0x2839, 0x283b,
+		0x283d, 0x283f, 0x2841, 0x2843, 0x110e, 0x2845, 0x2847, 0x2849, 0x284b, 0x284d, 0x284f, 0x2851, 0x2853, 0x2855,
+		0x2857, 0x2859, 0x1cd4, 0x1cd6, 0x111c, 0x285b, 0x285d, 0x285f, 0x2861, 0x2863, 0x2865, 0x2867, 0x2869, 0x286b,
+		0x286d, 0x286f, 0x2871, 0x1cd8, 0x2873, 0x2875, 0x2877, 0x2879, 0x287b, 0x287d, 0x287f, 0x2881, 0x2883, 0x2885,
+		0x2887, 0x2889, 0x288b, 0x288d, 0x288f, 0x2891, 0x2893, 0x2895, 0x2897, 0x2899, 0x289b, 0x289d, 0x289f, 0x28a1,
+		0x28a3, 0x28a5, 0x28a7, 0x28a9, 0x28ab, 0x28ad, 0x1ce4, 0x1ce4, 0x28af, 0x28b1, 0x28b3, 0x28b5, 0x28b7, 0x28b9,
+		0x28bb, 0x28bd, 0x28bf, 0x28c1, 0x1ce6, 0x28c3, 0x28c5, 0x28c7, 0x28c9, 0x28cb, 0x28cd, 0x28cf, 0x28d1, 0x28d3,
+		0x28d5, 0x117c, 0x28d7, 0x1184, 0x28d9, 0x28db, 0x28dd, 0x28df, 0x118e, 0x28e1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+		}
+	};
+
+	inline constexpr two_stage_table<uint16_t, 6, 3049, 11008> kCompatDecomposition{
+		0x0,
+		{
+		0x0, 0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x0, 0x8, 0x9, 0x0, 0xa, 0xb, 0xc, 0xd, 0xe, 0x0, 0xf, 0x0, 0x0,
+		0x10, 0x0, 0x11, 0x12, 0x0, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x15, 0x0, 0x16, 0x17, 0x18,
+		0x0, 0x0, 0x0, 0x19, 0x1a, 0x1b, 0x0, 0x1c, 0x0, 0x1d, 0x0, 0x1e, 0x0, 0x1f, 0x20, 0x0, 0x21, 0x22, 0x23, 0x24,
+		0x25, 0x0, 0x26, 0x0, 0x0, 0x27, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x28, 0x29, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0x2b, 0x2c, 0x0, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32,
+		0x33, 0x34, 0x35, 0x36, 0x37, 0x0, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x0, 0x0, 0x0, 0x0,
+		0x41, 0x42, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x44, 0x45, 0x0, 0x46, 0x0, 0x0, 0x0, 0x0, 0x0, 0x47, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0, 0x0, 0x0, 0x49, 0x4a,
+		0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x0, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c,
+		0x5d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0x0, 0x0,
+		0x5f, 0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x62, 0x63, 0x64,
+		0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+		0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x81, 0x0, 0x0,
+		0x0, 0x0, 0x82, 0x0, 0x0, 0x0, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x84, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x85, 0x86, 0x87, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88,
+		0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x98, 0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9a, 0x9b, 0x9c, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x9e, 0x9f, 0x0, 0xa0, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab
+		},
+		{
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x6, 0x0, 0x0, 0x0,
+		0x0, 0x8, 0x0, 0x0, 0xb, 0xd, 0xf, 0x12, 0x0, 0x0, 0x14, 0x17, 0x19, 0x0, 0x1b, 0x1f, 0x23, 0x0, 0x27, 0x2a,
+		0x2d, 0x30, 0x33, 0x36, 0x0, 0x39, 0x3c, 0x3f, 0x42, 0x45, 0x48, 0x4b, 0x4e, 0x51, 0x0, 0x54, 0x57, 0x5a, 0x5d,
+		0x60, 0x63, 0x0, 0x0, 0x66, 0x69, 0x6c, 0x6f, 0x72, 0x0, 0x0, 0x75, 0x78, 0x7b, 0x7e, 0x81, 0x84, 0x0, 0x87,
+		0x8a, 0x8d, 0x90, 0x93, 0x96, 0x99, 0x9c, 0x9f, 0x0, 0xa2, 0xa5, 0xa8, 0xab, 0xae, 0xb1, 0x0, 0x0, 0xb4, 0xb7,
+		0xba, 0xbd, 0xc0, 0x0, 0xc3, 0xc6, 0xc9, 0xcc, 0xcf, 0xd2, 0xd5, 0xd8, 0xdb, 0xde, 0xe1, 0xe4, 0xe7, 0xea, 0xed,
+		0xf0, 0xf3, 0x0, 0x0, 0xf6, 0xf9, 0xfc, 0xff, 0x102, 0x105, 0x108, 0x10b, 0x10e, 0x111, 0x114, 0x117, 0x11a,
+		0x11d, 0x120, 0x123, 0x126, 0x129, 0x12c, 0x12f, 0x0, 0x0, 0x132, 0x135, 0x138, 0x13b, 0x13e, 0x141, 0x144,
+		0x147, 0x14a, 0x0, 0x14d, 0x150, 0x153, 0x156, 0x159, 0x15c, 0x0, 0x15f, 0x162, 0x165, 0x168, 0x16b, 0x16e,
+		0x171, 0x174, 0x0, 0x0, 0x177, 0x17a, 0x17d, 0x180, 0x183, 0x186, 0x189, 0x0, 0x0, 0x18c, 0x18f, 0x192, 0x195,
+		0x198, 0x19b, 0x0, 0x0, 0x19e, 0x1a1, 0x1a4, 0x1a7, 0x1aa, 0x1ad, 0x1b0, 0x1b3, 0x1b6, 0x1b9, 0x1bc, 0x1bf,
+		0x1c2, 0x1c5, 0x1c8, 0x1cb, 0x1ce, 0x1d1, 0x0, 0x0, 0x1d4, 0x1d7, 0x1da, 0x1dd, 0x1e0, 0x1e3, 0x1e6, 0x1e9,
+		0x1ec, 0x1ef, 0x1f2, 0x1f5, 0x1f8, 0x1fb, 0x1fe, 0x201, 0x204, 0x207, 0x20a, 0x20d, 0x210, 0x213, 0x216, 0x219,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21b, 0x21e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x221, 0x224, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x227, 0x22b, 0x22f, 0x233, 0x236, 0x239, 0x23c, 0x23f, 0x242, 0x245, 0x248, 0x24b, 0x24e,
+		0x251, 0x254, 0x257, 0x25a, 0x25d, 0x261, 0x265, 0x269, 0x26d, 0x271, 0x275, 0x279, 0x0, 0x27d, 0x281, 0x285,
+		0x289, 0x28d, 0x290, 0x0, 0x0, 0x293, 0x296, 0x299, 0x29c, 0x29f, 0x2a2, 0x2a5, 0x2a9, 0x2ad, 0x2b0, 0x2b3,
+		0x2b6, 0x2b9, 0x2bc, 0x2bf, 0x2c2, 0x0, 0x0, 0x2c5, 0x2c8, 0x2cb, 0x2cf, 0x2d3, 0x2d6, 0x2d9, 0x2dc, 0x2df,
+		0x2e2, 0x2e5, 0x2e8, 0x2eb, 0x2ee, 0x2f1, 0x2f4, 0x2f7, 0x2fa, 0x2fd, 0x300, 0x303, 0x306, 0x309, 0x30c, 0x30f,
+		0x312, 0x315, 0x318, 0x31b, 0x31e, 0x321, 0x324, 0x327, 0x32a, 0x32d, 0x330, 0x0, 0x0, 0x333, 0x336, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x339, 0x33c, 0x33f, 0x342, 0x345, 0x349, 0x34d, 0x351, 0x355, 0x358, 0x35b, 0x35f, 0x363,
+		0x366, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x369, 0x36b, 0x36d, 0x36f,
+		0x371, 0x373, 0x375, 0x377, 0x379, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37b, 0x37e, 0x381, 0x384,
+		0x387, 0x38a, 0x0, 0x0, 0x38d, 0x38f, 0x219, 0x391, 0x393, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x395, 0x397, 0x0, 0x399,
+		0x39b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x39e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a0, 0x0, 0x0, 0x0, 0x3a3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+		0x3a8, 0x3ac, 0x3af, 0x3b1, 0x3b4, 0x3b7, 0x0, 0x3ba, 0x0, 0x3bd, 0x3c0, 0x3c3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c7, 0x3ca,
+		0x3cd, 0x3d0, 0x3d3, 0x3d6, 0x3d9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3dd, 0x3e0, 0x3e3, 0x3e6, 0x3e9, 0x0, 0x3ec, 0x3ee, 0x3f0,
+		0x3bd, 0x3ca, 0x3f8, 0x3fa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3fc, 0x3fe, 0x400, 0x0, 0x402, 0x404, 0x0, 0x0, 0x0, 0x406, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x408, 0x40b, 0x0, 0x40e, 0x0, 0x0, 0x0, 0x411, 0x0, 0x0, 0x0, 0x0, 0x414, 0x417, 0x41a,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x41d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x420, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x423,
+		0x426, 0x0, 0x429, 0x0, 0x0, 0x0, 0x42c, 0x0, 0x0, 0x0, 0x0, 0x42f, 0x432, 0x435, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x438, 0x43b, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x43e, 0x441, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x444, 0x447, 0x44a, 0x44d, 0x0, 0x0, 0x450, 0x453, 0x0, 0x0, 0x456, 0x459, 0x45c, 0x45f, 0x462, 0x465,
+		0x0, 0x0, 0x468, 0x46b, 0x46e, 0x471, 0x474, 0x477, 0x0, 0x0, 0x47a, 0x47d, 0x480, 0x483, 0x486, 0x489, 0x48c,
+		0x48f, 0x492, 0x495, 0x498, 0x49b, 0x0, 0x0, 0x49e, 0x4a1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x4a4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a7, 0x4aa, 0x4ad, 0x4b0, 0x4b3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x4b6, 0x4b9, 0x4bc, 0x4bf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c2, 0x0, 0x4c5, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4cb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ce, 0x0,
+		0x0, 0x4d1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d4, 0x4d7, 0x4da, 0x4dd, 0x4e0,
+		0x4e3, 0x4e6, 0x4e9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x4ec, 0x4ef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f2,
+		0x4f5, 0x0, 0x4f8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4fb,
+		0x0, 0x0, 0x4fe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x501, 0x504, 0x507, 0x0, 0x0, 0x50a,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x50d, 0x0, 0x0,
+		0x510, 0x513, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x516, 0x519, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x51c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x51f, 0x522, 0x525,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x528, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x52b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x52e, 0x531, 0x0, 0x534, 0x537, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x53b, 0x53e, 0x541, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x544, 0x0, 0x547, 0x54a, 0x54e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x551, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x554, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x557, 0x55a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55f,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x562, 0x0, 0x0, 0x0, 0x0, 0x565, 0x0, 0x0, 0x0, 0x0, 0x568, 0x0,
+		0x0, 0x0, 0x0, 0x56b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56e, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x571, 0x0, 0x574, 0x577, 0x57a, 0x57e, 0x581, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x585, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x588, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58b, 0x0, 0x0, 0x0, 0x0, 0x58e, 0x0, 0x0, 0x0, 0x0, 0x591, 0x0, 0x0, 0x0,
+		0x0, 0x594, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x597, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59a, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x59f, 0x0, 0x5a2, 0x0, 0x5a5, 0x0, 0x5a8, 0x0, 0x5ab, 0x0, 0x0, 0x0, 0x5ae, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b1, 0x0, 0x5b4, 0x0, 0x0, 0x5b7, 0x5ba, 0x0,
+		0x5bd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c0, 0x5c2, 0x5c4, 0x0,
+		0x5c6, 0x5c8, 0x5ca, 0x5cc, 0x5ce, 0x5d0, 0x5d2, 0x5d4, 0x5d6, 0x5d8, 0x5da, 0x0, 0x5dc, 0x5de, 0x5e0, 0x5e2,
+		0x5e4, 0x5e6, 0x5e8, 0x6, 0x5ea, 0x5ec, 0x5ee, 0x5f0, 0x5f2, 0x5f4, 0x5f6, 0x5f8, 0x5fa, 0x5fc, 0x0, 0x5fe,
+		0x600, 0x602, 0x19, 0x604, 0x606, 0x608, 0x60a, 0x60c, 0x60e, 0x610, 0x612, 0x614, 0x616, 0x3ec, 0x618, 0x61a,
+		0x3f8, 0x61c, 0x61e, 0x36f, 0x60e, 0x614, 0x3ec, 0x618, 0x3fe, 0x3f8, 0x61c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x620, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x622, 0x624,
+		0x626, 0x628, 0x5fa, 0x62a, 0x62c, 0x62e, 0x630, 0x632, 0x634, 0x636, 0x638, 0x63a, 0x63c, 0x63e, 0x640, 0x642,
+		0x644, 0x646, 0x648, 0x64a, 0x64c, 0x64e, 0x650, 0x652, 0x654, 0x656, 0x658, 0x65a, 0x65c, 0x65e, 0x660, 0x662,
+		0x664, 0x666, 0x3ee, 0x668, 0x66b, 0x66e, 0x671, 0x674, 0x677, 0x67a, 0x67d, 0x680, 0x684, 0x688, 0x68b, 0x68e,
+		0x691, 0x694, 0x697, 0x69a, 0x69d, 0x6a0, 0x6a3, 0x6a6, 0x6aa, 0x6ae, 0x6b2, 0x6b6, 0x6b9, 0x6bc, 0x6bf, 0x6c2,
+		0x6c6, 0x6ca, 0x6cd, 0x6d0, 0x6d3, 0x6d6, 0x6d9, 0x6dc, 0x6df, 0x6e2, 0x6e5, 0x6e8, 0x6eb, 0x6ee, 0x6f1, 0x6f4,
+		0x6f7, 0x6fa, 0x6fe, 0x702, 0x705, 0x708, 0x70b, 0x70e, 0x711, 0x714, 0x717, 0x71a, 0x71e, 0x722, 0x725, 0x728,
+		0x72b, 0x72e, 0x731, 0x734, 0x737, 0x73a, 0x73d, 0x740, 0x743, 0x746, 0x749, 0x74c, 0x74f, 0x752, 0x755, 0x758,
+		0x75c, 0x760, 0x764, 0x768, 0x76c, 0x770, 0x774, 0x778, 0x77b, 0x77e, 0x781, 0x784, 0x787, 0x78a, 0x78d, 0x790,
+		0x794, 0x798, 0x79b, 0x79e, 0x7a1, 0x7a4, 0x7a7, 0x7aa, 0x7ae, 0x7b2, 0x7b6, 0x7ba, 0x7be, 0x7c2, 0x7c5, 0x7c8,
+		0x7cb, 0x7ce, 0x7d1, 0x7d4, 0x7d7, 0x7da, 0x7dd, 0x7e0, 0x7e3, 0x7e6, 0x7e9, 0x7ec, 0x7f0, 0x7f4, 0x7f8, 0x7fc,
+		0x7ff, 0x802, 0x805, 0x808, 0x80b, 0x80e, 0x811, 0x814, 0x817, 0x81a, 0x81d, 0x820, 0x823, 0x826, 0x829, 0x82c,
+		0x82f, 0x832, 0x835, 0x838, 0x83b, 0x83e, 0x841, 0x844, 0x847, 0x84a, 0x84d, 0x850, 0x853, 0x856, 0x7a1, 0x0,
+		0x0, 0x0, 0x0, 0x85c, 0x85f, 0x862, 0x865, 0x868, 0x86c, 0x870, 0x874, 0x878, 0x87c, 0x880, 0x884, 0x888, 0x88c,
+		0x890, 0x894, 0x898, 0x89c, 0x8a0, 0x8a4, 0x8a8, 0x8ac, 0x8b0, 0x8b4, 0x8b8, 0x8bb, 0x8be, 0x8c1, 0x8c4, 0x8c7,
+		0x8ca, 0x8ce, 0x8d2, 0x8d6, 0x8da, 0x8de, 0x8e2, 0x8e6, 0x8ea, 0x8ee, 0x8f2, 0x8f5, 0x8f8, 0x8fb, 0x8fe, 0x901,
+		0x904, 0x907, 0x90a, 0x90e, 0x912, 0x916, 0x91a, 0x91e, 0x922, 0x926, 0x92a, 0x92e, 0x932, 0x936, 0x93a, 0x93e,
+		0x942, 0x946, 0x94a, 0x94e, 0x952, 0x956, 0x95a, 0x95d, 0x960, 0x963, 0x966, 0x96a, 0x96e, 0x972, 0x976, 0x97a,
+		0x97e, 0x982, 0x986, 0x98a, 0x98e, 0x991, 0x994, 0x997, 0x99a, 0x99d, 0x9a0, 0x9a3, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x9a6, 0x9a9, 0x9ac, 0x9b0, 0x9b4, 0x9b8, 0x9bc, 0x9c0, 0x9c4, 0x9c7, 0x9ca, 0x9ce, 0x9d2, 0x9d6, 0x9da,
+		0x9de, 0x9e2, 0x9e5, 0x9e8, 0x9ec, 0x9f0, 0x9f4, 0x0, 0x0, 0x9f8, 0x9fb, 0x9fe, 0xa02, 0xa06, 0xa0a, 0x0, 0x0,
+		0xa0e, 0xa11, 0xa14, 0xa18, 0xa1c, 0xa20, 0xa24, 0xa28, 0xa2c, 0xa2f, 0xa32, 0xa36, 0xa3a, 0xa3e, 0xa42, 0xa46,
+		0xa4a, 0xa4d, 0xa50, 0xa54, 0xa58, 0xa5c, 0xa60, 0xa64, 0xa68, 0xa6b, 0xa6e, 0xa72, 0xa76, 0xa7a, 0xa7e, 0xa82,
+		0xa86, 0xa89, 0xa8c, 0xa90, 0xa94, 0xa98, 0x0, 0x0, 0xa9c, 0xa9f, 0xaa2, 0xaa6, 0xaaa, 0xaae, 0x0, 0x0, 0xab2,
+		0xab5, 0xab8, 0xabc, 0xac0, 0xac4, 0xac8, 0xacc, 0x0, 0xad0, 0x0, 0xad3, 0x0, 0xad7, 0x0, 0xadb, 0xadf, 0xae2,
+		0xae5, 0xae9, 0xaed, 0xaf1, 0xaf5, 0xaf9, 0xafd, 0xb00, 0xb03, 0xb07, 0xb0b, 0xb0f, 0xb13, 0xb17, 0xb1b, 0x3cd,
+		0xb1e, 0x3d0, 0xb21, 0x3d3, 0xb24, 0x3d6, 0xb27, 0x3e3, 0xb2a, 0x3e6, 0xb2d, 0x3e9, 0x0, 0x0, 0xb30, 0xb34,
+		0xb38, 0xb3d, 0xb42, 0xb47, 0xb4c, 0xb51, 0xb56, 0xb5a, 0xb5e, 0xb63, 0xb68, 0xb6d, 0xb72, 0xb77, 0xb7c, 0xb80,
+		0xb84, 0xb89, 0xb8e, 0xb93, 0xb98, 0xb9d, 0xba2, 0xba6, 0xbaa, 0xbaf, 0xbb4, 0xbb9, 0xbbe, 0xbc3, 0xbc8, 0xbcc,
+		0xbd0, 0xbd5, 0xbda, 0xbdf, 0xbe4, 0xbe9, 0xbee, 0xbf2, 0xbf6, 0xbfb, 0xc00, 0xc05, 0xc0a, 0xc0f, 0xc14, 0xc17,
+		0xc1a, 0xc1e, 0xc21, 0x0, 0xc25, 0xc28, 0xc2c, 0xc2f, 0xc32, 0x3ac, 0xc35, 0xc38, 0xc3b, 0xc38, 0xc3d, 0xc43,
+		0xc47, 0xc4b, 0xc4e, 0x0, 0xc52, 0xc55, 0xc59, 0x3b1, 0xc5c, 0x3b4, 0xc5f, 0xc65, 0xc6c, 0xc73, 0xc77, 0xc7a,
+		0xc7d, 0x3c3, 0x0, 0x0, 0xc81, 0xc84, 0xc88, 0xc8b, 0xc8e, 0x3b7, 0x0, 0xc94, 0xc9b, 0xca2, 0xca6, 0xca9, 0xcac,
+		0x3d9, 0xcb0, 0xcb3, 0xcb6, 0xcb9, 0xcbd, 0xcc0, 0xcc3, 0x3bd, 0xcc6, 0xccc, 0x3a8, 0xcd0, 0x0, 0x0, 0xcd2,
+		0xcd6, 0xcd9, 0x0, 0xcdd, 0xce0, 0xce4, 0x3ba, 0xce7, 0x3c0, 0xcea, 0xf, 0xcef, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+		0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf8, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcfb, 0xcfd, 0xd00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x1, 0x0, 0x0, 0x0, 0xd04, 0xd07, 0x0, 0xd0b, 0xd0e, 0x0, 0x0, 0x0, 0x0, 0xd12, 0x0, 0xd15, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0xd18, 0xd1b, 0xd1e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd21,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0xd26, 0x61e, 0x0, 0x0, 0xd28, 0xd2a, 0xd2c, 0xd2e, 0xd30, 0xd32, 0xd34, 0xd36, 0xd38, 0xd3a, 0xd3c,
+		0xd3e, 0xd26, 0x17, 0xb, 0xd, 0xd28, 0xd2a, 0xd2c, 0xd2e, 0xd30, 0xd32, 0xd34, 0xd36, 0xd38, 0xd3a, 0xd3c, 0x0,
+		0x6, 0x5f4, 0x19, 0x391, 0x5f6, 0x369, 0x5fe, 0x38f, 0x600, 0xd3e, 0x60a, 0x219, 0x60c, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd43, 0xd47, 0xd4b, 0xd4d, 0x0, 0xd50, 0xd54, 0xd58, 0x0, 0xd5a, 0x5fc,
+		0x5ce, 0x5ce, 0x5ce, 0x369, 0xd5d, 0x5d0, 0x5d0, 0x5d6, 0x38f, 0x0, 0x5da, 0xd5f, 0x0, 0x0, 0x5e0, 0xd62, 0x5e2,
+		0x5e2, 0x5e2, 0x0, 0x0, 0xd64, 0xd67, 0xd6b, 0x0, 0xd6e, 0x0, 0xd70, 0x0, 0xd6e, 0x0, 0x5d4, 0x36, 0x5c4, 0xd4b,
+		0x0, 0x5f4, 0x5c8, 0xd72, 0x0, 0x5d8, 0x19, 0xd74, 0xd76, 0xd78, 0xd7a, 0x61e, 0x0, 0xd7c, 0x3fa, 0x618, 0xd80,
+		0xd82, 0xd84, 0x0, 0x0, 0x0, 0x0, 0x5c6, 0x5f2, 0x5f4, 0x61e, 0x36d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd86, 0xd8a,
+		0xd8e, 0xd93, 0xd97, 0xd9b, 0xd9f, 0xda3, 0xda7, 0xdab, 0xdaf, 0xdb3, 0xdb7, 0xdbb, 0xdbf, 0xdc3, 0x5d0, 0xdc6,
+		0xdc9, 0xdcd, 0xdd0, 0xdd2, 0xdd5, 0xdd9, 0xdde, 0xde1, 0xde3, 0xde6, 0x5d6, 0xd4b, 0x5c6, 0x5d8, 0x61e, 0xdea,
+		0xded, 0xdf1, 0x614, 0xdf4, 0xdf7, 0xdfb, 0xe00, 0x391, 0xe03, 0xe06, 0x38f, 0x624, 0x5f2, 0x600, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe0a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0xe0e, 0xe11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0xe14, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe17, 0xe1a, 0xe1d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe20,
+		0x0, 0x0, 0x0, 0x0, 0xe23, 0x0, 0x0, 0xe26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe29, 0x0, 0xe2c, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe2f, 0xe32, 0x0,
+		0xe36, 0xe39, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe3d, 0x0, 0x0,
+		0xe40, 0x0, 0x0, 0xe43, 0x0, 0xe46, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe49, 0x0, 0xe4c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe4f,
+		0xe52, 0xe55, 0xe58, 0xe5b, 0x0, 0x0, 0xe5e, 0xe61, 0x0, 0x0, 0xe64, 0xe67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6a,
+		0xe6d, 0x0, 0x0, 0xe70, 0xe73, 0x0, 0x0, 0xe76, 0xe79, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0xe7c, 0xe7f, 0xe82, 0xe85, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe88, 0xe8b, 0xe8e, 0xe91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0xe94, 0xe97, 0xe9a, 0xe9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea0,
+		0xea2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xb, 0xd, 0xd28, 0xd2a, 0xd2c, 0xd2e, 0xd30, 0xd32,
+		0xea4, 0xea7, 0xeaa, 0xead, 0xeb0, 0xeb3, 0xeb6, 0xeb9, 0xebc, 0xebf, 0xec2, 0xec5, 0xec9, 0xecd, 0xed1, 0xed5,
+		0xed9, 0xedd, 0xee1, 0xee5, 0xee9, 0xeee, 0xef3, 0xef8, 0xefd, 0xf02, 0xf07, 0xf0c, 0xf11, 0xf16, 0xf1b, 0xf20,
+		0xf23, 0xf26, 0xf29, 0xf2c, 0xf2f, 0xf32, 0xf35, 0xf38, 0xf3b, 0xf3f, 0xf43, 0xf47, 0xf4b, 0xf4f, 0xf53, 0xf57,
+		0xf5b, 0xf5f, 0xf63, 0xf67, 0xf6b, 0xf6f, 0xf73, 0xf77, 0xf7b, 0xf7f, 0xf83, 0xf87, 0xf8b, 0xf8f, 0xf93, 0xf97,
+		0xf9b, 0xf9f, 0xfa3, 0xfa7, 0xfab, 0xfaf, 0xfb3, 0xfb7, 0xfbb, 0xfbf, 0xfc3, 0xfc7, 0xfcb, 0x5c0, 0x5c4, 0xd4b,
+		0x5c6, 0x5c8, 0xd72, 0x5cc, 0x5ce, 0x5d0, 0x5d2, 0x5d4, 0x5d6, 0x5d8, 0x5da, 0x5dc, 0x5e0, 0xd62, 0x5e2, 0xfcf,
+		0x5e4, 0x5e6, 0xdd0, 0x5e8, 0xde1, 0xfd1, 0xd6e, 0x6, 0x5f0, 0x624, 0x5f2, 0x5f4, 0x62a, 0x5fc, 0x369, 0x61e,
+		0x36d, 0x5fe, 0x38f, 0x600, 0xd3e, 0x19, 0x60a, 0xfd3, 0x36f, 0x219, 0x60c, 0x60e, 0x614, 0x377, 0x391, 0x379,
+		0x660, 0xd26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfda, 0xfde, 0xfe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0xfe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36d, 0xdd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe8,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0xfea, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfec,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfee, 0xff0, 0xff2, 0xff4, 0xff6, 0xff8, 0xffa,
+		0xffc, 0xffe, 0x1000, 0x1002, 0x1004, 0x1006, 0x1008, 0x100a, 0x100c, 0x100e, 0x1010, 0x1012, 0x1014, 0x1016,
+		0x1018, 0x101a, 0x101c, 0x101e, 0x1020, 0x1022, 0x1024, 0x1026, 0x1028, 0x102a, 0x102c, 0x102e, 0x1030, 0x1032,
+		0x1034, 0x1036, 0x1038, 0x103a, 0x103c, 0x103e, 0x1040, 0x1042, 0x1044, 0x1046, 0x1048, 0x104a, 0x104c, 0x104e,
+		0x1050, 0x1052, 0x1054, 0x1056, 0x1058, 0x105a, 0x105c, 0x105e, 0x1060, 0x1062, 0x1064, 0x1066, 0x1068, 0x106a,
+		0x106c, 0x106e, 0x1070, 0x1072, 0x1074, 0x1076, 0x1078, 0x107a, 0x107c, 0x107e, 0x1080, 0x1082, 0x1084, 0x1086,
+		0x1088, 0x108a, 0x108c, 0x108e, 0x1090, 0x1092, 0x1094, 0x1096, 0x1098, 0x109a, 0x109c, 0x109e, 0x10a0, 0x10a2,
+		0x10a4, 0x10a6, 0x10a8, 0x10aa, 0x10ac, 0x10ae, 0x10b0, 0x10b2, 0x10b4, 0x10b6, 0x10b8, 0x10ba, 0x10bc, 0x10be,
+		0x10c0, 0x10c2, 0x10c4, 0x10c6, 0x10c8, 0x10ca, 0x10cc, 0x10ce, 0x10d0, 0x10d2, 0x10d4, 0x10d6, 0x10d8, 0x10da,
+		0x10dc, 0x10de, 0x10e0, 0x10e2, 0x10e4, 0x10e6, 0x10e8, 0x10ea, 0x10ec, 0x10ee, 0x10f0, 0x10f2, 0x10f4, 0x10f6,
+		0x10f8, 0x10fa, 0x10fc, 0x10fe, 0x1100, 0x1102, 0x1104, 0x1106, 0x1108, 0x110a, 0x110c, 0x110e, 0x1110, 0x1112,
+		0x1114, 0x1116, 0x1118, 0x111a, 0x111c, 0x111e, 0x1120, 0x1122, 0x1124, 0x1126, 0x1128, 0x112a, 0x112c, 0x112e,
+		0x1130, 0x1132, 0x1134, 0x1136, 0x1138, 0x113a, 0x113c, 0x113e, 0x1140, 0x1142, 0x1144, 0x1146, 0x1148, 0x114a,
+		0x114c, 0x114e, 0x1150, 0x1152, 0x1154, 0x1156, 0x1158, 0x115a, 0x115c, 0x115e, 0x1160, 0x1162, 0x1164, 0x1166,
+		0x1168, 0x116a, 0x116c, 0x116e, 0x1170, 0x1172, 0x1174, 0x1176, 0x1178, 0x117a, 0x117c, 0x117e, 0x1180, 0x1182,
+		0x1184, 0x1186, 0x1188, 0x118a, 0x118c, 0x118e, 0x1190, 0x1192, 0x1194, 0x1196, 0x1198, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x119a, 0x0, 0x101c, 0x119c, 0x119e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x11a0, 0x0, 0x11a3, 0x0, 0x11a6, 0x0, 0x11a9, 0x0, 0x11ac, 0x0, 0x11af, 0x0, 0x11b2,
+		0x0, 0x11b5, 0x0, 0x11b8, 0x0, 0x11bb, 0x0, 0x11be, 0x0, 0x11c1, 0x0, 0x0, 0x11c4, 0x0, 0x11c7, 0x0, 0x11ca,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11cd, 0x11d0, 0x0, 0x11d3, 0x11d6, 0x0, 0x11d9, 0x11dc, 0x0, 0x11df, 0x11e2,
+		0x0, 0x11e5, 0x11e8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x11eb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11ee, 0x11f1, 0x0, 0x11f4, 0x11f7, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11fa, 0x0, 0x11fd, 0x0, 0x1200, 0x0, 0x1203, 0x0, 0x1206, 0x0,
+		0x1209, 0x0, 0x120c, 0x0, 0x120f, 0x0, 0x1212, 0x0, 0x1215, 0x0, 0x1218, 0x0, 0x121b, 0x0, 0x0, 0x121e, 0x0,
+		0x1221, 0x0, 0x1224, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1227, 0x122a, 0x0, 0x122d, 0x1230, 0x0, 0x1233, 0x1236,
+		0x0, 0x1239, 0x123c, 0x0, 0x123f, 0x1242, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1245, 0x0, 0x0, 0x1248, 0x124b, 0x124e, 0x1251, 0x0, 0x0, 0x0, 0x1254,
+		0x1257, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x125a, 0x125c, 0x125e, 0x1260, 0x1262, 0x1264, 0x1266, 0x1268, 0x126a, 0x126c,
+		0x126e, 0x1270, 0x1272, 0x1274, 0x1276, 0x1278, 0x127a, 0x127c, 0x127e, 0x1280, 0x1282, 0x1284, 0x1286, 0x1288,
+		0x128a, 0x128c, 0x128e, 0x1290, 0x1292, 0x1294, 0x1296, 0x1298, 0x129a, 0x129c, 0x129e, 0x12a0, 0x12a2, 0x12a4,
+		0x12a6, 0x12a8, 0x12aa, 0x12ac, 0x12ae, 0x12b0, 0x12b2, 0x12b4, 0x12b6, 0x12b8, 0x12ba, 0x12bc, 0x12be, 0x12c0,
+		0x12c2, 0x12c4, 0x12c6, 0x12c8, 0x12ca, 0x12cc, 0x12ce, 0x12d0, 0x12d2, 0x12d4, 0x12d6, 0x12d8, 0x12da, 0x12dc,
+		0x12de, 0x12e0, 0x12e2, 0x12e4, 0x12e6, 0x12e8, 0x12ea, 0x12ec, 0x12ee, 0x12f0, 0x12f2, 0x12f4, 0x12f6, 0x12f8,
+		0x12fa, 0x12fc, 0x12fe, 0x1300, 0x1302, 0x1304, 0x1306, 0x1308, 0x130a, 0x130c, 0x130e, 0x1310, 0x1312, 0x1314,
+		0x0, 0x0, 0x0, 0xfee, 0xffa, 0x1316, 0x1318, 0x131a, 0x131c, 0x131e, 0x1320, 0xff6, 0x1322, 0x1324, 0x1326,
+		0x1328, 0xffe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x132a, 0x132e, 0x1332, 0x1336, 0x133a, 0x133e,
+		0x1342, 0x1346, 0x134a, 0x134e, 0x1352, 0x1356, 0x135a, 0x135e, 0x1362, 0x1367, 0x136c, 0x1371, 0x1376, 0x137b,
+		0x1380, 0x1385, 0x138a, 0x138f, 0x1394, 0x1399, 0x139e, 0x13a3, 0x13a8, 0x13ad, 0x13b5, 0x0, 0x13bc, 0x13c0,
+		0x13c4, 0x13c8, 0x13cc, 0x13d0, 0x13d4, 0x13d8, 0x13dc, 0x13e0, 0x13e4, 0x13e8, 0x13ec, 0x13f0, 0x13f4, 0x13f8,
+		0x13fc, 0x1400, 0x1404, 0x1408, 0x140c, 0x1410, 0x1414, 0x1418, 0x141c, 0x1420, 0x1424, 0x1428, 0x142c, 0x1430,
+		0x1434, 0x1438, 0x143c, 0x1440, 0x1444, 0x1448, 0x144c, 0x144e, 0x1072, 0x1450, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x1452, 0x1456, 0x1459, 0x145c, 0x145f, 0x1462, 0x1465, 0x1468, 0x146b, 0x146e, 0x1471, 0x1474,
+		0x1477, 0x147a, 0x147d, 0x1480, 0x125a, 0x1260, 0x1266, 0x126a, 0x127a, 0x127c, 0x1282, 0x1286, 0x1288, 0x128c,
+		0x128e, 0x1290, 0x1292, 0x1294, 0x1483, 0x1486, 0x1489, 0x148c, 0x148f, 0x1492, 0x1495, 0x1498, 0x149b, 0x149e,
+		0x14a1, 0x14a4, 0x14a7, 0x14aa, 0x14ad, 0x14b3, 0x14b8, 0x0, 0xfee, 0xffa, 0x1316, 0x1318, 0x14bb, 0x14bd,
+		0x14bf, 0x1004, 0x14c1, 0x101c, 0x1080, 0x1098, 0x1096, 0x1082, 0x113a, 0x102c, 0x107c, 0x14c3, 0x14c5, 0x14c7,
+		0x14c9, 0x14cb, 0x14cd, 0x14cf, 0x14d1, 0x14d3, 0x14d5, 0x1038, 0x14d7, 0x14d9, 0x14db, 0x14dd, 0x14df, 0x14e1,
+		0x14e3, 0x14e5, 0x131a, 0x131c, 0x131e, 0x14e7, 0x14e9, 0x14eb, 0x14ed, 0x14ef, 0x14f1, 0x14f3, 0x14f5, 0x14f7,
+		0x14f9, 0x14fb, 0x14fe, 0x1501, 0x1504, 0x1507, 0x150a, 0x150d, 0x1510, 0x1513, 0x1516, 0x1519, 0x151c, 0x151f,
+		0x1522, 0x1525, 0x1528, 0x152b, 0x152e, 0x1531, 0x1534, 0x1537, 0x153a, 0x153d, 0x1540, 0x1543, 0x1547, 0x154b,
+		0x154f, 0x1552, 0x1556, 0x1559, 0x155d, 0x155f, 0x1561, 0x1563, 0x1565, 0x1567, 0x1569, 0x156b, 0x156d, 0x156f,
+		0x1571, 0x1573, 0x1575, 0x1577, 0x1579, 0x157b, 0x157d, 0x157f, 0x1581, 0x1583, 0x1585, 0x1587, 0x1589, 0x158b,
+		0x158d, 0x158f, 0x1591, 0x1593, 0x1595, 0x1597, 0x1599, 0x159b, 0x159d, 0x159f, 0x15a1, 0x15a3, 0x15a5, 0x15a7,
+		0x15a9, 0x15ab, 0x15ad, 0x15af, 0x15b1, 0x15b3, 0x15b5, 0x15b7, 0x15b9, 0x15bb, 0x15be, 0x15c4, 0x15c9, 0x15cf,
+		0x15d3, 0x15d9, 0x15dd, 0x15e1, 0x15e8, 0x15ed, 0x15f1, 0x15f5, 0x15f9, 0x15fe, 0x1603, 0x1608, 0x160d, 0x1612,
+		0x1617, 0x161c, 0x1623, 0x1626, 0x162d, 0x1634, 0x163a, 0x163f, 0x1646, 0x164d, 0x1652, 0x1656, 0x165a, 0x165f,
+		0x1664, 0x166a, 0x1670, 0x1674, 0x1678, 0x167d, 0x1681, 0x1685, 0x1688, 0x168b, 0x168f, 0x1693, 0x169a, 0x169f,
+		0x16a5, 0x16ac, 0x16b1, 0x16b5, 0x16b9, 0x16c0, 0x16c5, 0x16cc, 0x16d0, 0x16d6, 0x16da, 0x16df, 0x16e3, 0x16e8,
+		0x16ee, 0x16f3, 0x16f9, 0x16fe, 0x1701, 0x1707, 0x170b, 0x170f, 0x1714, 0x1718, 0x171c, 0x1720, 0x1726, 0x172b,
+		0x172e, 0x1735, 0x1739, 0x173f, 0x1744, 0x1749, 0x174d, 0x1751, 0x1756, 0x1759, 0x175e, 0x1764, 0x1767, 0x176e,
+		0x1772, 0x1775, 0x1778, 0x177b, 0x177e, 0x1781, 0x1784, 0x1787, 0x178a, 0x178d, 0x1790, 0x1794, 0x1798, 0x179c,
+		0x17a0, 0x17a4, 0x17a8, 0x17ac, 0x17b0, 0x17b4, 0x17b8, 0x17bc, 0x17c0, 0x17c4, 0x17c8, 0x17cc, 0x17d0, 0x17d3,
+		0x17d6, 0x17da, 0x17dd, 0x17e0, 0x17e3, 0x17e7, 0x17eb, 0x17ee, 0x17f1, 0x17f4, 0x17f7, 0x17fa, 0x17ff, 0x1802,
+		0x1805, 0x1808, 0x180b, 0x180e, 0x1811, 0x1814, 0x1817, 0x181b, 0x1820, 0x1823, 0x1826, 0x1829, 0x182c, 0x182f,
+		0x1832, 0x1835, 0x1839, 0x183d, 0x1841, 0x1845, 0x1848, 0x184b, 0x184e, 0x1851, 0x1854, 0x1857, 0x185a, 0x185d,
+		0x1860, 0x1863, 0x1867, 0x186b, 0x186e, 0x1872, 0x1876, 0x187a, 0x187d, 0x1881, 0x1885, 0x188a, 0x188d, 0x1891,
+		0x1895, 0x1899, 0x189d, 0x18a3, 0x18aa, 0x18ad, 0x18b0, 0x18b3, 0x18b6, 0x18b9, 0x18bc, 0x18bf, 0x18c2, 0x18c5,
+		0x18c8, 0x18cb, 0x18ce, 0x18d1, 0x18d4, 0x18d7, 0x18da, 0x18dd, 0x18e0, 0x18e5, 0x18e8, 0x18eb, 0x18ee, 0x18f3,
+		0x18f7, 0x18fa, 0x18fd, 0x1900, 0x1903, 0x1906, 0x1909, 0x190c, 0x190f, 0x1912, 0x1915, 0x1919, 0x191c, 0x191f,
+		0x1923, 0x1927, 0x192a, 0x192f, 0x1933, 0x1936, 0x1939, 0x193c, 0x193f, 0x1943, 0x1947, 0x194a, 0x194d, 0x1950,
+		0x1953, 0x1956, 0x1959, 0x195c, 0x195f, 0x1962, 0x1966, 0x196a, 0x196e, 0x1972, 0x1976, 0x197a, 0x197e, 0x1982,
+		0x1986, 0x198a, 0x198e, 0x1992, 0x1996, 0x199a, 0x199e, 0x19a2, 0x19a6, 0x19aa, 0x19ae, 0x19b2, 0x19b6, 0x19ba,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19be, 0x19c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x19c2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0xd4b, 0xd72, 0xd62, 0x0, 0x0, 0x0, 0x19c4, 0x19c6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x19c8, 0x19ca, 0x19cc, 0x19ce, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19d0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19d2,
+		0x19d4, 0x112a, 0x19d6, 0x19d8, 0x19da, 0x19dc, 0x1196, 0x1196, 0x19de, 0x113a, 0x19e0, 0x19e2, 0x19e4, 0x19e6,
+		0x19e8, 0x19ea, 0x19ec, 0x19ee, 0x19f0, 0x19f2, 0x19f4, 0x19f6, 0x19f8, 0x19fa, 0x19fc, 0x19fe, 0x1a00, 0x1a02,
+		0x1a04, 0x1a06, 0x1a08, 0x1a0a, 0x1a0c, 0x1a0e, 0x1a10, 0x1a12, 0x1a14, 0x1a16, 0x1a18, 0x1a1a, 0x1a1c, 0x1a1e,
+		0x1a20, 0x1a22, 0x1a24, 0x1a26, 0x1a28, 0x1a2a, 0x1a2c, 0x1a2e, 0x1a30, 0x10e6, 0x1a32, 0x1a34, 0x1a36, 0x1a38,
+		0x1a3a, 0x1a3c, 0x1a3e, 0x1a40, 0x1a42, 0x1a44, 0x1a46, 0x1178, 0x1a48, 0x1a4a, 0x1a4c, 0x1a4e, 0x1a50, 0x1a52,
+		0x1a54, 0x1a56, 0x1a58, 0x1a5a, 0x1a5c, 0x1a5e, 0x1a60, 0x1a62, 0x1a64, 0x1a66, 0x1a68, 0x1a6a, 0x1a6c, 0x1a6e,
+		0x1a70, 0x1a72, 0x1a74, 0x1a76, 0x1a78, 0x1a7a, 0x1a7c, 0x19f2, 0x1a7e, 0x1a80, 0x1a82, 0x1a84, 0x1a86, 0x1a88,
+		0x1a8a, 0x1a8c, 0x1a8e, 0x1a90, 0x1a92, 0x1a94, 0x1a96, 0x1a98, 0x1a9a, 0x1a9c, 0x1a9e, 0x1aa0, 0x1aa2, 0x1aa4,
+		0x112e, 0x1aa6, 0x1aa8, 0x1aaa, 0x1aac, 0x1aae, 0x1ab0, 0x1ab2, 0x1ab4, 0x1ab6, 0x1ab8, 0x1aba, 0x1abc, 0x1abe,
+		0x1ac0, 0x1ac2, 0x1038, 0x1ac4, 0x1ac6, 0x1ac8, 0x1aca, 0x1acc, 0x1ace, 0x1ad0, 0x1ad2, 0x1012, 0x1ad4, 0x1ad6,
+		0x1ad8, 0x1ada, 0x1adc, 0x1ade, 0x1ae0, 0x1ae2, 0x1ae4, 0x1ae6, 0x1ae8, 0x1aea, 0x1aec, 0x1aee, 0x1af0, 0x1af2,
+		0x1af4, 0x1af6, 0x1af8, 0x1afa, 0x1afc, 0x1afe, 0x1aa2, 0x1b00, 0x1b02, 0x1b04, 0x1b06, 0x1b08, 0x1b0a, 0x1b0c,
+		0x1b0e, 0x1a82, 0x1b10, 0x1b12, 0x1b14, 0x1b16, 0x1b18, 0x1b1a, 0x1b1c, 0x1b1e, 0x1b20, 0x1b22, 0x1b24, 0x1b26,
+		0x1b28, 0x1b2a, 0x1b2c, 0x1b2e, 0x1b30, 0x1b32, 0x1b34, 0x1b36, 0x19f2, 0x1b38, 0x1b3a, 0x1b3c, 0x1b3e, 0x1194,
+		0x1b40, 0x1b42, 0x1b44, 0x1b46, 0x1b48, 0x1b4a, 0x1b4c, 0x1b4e, 0x1b50, 0x1b52, 0x1b54, 0x1b56, 0x14bd, 0x1b58,
+		0x1b5a, 0x1b5c, 0x1b5e, 0x1b60, 0x1b62, 0x1b64, 0x1b66, 0x1b68, 0x1a86, 0x1b6a, 0x1b6c, 0x1b6e, 0x1b70, 0x1b72,
+		0x1b74, 0x1b76, 0x1b78, 0x1b7a, 0x1b7c, 0x1b7e, 0x1b80, 0x1b82, 0x1138, 0x1b84, 0x1b86, 0x1b88, 0x1b8a, 0x1b8c,
+		0x1b8e, 0x1b90, 0x1b92, 0x1b94, 0x1b96, 0x1b98, 0x1b9a, 0x1b9c, 0x10d6, 0x1b9e, 0x1ba0, 0x1ba2, 0x1ba4, 0x1ba6,
+		0x1ba8, 0x1baa, 0x1bac, 0x1bae, 0x1bb0, 0x1bb2, 0x1bb4, 0x1bb6, 0x1bb8, 0x1bba, 0x1bbc, 0x110c, 0x1bbe, 0x1112,
+		0x1bc0, 0x1bc2, 0x1bc4, 0x0, 0x0, 0x1bc6, 0x0, 0x1bc8, 0x0, 0x0, 0x1bca, 0x1bcc, 0x1bce, 0x1bd0, 0x1bd2, 0x1bd4,
+		0x1bd6, 0x1bd8, 0x1bda, 0x10e4, 0x0, 0x1bdc, 0x0, 0x1bde, 0x0, 0x0, 0x1be0, 0x1be2, 0x0, 0x0, 0x0, 0x1be4,
+		0x1be6, 0x1be8, 0x1bea, 0x1bec, 0x1bee, 0x1bf0, 0x1bf2, 0x1bf4, 0x1bf6, 0x1bf8, 0x1bfa, 0x1bfc, 0x1bfe, 0x1c00,
+		0x1c02, 0x1c04, 0x1c06, 0x1046, 0x1c08, 0x1c0a, 0x1c0c, 0x1c0e, 0x1c10, 0x1c12, 0x1c14, 0x1c16, 0x1c18, 0x1c1a,
+		0x1c1c, 0x1c1e, 0x1c20, 0x1c22, 0x1c24, 0x14c7, 0x1c26, 0x1c28, 0x1c2a, 0x1c2c, 0x14cf, 0x1c2e, 0x1c30, 0x1c32,
+		0x1c34, 0x1c36, 0x1aea, 0x1c38, 0x1c3a, 0x1c3c, 0x1c3e, 0x1c40, 0x1c42, 0x1c42, 0x1c44, 0x1c46, 0x1c48, 0x1c4a,
+		0x1c4c, 0x1c4e, 0x1c50, 0x1c52, 0x1be0, 0x1c54, 0x1c56, 0x1c58, 0x1c5a, 0x1c5c, 0x1c5e, 0x0, 0x0, 0x1c60,
+		0x1c62, 0x1c64, 0x1c66, 0x1c68, 0x1c6a, 0x1c6c, 0x1c6e, 0x1bfc, 0x1c70, 0x1c72, 0x1c74, 0x1bc6, 0x1c76, 0x1c78,
+		0x1c7a, 0x1c7c, 0x1c7e, 0x1c80, 0x1c82, 0x1c84, 0x1c86, 0x1c88, 0x1c8a, 0x1c8c, 0x1c0c, 0x1c8e, 0x1c0e, 0x1c90,
+		0x1c92, 0x1c94, 0x1c96, 0x1c98, 0x1bc8, 0x1a1c, 0x1c9a, 0x1c9c, 0x1088, 0x1aa4, 0x1b4a, 0x1c9e, 0x1ca0, 0x1c1c,
+		0x1ca2, 0x1c1e, 0x1ca4, 0x1ca6, 0x1ca8, 0x1bcc, 0x1caa, 0x1cac, 0x1cae, 0x1cb0, 0x1cb2, 0x1bce, 0x1cb4, 0x1cb6,
+		0x1cb8, 0x1cba, 0x1cbc, 0x1cbe, 0x1c36, 0x1cc0, 0x1cc2, 0x1aea, 0x1cc4, 0x1c3e, 0x1cc6, 0x1cc8, 0x1cca, 0x1ccc,
+		0x1cce, 0x1c48, 0x1cd0, 0x1bde, 0x1cd2, 0x1c4a, 0x1a7e, 0x1cd4, 0x1c4c, 0x1cd6, 0x1c50, 0x1cd8, 0x1cda, 0x1cdc,
+		0x1cde, 0x1ce0, 0x1c54, 0x1bd8, 0x1ce2, 0x1c56, 0x1ce4, 0x1c58, 0x1ce6, 0x1196, 0x1ce8, 0x1cea, 0x1cec, 0x1cee,
+		0x1cf0, 0x1cf2, 0x1cf4, 0x1cf6, 0x1cf8, 0x1cfa, 0x1cfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x1cfe, 0x1d01, 0x1d04, 0x1d07, 0x1d0b, 0x1d0f, 0x1d0f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d12, 0x1d15, 0x1d18, 0x1d1b, 0x1d1e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d21, 0x0,
+		0x1d24, 0x1d27, 0xd74, 0xd7a, 0x1d29, 0x1d2b, 0x1d2d, 0x1d2f, 0x1d31, 0x1d33, 0xd34, 0x1d35, 0x1d38, 0x1d3b,
+		0x1d3f, 0x1d43, 0x1d46, 0x1d49, 0x1d4c, 0x1d4f, 0x1d52, 0x1d55, 0x1d58, 0x1d5b, 0x0, 0x1d5e, 0x1d61, 0x1d64,
+		0x1d67, 0x1d6a, 0x0, 0x1d6d, 0x0, 0x1d70, 0x1d73, 0x0, 0x1d76, 0x1d79, 0x0, 0x1d7c, 0x1d7f, 0x1d82, 0x1d85,
+		0x1d88, 0x1d8b, 0x1d8e, 0x1d91, 0x1d94, 0x1d97, 0x1d9a, 0x1d9a, 0x1d9c, 0x1d9c, 0x1d9c, 0x1d9c, 0x1d9e, 0x1d9e,
+		0x1d9e, 0x1d9e, 0x1da0, 0x1da0, 0x1da0, 0x1da0, 0x1da2, 0x1da2, 0x1da2, 0x1da2, 0x1da4, 0x1da4, 0x1da4, 0x1da4,
+		0x1da6, 0x1da6, 0x1da6, 0x1da6, 0x1da8, 0x1da8, 0x1da8, 0x1da8, 0x1daa, 0x1daa, 0x1daa, 0x1daa, 0x1dac, 0x1dac,
+		0x1dac, 0x1dac, 0x1dae, 0x1dae, 0x1dae, 0x1dae, 0x1db0, 0x1db0, 0x1db0, 0x1db0, 0x1db2, 0x1db2, 0x1db2, 0x1db2,
+		0x1db4, 0x1db4, 0x1db6, 0x1db6, 0x1db8, 0x1db8, 0x1dba, 0x1dba, 0x1dbc, 0x1dbc, 0x1dbe, 0x1dbe, 0x1dc0, 0x1dc0,
+		0x1dc0, 0x1dc0, 0x1dc2, 0x1dc2, 0x1dc2, 0x1dc2, 0x1dc4, 0x1dc4, 0x1dc4, 0x1dc4, 0x1dc6, 0x1dc6, 0x1dc6, 0x1dc6,
+		0x1dc8, 0x1dc8, 0x1dca, 0x1dca, 0x1dca, 0x1dca, 0x4c2, 0x4c2, 0x1dcc, 0x1dcc, 0x1dcc, 0x1dcc, 0x1dce, 0x1dce,
+		0x1dce, 0x1dce, 0x1dd0, 0x1dd0, 0x4c8, 0x4c8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1dd2,
+		0x1dd2, 0x1dd2, 0x1dd2, 0x1dd4, 0x1dd4, 0x1dd6, 0x1dd6, 0x1dd8, 0x1dd8, 0x4bc, 0x1dda, 0x1dda, 0x1ddc, 0x1ddc,
+		0x1dde, 0x1dde, 0x1de0, 0x1de0, 0x1de0, 0x1de0, 0x1de2, 0x1de2, 0x1de4, 0x1de4, 0x1de8, 0x1de8, 0x1dec, 0x1dec,
+		0x1df0, 0x1df0, 0x1df4, 0x1df4, 0x1df8, 0x1df8, 0x1dfc, 0x1dfc, 0x1dfc, 0x1e00, 0x1e00, 0x1e00, 0x1e04, 0x1e04,
+		0x1e04, 0x1e04, 0x1e06, 0x1e0a, 0x1e0e, 0x1e00, 0x1e12, 0x1e16, 0x1e19, 0x1e1c, 0x1e1f, 0x1e22, 0x1e25, 0x1e28,
+		0x1e2b, 0x1e2e, 0x1e31, 0x1e34, 0x1e37, 0x1e3a, 0x1e3d, 0x1e40, 0x1e43, 0x1e46, 0x1e49, 0x1e4c, 0x1e4f, 0x1e52,
+		0x1e55, 0x1e58, 0x1e5b, 0x1e5e, 0x1e61, 0x1e64, 0x1e67, 0x1e6a, 0x1e6d, 0x1e70, 0x1e73, 0x1e76, 0x1e79, 0x1e7c,
+		0x1e7f, 0x1e82, 0x1e85, 0x1e88, 0x1e8b, 0x1e8e, 0x1e91, 0x1e94, 0x1e97, 0x1e9a, 0x1e9d, 0x1ea0, 0x1ea3, 0x1ea6,
+		0x1ea9, 0x1eac, 0x1eaf, 0x1eb2, 0x1eb5, 0x1eb8, 0x1ebb, 0x1ebe, 0x1ec1, 0x1ec4, 0x1ec7, 0x1eca, 0x1ecd, 0x1ed0,
+		0x1ed3, 0x1ed6, 0x1ed9, 0x1edc, 0x1edf, 0x1ee2, 0x1ee5, 0x1ee8, 0x1eeb, 0x1eee, 0x1ef1, 0x1ef4, 0x1ef7, 0x1efa,
+		0x1efd, 0x1f00, 0x1f03, 0x1f06, 0x1f09, 0x1f0c, 0x1f0f, 0x1f12, 0x1f15, 0x1f18, 0x1f1b, 0x1f1e, 0x1f21, 0x1f25,
+		0x1f29, 0x1f2d, 0x1f31, 0x1f35, 0x1f39, 0x1f3d, 0x1e0e, 0x1f41, 0x1e00, 0x1e12, 0x1f45, 0x1f48, 0x1e1f, 0x1f4b,
+		0x1e22, 0x1e25, 0x1f4e, 0x1f51, 0x1e31, 0x1f54, 0x1e34, 0x1e37, 0x1f57, 0x1f5a, 0x1e3d, 0x1f5d, 0x1e40, 0x1e43,
+		0x1e9a, 0x1e9d, 0x1ea6, 0x1ea9, 0x1eac, 0x1eb8, 0x1ebb, 0x1ebe, 0x1ec1, 0x1ecd, 0x1ed0, 0x1ed3, 0x1f60, 0x1edf,
+		0x1f63, 0x1f66, 0x1ef1, 0x1f69, 0x1ef4, 0x1ef7, 0x1f1e, 0x1f6c, 0x1f6f, 0x1f0f, 0x1f72, 0x1f12, 0x1f15, 0x1e06,
+		0x1e0a, 0x1f75, 0x1e0e, 0x1f79, 0x1e16, 0x1e19, 0x1e1c, 0x1e1f, 0x1f7d, 0x1e28, 0x1e2b, 0x1e2e, 0x1e31, 0x1f80,
+		0x1e3d, 0x1e46, 0x1e49, 0x1e4c, 0x1e4f, 0x1e52, 0x1e58, 0x1e5b, 0x1e5e, 0x1e61, 0x1e64, 0x1e67, 0x1f83, 0x1e6a,
+		0x1e6d, 0x1e70, 0x1e73, 0x1e76, 0x1e79, 0x1e7f, 0x1e82, 0x1e85, 0x1e88, 0x1e8b, 0x1e8e, 0x1e91, 0x1e94, 0x1e97,
+		0x1ea0, 0x1ea3, 0x1eaf, 0x1eb2, 0x1eb5, 0x1eb8, 0x1ebb, 0x1ec4, 0x1ec7, 0x1eca, 0x1ecd, 0x1f86, 0x1ed6, 0x1ed9,
+		0x1edc, 0x1edf, 0x1ee8, 0x1eeb, 0x1eee, 0x1ef1, 0x1f89, 0x1efa, 0x1efd, 0x1f8c, 0x1f06, 0x1f09, 0x1f0c, 0x1f0f,
+		0x1f8f, 0x1e0e, 0x1f79, 0x1e1f, 0x1f7d, 0x1e31, 0x1f80, 0x1e3d, 0x1f92, 0x1e64, 0x1f95, 0x1f98, 0x1f9b, 0x1eb8,
+		0x1ebb, 0x1ecd, 0x1ef1, 0x1f89, 0x1f0f, 0x1f8f, 0x1f9e, 0x1fa2, 0x1fa6, 0x1faa, 0x1fad, 0x1fb0, 0x1fb3, 0x1fb6,
+		0x1fb9, 0x1fbc, 0x1fbf, 0x1fc2, 0x1fc5, 0x1fc8, 0x1fcb, 0x1fce, 0x1fd1, 0x1fd4, 0x1fd7, 0x1fda, 0x1fdd, 0x1fe0,
+		0x1fe3, 0x1fe6, 0x1fe9, 0x1fec, 0x1f98, 0x1fef, 0x1ff2, 0x1ff5, 0x1ff8, 0x1faa, 0x1fad, 0x1fb0, 0x1fb3, 0x1fb6,
+		0x1fb9, 0x1fbc, 0x1fbf, 0x1fc2, 0x1fc5, 0x1fc8, 0x1fcb, 0x1fce, 0x1fd1, 0x1fd4, 0x1fd7, 0x1fda, 0x1fdd, 0x1fe0,
+		0x1fe3, 0x1fe6, 0x1fe9, 0x1fec, 0x1f98, 0x1fef, 0x1ff2, 0x1ff5, 0x1ff8, 0x1fe6, 0x1fe9, 0x1fec, 0x1f98, 0x1f95,
+		0x1f9b, 0x1e7c, 0x1e5b, 0x1e5e, 0x1e61, 0x1fe6, 0x1fe9, 0x1fec, 0x1e7c, 0x1e7f, 0x1ffb, 0x1ffb, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1ffe, 0x2002, 0x2002, 0x2006,
+		0x200a, 0x200e, 0x2012, 0x2016, 0x201a, 0x201a, 0x201e, 0x2022, 0x2026, 0x202a, 0x202e, 0x2032, 0x2032, 0x2036,
+		0x203a, 0x203a, 0x203e, 0x203e, 0x2042, 0x2046, 0x2046, 0x204a, 0x204e, 0x204e, 0x2052, 0x2052, 0x2056, 0x205a,
+		0x205a, 0x205e, 0x205e, 0x2062, 0x2066, 0x206a, 0x206e, 0x206e, 0x2072, 0x2076, 0x207a, 0x207e, 0x2082, 0x2082,
+		0x2086, 0x208a, 0x208e, 0x2092, 0x2096, 0x209a, 0x209a, 0x209e, 0x209e, 0x20a2, 0x20a2, 0x20a6, 0x20aa, 0x20ae,
+		0x20b2, 0x20b6, 0x20ba, 0x20be, 0x0, 0x0, 0x20c2, 0x20c6, 0x20ca, 0x20ce, 0x20d2, 0x20d6, 0x20d6, 0x20da,
+		0x20de, 0x20e2, 0x20e6, 0x20e6, 0x20ea, 0x20ee, 0x20f2, 0x20f6, 0x20fa, 0x20fe, 0x2102, 0x2106, 0x210a, 0x210e,
+		0x2112, 0x2116, 0x211a, 0x211e, 0x2122, 0x2126, 0x212a, 0x212e, 0x2132, 0x2136, 0x213a, 0x213e, 0x2086, 0x208e,
+		0x2142, 0x2146, 0x214a, 0x214e, 0x2152, 0x2156, 0x2152, 0x214a, 0x215a, 0x215e, 0x2162, 0x2166, 0x216a, 0x2156,
+		0x206a, 0x2042, 0x216e, 0x2172, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x2176, 0x217a, 0x217e, 0x2183, 0x2188, 0x218d, 0x2192, 0x2197, 0x219c, 0x21a1, 0x21a5, 0x21b8,
+		0x21c1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21c6,
+		0x21c8, 0x21ca, 0x21cc, 0x3a3, 0x21ce, 0x21d0, 0x21d2, 0x21d4, 0xd00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcfd, 0x21d6, 0x21d8, 0x21da, 0x21da,
+		0xd3a, 0xd3c, 0x21dc, 0x21de, 0x21e0, 0x21e2, 0x21e4, 0x21e6, 0x21e8, 0x21ea, 0xea0, 0xea2, 0x21ec, 0x21ee,
+		0x21f0, 0x21f2, 0x0, 0x0, 0x21f4, 0x21f6, 0xd15, 0xd15, 0xd15, 0xd15, 0x21da, 0x21da, 0x21da, 0x21c6, 0x21c8,
+		0xcfb, 0x0, 0x3a3, 0x21cc, 0x21d0, 0x21ce, 0x21d6, 0xd3a, 0xd3c, 0x21dc, 0x21de, 0x21e0, 0x21e2, 0x21f8, 0x21fa,
+		0x21fc, 0xd34, 0x21fe, 0x2200, 0x2202, 0xd38, 0x0, 0x2204, 0x2206, 0x2208, 0x220a, 0x0, 0x0, 0x0, 0x0, 0x220c,
+		0x220f, 0x2212, 0x0, 0x2215, 0x0, 0x2218, 0x221b, 0x221e, 0x2221, 0x2224, 0x2227, 0x222a, 0x222d, 0x2230,
+		0x2233, 0x2236, 0x4a7, 0x4a7, 0x4aa, 0x4aa, 0x4ad, 0x4ad, 0x4b0, 0x4b0, 0x4b3, 0x4b3, 0x4b3, 0x4b3, 0x2238,
+		0x2238, 0x223a, 0x223a, 0x223a, 0x223a, 0x223c, 0x223c, 0x223e, 0x223e, 0x223e, 0x223e, 0x2240, 0x2240, 0x2240,
+		0x2240, 0x2242, 0x2242, 0x2242, 0x2242, 0x2244, 0x2244, 0x2244, 0x2244, 0x2246, 0x2246, 0x2246, 0x2246, 0x2248,
+		0x2248, 0x224a, 0x224a, 0x224c, 0x224c, 0x224e, 0x224e, 0x2250, 0x2250, 0x2250, 0x2250, 0x2252, 0x2252, 0x2252,
+		0x2252, 0x2254, 0x2254, 0x2254, 0x2254, 0x2256, 0x2256, 0x2256, 0x2256, 0x2258, 0x2258, 0x2258, 0x2258, 0x225a,
+		0x225a, 0x225a, 0x225a, 0x225c, 0x225c, 0x225c, 0x225c, 0x225e, 0x225e, 0x225e, 0x225e, 0x2260, 0x2260, 0x2260,
+		0x2260, 0x2262, 0x2262, 0x2262, 0x2262, 0x2264, 0x2264, 0x2264, 0x2264, 0x2266, 0x2266, 0x2266, 0x2266, 0x2268,
+		0x2268, 0x2268, 0x2268, 0x226a, 0x226a, 0x226a, 0x226a, 0x226c, 0x226c, 0x226c, 0x226c, 0x226e, 0x226e, 0x1de2,
+		0x1de2, 0x2270, 0x2270, 0x2270, 0x2270, 0x2272, 0x2272, 0x2276, 0x2276, 0x227a, 0x227a, 0x227e, 0x227e, 0x0,
+		0x0, 0x0, 0x0, 0x21ce, 0x2281, 0x21f8, 0x2206, 0x2208, 0x21fa, 0x2283, 0xd3a, 0xd3c, 0x21fc, 0xd34, 0x21c6,
+		0x21fe, 0xcfb, 0x2285, 0xd26, 0x17, 0xb, 0xd, 0xd28, 0xd2a, 0xd2c, 0xd2e, 0xd30, 0xd32, 0x21cc, 0x3a3, 0x2200,
+		0xd38, 0x2202, 0x21d0, 0x220a, 0x5c0, 0x5c4, 0xd4b, 0x5c6, 0x5c8, 0xd72, 0x5cc, 0x5ce, 0x5d0, 0x5d2, 0x5d4,
+		0x5d6, 0x5d8, 0x5da, 0x5dc, 0x5e0, 0xd62, 0x5e2, 0xfcf, 0x5e4, 0x5e6, 0xdd0, 0x5e8, 0xde1, 0xfd1, 0xd6e, 0x21f4,
+		0x2204, 0x21f6, 0x2287, 0x21da, 0xcd0, 0x6, 0x5f0, 0x624, 0x5f2, 0x5f4, 0x62a, 0x5fc, 0x369, 0x61e, 0x36d,
+		0x5fe, 0x38f, 0x600, 0xd3e, 0x19, 0x60a, 0xfd3, 0x36f, 0x219, 0x60c, 0x60e, 0x614, 0x377, 0x391, 0x379, 0x660,
+		0x21dc, 0x2289, 0x21de, 0x228b, 0x228d, 0x228f, 0x21ca, 0x21ec, 0x21ee, 0x21c8, 0x2291, 0x15b9, 0x2293, 0x2295,
+		0x2297, 0x2299, 0x229b, 0x229d, 0x229f, 0x22a1, 0x22a3, 0x22a5, 0x155d, 0x155f, 0x1561, 0x1563, 0x1565, 0x1567,
+		0x1569, 0x156b, 0x156d, 0x156f, 0x1571, 0x1573, 0x1575, 0x1577, 0x1579, 0x157b, 0x157d, 0x157f, 0x1581, 0x1583,
+		0x1585, 0x1587, 0x1589, 0x158b, 0x158d, 0x158f, 0x1591, 0x1593, 0x1595, 0x1597, 0x1599, 0x159b, 0x159d, 0x159f,
+		0x15a1, 0x15a3, 0x15a5, 0x15a7, 0x15a9, 0x15ab, 0x15ad, 0x15af, 0x15b1, 0x15b3, 0x22a7, 0x22a9, 0x22ab, 0x12c0,
+		0x125a, 0x125c, 0x125e, 0x1260, 0x1262, 0x1264, 0x1266, 0x1268, 0x126a, 0x126c, 0x126e, 0x1270, 0x1272, 0x1274,
+		0x1276, 0x1278, 0x127a, 0x127c, 0x127e, 0x1280, 0x1282, 0x1284, 0x1286, 0x1288, 0x128a, 0x128c, 0x128e, 0x1290,
+		0x1292, 0x1294, 0x0, 0x0, 0x0, 0x1296, 0x1298, 0x129a, 0x129c, 0x129e, 0x12a0, 0x0, 0x0, 0x12a2, 0x12a4, 0x12a6,
+		0x12a8, 0x12aa, 0x12ac, 0x0, 0x0, 0x12ae, 0x12b0, 0x12b2, 0x12b4, 0x12b6, 0x12b8, 0x0, 0x0, 0x12ba, 0x12bc,
+		0x12be, 0x0, 0x0, 0x0, 0x22ad, 0x22af, 0x22b1, 0x8, 0x22b3, 0x22b5, 0x22b7, 0x0, 0x22b9, 0x22bb, 0x22bd, 0x22bf,
+		0x22c1, 0x22c3, 0x22c5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x22c7, 0x22c9, 0x22cb, 0x22cd, 0x22cf, 0x0, 0x22d1, 0x22d3, 0x22d5, 0x22d7, 0x22d9, 0x22db, 0x22dd,
+		0x22df, 0x22e1, 0x22e3, 0x22e5, 0x22e7, 0x22e9, 0x22eb, 0xd5d, 0x22ed, 0x22ef, 0x22f1, 0x22f3, 0x22f5, 0x22f7,
+		0x22f9, 0x22fb, 0x22fd, 0x22ff, 0x2301, 0x2303, 0x2305, 0x2307, 0x2309, 0xfd3, 0x230b, 0x230d, 0x230f, 0x2311,
+		0x2313, 0x2315, 0x2317, 0x2319, 0x231b, 0x231d, 0x231f, 0x0, 0x2321, 0x2323, 0x2325, 0x2327, 0x2329, 0x232b,
+		0x232d, 0x232f, 0x2331, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2333, 0x0, 0x2336, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2339, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x233c, 0x233f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2342, 0x2345,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x2348, 0x234b, 0x0, 0x234e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2351,
+		0x2354, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2357, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x235a, 0x235d, 0x2360, 0x2364, 0x2368, 0x236c, 0x2370,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2374,
+		0x2377, 0x237a, 0x237e, 0x2382, 0x2386, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x5c0, 0x5c4, 0xd4b, 0x5c6, 0x5c8, 0xd72, 0x5cc, 0x5ce, 0x5d0, 0x5d2, 0x5d4, 0x5d6,
+		0x5d8, 0x5da, 0x5dc, 0x5e0, 0xd62, 0x5e2, 0xfcf, 0x5e4, 0x5e6, 0xdd0, 0x5e8, 0xde1, 0xfd1, 0xd6e, 0x6, 0x5f0,
+		0x624, 0x5f2, 0x5f4, 0x62a, 0x5fc, 0x369, 0x61e, 0x36d, 0x5fe, 0x38f, 0x600, 0xd3e, 0x19, 0x60a, 0xfd3, 0x36f,
+		0x219, 0x60c, 0x60e, 0x614, 0x377, 0x391, 0x379, 0x660, 0x5c0, 0x5c4, 0xd4b, 0x5c6, 0x5c8, 0xd72, 0x5cc, 0x5ce,
+		0x5d0, 0x5d2, 0x5d4, 0x5d6, 0x5d8, 0x5da, 0x5dc, 0x5e0, 0xd62, 0x5e2, 0xfcf, 0x5e4, 0x5e6, 0xdd0, 0x5e8, 0xde1,
+		0xfd1, 0xd6e, 0x6, 0x5f0, 0x624, 0x5f2, 0x5f4, 0x62a, 0x5fc, 0x0, 0x61e, 0x36d, 0x5fe, 0x38f, 0x600, 0xd3e,
+		0x19, 0x60a, 0xfd3, 0x36f, 0x219, 0x60c, 0x60e, 0x614, 0x377, 0x391, 0x379, 0x660, 0x5c0, 0x5c4, 0xd4b, 0x5c6,
+		0x5c8, 0xd72, 0x5cc, 0x5ce, 0x5d0, 0x5d2, 0x5d4, 0x5d6, 0x5d8, 0x5da, 0x5dc, 0x5e0, 0xd62, 0x5e2, 0xfcf, 0x5e4,
+		0x5e6, 0xdd0, 0x5e8, 0xde1, 0xfd1, 0xd6e, 0x6, 0x5f0, 0x624, 0x5f2, 0x5f4, 0x62a, 0x5fc, 0x369, 0x61e, 0x36d,
+		0x5fe, 0x38f, 0x600, 0xd3e, 0x19, 0x60a, 0xfd3, 0x36f, 0x219, 0x60c, 0x60e, 0x614, 0x377, 0x391, 0x379, 0x660,
+		0x5c0, 0x0, 0xd4b, 0x5c6, 0x0, 0x0, 0x5cc, 0x0, 0x0, 0x5d2, 0x5d4, 0x0, 0x0, 0x5da, 0x5dc, 0x5e0, 0xd62, 0x0,
+		0xfcf, 0x5e4, 0x5e6, 0xdd0, 0x5e8, 0xde1, 0xfd1, 0xd6e, 0x6, 0x5f0, 0x624, 0x5f2, 0x0, 0x62a, 0x0, 0x369, 0x61e,
+		0x36d, 0x5fe, 0x38f, 0x600, 0xd3e, 0x0, 0x60a, 0xfd3, 0x36f, 0x219, 0x60c, 0x60e, 0x614, 0x377, 0x391, 0x379,
+		0x660, 0x5c0, 0x5c4, 0xd4b, 0x5c6, 0x5c8, 0xd72, 0x5cc, 0x5ce, 0x5d0, 0x5d2, 0x5d4, 0x5d6, 0x5d8, 0x5da, 0x5dc,
+		0x5e0, 0xd62, 0x5e2, 0xfcf, 0x5e4, 0x5e6, 0xdd0, 0x5e8, 0xde1, 0xfd1, 0xd6e, 0x6, 0x5f0, 0x624, 0x5f2, 0x5f4,
+		0x62a, 0x5fc, 0x369, 0x61e, 0x36d, 0x5fe, 0x38f, 0x600, 0xd3e, 0x19, 0x60a, 0xfd3, 0x36f, 0x219, 0x60c, 0x60e,
+		0x614, 0x377, 0x391, 0x379, 0x660, 0x5c0, 0x5c4, 0x0, 0x5c6, 0x5c8, 0xd72, 0x5cc, 0x0, 0x0, 0x5d2, 0x5d4, 0x5d6,
+		0x5d8, 0x5da, 0x5dc, 0x5e0, 0xd62, 0x0, 0xfcf, 0x5e4, 0x5e6, 0xdd0, 0x5e8, 0xde1, 0xfd1, 0x0, 0x6, 0x5f0, 0x624,
+		0x5f2, 0x5f4, 0x62a, 0x5fc, 0x369, 0x61e, 0x36d, 0x5fe, 0x38f, 0x600, 0xd3e, 0x19, 0x60a, 0xfd3, 0x36f, 0x219,
+		0x60c, 0x60e, 0x614, 0x377, 0x391, 0x379, 0x660, 0x5c0, 0x5c4, 0x0, 0x5c6, 0x5c8, 0xd72, 0x5cc, 0x0, 0x5d0,
+		0x5d2, 0x5d4, 0x5d6, 0x5d8, 0x0, 0x5dc, 0x0, 0x0, 0x0, 0xfcf, 0x5e4, 0x5e6, 0xdd0, 0x5e8, 0xde1, 0xfd1, 0x0,
+		0x6, 0x5f0, 0x624, 0x5f2, 0x5f4, 0x62a, 0x5fc, 0x369, 0x61e, 0x36d, 0x5fe, 0x38f, 0x600, 0xd3e, 0x19, 0x60a,
+		0xfd3, 0x36f, 0x219, 0x60c, 0x60e, 0x614, 0x377, 0x391, 0x379, 0x660, 0x5c0, 0x5c4, 0xd4b, 0x5c6, 0x5c8, 0xd72,
+		0x5cc, 0x5ce, 0x5d0, 0x5d2, 0x5d4, 0x5d6, 0x5d8, 0x5da, 0x5dc, 0x5e0, 0xd62, 0x5e2, 0xfcf, 0x5e4, 0x5e6, 0xdd0,
+		0x5e8, 0xde1, 0xfd1, 0xd6e, 0x6, 0x5f0, 0x624, 0x5f2, 0x5f4, 0x62a, 0x5fc, 0x369, 0x61e, 0x36d, 0x5fe, 0x38f,
+		0x600, 0xd3e, 0x19, 0x60a, 0xfd3, 0x36f, 0x219, 0x60c, 0x60e, 0x614, 0x377, 0x391, 0x379, 0x660, 0x5c0, 0x5c4,
+		0xd4b, 0x5c6, 0x5c8, 0xd72, 0x5cc, 0x5ce, 0x5d0, 0x5d2, 0x5d4, 0x5d6, 0x5d8, 0x5da, 0x5dc, 0x5e0, 0xd62, 0x5e2,
+		0xfcf, 0x5e4, 0x5e6, 0xdd0, 0x5e8, 0xde1, 0xfd1, 0xd6e, 0x6, 0x5f0, 0x624, 0x5f2, 0x5f4, 0x62a, 0x5fc, 0x369,
+		0x61e, 0x36d, 0x5fe, 0x38f, 0x600, 0xd3e, 0x19, 0x60a, 0xfd3, 0x36f, 0x219, 0x60c, 0x60e, 0x614, 0x377, 0x391,
+		0x379, 0x660, 0x5c0, 0x5c4, 0xd4b, 0x5c6, 0x5c8, 0xd72, 0x5cc, 0x5ce, 0x5d0, 0x5d2, 0x5d4, 0x5d6, 0x5d8, 0x5da,
+		0x5dc, 0x5e0, 0xd62, 0x5e2, 0xfcf, 0x5e4, 0x5e6, 0xdd0, 0x5e8, 0xde1, 0xfd1, 0xd6e, 0x6, 0x5f0, 0x624, 0x5f2,
+		0x5f4, 0x62a, 0x5fc, 0x369, 0x61e, 0x36d, 0x5fe, 0x38f, 0x600, 0xd3e, 0x19, 0x60a, 0xfd3, 0x36f, 0x219, 0x60c,
+		0x60e, 0x614, 0x377, 0x391, 0x379, 0x660, 0x5c0, 0x5c4, 0xd4b, 0x5c6, 0x5c8, 0xd72, 0x5cc, 0x5ce, 0x5d0, 0x5d2,
+		0x5d4, 0x5d6, 0x5d8, 0x5da, 0x5dc, 0x5e0, 0xd62, 0x5e2, 0xfcf, 0x5e4, 0x5e6, 0xdd0, 0x5e8, 0xde1, 0xfd1, 0xd6e,
+		0x6, 0x5f0, 0x624, 0x5f2, 0x5f4, 0x62a, 0x5fc, 0x369, 0x61e, 0x36d, 0x5fe, 0x38f, 0x600, 0xd3e, 0x19, 0x60a,
+		0xfd3, 0x36f, 0x219, 0x60c, 0x60e, 0x614, 0x377, 0x391, 0x379, 0x660, 0x5c0, 0x5c4, 0xd4b, 0x5c6, 0x5c8, 0xd72,
+		0x5cc, 0x5ce, 0x5d0, 0x5d2, 0x5d4, 0x5d6, 0x5d8, 0x5da, 0x5dc, 0x5e0, 0xd62, 0x5e2, 0xfcf, 0x5e4, 0x5e6, 0xdd0,
+		0x5e8, 0xde1, 0xfd1, 0xd6e, 0x6, 0x5f0, 0x624, 0x5f2, 0x5f4, 0x62a, 0x5fc, 0x369, 0x61e, 0x36d, 0x5fe, 0x38f,
+		0x600, 0xd3e, 0x19, 0x60a, 0xfd3, 0x36f, 0x219, 0x60c, 0x60e, 0x614, 0x377, 0x391, 0x379, 0x660, 0x5c0, 0x5c4,
+		0xd4b, 0x5c6, 0x5c8, 0xd72, 0x5cc, 0x5ce, 0x5d0, 0x5d2, 0x5d4, 0x5d6, 0x5d8, 0x5da, 0x5dc, 0x5e0, 0xd62, 0x5e2,
+		0xfcf, 0x5e4, 0x5e6, 0xdd0, 0x5e8, 0xde1, 0xfd1, 0xd6e, 0x6, 0x5f0, 0x624, 0x5f2, 0x5f4, 0x62a, 0x5fc, 0x369,
+		0x61e, 0x36d, 0x5fe, 0x38f, 0x600, 0xd3e, 0x19, 0x60a, 0xfd3, 0x36f, 0x219, 0x60c, 0x60e, 0x614, 0x377, 0x391,
+		0x379, 0x660, 0x238a, 0x238c, 0x0, 0x0, 0x238e, 0x2390, 0xd80, 0x2392, 0x2394, 0x2396, 0x2398, 0x402, 0x239a,
+		0x239c, 0x239e, 0x23a0, 0x23a2, 0x23a4, 0x23a6, 0xd82, 0x23a8, 0x402, 0x406, 0x23aa, 0x3f0, 0x23ac, 0x23ae,
+		0x23b0, 0xd70, 0x23b2, 0x23b4, 0x3ec, 0x618, 0x61a, 0x404, 0x23b6, 0x23b8, 0x3ee, 0xc3b, 0x3fc, 0x23ba, 0x12,
+		0x23bc, 0x23be, 0x23c0, 0x3fa, 0x3fe, 0x400, 0x23c2, 0x23c4, 0x23c6, 0x3f8, 0x61c, 0x23c8, 0x23ca, 0x23cc,
+		0x404, 0x3ee, 0x3fc, 0x3f8, 0x3fe, 0x3fa, 0x238e, 0x2390, 0xd80, 0x2392, 0x2394, 0x2396, 0x2398, 0x402, 0x239a,
+		0x239c, 0x239e, 0x23a0, 0x23a2, 0x23a4, 0x23a6, 0xd82, 0x23a8, 0x402, 0x406, 0x23aa, 0x3f0, 0x23ac, 0x23ae,
+		0x23b0, 0xd70, 0x23b2, 0x23b4, 0x3ec, 0x618, 0x61a, 0x404, 0x23b6, 0x23b8, 0x3ee, 0xc3b, 0x3fc, 0x23ba, 0x12,
+		0x23bc, 0x23be, 0x23c0, 0x3fa, 0x3fe, 0x400, 0x23c2, 0x23c4, 0x23c6, 0x3f8, 0x61c, 0x23c8, 0x23ca, 0x23cc,
+		0x404, 0x3ee, 0x3fc, 0x3f8, 0x3fe, 0x3fa, 0x238e, 0x2390, 0xd80, 0x2392, 0x2394, 0x2396, 0x2398, 0x402, 0x239a,
+		0x239c, 0x239e, 0x23a0, 0x23a2, 0x23a4, 0x23a6, 0xd82, 0x23a8, 0x402, 0x406, 0x23aa, 0x3f0, 0x23ac, 0x23ae,
+		0x23b0, 0xd70, 0x23b2, 0x23b4, 0x3ec, 0x618, 0x61a, 0x404, 0x23b6, 0x23b8, 0x3ee, 0xc3b, 0x3fc, 0x23ba, 0x12,
+		0x23bc, 0x23be, 0x23c0, 0x3fa, 0x3fe, 0x400, 0x23c2, 0x23c4, 0x23c6, 0x3f8, 0x61c, 0x23c8, 0x23ca, 0x23cc,
+		0x404, 0x3ee, 0x3fc, 0x3f8, 0x3fe, 0x3fa, 0x238e, 0x2390, 0xd80, 0x2392, 0x2394, 0x2396, 0x2398, 0x402, 0x239a,
+		0x239c, 0x239e, 0x23a0, 0x23a2, 0x23a4, 0x23a6, 0xd82, 0x23a8, 0x402, 0x406, 0x23aa, 0x3f0, 0x23ac, 0x23ae,
+		0x23b0, 0xd70, 0x23b2, 0x23b4, 0x3ec, 0x618, 0x61a, 0x404, 0x23b6, 0x23b8, 0x3ee, 0xc3b, 0x3fc, 0x23ba, 0x12,
+		0x23bc, 0x23be, 0x23c0, 0x3fa, 0x3fe, 0x400, 0x23c2, 0x23c4, 0x23c6, 0x3f8, 0x61c, 0x23c8, 0x23ca, 0x23cc,
+		0x404, 0x3ee, 0x3fc, 0x3f8, 0x3fe, 0x3fa, 0x238e, 0x2390, 0xd80, 0x2392, 0x2394, 0x2396, 0x2398, 0x402, 0x239a,
+		0x239c, 0x239e, 0x23a0, 0x23a2, 0x23a4, 0x23a6, 0xd82, 0x23a8, 0x402, 0x406, 0x23aa, 0x3f0, 0x23ac, 0x23ae,
+		0x23b0, 0xd70, 0x23b2, 0x23b4, 0x3ec, 0x618, 0x61a, 0x404, 0x23b6, 0x23b8, 0x3ee, 0xc3b, 0x3fc, 0x23ba, 0x12,
+		0x23bc, 0x23be, 0x23c0, 0x3fa, 0x3fe, 0x400, 0x23c2, 0x23c4, 0x23c6, 0x3f8, 0x61c, 0x23c8, 0x23ca, 0x23cc,
+		0x404, 0x3ee, 0x3fc, 0x3f8, 0x3fe, 0x3fa, 0x23ce, 0x23d0, 0x0, 0x0, 0xd26, 0x17, 0xb, 0xd, 0xd28, 0xd2a, 0xd2c,
+		0xd2e, 0xd30, 0xd32, 0xd26, 0x17, 0xb, 0xd, 0xd28, 0xd2a, 0xd2c, 0xd2e, 0xd30, 0xd32, 0xd26, 0x17, 0xb, 0xd,
+		0xd28, 0xd2a, 0xd2c, 0xd2e, 0xd30, 0xd32, 0xd26, 0x17, 0xb, 0xd, 0xd28, 0xd2a, 0xd2c, 0xd2e, 0xd30, 0xd32,
+		0xd26, 0x17, 0xb, 0xd, 0xd28, 0xd2a, 0xd2c, 0xd2e, 0xd30, 0xd32, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x23d2, 0x23d4, 0x23d6,
+		0x23d8, 0x23da, 0x23dc, 0x23de, 0x23e0, 0x23e2, 0x23e4, 0x23e6, 0x23e8, 0x23ea, 0x23ec, 0x23ee, 0x23f0, 0x23f2,
+		0x23f4, 0x23f6, 0x23f8, 0x23fa, 0x23fc, 0x23fe, 0x2400, 0x2402, 0x2404, 0x2406, 0x2408, 0x240a, 0x240c, 0x240e,
+		0x2410, 0x2412, 0x23d2, 0x23d4, 0x23d6, 0x23d8, 0x23da, 0x23dc, 0x23de, 0x23e0, 0x23e2, 0x23e4, 0x23e6, 0x23ea,
+		0x23ec, 0x23f0, 0x23f4, 0x23f6, 0x23f8, 0x23fa, 0x23fc, 0x23fe, 0x19be, 0x2400, 0x2414, 0x240a, 0x2416, 0x2418,
+		0x241a, 0x241c, 0x241e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x2238, 0x223a, 0x2242, 0x2248, 0x0, 0x226e, 0x224e, 0x2244, 0x2258, 0x2270, 0x2264, 0x2266, 0x2268,
+		0x226a, 0x2250, 0x225c, 0x2260, 0x2254, 0x2262, 0x224c, 0x2252, 0x223e, 0x2240, 0x2246, 0x224a, 0x2256, 0x225a,
+		0x225e, 0x2420, 0x1dc8, 0x2422, 0x2424, 0x0, 0x223a, 0x2242, 0x0, 0x226c, 0x0, 0x0, 0x2244, 0x0, 0x2270, 0x2264,
+		0x2266, 0x2268, 0x226a, 0x2250, 0x225c, 0x2260, 0x2254, 0x2262, 0x0, 0x2252, 0x223e, 0x2240, 0x2246, 0x0,
+		0x2256, 0x0, 0x225e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2242, 0x0, 0x0, 0x0, 0x0, 0x2244, 0x0, 0x2270, 0x0, 0x2266,
+		0x0, 0x226a, 0x2250, 0x225c, 0x0, 0x2254, 0x2262, 0x0, 0x2252, 0x0, 0x0, 0x2246, 0x0, 0x2256, 0x0, 0x225e, 0x0,
+		0x1dc8, 0x0, 0x2424, 0x0, 0x223a, 0x2242, 0x0, 0x226c, 0x0, 0x0, 0x2244, 0x2258, 0x2270, 0x2264, 0x0, 0x2268,
+		0x226a, 0x2250, 0x225c, 0x2260, 0x2254, 0x2262, 0x0, 0x2252, 0x223e, 0x2240, 0x2246, 0x0, 0x2256, 0x225a,
+		0x225e, 0x2420, 0x0, 0x2422, 0x0, 0x2238, 0x223a, 0x2242, 0x2248, 0x226c, 0x226e, 0x224e, 0x2244, 0x2258,
+		0x2270, 0x0, 0x2266, 0x2268, 0x226a, 0x2250, 0x225c, 0x2260, 0x2254, 0x2262, 0x224c, 0x2252, 0x223e, 0x2240,
+		0x2246, 0x224a, 0x2256, 0x225a, 0x225e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x223a, 0x2242, 0x2248, 0x0, 0x226e, 0x224e,
+		0x2244, 0x2258, 0x2270, 0x0, 0x2266, 0x2268, 0x226a, 0x2250, 0x225c, 0x2260, 0x2254, 0x2262, 0x224c, 0x2252,
+		0x223e, 0x2240, 0x2246, 0x224a, 0x2256, 0x225a, 0x225e, 0x0, 0x0, 0x0, 0x0, 0x2426, 0x2429, 0x242c, 0x242f,
+		0x2432, 0x2435, 0x2438, 0x243b, 0x243e, 0x2441, 0x2444, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2447, 0x244b, 0x244f, 0x2453,
+		0x2457, 0x245b, 0x245f, 0x2463, 0x2467, 0x246b, 0x246f, 0x2473, 0x2477, 0x247b, 0x247f, 0x2483, 0x2487, 0x248b,
+		0x248f, 0x2493, 0x2497, 0x249b, 0x249f, 0x24a3, 0x24a7, 0x24ab, 0x24af, 0xd4b, 0x5e2, 0x24b3, 0x24b6, 0x0,
+		0x5c0, 0x5c4, 0xd4b, 0x5c6, 0x5c8, 0xd72, 0x5cc, 0x5ce, 0x5d0, 0x5d2, 0x5d4, 0x5d6, 0x5d8, 0x5da, 0x5dc, 0x5e0,
+		0xd62, 0x5e2, 0xfcf, 0x5e4, 0x5e6, 0xdd0, 0x5e8, 0xde1, 0xfd1, 0xd6e, 0x24b9, 0x18c5, 0x24bc, 0x24bf, 0x24c2,
+		0x24c6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x24c9, 0x24cc, 0x24cf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x24d2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x24d5, 0x24d8, 0x1571, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x106c, 0x24db, 0x24dd, 0x1221, 0xffa, 0x24df, 0x24e1, 0x1326, 0x24e3, 0x24e5, 0x24e7, 0x1b36, 0x24e9,
+		0x24eb, 0x24ed, 0x24ef, 0x24f1, 0x24f3, 0x10b4, 0x24f5, 0x24f7, 0x24f9, 0x24fb, 0x24fd, 0x24ff, 0xfee, 0x1316,
+		0x2501, 0x14e7, 0x131c, 0x14e9, 0x2503, 0x1124, 0x2505, 0x2507, 0x2509, 0x250b, 0x250d, 0x14c5, 0x1080, 0x250f,
+		0x2511, 0x2513, 0x2515, 0x0, 0x0, 0x0, 0x0, 0x2517, 0x251b, 0x251f, 0x2523, 0x2527, 0x252b, 0x252f, 0x2533,
+		0x2537, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x253b, 0x253d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd26, 0x17, 0xb, 0xd,
+		0xd28, 0xd2a, 0xd2c, 0xd2e, 0xd30, 0xd32, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x253f, 0x2541, 0x2543, 0x2545, 0x2547,
+		0x1bf0, 0x2549, 0x254b, 0x254d, 0x254f, 0x1bf2, 0x2551, 0x2553, 0x2555, 0x1bf4, 0x2557, 0x2559, 0x255b, 0x255d,
+		0x255f, 0x2561, 0x24ed, 0x2563, 0x2565, 0x2567, 0x2569, 0x256b, 0x1c62, 0x256d, 0x100e, 0x256f, 0x2571, 0x2573,
+		0x2575, 0x2511, 0x2577, 0x2579, 0x1c6c, 0x1bf6, 0x1bf8, 0x1c6e, 0x257b, 0x257d, 0x1a8a, 0x257f, 0x1bfa, 0x2581,
+		0x2583, 0x2585, 0x2587, 0x2587, 0x2587, 0x2589, 0x258b, 0x258d, 0x258f, 0x2591, 0x2593, 0x2595, 0x2597, 0x2599,
+		0x259b, 0x259d, 0x259f, 0x25a1, 0x25a3, 0x25a5, 0x25a7, 0x25a9, 0x25ab, 0x25ab, 0x1c72, 0x25ad, 0x25af, 0x25b1,
+		0x25b3, 0x1bfe, 0x25b5, 0x25b7, 0x25b9, 0x1bae, 0x25bb, 0x25bd, 0x25bf, 0x25c1, 0x25c3, 0x25c5, 0x25c7, 0x25c9,
+		0x25cb, 0x25cd, 0x25cf, 0x25d1, 0x24df, 0x25d3, 0x25d5, 0x25d7, 0x25d9, 0x25db, 0x25dd, 0x25df, 0x25e1, 0x25e3,
+		0x25e5, 0x25e7, 0x25e9, 0x25eb, 0x25eb, 0x25ed, 0x25ef, 0x25f1, 0x1a82, 0x25f3, 0x25f5, 0x25f7, 0x25f9, 0x25fb,
+		0x1042, 0x25fd, 0x25ff, 0x1046, 0x2601, 0x2603, 0x2605, 0x2607, 0x2609, 0x260b, 0x260d, 0x260f, 0x2611, 0x2613,
+		0x2615, 0x2617, 0x2619, 0x261b, 0x261d, 0x261f, 0x2621, 0x2623, 0x2625, 0x2627, 0x2629, 0x1a1a, 0x262b, 0x105a,
+		0x262d, 0x262d, 0x262f, 0x2631, 0x2631, 0x2633, 0x2635, 0x2637, 0x2639, 0x263b, 0x263d, 0x263f, 0x2641, 0x2643,
+		0x2645, 0x2647, 0x2649, 0x264b, 0x1c08, 0x264d, 0x264f, 0x2651, 0x2653, 0x1c8a, 0x2653, 0x2655, 0x1c0c, 0x2657,
+		0x2659, 0x265b, 0x265d, 0x1c0e, 0x19e4, 0x265f, 0x2661, 0x2663, 0x2665, 0x2667, 0x2669, 0x266b, 0x266d, 0x266f,
+		0x2671, 0x2673, 0x2675, 0x2677, 0x2679, 0x267b, 0x267d, 0x267f, 0x2681, 0x2683, 0x2685, 0x2687, 0x2689, 0x1c10,
+		0x268b, 0x268d, 0x268f, 0x2691, 0x2693, 0x2695, 0x1c14, 0x2697, 0x2699, 0x269b, 0x269d, 0x269f, 0x26a1, 0x26a3,
+		0x26a5, 0x1a1c, 0x1c9a, 0x26a7, 0x26a9, 0x26ab, 0x26ad, 0x26af, 0x26b1, 0x26b3, 0x26b5, 0x1c16, 0x26b7, 0x26b9,
+		0x26bb, 0x26bd, 0x1cee, 0x26bf, 0x26c1, 0x26c3, 0x26c5, 0x26c7, 0x26c9, 0x26cb, 0x26cd, 0x26cf, 0x26d1, 0x26d3,
+		0x26d5, 0x26d7, 0x1aa4, 0x26d9, 0x26db, 0x26dd, 0x26df, 0x26e1, 0x26e3, 0x26e5, 0x26e7, 0x26e9, 0x26eb, 0x26ed,
+		0x1c18, 0x1b4a, 0x26ef, 0x26f1, 0x26f3, 0x26f5, 0x26f7, 0x26f9, 0x26fb, 0x26fd, 0x1ca0, 0x26ff, 0x2701, 0x2703,
+		0x2705, 0x2707, 0x2709, 0x270b, 0x270d, 0x1ca2, 0x270f, 0x2711, 0x2713, 0x2715, 0x2717, 0x2719, 0x271b, 0x271d,
+		0x271f, 0x2721, 0x2723, 0x2725, 0x1ca6, 0x2727, 0x2729, 0x272b, 0x272d, 0x272f, 0x2731, 0x2733, 0x2735, 0x2737,
+		0x2739, 0x273b, 0x273b, 0x273d, 0x273f, 0x1caa, 0x2741, 0x2743, 0x2745, 0x2747, 0x2749, 0x274b, 0x274d, 0x1a88,
+		0x274f, 0x2751, 0x2753, 0x2755, 0x2757, 0x2759, 0x275b, 0x1cb6, 0x275d, 0x275f, 0x2761, 0x2763, 0x2765, 0x2767,
+		0x2767, 0x1cb8, 0x1cf2, 0x2769, 0x276b, 0x276d, 0x276f, 0x2771, 0x1a3e, 0x1cbc, 0x2773, 0x2775, 0x1c2c, 0x2777,
+		0x2779, 0x1bd6, 0x277b, 0x277d, 0x1c32, 0x277f, 0x2781, 0x2783, 0x2785, 0x2785, 0x2787, 0x2789, 0x278b, 0x278d,
+		0x278f, 0x2791, 0x2793, 0x2795, 0x2797, 0x2799, 0x279b, 0x279d, 0x279f, 0x27a1, 0x27a3, 0x27a5, 0x27a7, 0x27a9,
+		0x27ab, 0x27ad, 0x27af, 0x27b1, 0x27b3, 0x27b5, 0x27b7, 0x27b9, 0x27bb, 0x1c3e, 0x27bd, 0x27bf, 0x27c1, 0x27c3,
+		0x27c5, 0x27c7, 0x27c9, 0x27cb, 0x27cd, 0x27cf, 0x27d1, 0x27d3, 0x27d5, 0x27d7, 0x27d9, 0x27db, 0x262f, 0x27dd,
+		0x27df, 0x27e1, 0x27e3, 0x27e5, 0x27e7, 0x27e9, 0x27eb, 0x27ed, 0x27ef, 0x27f1, 0x27f3, 0x1aaa, 0x27f5, 0x27f7,
+		0x27f9, 0x27fb, 0x27fd, 0x27ff, 0x1c44, 0x2801, 0x2803, 0x2805, 0x2807, 0x2809, 0x280b, 0x280d, 0x280f, 0x2811,
+		0x2813, 0x2815, 0x2817, 0x2819, 0x281b, 0x281d, 0x281f, 0x2821, 0x2823, 0x2825, 0x2827, 0x1a34, 0x2829, 0x282b,
+		0x282d, 0x282f, 0x2831, 0x2833, 0x1cca, 0x2835, 0x2837, 0x2839, 0x283b, 0x283d, 0x283f, 0x2841, 0x2843, 0x110e,
+		0x2845, 0x2847, 0x2849, 0x284b, 0x284d, 0x284f, 0x2851, 0x2853, 0x2855, 0x2857, 0x2859, 0x1cd4, 0x1cd6, 0x111c,
+		0x285b, 0x285d, 0x285f, 0x2861, 0x2863, 0x2865, 0x2867, 0x2869, 0x286b, 0x286d, 0x286f, 0x2871, 0x1cd8, 0x2873,
+		0x2875, 0x2877, 0x2879, 0x287b, 0x287d, 0x287f, 0x2881, 0x2883, 0x2885, 0x2887, 0x2889, 0x288b, 0x288d, 0x288f,
+		0x2891, 0x2893, 0x2895, 0x2897, 0x2899, 0x289b, 0x289d, 0x289f, 0x28a1, 0x28a3, 0x28a5, 0x28a7, 0x28a9, 0x28ab,
+		0x28ad, 0x1ce4, 0x1ce4, 0x28af, 0x28b1, 0x28b3, 0x28b5, 0x28b7, 0x28b9, 0x28bb, 0x28bd, 0x28bf, 0x28c1, 0x1ce6,
+		0x28c3, 0x28c5, 0x28c7, 0x28c9, 0x28cb, 0x28cd, 0x28cf, 0x28d1, 0x28d3, 0x28d5, 0x117c, 0x28d7, 0x1184, 0x28d9,
+		0x28db, 0x28dd, 0x28df, 0x118e, 0x28e1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+		0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+		}
+	};
+
+	// decompositions as a length followed by the code points
+	inline constexpr char32_t kDecompositionPool[10467] = {
+		0x0, 0x1, 0x20, 0x2, 0x20, 0x308, 0x1, 0x61, 0x2, 0x20, 0x304, 0x1, 0x32, 0x1, 0x33, 0x2, 0x20, 0x301, 0x1,
+		0x3bc, 0x2, 0x20, 0x327, 0x1, 0x31, 0x1, 0x6f, 0x3, 0x31, 0x2044, 0x34, 0x3, 0x31, 0x2044, 0x32, 0x3, 0x33,
+		0x2044, 0x34, 0x2, 0x41, 0x300, 0x2, 0x41, 0x301, 0x2, 0x41, 0x302, 0x2, 0x41, 0x303, 0x2, 0x41, 0x308, 0x2,
+		0x41, 0x30a, 0x2, 0x43, 0x327, 0x2, 0x45, 0x300, 0x2, 0x45, 0x301, 0x2, 0x45, 0x302, 0x2, 0x45, 0x308, 0x2,
+		0x49, 0x300, 0x2, 0x49, 0x301, 0x2, 0x49, 0x302, 0x2, 0x49, 0x308, 0x2, 0x4e, 0x303, 0x2, 0x4f, 0x300, 0x2,
+		0x4f, 0x301, 0x2, 0x4f, 0x302, 0x2, 0x4f, 0x303, 0x2, 0x4f, 0x308, 0x2, 0x55, 0x300, 0x2, 0x55, 0x301, 0x2,
+		0x55, 0x302, 0x2, 0x55, 0x308, 0x2, 0x59, 0x301, 0x2, 0x61, 0x300, 0x2, 0x61, 0x301, 0x2, 0x61, 0x302, 0x2,
+		0x61, 0x303, 0x2, 0x61, 0x308, 0x2, 0x61, 0x30a, 0x2, 0x63, 0x327, 0x2, 0x65, 0x300, 0x2, 0x65, 0x301, 0x2,
+		0x65, 0x302, 0x2, 0x65, 0x308, 0x2, 0x69, 0x300, 0x2, 0x69, 0x301, 0x2, 0x69, 0x302, 0x2, 0x69, 0x308, 0x2,
+		0x6e, 0x303, 0x2, 0x6f, 0x300, 0x2, 0x6f, 0x301, 0x2, 0x6f, 0x302, 0x2, 0x6f, 0x303, 0x2, 0x6f, 0x308, 0x2,
+		0x75, 0x300, 0x2, 0x75, 0x301, 0x2, 0x75, 0x302, 0x2, 0x75, 0x308, 0x2, 0x79, 0x301, 0x2, 0x79, 0x308, 0x2,
+		0x41, 0x304, 0x2, 0x61, 0x304, 0x2, 0x41, 0x306, 0x2, 0x61, 0x306, 0x2, 0x41, 0x328, 0x2, 0x61, 0x328, 0x2,
+		0x43, 0x301, 0x2, 0x63, 0x301, 0x2, 0x43, 0x302, 0x2, 0x63, 0x302, 0x2, 0x43, 0x307, 0x2, 0x63, 0x307, 0x2,
+		0x43, 0x30c, 0x2, 0x63, 0x30c, 0x2, 0x44, 0x30c, 0x2, 0x64, 0x30c, 0x2, 0x45, 0x304, 0x2, 0x65, 0x304, 0x2,
+		0x45, 0x306, 0x2, 0x65, 0x306, 0x2, 0x45, 0x307, 0x2, 0x65, 0x307, 0x2, 0x45, 0x328, 0x2, 0x65, 0x328, 0x2,
+		0x45, 0x30c, 0x2, 0x65, 0x30c, 0x2, 0x47, 0x302, 0x2, 0x67, 0x302, 0x2, 0x47, 0x306, 0x2, 0x67, 0x306, 0x2,
+		0x47, 0x307, 0x2, 0x67, 0x307, 0x2, 0x47, 0x327, 0x2, 0x67, 0x327, 0x2, 0x48, 0x302, 0x2, 0x68, 0x302, 0x2,
+		0x49, 0x303, 0x2, 0x69, 0x303, 0x2, 0x49, 0x304, 0x2, 0x69, 0x304, 0x2, 0x49, 0x306, 0x2, 0x69, 0x306, 0x2,
+		0x49, 0x328, 0x2, 0x69, 0x328, 0x2, 0x49, 0x307, 0x2, 0x49, 0x4a, 0x2, 0x69, 0x6a, 0x2, 0x4a, 0x302, 0x2, 0x6a,
+		0x302, 0x2, 0x4b, 0x327, 0x2, 0x6b, 0x327, 0x2, 0x4c, 0x301, 0x2, 0x6c, 0x301, 0x2, 0x4c, 0x327, 0x2, 0x6c,
+		0x327, 0x2, 0x4c, 0x30c, 0x2, 0x6c, 0x30c, 0x2, 0x4c, 0xb7, 0x2, 0x6c, 0xb7, 0x2, 0x4e, 0x301, 0x2, 0x6e, 0x301,
+		0x2, 0x4e, 0x327, 0x2, 0x6e, 0x327, 0x2, 0x4e, 0x30c, 0x2, 0x6e, 0x30c, 0x2, 0x2bc, 0x6e, 0x2, 0x4f, 0x304, 0x2,
+		0x6f, 0x304, 0x2, 0x4f, 0x306, 0x2, 0x6f, 0x306, 0x2, 0x4f, 0x30b, 0x2, 0x6f, 0x30b, 0x2, 0x52, 0x301, 0x2,
+		0x72, 0x301, 0x2, 0x52, 0x327, 0x2, 0x72, 0x327, 0x2, 0x52, 0x30c, 0x2, 0x72, 0x30c, 0x2, 0x53, 0x301, 0x2,
+		0x73, 0x301, 0x2, 0x53, 0x302, 0x2, 0x73, 0x302, 0x2, 0x53, 0x327, 0x2, 0x73, 0x327, 0x2, 0x53, 0x30c, 0x2,
+		0x73, 0x30c, 0x2, 0x54, 0x327, 0x2, 0x74, 0x327, 0x2, 0x54, 0x30c, 0x2, 0x74, 0x30c, 0x2, 0x55, 0x303, 0x2,
+		0x75, 0x303, 0x2, 0x55, 0x304, 0x2, 0x75, 0x304, 0x2, 0x55, 0x306, 0x2, 0x75, 0x306, 0x2, 0x55, 0x30a, 0x2,
+		0x75, 0x30a, 0x2, 0x55, 0x30b, 0x2, 0x75, 0x30b, 0x2, 0x55, 0x328, 0x2, 0x75, 0x328, 0x2, 0x57, 0x302, 0x2,
+		0x77, 0x302, 0x2, 0x59, 0x302, 0x2, 0x79, 0x302, 0x2, 0x59, 0x308, 0x2, 0x5a, 0x301, 0x2, 0x7a, 0x301, 0x2,
+		0x5a, 0x307, 0x2, 0x7a, 0x307, 0x2, 0x5a, 0x30c, 0x2, 0x7a, 0x30c, 0x1, 0x73, 0x2, 0x4f, 0x31b, 0x2, 0x6f,
+		0x31b, 0x2, 0x55, 0x31b, 0x2, 0x75, 0x31b, 0x3, 0x44, 0x5a, 0x30c, 0x3, 0x44, 0x7a, 0x30c, 0x3, 0x64, 0x7a,
+		0x30c, 0x2, 0x4c, 0x4a, 0x2, 0x4c, 0x6a, 0x2, 0x6c, 0x6a, 0x2, 0x4e, 0x4a, 0x2, 0x4e, 0x6a, 0x2, 0x6e, 0x6a,
+		0x2, 0x41, 0x30c, 0x2, 0x61, 0x30c, 0x2, 0x49, 0x30c, 0x2, 0x69, 0x30c, 0x2, 0x4f, 0x30c, 0x2, 0x6f, 0x30c, 0x2,
+		0x55, 0x30c, 0x2, 0x75, 0x30c, 0x3, 0x55, 0x308, 0x304, 0x3, 0x75, 0x308, 0x304, 0x3, 0x55, 0x308, 0x301, 0x3,
+		0x75, 0x308, 0x301, 0x3, 0x55, 0x308, 0x30c, 0x3, 0x75, 0x308, 0x30c, 0x3, 0x55, 0x308, 0x300, 0x3, 0x75, 0x308,
+		0x300, 0x3, 0x41, 0x308, 0x304, 0x3, 0x61, 0x308, 0x304, 0x3, 0x41, 0x307, 0x304, 0x3, 0x61, 0x307, 0x304, 0x2,
+		0xc6, 0x304, 0x2, 0xe6, 0x304, 0x2, 0x47, 0x30c, 0x2, 0x67, 0x30c, 0x2, 0x4b, 0x30c, 0x2, 0x6b, 0x30c, 0x2,
+		0x4f, 0x328, 0x2, 0x6f, 0x328, 0x3, 0x4f, 0x328, 0x304, 0x3, 0x6f, 0x328, 0x304, 0x2, 0x1b7, 0x30c, 0x2, 0x292,
+		0x30c, 0x2, 0x6a, 0x30c, 0x2, 0x44, 0x5a, 0x2, 0x44, 0x7a, 0x2, 0x64, 0x7a, 0x2, 0x47, 0x301, 0x2, 0x67, 0x301,
+		0x2, 0x4e, 0x300, 0x2, 0x6e, 0x300, 0x3, 0x41, 0x30a, 0x301, 0x3, 0x61, 0x30a, 0x301, 0x2, 0xc6, 0x301, 0x2,
+		0xe6, 0x301, 0x2, 0xd8, 0x301, 0x2, 0xf8, 0x301, 0x2, 0x41, 0x30f, 0x2, 0x61, 0x30f, 0x2, 0x41, 0x311, 0x2,
+		0x61, 0x311, 0x2, 0x45, 0x30f, 0x2, 0x65, 0x30f, 0x2, 0x45, 0x311, 0x2, 0x65, 0x311, 0x2, 0x49, 0x30f, 0x2,
+		0x69, 0x30f, 0x2, 0x49, 0x311, 0x2, 0x69, 0x311, 0x2, 0x4f, 0x30f, 0x2, 0x6f, 0x30f, 0x2, 0x4f, 0x311, 0x2,
+		0x6f, 0x311, 0x2, 0x52, 0x30f, 0x2, 0x72, 0x30f, 0x2, 0x52, 0x311, 0x2, 0x72, 0x311, 0x2, 0x55, 0x30f, 0x2,
+		0x75, 0x30f, 0x2, 0x55, 0x311, 0x2, 0x75, 0x311, 0x2, 0x53, 0x326, 0x2, 0x73, 0x326, 0x2, 0x54, 0x326, 0x2,
+		0x74, 0x326, 0x2, 0x48, 0x30c, 0x2, 0x68, 0x30c, 0x2, 0x41, 0x307, 0x2, 0x61, 0x307, 0x2, 0x45, 0x327, 0x2,
+		0x65, 0x327, 0x3, 0x4f, 0x308, 0x304, 0x3, 0x6f, 0x308, 0x304, 0x3, 0x4f, 0x303, 0x304, 0x3, 0x6f, 0x303, 0x304,
+		0x2, 0x4f, 0x307, 0x2, 0x6f, 0x307, 0x3, 0x4f, 0x307, 0x304, 0x3, 0x6f, 0x307, 0x304, 0x2, 0x59, 0x304, 0x2,
+		0x79, 0x304, 0x1, 0x68, 0x1, 0x266, 0x1, 0x6a, 0x1, 0x72, 0x1, 0x279, 0x1, 0x27b, 0x1, 0x281, 0x1, 0x77, 0x1,
+		0x79, 0x2, 0x20, 0x306, 0x2, 0x20, 0x307, 0x2, 0x20, 0x30a, 0x2, 0x20, 0x328, 0x2, 0x20, 0x303, 0x2, 0x20,
+		0x30b, 0x1, 0x263, 0x1, 0x6c, 0x1, 0x78, 0x1, 0x295, 0x1, 0x300, 0x1, 0x301, 0x1, 0x313, 0x2, 0x308, 0x301, 0x1,
+		0x2b9, 0x2, 0x20, 0x345, 0x1, 0x3b, 0x2, 0xa8, 0x301, 0x3, 0x20, 0x308, 0x301, 0x2, 0x391, 0x301, 0x1, 0xb7,
+		0x2, 0x395, 0x301, 0x2, 0x397, 0x301, 0x2, 0x399, 0x301, 0x2, 0x39f, 0x301, 0x2, 0x3a5, 0x301, 0x2, 0x3a9,
+		0x301, 0x3, 0x3b9, 0x308, 0x301, 0x2, 0x399, 0x308, 0x2, 0x3a5, 0x308, 0x2, 0x3b1, 0x301, 0x2, 0x3b5, 0x301,
+		0x2, 0x3b7, 0x301, 0x2, 0x3b9, 0x301, 0x3, 0x3c5, 0x308, 0x301, 0x2, 0x3b9, 0x308, 0x2, 0x3c5, 0x308, 0x2,
+		0x3bf, 0x301, 0x2, 0x3c5, 0x301, 0x2, 0x3c9, 0x301, 0x1, 0x3b2, 0x1, 0x3b8, 0x1, 0x3a5, 0x2, 0x3d2, 0x301, 0x2,
+		0x3d2, 0x308, 0x1, 0x3c6, 0x1, 0x3c0, 0x1, 0x3ba, 0x1, 0x3c1, 0x1, 0x3c2, 0x1, 0x398, 0x1, 0x3b5, 0x1, 0x3a3,
+		0x2, 0x415, 0x300, 0x2, 0x415, 0x308, 0x2, 0x413, 0x301, 0x2, 0x406, 0x308, 0x2, 0x41a, 0x301, 0x2, 0x418,
+		0x300, 0x2, 0x423, 0x306, 0x2, 0x418, 0x306, 0x2, 0x438, 0x306, 0x2, 0x435, 0x300, 0x2, 0x435, 0x308, 0x2,
+		0x433, 0x301, 0x2, 0x456, 0x308, 0x2, 0x43a, 0x301, 0x2, 0x438, 0x300, 0x2, 0x443, 0x306, 0x2, 0x474, 0x30f,
+		0x2, 0x475, 0x30f, 0x2, 0x416, 0x306, 0x2, 0x436, 0x306, 0x2, 0x410, 0x306, 0x2, 0x430, 0x306, 0x2, 0x410,
+		0x308, 0x2, 0x430, 0x308, 0x2, 0x415, 0x306, 0x2, 0x435, 0x306, 0x2, 0x4d8, 0x308, 0x2, 0x4d9, 0x308, 0x2,
+		0x416, 0x308, 0x2, 0x436, 0x308, 0x2, 0x417, 0x308, 0x2, 0x437, 0x308, 0x2, 0x418, 0x304, 0x2, 0x438, 0x304,
+		0x2, 0x418, 0x308, 0x2, 0x438, 0x308, 0x2, 0x41e, 0x308, 0x2, 0x43e, 0x308, 0x2, 0x4e8, 0x308, 0x2, 0x4e9,
+		0x308, 0x2, 0x42d, 0x308, 0x2, 0x44d, 0x308, 0x2, 0x423, 0x304, 0x2, 0x443, 0x304, 0x2, 0x423, 0x308, 0x2,
+		0x443, 0x308, 0x2, 0x423, 0x30b, 0x2, 0x443, 0x30b, 0x2, 0x427, 0x308, 0x2, 0x447, 0x308, 0x2, 0x42b, 0x308,
+		0x2, 0x44b, 0x308, 0x2, 0x565, 0x582, 0x2, 0x627, 0x653, 0x2, 0x627, 0x654, 0x2, 0x648, 0x654, 0x2, 0x627,
+		0x655, 0x2, 0x64a, 0x654, 0x2, 0x627, 0x674, 0x2, 0x648, 0x674, 0x2, 0x6c7, 0x674, 0x2, 0x64a, 0x674, 0x2,
+		0x6d5, 0x654, 0x2, 0x6c1, 0x654, 0x2, 0x6d2, 0x654, 0x2, 0x928, 0x93c, 0x2, 0x930, 0x93c, 0x2, 0x933, 0x93c,
+		0x2, 0x915, 0x93c, 0x2, 0x916, 0x93c, 0x2, 0x917, 0x93c, 0x2, 0x91c, 0x93c, 0x2, 0x921, 0x93c, 0x2, 0x922,
+		0x93c, 0x2, 0x92b, 0x93c, 0x2, 0x92f, 0x93c, 0x2, 0x9c7, 0x9be, 0x2, 0x9c7, 0x9d7, 0x2, 0x9a1, 0x9bc, 0x2,
+		0x9a2, 0x9bc, 0x2, 0x9af, 0x9bc, 0x2, 0xa32, 0xa3c, 0x2, 0xa38, 0xa3c, 0x2, 0xa16, 0xa3c, 0x2, 0xa17, 0xa3c,
+		0x2, 0xa1c, 0xa3c, 0x2, 0xa2b, 0xa3c, 0x2, 0xb47, 0xb56, 0x2, 0xb47, 0xb3e, 0x2, 0xb47, 0xb57, 0x2, 0xb21,
+		0xb3c, 0x2, 0xb22, 0xb3c, 0x2, 0xb92, 0xbd7, 0x2, 0xbc6, 0xbbe, 0x2, 0xbc7, 0xbbe, 0x2, 0xbc6, 0xbd7, 0x2,
+		0xc46, 0xc56, 0x2, 0xcbf, 0xcd5, 0x2, 0xcc6, 0xcd5, 0x2, 0xcc6, 0xcd6, 0x2, 0xcc6, 0xcc2, 0x3, 0xcc6, 0xcc2,
+		0xcd5, 0x2, 0xd46, 0xd3e, 0x2, 0xd47, 0xd3e, 0x2, 0xd46, 0xd57, 0x2, 0xdd9, 0xdca, 0x2, 0xdd9, 0xdcf, 0x3,
+		0xdd9, 0xdcf, 0xdca, 0x2, 0xdd9, 0xddf, 0x2, 0xe4d, 0xe32, 0x2, 0xecd, 0xeb2, 0x2, 0xeab, 0xe99, 0x2, 0xeab,
+		0xea1, 0x1, 0xf0b, 0x2, 0xf42, 0xfb7, 0x2, 0xf4c, 0xfb7, 0x2, 0xf51, 0xfb7, 0x2, 0xf56, 0xfb7, 0x2, 0xf5b,
+		0xfb7, 0x2, 0xf40, 0xfb5, 0x2, 0xf71, 0xf72, 0x2, 0xf71, 0xf74, 0x2, 0xfb2, 0xf80, 0x3, 0xfb2, 0xf71, 0xf80,
+		0x2, 0xfb3, 0xf80, 0x3, 0xfb3, 0xf71, 0xf80, 0x2, 0xf71, 0xf80, 0x2, 0xf92, 0xfb7, 0x2, 0xf9c, 0xfb7, 0x2,
+		0xfa1, 0xfb7, 0x2, 0xfa6, 0xfb7, 0x2, 0xfab, 0xfb7, 0x2, 0xf90, 0xfb5, 0x2, 0x1025, 0x102e, 0x1, 0x10dc, 0x2,
+		0x1b05, 0x1b35, 0x2, 0x1b07, 0x1b35, 0x2, 0x1b09, 0x1b35, 0x2, 0x1b0b, 0x1b35, 0x2, 0x1b0d, 0x1b35, 0x2, 0x1b11,
+		0x1b35, 0x2, 0x1b3a, 0x1b35, 0x2, 0x1b3c, 0x1b35, 0x2, 0x1b3e, 0x1b35, 0x2, 0x1b3f, 0x1b35, 0x2, 0x1b42, 0x1b35,
+		0x1, 0x41, 0x1, 0xc6, 0x1, 0x42, 0x1, 0x44, 0x1, 0x45, 0x1, 0x18e, 0x1, 0x47, 0x1, 0x48, 0x1, 0x49, 0x1, 0x4a,
+		0x1, 0x4b, 0x1, 0x4c, 0x1, 0x4d, 0x1, 0x4e, 0x1, 0x4f, 0x1, 0x222, 0x1, 0x50, 0x1, 0x52, 0x1, 0x54, 0x1, 0x55,
+		0x1, 0x57, 0x1, 0x250, 0x1, 0x251, 0x1, 0x1d02, 0x1, 0x62, 0x1, 0x64, 0x1, 0x65, 0x1, 0x259, 0x1, 0x25b, 0x1,
+		0x25c, 0x1, 0x67, 0x1, 0x6b, 0x1, 0x6d, 0x1, 0x14b, 0x1, 0x254, 0x1, 0x1d16, 0x1, 0x1d17, 0x1, 0x70, 0x1, 0x74,
+		0x1, 0x75, 0x1, 0x1d1d, 0x1, 0x26f, 0x1, 0x76, 0x1, 0x1d25, 0x1, 0x3b3, 0x1, 0x3b4, 0x1, 0x3c7, 0x1, 0x69, 0x1,
+		0x43d, 0x1, 0x252, 0x1, 0x63, 0x1, 0x255, 0x1, 0xf0, 0x1, 0x66, 0x1, 0x25f, 0x1, 0x261, 0x1, 0x265, 0x1, 0x268,
+		0x1, 0x269, 0x1, 0x26a, 0x1, 0x1d7b, 0x1, 0x29d, 0x1, 0x26d, 0x1, 0x1d85, 0x1, 0x29f, 0x1, 0x271, 0x1, 0x270,
+		0x1, 0x272, 0x1, 0x273, 0x1, 0x274, 0x1, 0x275, 0x1, 0x278, 0x1, 0x282, 0x1, 0x283, 0x1, 0x1ab, 0x1, 0x289, 0x1,
+		0x28a, 0x1, 0x1d1c, 0x1, 0x28b, 0x1, 0x28c, 0x1, 0x7a, 0x1, 0x290, 0x1, 0x291, 0x1, 0x292, 0x2, 0x41, 0x325,
+		0x2, 0x61, 0x325, 0x2, 0x42, 0x307, 0x2, 0x62, 0x307, 0x2, 0x42, 0x323, 0x2, 0x62, 0x323, 0x2, 0x42, 0x331, 0x2,
+		0x62, 0x331, 0x3, 0x43, 0x327, 0x301, 0x3, 0x63, 0x327, 0x301, 0x2, 0x44, 0x307, 0x2, 0x64, 0x307, 0x2, 0x44,
+		0x323, 0x2, 0x64, 0x323, 0x2, 0x44, 0x331, 0x2, 0x64, 0x331, 0x2, 0x44, 0x327, 0x2, 0x64, 0x327, 0x2, 0x44,
+		0x32d, 0x2, 0x64, 0x32d, 0x3, 0x45, 0x304, 0x300, 0x3, 0x65, 0x304, 0x300, 0x3, 0x45, 0x304, 0x301, 0x3, 0x65,
+		0x304, 0x301, 0x2, 0x45, 0x32d, 0x2, 0x65, 0x32d, 0x2, 0x45, 0x330, 0x2, 0x65, 0x330, 0x3, 0x45, 0x327, 0x306,
+		0x3, 0x65, 0x327, 0x306, 0x2, 0x46, 0x307, 0x2, 0x66, 0x307, 0x2, 0x47, 0x304, 0x2, 0x67, 0x304, 0x2, 0x48,
+		0x307, 0x2, 0x68, 0x307, 0x2, 0x48, 0x323, 0x2, 0x68, 0x323, 0x2, 0x48, 0x308, 0x2, 0x68, 0x308, 0x2, 0x48,
+		0x327, 0x2, 0x68, 0x327, 0x2, 0x48, 0x32e, 0x2, 0x68, 0x32e, 0x2, 0x49, 0x330, 0x2, 0x69, 0x330, 0x3, 0x49,
+		0x308, 0x301, 0x3, 0x69, 0x308, 0x301, 0x2, 0x4b, 0x301, 0x2, 0x6b, 0x301, 0x2, 0x4b, 0x323, 0x2, 0x6b, 0x323,
+		0x2, 0x4b, 0x331, 0x2, 0x6b, 0x331, 0x2, 0x4c, 0x323, 0x2, 0x6c, 0x323, 0x3, 0x4c, 0x323, 0x304, 0x3, 0x6c,
+		0x323, 0x304, 0x2, 0x4c, 0x331, 0x2, 0x6c, 0x331, 0x2, 0x4c, 0x32d, 0x2, 0x6c, 0x32d, 0x2, 0x4d, 0x301, 0x2,
+		0x6d, 0x301, 0x2, 0x4d, 0x307, 0x2, 0x6d, 0x307, 0x2, 0x4d, 0x323, 0x2, 0x6d, 0x323, 0x2, 0x4e, 0x307, 0x2,
+		0x6e, 0x307, 0x2, 0x4e, 0x323, 0x2, 0x6e, 0x323, 0x2, 0x4e, 0x331, 0x2, 0x6e, 0x331, 0x2, 0x4e, 0x32d, 0x2,
+		0x6e, 0x32d, 0x3, 0x4f, 0x303, 0x301, 0x3, 0x6f, 0x303, 0x301, 0x3, 0x4f, 0x303, 0x308, 0x3, 0x6f, 0x303, 0x308,
+		0x3, 0x4f, 0x304, 0x300, 0x3, 0x6f, 0x304, 0x300, 0x3, 0x4f, 0x304, 0x301, 0x3, 0x6f, 0x304, 0x301, 0x2, 0x50,
+		0x301, 0x2, 0x70, 0x301, 0x2, 0x50, 0x307, 0x2, 0x70, 0x307, 0x2, 0x52, 0x307, 0x2, 0x72, 0x307, 0x2, 0x52,
+		0x323, 0x2, 0x72, 0x323, 0x3, 0x52, 0x323, 0x304, 0x3, 0x72, 0x323, 0x304, 0x2, 0x52, 0x331, 0x2, 0x72, 0x331,
+		0x2, 0x53, 0x307, 0x2, 0x73, 0x307, 0x2, 0x53, 0x323, 0x2, 0x73, 0x323, 0x3, 0x53, 0x301, 0x307, 0x3, 0x73,
+		0x301, 0x307, 0x3, 0x53, 0x30c, 0x307, 0x3, 0x73, 0x30c, 0x307, 0x3, 0x53, 0x323, 0x307, 0x3, 0x73, 0x323,
+		0x307, 0x2, 0x54, 0x307, 0x2, 0x74, 0x307, 0x2, 0x54, 0x323, 0x2, 0x74, 0x323, 0x2, 0x54, 0x331, 0x2, 0x74,
+		0x331, 0x2, 0x54, 0x32d, 0x2, 0x74, 0x32d, 0x2, 0x55, 0x324, 0x2, 0x75, 0x324, 0x2, 0x55, 0x330, 0x2, 0x75,
+		0x330, 0x2, 0x55, 0x32d, 0x2, 0x75, 0x32d, 0x3, 0x55, 0x303, 0x301, 0x3, 0x75, 0x303, 0x301, 0x3, 0x55, 0x304,
+		0x308, 0x3, 0x75, 0x304, 0x308, 0x2, 0x56, 0x303, 0x2, 0x76, 0x303, 0x2, 0x56, 0x323, 0x2, 0x76, 0x323, 0x2,
+		0x57, 0x300, 0x2, 0x77, 0x300, 0x2, 0x57, 0x301, 0x2, 0x77, 0x301, 0x2, 0x57, 0x308, 0x2, 0x77, 0x308, 0x2,
+		0x57, 0x307, 0x2, 0x77, 0x307, 0x2, 0x57, 0x323, 0x2, 0x77, 0x323, 0x2, 0x58, 0x307, 0x2, 0x78, 0x307, 0x2,
+		0x58, 0x308, 0x2, 0x78, 0x308, 0x2, 0x59, 0x307, 0x2, 0x79, 0x307, 0x2, 0x5a, 0x302, 0x2, 0x7a, 0x302, 0x2,
+		0x5a, 0x323, 0x2, 0x7a, 0x323, 0x2, 0x5a, 0x331, 0x2, 0x7a, 0x331, 0x2, 0x68, 0x331, 0x2, 0x74, 0x308, 0x2,
+		0x77, 0x30a, 0x2, 0x79, 0x30a, 0x2, 0x61, 0x2be, 0x2, 0x17f, 0x307, 0x2, 0x41, 0x323, 0x2, 0x61, 0x323, 0x2,
+		0x41, 0x309, 0x2, 0x61, 0x309, 0x3, 0x41, 0x302, 0x301, 0x3, 0x61, 0x302, 0x301, 0x3, 0x41, 0x302, 0x300, 0x3,
+		0x61, 0x302, 0x300, 0x3, 0x41, 0x302, 0x309, 0x3, 0x61, 0x302, 0x309, 0x3, 0x41, 0x302, 0x303, 0x3, 0x61, 0x302,
+		0x303, 0x3, 0x41, 0x323, 0x302, 0x3, 0x61, 0x323, 0x302, 0x3, 0x41, 0x306, 0x301, 0x3, 0x61, 0x306, 0x301, 0x3,
+		0x41, 0x306, 0x300, 0x3, 0x61, 0x306, 0x300, 0x3, 0x41, 0x306, 0x309, 0x3, 0x61, 0x306, 0x309, 0x3, 0x41, 0x306,
+		0x303, 0x3, 0x61, 0x306, 0x303, 0x3, 0x41, 0x323, 0x306, 0x3, 0x61, 0x323, 0x306, 0x2, 0x45, 0x323, 0x2, 0x65,
+		0x323, 0x2, 0x45, 0x309, 0x2, 0x65, 0x309, 0x2, 0x45, 0x303, 0x2, 0x65, 0x303, 0x3, 0x45, 0x302, 0x301, 0x3,
+		0x65, 0x302, 0x301, 0x3, 0x45, 0x302, 0x300, 0x3, 0x65, 0x302, 0x300, 0x3, 0x45, 0x302, 0x309, 0x3, 0x65, 0x302,
+		0x309, 0x3, 0x45, 0x302, 0x303, 0x3, 0x65, 0x302, 0x303, 0x3, 0x45, 0x323, 0x302, 0x3, 0x65, 0x323, 0x302, 0x2,
+		0x49, 0x309, 0x2, 0x69, 0x309, 0x2, 0x49, 0x323, 0x2, 0x69, 0x323, 0x2, 0x4f, 0x323, 0x2, 0x6f, 0x323, 0x2,
+		0x4f, 0x309, 0x2, 0x6f, 0x309, 0x3, 0x4f, 0x302, 0x301, 0x3, 0x6f, 0x302, 0x301, 0x3, 0x4f, 0x302, 0x300, 0x3,
+		0x6f, 0x302, 0x300, 0x3, 0x4f, 0x302, 0x309, 0x3, 0x6f, 0x302, 0x309, 0x3, 0x4f, 0x302, 0x303, 0x3, 0x6f, 0x302,
+		0x303, 0x3, 0x4f, 0x323, 0x302, 0x3, 0x6f, 0x323, 0x302, 0x3, 0x4f, 0x31b, 0x301, 0x3, 0x6f, 0x31b, 0x301, 0x3,
+		0x4f, 0x31b, 0x300, 0x3, 0x6f, 0x31b, 0x300, 0x3, 0x4f, 0x31b, 0x309, 0x3, 0x6f, 0x31b, 0x309, 0x3, 0x4f, 0x31b,
+		0x303, 0x3, 0x6f, 0x31b, 0x303, 0x3, 0x4f, 0x31b, 0x323, 0x3, 0x6f, 0x31b, 0x323, 0x2, 0x55, 0x323, 0x2, 0x75,
+		0x323, 0x2, 0x55, 0x309, 0x2, 0x75, 0x309, 0x3, 0x55, 0x31b, 0x301, 0x3, 0x75, 0x31b, 0x301, 0x3, 0x55, 0x31b,
+		0x300, 0x3, 0x75, 0x31b, 0x300, 0x3, 0x55, 0x31b, 0x309, 0x3, 0x75, 0x31b, 0x309, 0x3, 0x55, 0x31b, 0x303, 0x3,
+		0x75, 0x31b, 0x303, 0x3, 0x55, 0x31b, 0x323, 0x3, 0x75, 0x31b, 0x323, 0x2, 0x59, 0x300, 0x2, 0x79, 0x300, 0x2,
+		0x59, 0x323, 0x2, 0x79, 0x323, 0x2, 0x59, 0x309, 0x2, 0x79, 0x309, 0x2, 0x59, 0x303, 0x2, 0x79, 0x303, 0x2,
+		0x3b1, 0x313, 0x2, 0x3b1, 0x314, 0x3, 0x3b1, 0x313, 0x300, 0x3, 0x3b1, 0x314, 0x300, 0x3, 0x3b1, 0x313, 0x301,
+		0x3, 0x3b1, 0x314, 0x301, 0x3, 0x3b1, 0x313, 0x342, 0x3, 0x3b1, 0x314, 0x342, 0x2, 0x391, 0x313, 0x2, 0x391,
+		0x314, 0x3, 0x391, 0x313, 0x300, 0x3, 0x391, 0x314, 0x300, 0x3, 0x391, 0x313, 0x301, 0x3, 0x391, 0x314, 0x301,
+		0x3, 0x391, 0x313, 0x342, 0x3, 0x391, 0x314, 0x342, 0x2, 0x3b5, 0x313, 0x2, 0x3b5, 0x314, 0x3, 0x3b5, 0x313,
+		0x300, 0x3, 0x3b5, 0x314, 0x300, 0x3, 0x3b5, 0x313, 0x301, 0x3, 0x3b5, 0x314, 0x301, 0x2, 0x395, 0x313, 0x2,
+		0x395, 0x314, 0x3, 0x395, 0x313, 0x300, 0x3, 0x395, 0x314, 0x300, 0x3, 0x395, 0x313, 0x301, 0x3, 0x395, 0x314,
+		0x301, 0x2, 0x3b7, 0x313, 0x2, 0x3b7, 0x314, 0x3, 0x3b7, 0x313, 0x300, 0x3, 0x3b7, 0x314, 0x300, 0x3, 0x3b7,
+		0x313, 0x301, 0x3, 0x3b7, 0x314, 0x301, 0x3, 0x3b7, 0x313, 0x342, 0x3, 0x3b7, 0x314, 0x342, 0x2, 0x397, 0x313,
+		0x2, 0x397, 0x314, 0x3, 0x397, 0x313, 0x300, 0x3, 0x397, 0x314, 0x300, 0x3, 0x397, 0x313, 0x301, 0x3, 0x397,
+		0x314, 0x301, 0x3, 0x397, 0x313, 0x342, 0x3, 0x397, 0x314, 0x342, 0x2, 0x3b9, 0x313, 0x2, 0x3b9, 0x314, 0x3,
+		0x3b9, 0x313, 0x300, 0x3, 0x3b9, 0x314, 0x300, 0x3, 0x3b9, 0x313, 0x301, 0x3, 0x3b9, 0x314, 0x301, 0x3, 0x3b9,
+		0x313, 0x342, 0x3, 0x3b9, 0x314, 0x342, 0x2, 0x399, 0x313, 0x2, 0x399, 0x314, 0x3, 0x399, 0x313, 0x300, 0x3,
+		0x399, 0x314, 0x300, 0x3, 0x399, 0x313, 0x301, 0x3, 0x399, 0x314, 0x301, 0x3, 0x399, 0x313, 0x342, 0x3, 0x399,
+		0x314, 0x342, 0x2, 0x3bf, 0x313, 0x2, 0x3bf, 0x314, 0x3, 0x3bf, 0x313, 0x300, 0x3, 0x3bf, 0x314, 0x300, 0x3,
+		0x3bf, 0x313, 0x301, 0x3, 0x3bf, 0x314, 0x301, 0x2, 0x39f, 0x313, 0x2, 0x39f, 0x314, 0x3, 0x39f, 0x313, 0x300,
+		0x3, 0x39f, 0x314, 0x300, 0x3, 0x39f, 0x313, 0x301, 0x3, 0x39f, 0x314, 0x301, 0x2, 0x3c5, 0x313, 0x2, 0x3c5,
+		0x314, 0x3, 0x3c5, 0x313, 0x300, 0x3, 0x3c5, 0x314, 0x300, 0x3, 0x3c5, 0x313, 0x301, 0x3, 0x3c5, 0x314, 0x301,
+		0x3, 0x3c5, 0x313, 0x342, 0x3, 0x3c5, 0x314, 0x342, 0x2, 0x3a5, 0x314, 0x3, 0x3a5, 0x314, 0x300, 0x3, 0x3a5,
+		0x314, 0x301, 0x3, 0x3a5, 0x314, 0x342, 0x2, 0x3c9, 0x313, 0x2, 0x3c9, 0x314, 0x3, 0x3c9, 0x313, 0x300, 0x3,
+		0x3c9, 0x314, 0x300, 0x3, 0x3c9, 0x313, 0x301, 0x3, 0x3c9, 0x314, 0x301, 0x3, 0x3c9, 0x313, 0x342, 0x3, 0x3c9,
+		0x314, 0x342, 0x2, 0x3a9, 0x313, 0x2, 0x3a9, 0x314, 0x3, 0x3a9, 0x313, 0x300, 0x3, 0x3a9, 0x314, 0x300, 0x3,
+		0x3a9, 0x313, 0x301, 0x3, 0x3a9, 0x314, 0x301, 0x3, 0x3a9, 0x313, 0x342, 0x3, 0x3a9, 0x314, 0x342, 0x2, 0x3b1,
+		0x300, 0x2, 0x3b5, 0x300, 0x2, 0x3b7, 0x300, 0x2, 0x3b9, 0x300, 0x2, 0x3bf, 0x300, 0x2, 0x3c5, 0x300, 0x2,
+		0x3c9, 0x300, 0x3, 0x3b1, 0x313, 0x345, 0x3, 0x3b1, 0x314, 0x345, 0x4, 0x3b1, 0x313, 0x300, 0x345, 0x4, 0x3b1,
+		0x314, 0x300, 0x345, 0x4, 0x3b1, 0x313, 0x301, 0x345, 0x4, 0x3b1, 0x314, 0x301, 0x345, 0x4, 0x3b1, 0x313, 0x342,
+		0x345, 0x4, 0x3b1, 0x314, 0x342, 0x345, 0x3, 0x391, 0x313, 0x345, 0x3, 0x391, 0x314, 0x345, 0x4, 0x391, 0x313,
+		0x300, 0x345, 0x4, 0x391, 0x314, 0x300, 0x345, 0x4, 0x391, 0x313, 0x301, 0x345, 0x4, 0x391, 0x314, 0x301, 0x345,
+		0x4, 0x391, 0x313, 0x342, 0x345, 0x4, 0x391, 0x314, 0x342, 0x345, 0x3, 0x3b7, 0x313, 0x345, 0x3, 0x3b7, 0x314,
+		0x345, 0x4, 0x3b7, 0x313, 0x300, 0x345, 0x4, 0x3b7, 0x314, 0x300, 0x345, 0x4, 0x3b7, 0x313, 0x301, 0x345, 0x4,
+		0x3b7, 0x314, 0x301, 0x345, 0x4, 0x3b7, 0x313, 0x342, 0x345, 0x4, 0x3b7, 0x314, 0x342, 0x345, 0x3, 0x397, 0x313,
+		0x345, 0x3, 0x397, 0x314, 0x345, 0x4, 0x397, 0x313, 0x300, 0x345, 0x4, 0x397, 0x314, 0x300, 0x345, 0x4, 0x397,
+		0x313, 0x301, 0x345, 0x4, 0x397, 0x314, 0x301, 0x345, 0x4, 0x397, 0x313, 0x342, 0x345, 0x4, 0x397, 0x314, 0x342,
+		0x345, 0x3, 0x3c9, 0x313, 0x345, 0x3, 0x3c9, 0x314, 0x345, 0x4, 0x3c9, 0x313, 0x300, 0x345, 0x4, 0x3c9, 0x314,
+		0x300, 0x345, 0x4, 0x3c9, 0x313, 0x301, 0x345, 0x4, 0x3c9, 0x314, 0x301, 0x345, 0x4, 0x3c9, 0x313, 0x342, 0x345,
+		0x4, 0x3c9, 0x314, 0x342, 0x345, 0x3, 0x3a9, 0x313, 0x345, 0x3, 0x3a9, 0x314, 0x345, 0x4, 0x3a9, 0x313, 0x300,
+		0x345, 0x4, 0x3a9, 0x314, 0x300, 0x345, 0x4, 0x3a9, 0x313, 0x301, 0x345, 0x4, 0x3a9, 0x314, 0x301, 0x345, 0x4,
+		0x3a9, 0x313, 0x342, 0x345, 0x4, 0x3a9, 0x314, 0x342, 0x345, 0x2, 0x3b1, 0x306, 0x2, 0x3b1, 0x304, 0x3, 0x3b1,
+		0x300, 0x345, 0x2, 0x3b1, 0x345, 0x3, 0x3b1, 0x301, 0x345, 0x2, 0x3b1, 0x342, 0x3, 0x3b1, 0x342, 0x345, 0x2,
+		0x391, 0x306, 0x2, 0x391, 0x304, 0x2, 0x391, 0x300, 0x2, 0x391, 0x345, 0x2, 0x20, 0x313, 0x1, 0x3b9, 0x2, 0x20,
+		0x342, 0x2, 0xa8, 0x342, 0x3, 0x20, 0x308, 0x342, 0x3, 0x3b7, 0x300, 0x345, 0x2, 0x3b7, 0x345, 0x3, 0x3b7,
+		0x301, 0x345, 0x2, 0x3b7, 0x342, 0x3, 0x3b7, 0x342, 0x345, 0x2, 0x395, 0x300, 0x2, 0x397, 0x300, 0x2, 0x397,
+		0x345, 0x2, 0x1fbf, 0x300, 0x3, 0x20, 0x313, 0x300, 0x2, 0x1fbf, 0x301, 0x3, 0x20, 0x313, 0x301, 0x2, 0x1fbf,
+		0x342, 0x3, 0x20, 0x313, 0x342, 0x2, 0x3b9, 0x306, 0x2, 0x3b9, 0x304, 0x3, 0x3b9, 0x308, 0x300, 0x2, 0x3b9,
+		0x342, 0x3, 0x3b9, 0x308, 0x342, 0x2, 0x399, 0x306, 0x2, 0x399, 0x304, 0x2, 0x399, 0x300, 0x2, 0x1ffe, 0x300,
+		0x3, 0x20, 0x314, 0x300, 0x2, 0x1ffe, 0x301, 0x3, 0x20, 0x314, 0x301, 0x2, 0x1ffe, 0x342, 0x3, 0x20, 0x314,
+		0x342, 0x2, 0x3c5, 0x306, 0x2, 0x3c5, 0x304, 0x3, 0x3c5, 0x308, 0x300, 0x2, 0x3c1, 0x313, 0x2, 0x3c1, 0x314,
+		0x2, 0x3c5, 0x342, 0x3, 0x3c5, 0x308, 0x342, 0x2, 0x3a5, 0x306, 0x2, 0x3a5, 0x304, 0x2, 0x3a5, 0x300, 0x2,
+		0x3a1, 0x314, 0x2, 0xa8, 0x300, 0x3, 0x20, 0x308, 0x300, 0x1, 0x60, 0x3, 0x3c9, 0x300, 0x345, 0x2, 0x3c9, 0x345,
+		0x3, 0x3c9, 0x301, 0x345, 0x2, 0x3c9, 0x342, 0x3, 0x3c9, 0x342, 0x345, 0x2, 0x39f, 0x300, 0x2, 0x3a9, 0x300,
+		0x2, 0x3a9, 0x345, 0x1, 0xb4, 0x2, 0x20, 0x314, 0x1, 0x2002, 0x1, 0x2003, 0x1, 0x2010, 0x2, 0x20, 0x333, 0x1,
+		0x2e, 0x2, 0x2e, 0x2e, 0x3, 0x2e, 0x2e, 0x2e, 0x2, 0x2032, 0x2032, 0x3, 0x2032, 0x2032, 0x2032, 0x2, 0x2035,
+		0x2035, 0x3, 0x2035, 0x2035, 0x2035, 0x2, 0x21, 0x21, 0x2, 0x20, 0x305, 0x2, 0x3f, 0x3f, 0x2, 0x3f, 0x21, 0x2,
+		0x21, 0x3f, 0x4, 0x2032, 0x2032, 0x2032, 0x2032, 0x1, 0x30, 0x1, 0x34, 0x1, 0x35, 0x1, 0x36, 0x1, 0x37, 0x1,
+		0x38, 0x1, 0x39, 0x1, 0x2b, 0x1, 0x2212, 0x1, 0x3d, 0x1, 0x28, 0x1, 0x29, 0x1, 0x6e, 0x2, 0x52, 0x73, 0x3, 0x61,
+		0x2f, 0x63, 0x3, 0x61, 0x2f, 0x73, 0x1, 0x43, 0x2, 0xb0, 0x43, 0x3, 0x63, 0x2f, 0x6f, 0x3, 0x63, 0x2f, 0x75,
+		0x1, 0x190, 0x2, 0xb0, 0x46, 0x1, 0x127, 0x2, 0x4e, 0x6f, 0x1, 0x51, 0x2, 0x53, 0x4d, 0x3, 0x54, 0x45, 0x4c,
+		0x2, 0x54, 0x4d, 0x1, 0x5a, 0x1, 0x3a9, 0x1, 0x46, 0x1, 0x5d0, 0x1, 0x5d1, 0x1, 0x5d2, 0x1, 0x5d3, 0x3, 0x46,
+		0x41, 0x58, 0x1, 0x393, 0x1, 0x3a0, 0x1, 0x2211, 0x3, 0x31, 0x2044, 0x37, 0x3, 0x31, 0x2044, 0x39, 0x4, 0x31,
+		0x2044, 0x31, 0x30, 0x3, 0x31, 0x2044, 0x33, 0x3, 0x32, 0x2044, 0x33, 0x3, 0x31, 0x2044, 0x35, 0x3, 0x32,
+		0x2044, 0x35, 0x3, 0x33, 0x2044, 0x35, 0x3, 0x34, 0x2044, 0x35, 0x3, 0x31, 0x2044, 0x36, 0x3, 0x35, 0x2044,
+		0x36, 0x3, 0x31, 0x2044, 0x38, 0x3, 0x33, 0x2044, 0x38, 0x3, 0x35, 0x2044, 0x38, 0x3, 0x37, 0x2044, 0x38, 0x2,
+		0x31, 0x2044, 0x2, 0x49, 0x49, 0x3, 0x49, 0x49, 0x49, 0x2, 0x49, 0x56, 0x1, 0x56, 0x2, 0x56, 0x49, 0x3, 0x56,
+		0x49, 0x49, 0x4, 0x56, 0x49, 0x49, 0x49, 0x2, 0x49, 0x58, 0x1, 0x58, 0x2, 0x58, 0x49, 0x3, 0x58, 0x49, 0x49,
+		0x2, 0x69, 0x69, 0x3, 0x69, 0x69, 0x69, 0x2, 0x69, 0x76, 0x2, 0x76, 0x69, 0x3, 0x76, 0x69, 0x69, 0x4, 0x76,
+		0x69, 0x69, 0x69, 0x2, 0x69, 0x78, 0x2, 0x78, 0x69, 0x3, 0x78, 0x69, 0x69, 0x3, 0x30, 0x2044, 0x33, 0x2, 0x2190,
+		0x338, 0x2, 0x2192, 0x338, 0x2, 0x2194, 0x338, 0x2, 0x21d0, 0x338, 0x2, 0x21d4, 0x338, 0x2, 0x21d2, 0x338, 0x2,
+		0x2203, 0x338, 0x2, 0x2208, 0x338, 0x2, 0x220b, 0x338, 0x2, 0x2223, 0x338, 0x2, 0x2225, 0x338, 0x2, 0x222b,
+		0x222b, 0x3, 0x222b, 0x222b, 0x222b, 0x2, 0x222e, 0x222e, 0x3, 0x222e, 0x222e, 0x222e, 0x2, 0x223c, 0x338, 0x2,
+		0x2243, 0x338, 0x2, 0x2245, 0x338, 0x2, 0x2248, 0x338, 0x2, 0x3d, 0x338, 0x2, 0x2261, 0x338, 0x2, 0x224d, 0x338,
+		0x2, 0x3c, 0x338, 0x2, 0x3e, 0x338, 0x2, 0x2264, 0x338, 0x2, 0x2265, 0x338, 0x2, 0x2272, 0x338, 0x2, 0x2273,
+		0x338, 0x2, 0x2276, 0x338, 0x2, 0x2277, 0x338, 0x2, 0x227a, 0x338, 0x2, 0x227b, 0x338, 0x2, 0x2282, 0x338, 0x2,
+		0x2283, 0x338, 0x2, 0x2286, 0x338, 0x2, 0x2287, 0x338, 0x2, 0x22a2, 0x338, 0x2, 0x22a8, 0x338, 0x2, 0x22a9,
+		0x338, 0x2, 0x22ab, 0x338, 0x2, 0x227c, 0x338, 0x2, 0x227d, 0x338, 0x2, 0x2291, 0x338, 0x2, 0x2292, 0x338, 0x2,
+		0x22b2, 0x338, 0x2, 0x22b3, 0x338, 0x2, 0x22b4, 0x338, 0x2, 0x22b5, 0x338, 0x1, 0x3008, 0x1, 0x3009, 0x2, 0x31,
+		0x30, 0x2, 0x31, 0x31, 0x2, 0x31, 0x32, 0x2, 0x31, 0x33, 0x2, 0x31, 0x34, 0x2, 0x31, 0x35, 0x2, 0x31, 0x36, 0x2,
+		0x31, 0x37, 0x2, 0x31, 0x38, 0x2, 0x31, 0x39, 0x2, 0x32, 0x30, 0x3, 0x28, 0x31, 0x29, 0x3, 0x28, 0x32, 0x29,
+		0x3, 0x28, 0x33, 0x29, 0x3, 0x28, 0x34, 0x29, 0x3, 0x28, 0x35, 0x29, 0x3, 0x28, 0x36, 0x29, 0x3, 0x28, 0x37,
+		0x29, 0x3, 0x28, 0x38, 0x29, 0x3, 0x28, 0x39, 0x29, 0x4, 0x28, 0x31, 0x30, 0x29, 0x4, 0x28, 0x31, 0x31, 0x29,
+		0x4, 0x28, 0x31, 0x32, 0x29, 0x4, 0x28, 0x31, 0x33, 0x29, 0x4, 0x28, 0x31, 0x34, 0x29, 0x4, 0x28, 0x31, 0x35,
+		0x29, 0x4, 0x28, 0x31, 0x36, 0x29, 0x4, 0x28, 0x31, 0x37, 0x29, 0x4, 0x28, 0x31, 0x38, 0x29, 0x4, 0x28, 0x31,
+		0x39, 0x29, 0x4, 0x28, 0x32, 0x30, 0x29, 0x2, 0x31, 0x2e, 0x2, 0x32, 0x2e, 0x2, 0x33, 0x2e, 0x2, 0x34, 0x2e,
+		0x2, 0x35, 0x2e, 0x2, 0x36, 0x2e, 0x2, 0x37, 0x2e, 0x2, 0x38, 0x2e, 0x2, 0x39, 0x2e, 0x3, 0x31, 0x30, 0x2e, 0x3,
+		0x31, 0x31, 0x2e, 0x3, 0x31, 0x32, 0x2e, 0x3, 0x31, 0x33, 0x2e, 0x3, 0x31, 0x34, 0x2e, 0x3, 0x31, 0x35, 0x2e,
+		0x3, 0x31, 0x36, 0x2e, 0x3, 0x31, 0x37, 0x2e, 0x3, 0x31, 0x38, 0x2e, 0x3, 0x31, 0x39, 0x2e, 0x3, 0x32, 0x30,
+		0x2e, 0x3, 0x28, 0x61, 0x29, 0x3, 0x28, 0x62, 0x29, 0x3, 0x28, 0x63, 0x29, 0x3, 0x28, 0x64, 0x29, 0x3, 0x28,
+		0x65, 0x29, 0x3, 0x28, 0x66, 0x29, 0x3, 0x28, 0x67, 0x29, 0x3, 0x28, 0x68, 0x29, 0x3, 0x28, 0x69, 0x29, 0x3,
+		0x28, 0x6a, 0x29, 0x3, 0x28, 0x6b, 0x29, 0x3, 0x28, 0x6c, 0x29, 0x3, 0x28, 0x6d, 0x29, 0x3, 0x28, 0x6e, 0x29,
+		0x3, 0x28, 0x6f, 0x29, 0x3, 0x28, 0x70, 0x29, 0x3, 0x28, 0x71, 0x29, 0x3, 0x28, 0x72, 0x29, 0x3, 0x28, 0x73,
+		0x29, 0x3, 0x28, 0x74, 0x29, 0x3, 0x28, 0x75, 0x29, 0x3, 0x28, 0x76, 0x29, 0x3, 0x28, 0x77, 0x29, 0x3, 0x28,
+		0x78, 0x29, 0x3, 0x28, 0x79, 0x29, 0x3, 0x28, 0x7a, 0x29, 0x1, 0x53, 0x1, 0x59, 0x1, 0x71, 0x4, 0x222b, 0x222b,
+		0x222b, 0x222b, 0x3, 0x3a, 0x3a, 0x3d, 0x2, 0x3d, 0x3d, 0x3, 0x3d, 0x3d, 0x3d, 0x2, 0x2add, 0x338, 0x1, 0x2d61,
+		0x1, 0x6bcd, 0x1, 0x9f9f, 0x1, 0x4e00, 0x1, 0x4e28, 0x1, 0x4e36, 0x1, 0x4e3f, 0x1, 0x4e59, 0x1, 0x4e85, 0x1,
+		0x4e8c, 0x1, 0x4ea0, 0x1, 0x4eba, 0x1, 0x513f, 0x1, 0x5165, 0x1, 0x516b, 0x1, 0x5182, 0x1, 0x5196, 0x1, 0x51ab,
+		0x1, 0x51e0, 0x1, 0x51f5, 0x1, 0x5200, 0x1, 0x529b, 0x1, 0x52f9, 0x1, 0x5315, 0x1, 0x531a, 0x1, 0x5338, 0x1,
+		0x5341, 0x1, 0x535c, 0x1, 0x5369, 0x1, 0x5382, 0x1, 0x53b6, 0x1, 0x53c8, 0x1, 0x53e3, 0x1, 0x56d7, 0x1, 0x571f,
+		0x1, 0x58eb, 0x1, 0x5902, 0x1, 0x590a, 0x1, 0x5915, 0x1, 0x5927, 0x1, 0x5973, 0x1, 0x5b50, 0x1, 0x5b80, 0x1,
+		0x5bf8, 0x1, 0x5c0f, 0x1, 0x5c22, 0x1, 0x5c38, 0x1, 0x5c6e, 0x1, 0x5c71, 0x1, 0x5ddb, 0x1, 0x5de5, 0x1, 0x5df1,
+		0x1, 0x5dfe, 0x1, 0x5e72, 0x1, 0x5e7a, 0x1, 0x5e7f, 0x1, 0x5ef4, 0x1, 0x5efe, 0x1, 0x5f0b, 0x1, 0x5f13, 0x1,
+		0x5f50, 0x1, 0x5f61, 0x1, 0x5f73, 0x1, 0x5fc3, 0x1, 0x6208, 0x1, 0x6236, 0x1, 0x624b, 0x1, 0x652f, 0x1, 0x6534,
+		0x1, 0x6587, 0x1, 0x6597, 0x1, 0x65a4, 0x1, 0x65b9, 0x1, 0x65e0, 0x1, 0x65e5, 0x1, 0x66f0, 0x1, 0x6708, 0x1,
+		0x6728, 0x1, 0x6b20, 0x1, 0x6b62, 0x1, 0x6b79, 0x1, 0x6bb3, 0x1, 0x6bcb, 0x1, 0x6bd4, 0x1, 0x6bdb, 0x1, 0x6c0f,
+		0x1, 0x6c14, 0x1, 0x6c34, 0x1, 0x706b, 0x1, 0x722a, 0x1, 0x7236, 0x1, 0x723b, 0x1, 0x723f, 0x1, 0x7247, 0x1,
+		0x7259, 0x1, 0x725b, 0x1, 0x72ac, 0x1, 0x7384, 0x1, 0x7389, 0x1, 0x74dc, 0x1, 0x74e6, 0x1, 0x7518, 0x1, 0x751f,
+		0x1, 0x7528, 0x1, 0x7530, 0x1, 0x758b, 0x1, 0x7592, 0x1, 0x7676, 0x1, 0x767d, 0x1, 0x76ae, 0x1, 0x76bf, 0x1,
+		0x76ee, 0x1, 0x77db, 0x1, 0x77e2, 0x1, 0x77f3, 0x1, 0x793a, 0x1, 0x79b8, 0x1, 0x79be, 0x1, 0x7a74, 0x1, 0x7acb,
+		0x1, 0x7af9, 0x1, 0x7c73, 0x1, 0x7cf8, 0x1, 0x7f36, 0x1, 0x7f51, 0x1, 0x7f8a, 0x1, 0x7fbd, 0x1, 0x8001, 0x1,
+		0x800c, 0x1, 0x8012, 0x1, 0x8033, 0x1, 0x807f, 0x1, 0x8089, 0x1, 0x81e3, 0x1, 0x81ea, 0x1, 0x81f3, 0x1, 0x81fc,
+		0x1, 0x820c, 0x1, 0x821b, 0x1, 0x821f, 0x1, 0x826e, 0x1, 0x8272, 0x1, 0x8278, 0x1, 0x864d, 0x1, 0x866b, 0x1,
+		0x8840, 0x1, 0x884c, 0x1, 0x8863, 0x1, 0x897e, 0x1, 0x898b, 0x1, 0x89d2, 0x1, 0x8a00, 0x1, 0x8c37, 0x1, 0x8c46,
+		0x1, 0x8c55, 0x1, 0x8c78, 0x1, 0x8c9d, 0x1, 0x8d64, 0x1, 0x8d70, 0x1, 0x8db3, 0x1, 0x8eab, 0x1, 0x8eca, 0x1,
+		0x8f9b, 0x1, 0x8fb0, 0x1, 0x8fb5, 0x1, 0x9091, 0x1, 0x9149, 0x1, 0x91c6, 0x1, 0x91cc, 0x1, 0x91d1, 0x1, 0x9577,
+		0x1, 0x9580, 0x1, 0x961c, 0x1, 0x96b6, 0x1, 0x96b9, 0x1, 0x96e8, 0x1, 0x9751, 0x1, 0x975e, 0x1, 0x9762, 0x1,
+		0x9769, 0x1, 0x97cb, 0x1, 0x97ed, 0x1, 0x97f3, 0x1, 0x9801, 0x1, 0x98a8, 0x1, 0x98db, 0x1, 0x98df, 0x1, 0x9996,
+		0x1, 0x9999, 0x1, 0x99ac, 0x1, 0x9aa8, 0x1, 0x9ad8, 0x1, 0x9adf, 0x1, 0x9b25, 0x1, 0x9b2f, 0x1, 0x9b32, 0x1,
+		0x9b3c, 0x1, 0x9b5a, 0x1, 0x9ce5, 0x1, 0x9e75, 0x1, 0x9e7f, 0x1, 0x9ea5, 0x1, 0x9ebb, 0x1, 0x9ec3, 0x1, 0x9ecd,
+		0x1, 0x9ed1, 0x1, 0x9ef9, 0x1, 0x9efd, 0x1, 0x9f0e, 0x1, 0x9f13, 0x1, 0x9f20, 0x1, 0x9f3b, 0x1, 0x9f4a, 0x1,
+		0x9f52, 0x1, 0x9f8d, 0x1, 0x9f9c, 0x1, 0x9fa0, 0x1, 0x3012, 0x1, 0x5344, 0x1, 0x5345, 0x2, 0x304b, 0x3099, 0x2,
+		0x304d, 0x3099, 0x2, 0x304f, 0x3099, 0x2, 0x3051, 0x3099, 0x2, 0x3053, 0x3099, 0x2, 0x3055, 0x3099, 0x2, 0x3057,
+		0x3099, 0x2, 0x3059, 0x3099, 0x2, 0x305b, 0x3099, 0x2, 0x305d, 0x3099, 0x2, 0x305f, 0x3099, 0x2, 0x3061, 0x3099,
+		0x2, 0x3064, 0x3099, 0x2, 0x3066, 0x3099, 0x2, 0x3068, 0x3099, 0x2, 0x306f, 0x3099, 0x2, 0x306f, 0x309a, 0x2,
+		0x3072, 0x3099, 0x2, 0x3072, 0x309a, 0x2, 0x3075, 0x3099, 0x2, 0x3075, 0x309a, 0x2, 0x3078, 0x3099, 0x2, 0x3078,
+		0x309a, 0x2, 0x307b, 0x3099, 0x2, 0x307b, 0x309a, 0x2, 0x3046, 0x3099, 0x2, 0x20, 0x3099, 0x2, 0x20, 0x309a,
+		0x2, 0x309d, 0x3099, 0x2, 0x3088, 0x308a, 0x2, 0x30ab, 0x3099, 0x2, 0x30ad, 0x3099, 0x2, 0x30af, 0x3099, 0x2,
+		0x30b1, 0x3099, 0x2, 0x30b3, 0x3099, 0x2, 0x30b5, 0x3099, 0x2, 0x30b7, 0x3099, 0x2, 0x30b9, 0x3099, 0x2, 0x30bb,
+		0x3099, 0x2, 0x30bd, 0x3099, 0x2, 0x30bf, 0x3099, 0x2, 0x30c1, 0x3099, 0x2, 0x30c4, 0x3099, 0x2, 0x30c6, 0x3099,
+		0x2, 0x30c8, 0x3099, 0x2, 0x30cf, 0x3099, 0x2, 0x30cf, 0x309a, 0x2, 0x30d2, 0x3099, 0x2, 0x30d2, 0x309a, 0x2,
+		0x30d5, 0x3099, 0x2, 0x30d5, 0x309a, 0x2, 0x30d8, 0x3099, 0x2, 0x30d8, 0x309a, 0x2, 0x30db, 0x3099, 0x2, 0x30db,
+		0x309a, 0x2, 0x30a6, 0x3099, 0x2, 0x30ef, 0x3099, 0x2, 0x30f0, 0x3099, 0x2, 0x30f1, 0x3099, 0x2, 0x30f2, 0x3099,
+		0x2, 0x30fd, 0x3099, 0x2, 0x30b3, 0x30c8, 0x1, 0x1100, 0x1, 0x1101, 0x1, 0x11aa, 0x1, 0x1102, 0x1, 0x11ac, 0x1,
+		0x11ad, 0x1, 0x1103, 0x1, 0x1104, 0x1, 0x1105, 0x1, 0x11b0, 0x1, 0x11b1, 0x1, 0x11b2, 0x1, 0x11b3, 0x1, 0x11b4,
+		0x1, 0x11b5, 0x1, 0x111a, 0x1, 0x1106, 0x1, 0x1107, 0x1, 0x1108, 0x1, 0x1121, 0x1, 0x1109, 0x1, 0x110a, 0x1,
+		0x110b, 0x1, 0x110c, 0x1, 0x110d, 0x1, 0x110e, 0x1, 0x110f, 0x1, 0x1110, 0x1, 0x1111, 0x1, 0x1112, 0x1, 0x1161,
+		0x1, 0x1162, 0x1, 0x1163, 0x1, 0x1164, 0x1, 0x1165, 0x1, 0x1166, 0x1, 0x1167, 0x1, 0x1168, 0x1, 0x1169, 0x1,
+		0x116a, 0x1, 0x116b, 0x1, 0x116c, 0x1, 0x116d, 0x1, 0x116e, 0x1, 0x116f, 0x1, 0x1170, 0x1, 0x1171, 0x1, 0x1172,
+		0x1, 0x1173, 0x1, 0x1174, 0x1, 0x1175, 0x1, 0x1160, 0x1, 0x1114, 0x1, 0x1115, 0x1, 0x11c7, 0x1, 0x11c8, 0x1,
+		0x11cc, 0x1, 0x11ce, 0x1, 0x11d3, 0x1, 0x11d7, 0x1, 0x11d9, 0x1, 0x111c, 0x1, 0x11dd, 0x1, 0x11df, 0x1, 0x111d,
+		0x1, 0x111e, 0x1, 0x1120, 0x1, 0x1122, 0x1, 0x1123, 0x1, 0x1127, 0x1, 0x1129, 0x1, 0x112b, 0x1, 0x112c, 0x1,
+		0x112d, 0x1, 0x112e, 0x1, 0x112f, 0x1, 0x1132, 0x1, 0x1136, 0x1, 0x1140, 0x1, 0x1147, 0x1, 0x114c, 0x1, 0x11f1,
+		0x1, 0x11f2, 0x1, 0x1157, 0x1, 0x1158, 0x1, 0x1159, 0x1, 0x1184, 0x1, 0x1185, 0x1, 0x1188, 0x1, 0x1191, 0x1,
+		0x1192, 0x1, 0x1194, 0x1, 0x119e, 0x1, 0x11a1, 0x1, 0x4e09, 0x1, 0x56db, 0x1, 0x4e0a, 0x1, 0x4e2d, 0x1, 0x4e0b,
+		0x1, 0x7532, 0x1, 0x4e19, 0x1, 0x4e01, 0x1, 0x5929, 0x1, 0x5730, 0x3, 0x28, 0x1100, 0x29, 0x3, 0x28, 0x1102,
+		0x29, 0x3, 0x28, 0x1103, 0x29, 0x3, 0x28, 0x1105, 0x29, 0x3, 0x28, 0x1106, 0x29, 0x3, 0x28, 0x1107, 0x29, 0x3,
+		0x28, 0x1109, 0x29, 0x3, 0x28, 0x110b, 0x29, 0x3, 0x28, 0x110c, 0x29, 0x3, 0x28, 0x110e, 0x29, 0x3, 0x28,
+		0x110f, 0x29, 0x3, 0x28, 0x1110, 0x29, 0x3, 0x28, 0x1111, 0x29, 0x3, 0x28, 0x1112, 0x29, 0x4, 0x28, 0x1100,
+		0x1161, 0x29, 0x4, 0x28, 0x1102, 0x1161, 0x29, 0x4, 0x28, 0x1103, 0x1161, 0x29, 0x4, 0x28, 0x1105, 0x1161, 0x29,
+		0x4, 0x28, 0x1106, 0x1161, 0x29, 0x4, 0x28, 0x1107, 0x1161, 0x29, 0x4, 0x28, 0x1109, 0x1161, 0x29, 0x4, 0x28,
+		0x110b, 0x1161, 0x29, 0x4, 0x28, 0x110c, 0x1161, 0x29, 0x4, 0x28, 0x110e, 0x1161, 0x29, 0x4, 0x28, 0x110f,
+		0x1161, 0x29, 0x4, 0x28, 0x1110, 0x1161, 0x29, 0x4, 0x28, 0x1111, 0x1161, 0x29, 0x4, 0x28, 0x1112, 0x1161, 0x29,
+		0x4, 0x28, 0x110c, 0x116e, 0x29, 0x7, 0x28, 0x110b, 0x1169, 0x110c, 0x1165, 0x11ab, 0x29, 0x6, 0x28, 0x110b,
+		0x1169, 0x1112, 0x116e, 0x29, 0x3, 0x28, 0x4e00, 0x29, 0x3, 0x28, 0x4e8c, 0x29, 0x3, 0x28, 0x4e09, 0x29, 0x3,
+		0x28, 0x56db, 0x29, 0x3, 0x28, 0x4e94, 0x29, 0x3, 0x28, 0x516d, 0x29, 0x3, 0x28, 0x4e03, 0x29, 0x3, 0x28,
+		0x516b, 0x29, 0x3, 0x28, 0x4e5d, 0x29, 0x3, 0x28, 0x5341, 0x29, 0x3, 0x28, 0x6708, 0x29, 0x3, 0x28, 0x706b,
+		0x29, 0x3, 0x28, 0x6c34, 0x29, 0x3, 0x28, 0x6728, 0x29, 0x3, 0x28, 0x91d1, 0x29, 0x3, 0x28, 0x571f, 0x29, 0x3,
+		0x28, 0x65e5, 0x29, 0x3, 0x28, 0x682a, 0x29, 0x3, 0x28, 0x6709, 0x29, 0x3, 0x28, 0x793e, 0x29, 0x3, 0x28,
+		0x540d, 0x29, 0x3, 0x28, 0x7279, 0x29, 0x3, 0x28, 0x8ca1, 0x29, 0x3, 0x28, 0x795d, 0x29, 0x3, 0x28, 0x52b4,
+		0x29, 0x3, 0x28, 0x4ee3, 0x29, 0x3, 0x28, 0x547c, 0x29, 0x3, 0x28, 0x5b66, 0x29, 0x3, 0x28, 0x76e3, 0x29, 0x3,
+		0x28, 0x4f01, 0x29, 0x3, 0x28, 0x8cc7, 0x29, 0x3, 0x28, 0x5354, 0x29, 0x3, 0x28, 0x796d, 0x29, 0x3, 0x28,
+		0x4f11, 0x29, 0x3, 0x28, 0x81ea, 0x29, 0x3, 0x28, 0x81f3, 0x29, 0x1, 0x554f, 0x1, 0x5e7c, 0x1, 0x7b8f, 0x3,
+		0x50, 0x54, 0x45, 0x2, 0x32, 0x31, 0x2, 0x32, 0x32, 0x2, 0x32, 0x33, 0x2, 0x32, 0x34, 0x2, 0x32, 0x35, 0x2,
+		0x32, 0x36, 0x2, 0x32, 0x37, 0x2, 0x32, 0x38, 0x2, 0x32, 0x39, 0x2, 0x33, 0x30, 0x2, 0x33, 0x31, 0x2, 0x33,
+		0x32, 0x2, 0x33, 0x33, 0x2, 0x33, 0x34, 0x2, 0x33, 0x35, 0x2, 0x1100, 0x1161, 0x2, 0x1102, 0x1161, 0x2, 0x1103,
+		0x1161, 0x2, 0x1105, 0x1161, 0x2, 0x1106, 0x1161, 0x2, 0x1107, 0x1161, 0x2, 0x1109, 0x1161, 0x2, 0x110b, 0x1161,
+		0x2, 0x110c, 0x1161, 0x2, 0x110e, 0x1161, 0x2, 0x110f, 0x1161, 0x2, 0x1110, 0x1161, 0x2, 0x1111, 0x1161, 0x2,
+		0x1112, 0x1161, 0x5, 0x110e, 0x1161, 0x11b7, 0x1100, 0x1169, 0x4, 0x110c, 0x116e, 0x110b, 0x1174, 0x2, 0x110b,
+		0x116e, 0x1, 0x4e94, 0x1, 0x516d, 0x1, 0x4e03, 0x1, 0x4e5d, 0x1, 0x682a, 0x1, 0x6709, 0x1, 0x793e, 0x1, 0x540d,
+		0x1, 0x7279, 0x1, 0x8ca1, 0x1, 0x795d, 0x1, 0x52b4, 0x1, 0x79d8, 0x1, 0x7537, 0x1, 0x9069, 0x1, 0x512a, 0x1,
+		0x5370, 0x1, 0x6ce8, 0x1, 0x9805, 0x1, 0x4f11, 0x1, 0x5199, 0x1, 0x6b63, 0x1, 0x5de6, 0x1, 0x53f3, 0x1, 0x533b,
+		0x1, 0x5b97, 0x1, 0x5b66, 0x1, 0x76e3, 0x1, 0x4f01, 0x1, 0x8cc7, 0x1, 0x5354, 0x1, 0x591c, 0x2, 0x33, 0x36, 0x2,
+		0x33, 0x37, 0x2, 0x33, 0x38, 0x2, 0x33, 0x39, 0x2, 0x34, 0x30, 0x2, 0x34, 0x31, 0x2, 0x34, 0x32, 0x2, 0x34,
+		0x33, 0x2, 0x34, 0x34, 0x2, 0x34, 0x35, 0x2, 0x34, 0x36, 0x2, 0x34, 0x37, 0x2, 0x34, 0x38, 0x2, 0x34, 0x39, 0x2,
+		0x35, 0x30, 0x2, 0x31, 0x6708, 0x2, 0x32, 0x6708, 0x2, 0x33, 0x6708, 0x2, 0x34, 0x6708, 0x2, 0x35, 0x6708, 0x2,
+		0x36, 0x6708, 0x2, 0x37, 0x6708, 0x2, 0x38, 0x6708, 0x2, 0x39, 0x6708, 0x3, 0x31, 0x30, 0x6708, 0x3, 0x31, 0x31,
+		0x6708, 0x3, 0x31, 0x32, 0x6708, 0x2, 0x48, 0x67, 0x3, 0x65, 0x72, 0x67, 0x2, 0x65, 0x56, 0x3, 0x4c, 0x54, 0x44,
+		0x1, 0x30a2, 0x1, 0x30a4, 0x1, 0x30a6, 0x1, 0x30a8, 0x1, 0x30aa, 0x1, 0x30ab, 0x1, 0x30ad, 0x1, 0x30af, 0x1,
+		0x30b1, 0x1, 0x30b3, 0x1, 0x30b5, 0x1, 0x30b7, 0x1, 0x30b9, 0x1, 0x30bb, 0x1, 0x30bd, 0x1, 0x30bf, 0x1, 0x30c1,
+		0x1, 0x30c4, 0x1, 0x30c6, 0x1, 0x30c8, 0x1, 0x30ca, 0x1, 0x30cb, 0x1, 0x30cc, 0x1, 0x30cd, 0x1, 0x30ce, 0x1,
+		0x30cf, 0x1, 0x30d2, 0x1, 0x30d5, 0x1, 0x30d8, 0x1, 0x30db, 0x1, 0x30de, 0x1, 0x30df, 0x1, 0x30e0, 0x1, 0x30e1,
+		0x1, 0x30e2, 0x1, 0x30e4, 0x1, 0x30e6, 0x1, 0x30e8, 0x1, 0x30e9, 0x1, 0x30ea, 0x1, 0x30eb, 0x1, 0x30ec, 0x1,
+		0x30ed, 0x1, 0x30ef, 0x1, 0x30f0, 0x1, 0x30f1, 0x1, 0x30f2, 0x2, 0x4ee4, 0x548c, 0x5, 0x30a2, 0x30cf, 0x309a,
+		0x30fc, 0x30c8, 0x4, 0x30a2, 0x30eb, 0x30d5, 0x30a1, 0x5, 0x30a2, 0x30f3, 0x30d8, 0x309a, 0x30a2, 0x3, 0x30a2,
+		0x30fc, 0x30eb, 0x5, 0x30a4, 0x30cb, 0x30f3, 0x30af, 0x3099, 0x3, 0x30a4, 0x30f3, 0x30c1, 0x3, 0x30a6, 0x30a9,
+		0x30f3, 0x6, 0x30a8, 0x30b9, 0x30af, 0x30fc, 0x30c8, 0x3099, 0x4, 0x30a8, 0x30fc, 0x30ab, 0x30fc, 0x3, 0x30aa,
+		0x30f3, 0x30b9, 0x3, 0x30aa, 0x30fc, 0x30e0, 0x3, 0x30ab, 0x30a4, 0x30ea, 0x4, 0x30ab, 0x30e9, 0x30c3, 0x30c8,
+		0x4, 0x30ab, 0x30ed, 0x30ea, 0x30fc, 0x4, 0x30ab, 0x3099, 0x30ed, 0x30f3, 0x4, 0x30ab, 0x3099, 0x30f3, 0x30de,
+		0x4, 0x30ad, 0x3099, 0x30ab, 0x3099, 0x4, 0x30ad, 0x3099, 0x30cb, 0x30fc, 0x4, 0x30ad, 0x30e5, 0x30ea, 0x30fc,
+		0x6, 0x30ad, 0x3099, 0x30eb, 0x30bf, 0x3099, 0x30fc, 0x2, 0x30ad, 0x30ed, 0x6, 0x30ad, 0x30ed, 0x30af, 0x3099,
+		0x30e9, 0x30e0, 0x6, 0x30ad, 0x30ed, 0x30e1, 0x30fc, 0x30c8, 0x30eb, 0x5, 0x30ad, 0x30ed, 0x30ef, 0x30c3,
+		0x30c8, 0x4, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x6, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x30c8, 0x30f3, 0x6, 0x30af,
+		0x30eb, 0x30bb, 0x3099, 0x30a4, 0x30ed, 0x4, 0x30af, 0x30ed, 0x30fc, 0x30cd, 0x3, 0x30b1, 0x30fc, 0x30b9, 0x3,
+		0x30b3, 0x30eb, 0x30ca, 0x4, 0x30b3, 0x30fc, 0x30db, 0x309a, 0x4, 0x30b5, 0x30a4, 0x30af, 0x30eb, 0x5, 0x30b5,
+		0x30f3, 0x30c1, 0x30fc, 0x30e0, 0x5, 0x30b7, 0x30ea, 0x30f3, 0x30af, 0x3099, 0x3, 0x30bb, 0x30f3, 0x30c1, 0x3,
+		0x30bb, 0x30f3, 0x30c8, 0x4, 0x30bf, 0x3099, 0x30fc, 0x30b9, 0x3, 0x30c6, 0x3099, 0x30b7, 0x3, 0x30c8, 0x3099,
+		0x30eb, 0x2, 0x30c8, 0x30f3, 0x2, 0x30ca, 0x30ce, 0x3, 0x30ce, 0x30c3, 0x30c8, 0x3, 0x30cf, 0x30a4, 0x30c4, 0x6,
+		0x30cf, 0x309a, 0x30fc, 0x30bb, 0x30f3, 0x30c8, 0x4, 0x30cf, 0x309a, 0x30fc, 0x30c4, 0x5, 0x30cf, 0x3099,
+		0x30fc, 0x30ec, 0x30eb, 0x6, 0x30d2, 0x309a, 0x30a2, 0x30b9, 0x30c8, 0x30eb, 0x4, 0x30d2, 0x309a, 0x30af,
+		0x30eb, 0x3, 0x30d2, 0x309a, 0x30b3, 0x3, 0x30d2, 0x3099, 0x30eb, 0x6, 0x30d5, 0x30a1, 0x30e9, 0x30c3, 0x30c8,
+		0x3099, 0x4, 0x30d5, 0x30a3, 0x30fc, 0x30c8, 0x6, 0x30d5, 0x3099, 0x30c3, 0x30b7, 0x30a7, 0x30eb, 0x3, 0x30d5,
+		0x30e9, 0x30f3, 0x5, 0x30d8, 0x30af, 0x30bf, 0x30fc, 0x30eb, 0x3, 0x30d8, 0x309a, 0x30bd, 0x4, 0x30d8, 0x309a,
+		0x30cb, 0x30d2, 0x3, 0x30d8, 0x30eb, 0x30c4, 0x4, 0x30d8, 0x309a, 0x30f3, 0x30b9, 0x5, 0x30d8, 0x309a, 0x30fc,
+		0x30b7, 0x3099, 0x4, 0x30d8, 0x3099, 0x30fc, 0x30bf, 0x5, 0x30db, 0x309a, 0x30a4, 0x30f3, 0x30c8, 0x4, 0x30db,
+		0x3099, 0x30eb, 0x30c8, 0x2, 0x30db, 0x30f3, 0x5, 0x30db, 0x309a, 0x30f3, 0x30c8, 0x3099, 0x3, 0x30db, 0x30fc,
+		0x30eb, 0x3, 0x30db, 0x30fc, 0x30f3, 0x4, 0x30de, 0x30a4, 0x30af, 0x30ed, 0x3, 0x30de, 0x30a4, 0x30eb, 0x3,
+		0x30de, 0x30c3, 0x30cf, 0x3, 0x30de, 0x30eb, 0x30af, 0x5, 0x30de, 0x30f3, 0x30b7, 0x30e7, 0x30f3, 0x4, 0x30df,
+		0x30af, 0x30ed, 0x30f3, 0x2, 0x30df, 0x30ea, 0x6, 0x30df, 0x30ea, 0x30cf, 0x3099, 0x30fc, 0x30eb, 0x3, 0x30e1,
+		0x30ab, 0x3099, 0x5, 0x30e1, 0x30ab, 0x3099, 0x30c8, 0x30f3, 0x4, 0x30e1, 0x30fc, 0x30c8, 0x30eb, 0x4, 0x30e4,
+		0x30fc, 0x30c8, 0x3099, 0x3, 0x30e4, 0x30fc, 0x30eb, 0x3, 0x30e6, 0x30a2, 0x30f3, 0x4, 0x30ea, 0x30c3, 0x30c8,
+		0x30eb, 0x2, 0x30ea, 0x30e9, 0x4, 0x30eb, 0x30d2, 0x309a, 0x30fc, 0x5, 0x30eb, 0x30fc, 0x30d5, 0x3099, 0x30eb,
+		0x2, 0x30ec, 0x30e0, 0x6, 0x30ec, 0x30f3, 0x30c8, 0x30b1, 0x3099, 0x30f3, 0x3, 0x30ef, 0x30c3, 0x30c8, 0x2,
+		0x30, 0x70b9, 0x2, 0x31, 0x70b9, 0x2, 0x32, 0x70b9, 0x2, 0x33, 0x70b9, 0x2, 0x34, 0x70b9, 0x2, 0x35, 0x70b9,
+		0x2, 0x36, 0x70b9, 0x2, 0x37, 0x70b9, 0x2, 0x38, 0x70b9, 0x2, 0x39, 0x70b9, 0x3, 0x31, 0x30, 0x70b9, 0x3, 0x31,
+		0x31, 0x70b9, 0x3, 0x31, 0x32, 0x70b9, 0x3, 0x31, 0x33, 0x70b9, 0x3, 0x31, 0x34, 0x70b9, 0x3, 0x31, 0x35,
+		0x70b9, 0x3, 0x31, 0x36, 0x70b9, 0x3, 0x31, 0x37, 0x70b9, 0x3, 0x31, 0x38, 0x70b9, 0x3, 0x31, 0x39, 0x70b9, 0x3,
+		0x32, 0x30, 0x70b9, 0x3, 0x32, 0x31, 0x70b9, 0x3, 0x32, 0x32, 0x70b9, 0x3, 0x32, 0x33, 0x70b9, 0x3, 0x32, 0x34,
+		0x70b9, 0x3, 0x68, 0x50, 0x61, 0x2, 0x64, 0x61, 0x2, 0x41, 0x55, 0x3, 0x62, 0x61, 0x72, 0x2, 0x6f, 0x56, 0x2,
+		0x70, 0x63, 0x2, 0x64, 0x6d, 0x3, 0x64, 0x6d, 0x32, 0x3, 0x64, 0x6d, 0x33, 0x2, 0x49, 0x55, 0x2, 0x5e73, 0x6210,
+		0x2, 0x662d, 0x548c, 0x2, 0x5927, 0x6b63, 0x2, 0x660e, 0x6cbb, 0x4, 0x682a, 0x5f0f, 0x4f1a, 0x793e, 0x2, 0x70,
+		0x41, 0x2, 0x6e, 0x41, 0x2, 0x3bc, 0x41, 0x2, 0x6d, 0x41, 0x2, 0x6b, 0x41, 0x2, 0x4b, 0x42, 0x2, 0x4d, 0x42,
+		0x2, 0x47, 0x42, 0x3, 0x63, 0x61, 0x6c, 0x4, 0x6b, 0x63, 0x61, 0x6c, 0x2, 0x70, 0x46, 0x2, 0x6e, 0x46, 0x2,
+		0x3bc, 0x46, 0x2, 0x3bc, 0x67, 0x2, 0x6d, 0x67, 0x2, 0x6b, 0x67, 0x2, 0x48, 0x7a, 0x3, 0x6b, 0x48, 0x7a, 0x3,
+		0x4d, 0x48, 0x7a, 0x3, 0x47, 0x48, 0x7a, 0x3, 0x54, 0x48, 0x7a, 0x2, 0x3bc, 0x6c, 0x2, 0x6d, 0x6c, 0x2, 0x64,
+		0x6c, 0x2, 0x6b, 0x6c, 0x2, 0x66, 0x6d, 0x2, 0x6e, 0x6d, 0x2, 0x3bc, 0x6d, 0x2, 0x6d, 0x6d, 0x2, 0x63, 0x6d,
+		0x2, 0x6b, 0x6d, 0x3, 0x6d, 0x6d, 0x32, 0x3, 0x63, 0x6d, 0x32, 0x2, 0x6d, 0x32, 0x3, 0x6b, 0x6d, 0x32, 0x3,
+		0x6d, 0x6d, 0x33, 0x3, 0x63, 0x6d, 0x33, 0x2, 0x6d, 0x33, 0x3, 0x6b, 0x6d, 0x33, 0x3, 0x6d, 0x2215, 0x73, 0x4,
+		0x6d, 0x2215, 0x73, 0x32, 0x2, 0x50, 0x61, 0x3, 0x6b, 0x50, 0x61, 0x3, 0x4d, 0x50, 0x61, 0x3, 0x47, 0x50, 0x61,
+		0x3, 0x72, 0x61, 0x64, 0x5, 0x72, 0x61, 0x64, 0x2215, 0x73, 0x6, 0x72, 0x61, 0x64, 0x2215, 0x73, 0x32, 0x2,
+		0x70, 0x73, 0x2, 0x6e, 0x73, 0x2, 0x3bc, 0x73, 0x2, 0x6d, 0x73, 0x2, 0x70, 0x56, 0x2, 0x6e, 0x56, 0x2, 0x3bc,
+		0x56, 0x2, 0x6d, 0x56, 0x2, 0x6b, 0x56, 0x2, 0x4d, 0x56, 0x2, 0x70, 0x57, 0x2, 0x6e, 0x57, 0x2, 0x3bc, 0x57,
+		0x2, 0x6d, 0x57, 0x2, 0x6b, 0x57, 0x2, 0x4d, 0x57, 0x2, 0x6b, 0x3a9, 0x2, 0x4d, 0x3a9, 0x4, 0x61, 0x2e, 0x6d,
+		0x2e, 0x2, 0x42, 0x71, 0x2, 0x63, 0x63, 0x2, 0x63, 0x64, 0x4, 0x43, 0x2215, 0x6b, 0x67, 0x3, 0x43, 0x6f, 0x2e,
+		0x2, 0x64, 0x42, 0x2, 0x47, 0x79, 0x2, 0x68, 0x61, 0x2, 0x48, 0x50, 0x2, 0x69, 0x6e, 0x2, 0x4b, 0x4b, 0x2, 0x4b,
+		0x4d, 0x2, 0x6b, 0x74, 0x2, 0x6c, 0x6d, 0x2, 0x6c, 0x6e, 0x3, 0x6c, 0x6f, 0x67, 0x2, 0x6c, 0x78, 0x2, 0x6d,
+		0x62, 0x3, 0x6d, 0x69, 0x6c, 0x3, 0x6d, 0x6f, 0x6c, 0x2, 0x50, 0x48, 0x4, 0x70, 0x2e, 0x6d, 0x2e, 0x3, 0x50,
+		0x50, 0x4d, 0x2, 0x50, 0x52, 0x2, 0x73, 0x72, 0x2, 0x53, 0x76, 0x2, 0x57, 0x62, 0x3, 0x56, 0x2215, 0x6d, 0x3,
+		0x41, 0x2215, 0x6d, 0x2, 0x31, 0x65e5, 0x2, 0x32, 0x65e5, 0x2, 0x33, 0x65e5, 0x2, 0x34, 0x65e5, 0x2, 0x35,
+		0x65e5, 0x2, 0x36, 0x65e5, 0x2, 0x37, 0x65e5, 0x2, 0x38, 0x65e5, 0x2, 0x39, 0x65e5, 0x3, 0x31, 0x30, 0x65e5,
+		0x3, 0x31, 0x31, 0x65e5, 0x3, 0x31, 0x32, 0x65e5, 0x3, 0x31, 0x33, 0x65e5, 0x3, 0x31, 0x34, 0x65e5, 0x3, 0x31,
+		0x35, 0x65e5, 0x3, 0x31, 0x36, 0x65e5, 0x3, 0x31, 0x37, 0x65e5, 0x3, 0x31, 0x38, 0x65e5, 0x3, 0x31, 0x39,
+		0x65e5, 0x3, 0x32, 0x30, 0x65e5, 0x3, 0x32, 0x31, 0x65e5, 0x3, 0x32, 0x32, 0x65e5, 0x3, 0x32, 0x33, 0x65e5, 0x3,
+		0x32, 0x34, 0x65e5, 0x3, 0x32, 0x35, 0x65e5, 0x3, 0x32, 0x36, 0x65e5, 0x3, 0x32, 0x37, 0x65e5, 0x3, 0x32, 0x38,
+		0x65e5, 0x3, 0x32, 0x39, 0x65e5, 0x3, 0x33, 0x30, 0x65e5, 0x3, 0x33, 0x31, 0x65e5, 0x3, 0x67, 0x61, 0x6c, 0x1,
+		0x44a, 0x1, 0x44c, 0x1, 0xa76f, 0x1, 0x126, 0x1, 0x153, 0x1, 0xa727, 0x1, 0xab37, 0x1, 0x26b, 0x1, 0xab52, 0x1,
+		0x28d, 0x1, 0x8c48, 0x1, 0x66f4, 0x1, 0x8cc8, 0x1, 0x6ed1, 0x1, 0x4e32, 0x1, 0x53e5, 0x1, 0x5951, 0x1, 0x5587,
+		0x1, 0x5948, 0x1, 0x61f6, 0x1, 0x7669, 0x1, 0x7f85, 0x1, 0x863f, 0x1, 0x87ba, 0x1, 0x88f8, 0x1, 0x908f, 0x1,
+		0x6a02, 0x1, 0x6d1b, 0x1, 0x70d9, 0x1, 0x73de, 0x1, 0x843d, 0x1, 0x916a, 0x1, 0x99f1, 0x1, 0x4e82, 0x1, 0x5375,
+		0x1, 0x6b04, 0x1, 0x721b, 0x1, 0x862d, 0x1, 0x9e1e, 0x1, 0x5d50, 0x1, 0x6feb, 0x1, 0x85cd, 0x1, 0x8964, 0x1,
+		0x62c9, 0x1, 0x81d8, 0x1, 0x881f, 0x1, 0x5eca, 0x1, 0x6717, 0x1, 0x6d6a, 0x1, 0x72fc, 0x1, 0x90ce, 0x1, 0x4f86,
+		0x1, 0x51b7, 0x1, 0x52de, 0x1, 0x64c4, 0x1, 0x6ad3, 0x1, 0x7210, 0x1, 0x76e7, 0x1, 0x8606, 0x1, 0x865c, 0x1,
+		0x8def, 0x1, 0x9732, 0x1, 0x9b6f, 0x1, 0x9dfa, 0x1, 0x788c, 0x1, 0x797f, 0x1, 0x7da0, 0x1, 0x83c9, 0x1, 0x9304,
+		0x1, 0x8ad6, 0x1, 0x58df, 0x1, 0x5f04, 0x1, 0x7c60, 0x1, 0x807e, 0x1, 0x7262, 0x1, 0x78ca, 0x1, 0x8cc2, 0x1,
+		0x96f7, 0x1, 0x58d8, 0x1, 0x5c62, 0x1, 0x6a13, 0x1, 0x6dda, 0x1, 0x6f0f, 0x1, 0x7d2f, 0x1, 0x7e37, 0x1, 0x964b,
+		0x1, 0x52d2, 0x1, 0x808b, 0x1, 0x51dc, 0x1, 0x51cc, 0x1, 0x7a1c, 0x1, 0x7dbe, 0x1, 0x83f1, 0x1, 0x9675, 0x1,
+		0x8b80, 0x1, 0x62cf, 0x1, 0x8afe, 0x1, 0x4e39, 0x1, 0x5be7, 0x1, 0x6012, 0x1, 0x7387, 0x1, 0x7570, 0x1, 0x5317,
+		0x1, 0x78fb, 0x1, 0x4fbf, 0x1, 0x5fa9, 0x1, 0x4e0d, 0x1, 0x6ccc, 0x1, 0x6578, 0x1, 0x7d22, 0x1, 0x53c3, 0x1,
+		0x585e, 0x1, 0x7701, 0x1, 0x8449, 0x1, 0x8aaa, 0x1, 0x6bba, 0x1, 0x6c88, 0x1, 0x62fe, 0x1, 0x82e5, 0x1, 0x63a0,
+		0x1, 0x7565, 0x1, 0x4eae, 0x1, 0x5169, 0x1, 0x51c9, 0x1, 0x6881, 0x1, 0x7ce7, 0x1, 0x826f, 0x1, 0x8ad2, 0x1,
+		0x91cf, 0x1, 0x52f5, 0x1, 0x5442, 0x1, 0x5eec, 0x1, 0x65c5, 0x1, 0x6ffe, 0x1, 0x792a, 0x1, 0x95ad, 0x1, 0x9a6a,
+		0x1, 0x9e97, 0x1, 0x9ece, 0x1, 0x66c6, 0x1, 0x6b77, 0x1, 0x8f62, 0x1, 0x5e74, 0x1, 0x6190, 0x1, 0x6200, 0x1,
+		0x649a, 0x1, 0x6f23, 0x1, 0x7149, 0x1, 0x7489, 0x1, 0x79ca, 0x1, 0x7df4, 0x1, 0x806f, 0x1, 0x8f26, 0x1, 0x84ee,
+		0x1, 0x9023, 0x1, 0x934a, 0x1, 0x5217, 0x1, 0x52a3, 0x1, 0x54bd, 0x1, 0x70c8, 0x1, 0x88c2, 0x1, 0x5ec9, 0x1,
+		0x5ff5, 0x1, 0x637b, 0x1, 0x6bae, 0x1, 0x7c3e, 0x1, 0x7375, 0x1, 0x4ee4, 0x1, 0x56f9, 0x1, 0x5dba, 0x1, 0x601c,
+		0x1, 0x73b2, 0x1, 0x7469, 0x1, 0x7f9a, 0x1, 0x8046, 0x1, 0x9234, 0x1, 0x96f6, 0x1, 0x9748, 0x1, 0x9818, 0x1,
+		0x4f8b, 0x1, 0x79ae, 0x1, 0x91b4, 0x1, 0x96b8, 0x1, 0x60e1, 0x1, 0x4e86, 0x1, 0x50da, 0x1, 0x5bee, 0x1, 0x5c3f,
+		0x1, 0x6599, 0x1, 0x71ce, 0x1, 0x7642, 0x1, 0x84fc, 0x1, 0x907c, 0x1, 0x6688, 0x1, 0x962e, 0x1, 0x5289, 0x1,
+		0x677b, 0x1, 0x67f3, 0x1, 0x6d41, 0x1, 0x6e9c, 0x1, 0x7409, 0x1, 0x7559, 0x1, 0x786b, 0x1, 0x7d10, 0x1, 0x985e,
+		0x1, 0x622e, 0x1, 0x9678, 0x1, 0x502b, 0x1, 0x5d19, 0x1, 0x6dea, 0x1, 0x8f2a, 0x1, 0x5f8b, 0x1, 0x6144, 0x1,
+		0x6817, 0x1, 0x9686, 0x1, 0x5229, 0x1, 0x540f, 0x1, 0x5c65, 0x1, 0x6613, 0x1, 0x674e, 0x1, 0x68a8, 0x1, 0x6ce5,
+		0x1, 0x7406, 0x1, 0x75e2, 0x1, 0x7f79, 0x1, 0x88cf, 0x1, 0x88e1, 0x1, 0x96e2, 0x1, 0x533f, 0x1, 0x6eba, 0x1,
+		0x541d, 0x1, 0x71d0, 0x1, 0x7498, 0x1, 0x85fa, 0x1, 0x96a3, 0x1, 0x9c57, 0x1, 0x9e9f, 0x1, 0x6797, 0x1, 0x6dcb,
+		0x1, 0x81e8, 0x1, 0x7b20, 0x1, 0x7c92, 0x1, 0x72c0, 0x1, 0x7099, 0x1, 0x8b58, 0x1, 0x4ec0, 0x1, 0x8336, 0x1,
+		0x523a, 0x1, 0x5207, 0x1, 0x5ea6, 0x1, 0x62d3, 0x1, 0x7cd6, 0x1, 0x5b85, 0x1, 0x6d1e, 0x1, 0x66b4, 0x1, 0x8f3b,
+		0x1, 0x964d, 0x1, 0x5ed3, 0x1, 0x5140, 0x1, 0x55c0, 0x1, 0x585a, 0x1, 0x6674, 0x1, 0x51de, 0x1, 0x732a, 0x1,
+		0x76ca, 0x1, 0x793c, 0x1, 0x795e, 0x1, 0x7965, 0x1, 0x798f, 0x1, 0x9756, 0x1, 0x7cbe, 0x1, 0x8612, 0x1, 0x8af8,
+		0x1, 0x9038, 0x1, 0x90fd, 0x1, 0x98ef, 0x1, 0x98fc, 0x1, 0x9928, 0x1, 0x9db4, 0x1, 0x90de, 0x1, 0x96b7, 0x1,
+		0x4fae, 0x1, 0x50e7, 0x1, 0x514d, 0x1, 0x52c9, 0x1, 0x52e4, 0x1, 0x5351, 0x1, 0x559d, 0x1, 0x5606, 0x1, 0x5668,
+		0x1, 0x5840, 0x1, 0x58a8, 0x1, 0x5c64, 0x1, 0x6094, 0x1, 0x6168, 0x1, 0x618e, 0x1, 0x61f2, 0x1, 0x654f, 0x1,
+		0x65e2, 0x1, 0x6691, 0x1, 0x6885, 0x1, 0x6d77, 0x1, 0x6e1a, 0x1, 0x6f22, 0x1, 0x716e, 0x1, 0x722b, 0x1, 0x7422,
+		0x1, 0x7891, 0x1, 0x7949, 0x1, 0x7948, 0x1, 0x7950, 0x1, 0x7956, 0x1, 0x798d, 0x1, 0x798e, 0x1, 0x7a40, 0x1,
+		0x7a81, 0x1, 0x7bc0, 0x1, 0x7e09, 0x1, 0x7e41, 0x1, 0x7f72, 0x1, 0x8005, 0x1, 0x81ed, 0x1, 0x8279, 0x1, 0x8457,
+		0x1, 0x8910, 0x1, 0x8996, 0x1, 0x8b01, 0x1, 0x8b39, 0x1, 0x8cd3, 0x1, 0x8d08, 0x1, 0x8fb6, 0x1, 0x96e3, 0x1,
+		0x97ff, 0x1, 0x983b, 0x1, 0x6075, 0x1, 0x242ee, 0x1, 0x8218, 0x1, 0x4e26, 0x1, 0x51b5, 0x1, 0x5168, 0x1, 0x4f80,
+		0x1, 0x5145, 0x1, 0x5180, 0x1, 0x52c7, 0x1, 0x52fa, 0x1, 0x5555, 0x1, 0x5599, 0x1, 0x55e2, 0x1, 0x58b3, 0x1,
+		0x5944, 0x1, 0x5954, 0x1, 0x5a62, 0x1, 0x5b28, 0x1, 0x5ed2, 0x1, 0x5ed9, 0x1, 0x5f69, 0x1, 0x5fad, 0x1, 0x60d8,
+		0x1, 0x614e, 0x1, 0x6108, 0x1, 0x6160, 0x1, 0x6234, 0x1, 0x63c4, 0x1, 0x641c, 0x1, 0x6452, 0x1, 0x6556, 0x1,
+		0x671b, 0x1, 0x6756, 0x1, 0x6edb, 0x1, 0x6ecb, 0x1, 0x701e, 0x1, 0x77a7, 0x1, 0x7235, 0x1, 0x72af, 0x1, 0x7471,
+		0x1, 0x7506, 0x1, 0x753b, 0x1, 0x761d, 0x1, 0x761f, 0x1, 0x76db, 0x1, 0x76f4, 0x1, 0x774a, 0x1, 0x7740, 0x1,
+		0x78cc, 0x1, 0x7ab1, 0x1, 0x7c7b, 0x1, 0x7d5b, 0x1, 0x7f3e, 0x1, 0x8352, 0x1, 0x83ef, 0x1, 0x8779, 0x1, 0x8941,
+		0x1, 0x8986, 0x1, 0x8abf, 0x1, 0x8acb, 0x1, 0x8aed, 0x1, 0x8b8a, 0x1, 0x8f38, 0x1, 0x9072, 0x1, 0x9199, 0x1,
+		0x9276, 0x1, 0x967c, 0x1, 0x97db, 0x1, 0x980b, 0x1, 0x9b12, 0x1, 0x2284a, 0x1, 0x22844, 0x1, 0x233d5, 0x1,
+		0x3b9d, 0x1, 0x4018, 0x1, 0x4039, 0x1, 0x25249, 0x1, 0x25cd0, 0x1, 0x27ed3, 0x1, 0x9f43, 0x1, 0x9f8e, 0x2, 0x66,
+		0x66, 0x2, 0x66, 0x69, 0x2, 0x66, 0x6c, 0x3, 0x66, 0x66, 0x69, 0x3, 0x66, 0x66, 0x6c, 0x2, 0x73, 0x74, 0x2,
+		0x574, 0x576, 0x2, 0x574, 0x565, 0x2, 0x574, 0x56b, 0x2, 0x57e, 0x576, 0x2, 0x574, 0x56d, 0x2, 0x5d9, 0x5b4,
+		0x2, 0x5f2, 0x5b7, 0x1, 0x5e2, 0x1, 0x5d4, 0x1, 0x5db, 0x1, 0x5dc, 0x1, 0x5dd, 0x1, 0x5e8, 0x1, 0x5ea, 0x2,
+		0x5e9, 0x5c1, 0x2, 0x5e9, 0x5c2, 0x3, 0x5e9, 0x5bc, 0x5c1, 0x3, 0x5e9, 0x5bc, 0x5c2, 0x2, 0x5d0, 0x5b7, 0x2,
+		0x5d0, 0x5b8, 0x2, 0x5d0, 0x5bc, 0x2, 0x5d1, 0x5bc, 0x2, 0x5d2, 0x5bc, 0x2, 0x5d3, 0x5bc, 0x2, 0x5d4, 0x5bc,
+		0x2, 0x5d5, 0x5bc, 0x2, 0x5d6, 0x5bc, 0x2, 0x5d8, 0x5bc, 0x2, 0x5d9, 0x5bc, 0x2, 0x5da, 0x5bc, 0x2, 0x5db,
+		0x5bc, 0x2, 0x5dc, 0x5bc, 0x2, 0x5de, 0x5bc, 0x2, 0x5e0, 0x5bc, 0x2, 0x5e1, 0x5bc, 0x2, 0x5e3, 0x5bc, 0x2,
+		0x5e4, 0x5bc, 0x2, 0x5e6, 0x5bc, 0x2, 0x5e7, 0x5bc, 0x2, 0x5e8, 0x5bc, 0x2, 0x5e9, 0x5bc, 0x2, 0x5ea, 0x5bc,
+		0x2, 0x5d5, 0x5b9, 0x2, 0x5d1, 0x5bf, 0x2, 0x5db, 0x5bf, 0x2, 0x5e4, 0x5bf, 0x2, 0x5d0, 0x5dc, 0x1, 0x671, 0x1,
+		0x67b, 0x1, 0x67e, 0x1, 0x680, 0x1, 0x67a, 0x1, 0x67f, 0x1, 0x679, 0x1, 0x6a4, 0x1, 0x6a6, 0x1, 0x684, 0x1,
+		0x683, 0x1, 0x686, 0x1, 0x687, 0x1, 0x68d, 0x1, 0x68c, 0x1, 0x68e, 0x1, 0x688, 0x1, 0x698, 0x1, 0x691, 0x1,
+		0x6a9, 0x1, 0x6af, 0x1, 0x6b3, 0x1, 0x6b1, 0x1, 0x6ba, 0x1, 0x6bb, 0x1, 0x6c1, 0x1, 0x6be, 0x1, 0x6d2, 0x1,
+		0x6ad, 0x1, 0x6c7, 0x1, 0x6c6, 0x1, 0x6c8, 0x1, 0x6cb, 0x1, 0x6c5, 0x1, 0x6c9, 0x1, 0x6d0, 0x1, 0x649, 0x3,
+		0x64a, 0x654, 0x627, 0x3, 0x64a, 0x654, 0x6d5, 0x3, 0x64a, 0x654, 0x648, 0x3, 0x64a, 0x654, 0x6c7, 0x3, 0x64a,
+		0x654, 0x6c6, 0x3, 0x64a, 0x654, 0x6c8, 0x3, 0x64a, 0x654, 0x6d0, 0x3, 0x64a, 0x654, 0x649, 0x1, 0x6cc, 0x3,
+		0x64a, 0x654, 0x62c, 0x3, 0x64a, 0x654, 0x62d, 0x3, 0x64a, 0x654, 0x645, 0x3, 0x64a, 0x654, 0x64a, 0x2, 0x628,
+		0x62c, 0x2, 0x628, 0x62d, 0x2, 0x628, 0x62e, 0x2, 0x628, 0x645, 0x2, 0x628, 0x649, 0x2, 0x628, 0x64a, 0x2,
+		0x62a, 0x62c, 0x2, 0x62a, 0x62d, 0x2, 0x62a, 0x62e, 0x2, 0x62a, 0x645, 0x2, 0x62a, 0x649, 0x2, 0x62a, 0x64a,
+		0x2, 0x62b, 0x62c, 0x2, 0x62b, 0x645, 0x2, 0x62b, 0x649, 0x2, 0x62b, 0x64a, 0x2, 0x62c, 0x62d, 0x2, 0x62c,
+		0x645, 0x2, 0x62d, 0x62c, 0x2, 0x62d, 0x645, 0x2, 0x62e, 0x62c, 0x2, 0x62e, 0x62d, 0x2, 0x62e, 0x645, 0x2,
+		0x633, 0x62c, 0x2, 0x633, 0x62d, 0x2, 0x633, 0x62e, 0x2, 0x633, 0x645, 0x2, 0x635, 0x62d, 0x2, 0x635, 0x645,
+		0x2, 0x636, 0x62c, 0x2, 0x636, 0x62d, 0x2, 0x636, 0x62e, 0x2, 0x636, 0x645, 0x2, 0x637, 0x62d, 0x2, 0x637,
+		0x645, 0x2, 0x638, 0x645, 0x2, 0x639, 0x62c, 0x2, 0x639, 0x645, 0x2, 0x63a, 0x62c, 0x2, 0x63a, 0x645, 0x2,
+		0x641, 0x62c, 0x2, 0x641, 0x62d, 0x2, 0x641, 0x62e, 0x2, 0x641, 0x645, 0x2, 0x641, 0x649, 0x2, 0x641, 0x64a,
+		0x2, 0x642, 0x62d, 0x2, 0x642, 0x645, 0x2, 0x642, 0x649, 0x2, 0x642, 0x64a, 0x2, 0x643, 0x627, 0x2, 0x643,
+		0x62c, 0x2, 0x643, 0x62d, 0x2, 0x643, 0x62e, 0x2, 0x643, 0x644, 0x2, 0x643, 0x645, 0x2, 0x643, 0x649, 0x2,
+		0x643, 0x64a, 0x2, 0x644, 0x62c, 0x2, 0x644, 0x62d, 0x2, 0x644, 0x62e, 0x2, 0x644, 0x645, 0x2, 0x644, 0x649,
+		0x2, 0x644, 0x64a, 0x2, 0x645, 0x62c, 0x2, 0x645, 0x62d, 0x2, 0x645, 0x62e, 0x2, 0x645, 0x645, 0x2, 0x645,
+		0x649, 0x2, 0x645, 0x64a, 0x2, 0x646, 0x62c, 0x2, 0x646, 0x62d, 0x2, 0x646, 0x62e, 0x2, 0x646, 0x645, 0x2,
+		0x646, 0x649, 0x2, 0x646, 0x64a, 0x2, 0x647, 0x62c, 0x2, 0x647, 0x645, 0x2, 0x647, 0x649, 0x2, 0x647, 0x64a,
+		0x2, 0x64a, 0x62c, 0x2, 0x64a, 0x62d, 0x2, 0x64a, 0x62e, 0x2, 0x64a, 0x645, 0x2, 0x64a, 0x649, 0x2, 0x64a,
+		0x64a, 0x2, 0x630, 0x670, 0x2, 0x631, 0x670, 0x2, 0x649, 0x670, 0x3, 0x20, 0x64c, 0x651, 0x3, 0x20, 0x64d,
+		0x651, 0x3, 0x20, 0x64e, 0x651, 0x3, 0x20, 0x64f, 0x651, 0x3, 0x20, 0x650, 0x651, 0x3, 0x20, 0x651, 0x670, 0x3,
+		0x64a, 0x654, 0x631, 0x3, 0x64a, 0x654, 0x632, 0x3, 0x64a, 0x654, 0x646, 0x2, 0x628, 0x631, 0x2, 0x628, 0x632,
+		0x2, 0x628, 0x646, 0x2, 0x62a, 0x631, 0x2, 0x62a, 0x632, 0x2, 0x62a, 0x646, 0x2, 0x62b, 0x631, 0x2, 0x62b,
+		0x632, 0x2, 0x62b, 0x646, 0x2, 0x645, 0x627, 0x2, 0x646, 0x631, 0x2, 0x646, 0x632, 0x2, 0x646, 0x646, 0x2,
+		0x64a, 0x631, 0x2, 0x64a, 0x632, 0x2, 0x64a, 0x646, 0x3, 0x64a, 0x654, 0x62e, 0x3, 0x64a, 0x654, 0x647, 0x2,
+		0x628, 0x647, 0x2, 0x62a, 0x647, 0x2, 0x635, 0x62e, 0x2, 0x644, 0x647, 0x2, 0x646, 0x647, 0x2, 0x647, 0x670,
+		0x2, 0x64a, 0x647, 0x2, 0x62b, 0x647, 0x2, 0x633, 0x647, 0x2, 0x634, 0x645, 0x2, 0x634, 0x647, 0x3, 0x640,
+		0x64e, 0x651, 0x3, 0x640, 0x64f, 0x651, 0x3, 0x640, 0x650, 0x651, 0x2, 0x637, 0x649, 0x2, 0x637, 0x64a, 0x2,
+		0x639, 0x649, 0x2, 0x639, 0x64a, 0x2, 0x63a, 0x649, 0x2, 0x63a, 0x64a, 0x2, 0x633, 0x649, 0x2, 0x633, 0x64a,
+		0x2, 0x634, 0x649, 0x2, 0x634, 0x64a, 0x2, 0x62d, 0x649, 0x2, 0x62d, 0x64a, 0x2, 0x62c, 0x649, 0x2, 0x62c,
+		0x64a, 0x2, 0x62e, 0x649, 0x2, 0x62e, 0x64a, 0x2, 0x635, 0x649, 0x2, 0x635, 0x64a, 0x2, 0x636, 0x649, 0x2,
+		0x636, 0x64a, 0x2, 0x634, 0x62c, 0x2, 0x634, 0x62d, 0x2, 0x634, 0x62e, 0x2, 0x634, 0x631, 0x2, 0x633, 0x631,
+		0x2, 0x635, 0x631, 0x2, 0x636, 0x631, 0x2, 0x627, 0x64b, 0x3, 0x62a, 0x62c, 0x645, 0x3, 0x62a, 0x62d, 0x62c,
+		0x3, 0x62a, 0x62d, 0x645, 0x3, 0x62a, 0x62e, 0x645, 0x3, 0x62a, 0x645, 0x62c, 0x3, 0x62a, 0x645, 0x62d, 0x3,
+		0x62a, 0x645, 0x62e, 0x3, 0x62c, 0x645, 0x62d, 0x3, 0x62d, 0x645, 0x64a, 0x3, 0x62d, 0x645, 0x649, 0x3, 0x633,
+		0x62d, 0x62c, 0x3, 0x633, 0x62c, 0x62d, 0x3, 0x633, 0x62c, 0x649, 0x3, 0x633, 0x645, 0x62d, 0x3, 0x633, 0x645,
+		0x62c, 0x3, 0x633, 0x645, 0x645, 0x3, 0x635, 0x62d, 0x62d, 0x3, 0x635, 0x645, 0x645, 0x3, 0x634, 0x62d, 0x645,
+		0x3, 0x634, 0x62c, 0x64a, 0x3, 0x634, 0x645, 0x62e, 0x3, 0x634, 0x645, 0x645, 0x3, 0x636, 0x62d, 0x649, 0x3,
+		0x636, 0x62e, 0x645, 0x3, 0x637, 0x645, 0x62d, 0x3, 0x637, 0x645, 0x645, 0x3, 0x637, 0x645, 0x64a, 0x3, 0x639,
+		0x62c, 0x645, 0x3, 0x639, 0x645, 0x645, 0x3, 0x639, 0x645, 0x649, 0x3, 0x63a, 0x645, 0x645, 0x3, 0x63a, 0x645,
+		0x64a, 0x3, 0x63a, 0x645, 0x649, 0x3, 0x641, 0x62e, 0x645, 0x3, 0x642, 0x645, 0x62d, 0x3, 0x642, 0x645, 0x645,
+		0x3, 0x644, 0x62d, 0x645, 0x3, 0x644, 0x62d, 0x64a, 0x3, 0x644, 0x62d, 0x649, 0x3, 0x644, 0x62c, 0x62c, 0x3,
+		0x644, 0x62e, 0x645, 0x3, 0x644, 0x645, 0x62d, 0x3, 0x645, 0x62d, 0x62c, 0x3, 0x645, 0x62d, 0x645, 0x3, 0x645,
+		0x62d, 0x64a, 0x3, 0x645, 0x62c, 0x62d, 0x3, 0x645, 0x62c, 0x645, 0x3, 0x645, 0x62e, 0x62c, 0x3, 0x645, 0x62e,
+		0x645, 0x3, 0x645, 0x62c, 0x62e, 0x3, 0x647, 0x645, 0x62c, 0x3, 0x647, 0x645, 0x645, 0x3, 0x646, 0x62d, 0x645,
+		0x3, 0x646, 0x62d, 0x649, 0x3, 0x646, 0x62c, 0x645, 0x3, 0x646, 0x62c, 0x649, 0x3, 0x646, 0x645, 0x64a, 0x3,
+		0x646, 0x645, 0x649, 0x3, 0x64a, 0x645, 0x645, 0x3, 0x628, 0x62e, 0x64a, 0x3, 0x62a, 0x62c, 0x64a, 0x3, 0x62a,
+		0x62c, 0x649, 0x3, 0x62a, 0x62e, 0x64a, 0x3, 0x62a, 0x62e, 0x649, 0x3, 0x62a, 0x645, 0x64a, 0x3, 0x62a, 0x645,
+		0x649, 0x3, 0x62c, 0x645, 0x64a, 0x3, 0x62c, 0x62d, 0x649, 0x3, 0x62c, 0x645, 0x649, 0x3, 0x633, 0x62e, 0x649,
+		0x3, 0x635, 0x62d, 0x64a, 0x3, 0x634, 0x62d, 0x64a, 0x3, 0x636, 0x62d, 0x64a, 0x3, 0x644, 0x62c, 0x64a, 0x3,
+		0x644, 0x645, 0x64a, 0x3, 0x64a, 0x62d, 0x64a, 0x3, 0x64a, 0x62c, 0x64a, 0x3, 0x64a, 0x645, 0x64a, 0x3, 0x645,
+		0x645, 0x64a, 0x3, 0x642, 0x645, 0x64a, 0x3, 0x646, 0x62d, 0x64a, 0x3, 0x639, 0x645, 0x64a, 0x3, 0x643, 0x645,
+		0x64a, 0x3, 0x646, 0x62c, 0x62d, 0x3, 0x645, 0x62e, 0x64a, 0x3, 0x644, 0x62c, 0x645, 0x3, 0x643, 0x645, 0x645,
+		0x3, 0x62c, 0x62d, 0x64a, 0x3, 0x62d, 0x62c, 0x64a, 0x3, 0x645, 0x62c, 0x64a, 0x3, 0x641, 0x645, 0x64a, 0x3,
+		0x628, 0x62d, 0x64a, 0x3, 0x633, 0x62e, 0x64a, 0x3, 0x646, 0x62c, 0x64a, 0x3, 0x635, 0x644, 0x6d2, 0x3, 0x642,
+		0x644, 0x6d2, 0x4, 0x627, 0x644, 0x644, 0x647, 0x4, 0x627, 0x643, 0x628, 0x631, 0x4, 0x645, 0x62d, 0x645, 0x62f,
+		0x4, 0x635, 0x644, 0x639, 0x645, 0x4, 0x631, 0x633, 0x648, 0x644, 0x4, 0x639, 0x644, 0x64a, 0x647, 0x4, 0x648,
+		0x633, 0x644, 0x645, 0x3, 0x635, 0x644, 0x649, 0x12, 0x635, 0x644, 0x649, 0x20, 0x627, 0x644, 0x644, 0x647,
+		0x20, 0x639, 0x644, 0x64a, 0x647, 0x20, 0x648, 0x633, 0x644, 0x645, 0x8, 0x62c, 0x644, 0x20, 0x62c, 0x644,
+		0x627, 0x644, 0x647, 0x4, 0x631, 0x6cc, 0x627, 0x644, 0x1, 0x2c, 0x1, 0x3001, 0x1, 0x3002, 0x1, 0x3a, 0x1, 0x21,
+		0x1, 0x3f, 0x1, 0x3016, 0x1, 0x3017, 0x1, 0x2014, 0x1, 0x2013, 0x1, 0x5f, 0x1, 0x7b, 0x1, 0x7d, 0x1, 0x3014,
+		0x1, 0x3015, 0x1, 0x3010, 0x1, 0x3011, 0x1, 0x300a, 0x1, 0x300b, 0x1, 0x300c, 0x1, 0x300d, 0x1, 0x300e, 0x1,
+		0x300f, 0x1, 0x5b, 0x1, 0x5d, 0x1, 0x23, 0x1, 0x26, 0x1, 0x2a, 0x1, 0x2d, 0x1, 0x3c, 0x1, 0x3e, 0x1, 0x5c, 0x1,
+		0x24, 0x1, 0x25, 0x1, 0x40, 0x2, 0x20, 0x64b, 0x2, 0x640, 0x64b, 0x2, 0x20, 0x64c, 0x2, 0x20, 0x64d, 0x2, 0x20,
+		0x64e, 0x2, 0x640, 0x64e, 0x2, 0x20, 0x64f, 0x2, 0x640, 0x64f, 0x2, 0x20, 0x650, 0x2, 0x640, 0x650, 0x2, 0x20,
+		0x651, 0x2, 0x640, 0x651, 0x2, 0x20, 0x652, 0x2, 0x640, 0x652, 0x1, 0x621, 0x1, 0x627, 0x1, 0x628, 0x1, 0x629,
+		0x1, 0x62a, 0x1, 0x62b, 0x1, 0x62c, 0x1, 0x62d, 0x1, 0x62e, 0x1, 0x62f, 0x1, 0x630, 0x1, 0x631, 0x1, 0x632, 0x1,
+		0x633, 0x1, 0x634, 0x1, 0x635, 0x1, 0x636, 0x1, 0x637, 0x1, 0x638, 0x1, 0x639, 0x1, 0x63a, 0x1, 0x641, 0x1,
+		0x642, 0x1, 0x643, 0x1, 0x644, 0x1, 0x645, 0x1, 0x646, 0x1, 0x647, 0x1, 0x648, 0x1, 0x64a, 0x3, 0x644, 0x627,
+		0x653, 0x3, 0x644, 0x627, 0x654, 0x3, 0x644, 0x627, 0x655, 0x2, 0x644, 0x627, 0x1, 0x22, 0x1, 0x27, 0x1, 0x2f,
+		0x1, 0x5e, 0x1, 0x7c, 0x1, 0x7e, 0x1, 0x2985, 0x1, 0x2986, 0x1, 0x30fb, 0x1, 0x30a1, 0x1, 0x30a3, 0x1, 0x30a5,
+		0x1, 0x30a7, 0x1, 0x30a9, 0x1, 0x30e3, 0x1, 0x30e5, 0x1, 0x30e7, 0x1, 0x30c3, 0x1, 0x30fc, 0x1, 0x30f3, 0x1,
+		0x3099, 0x1, 0x309a, 0x1, 0xa2, 0x1, 0xa3, 0x1, 0xac, 0x1, 0xa6, 0x1, 0xa5, 0x1, 0x20a9, 0x1, 0x2502, 0x1,
+		0x2190, 0x1, 0x2191, 0x1, 0x2192, 0x1, 0x2193, 0x1, 0x25a0, 0x1, 0x25cb, 0x1, 0x2d0, 0x1, 0x2d1, 0x1, 0xe6, 0x1,
+		0x299, 0x1, 0x253, 0x1, 0x2a3, 0x1, 0xab66, 0x1, 0x2a5, 0x1, 0x2a4, 0x1, 0x256, 0x1, 0x257, 0x1, 0x1d91, 0x1,
+		0x258, 0x1, 0x25e, 0x1, 0x2a9, 0x1, 0x264, 0x1, 0x262, 0x1, 0x260, 0x1, 0x29b, 0x1, 0x29c, 0x1, 0x267, 0x1,
+		0x284, 0x1, 0x2aa, 0x1, 0x2ab, 0x1, 0x26c, 0x1, 0x1df04, 0x1, 0xa78e, 0x1, 0x26e, 0x1, 0x1df05, 0x1, 0x28e, 0x1,
+		0x1df06, 0x1, 0xf8, 0x1, 0x276, 0x1, 0x277, 0x1, 0x27a, 0x1, 0x1df08, 0x1, 0x27d, 0x1, 0x27e, 0x1, 0x280, 0x1,
+		0x2a8, 0x1, 0x2a6, 0x1, 0xab67, 0x1, 0x2a7, 0x1, 0x288, 0x1, 0x2c71, 0x1, 0x28f, 0x1, 0x2a1, 0x1, 0x2a2, 0x1,
+		0x298, 0x1, 0x1c0, 0x1, 0x1c1, 0x1, 0x1c2, 0x1, 0x1df0a, 0x1, 0x1df1e, 0x2, 0x11099, 0x110ba, 0x2, 0x1109b,
+		0x110ba, 0x2, 0x110a5, 0x110ba, 0x2, 0x11131, 0x11127, 0x2, 0x11132, 0x11127, 0x2, 0x11347, 0x1133e, 0x2,
+		0x11347, 0x11357, 0x2, 0x114b9, 0x114ba, 0x2, 0x114b9, 0x114b0, 0x2, 0x114b9, 0x114bd, 0x2, 0x115b8, 0x115af,
+		0x2, 0x115b9, 0x115af, 0x2, 0x11935, 0x11930, 0x2, 0x1d157, 0x1d165, 0x2, 0x1d158, 0x1d165, 0x3, 0x1d158,
+		0x1d165, 0x1d16e, 0x3, 0x1d158, 0x1d165, 0x1d16f, 0x3, 0x1d158, 0x1d165, 0x1d170, 0x3, 0x1d158, 0x1d165,
+		0x1d171, 0x3, 0x1d158, 0x1d165, 0x1d172, 0x2, 0x1d1b9, 0x1d165, 0x2, 0x1d1ba, 0x1d165, 0x3, 0x1d1b9, 0x1d165,
+		0x1d16e, 0x3, 0x1d1ba, 0x1d165, 0x1d16e, 0x3, 0x1d1b9, 0x1d165, 0x1d16f, 0x3, 0x1d1ba, 0x1d165, 0x1d16f, 0x1,
+		0x131, 0x1, 0x237, 0x1, 0x391, 0x1, 0x392, 0x1, 0x394, 0x1, 0x395, 0x1, 0x396, 0x1, 0x397, 0x1, 0x399, 0x1,
+		0x39a, 0x1, 0x39b, 0x1, 0x39c, 0x1, 0x39d, 0x1, 0x39e, 0x1, 0x39f, 0x1, 0x3a1, 0x1, 0x3a4, 0x1, 0x3a6, 0x1,
+		0x3a7, 0x1, 0x3a8, 0x1, 0x2207, 0x1, 0x3b1, 0x1, 0x3b6, 0x1, 0x3b7, 0x1, 0x3bb, 0x1, 0x3bd, 0x1, 0x3be, 0x1,
+		0x3bf, 0x1, 0x3c3, 0x1, 0x3c4, 0x1, 0x3c5, 0x1, 0x3c8, 0x1, 0x3c9, 0x1, 0x2202, 0x1, 0x3dc, 0x1, 0x3dd, 0x1,
+		0x430, 0x1, 0x431, 0x1, 0x432, 0x1, 0x433, 0x1, 0x434, 0x1, 0x435, 0x1, 0x436, 0x1, 0x437, 0x1, 0x438, 0x1,
+		0x43a, 0x1, 0x43b, 0x1, 0x43c, 0x1, 0x43e, 0x1, 0x43f, 0x1, 0x440, 0x1, 0x441, 0x1, 0x442, 0x1, 0x443, 0x1,
+		0x444, 0x1, 0x445, 0x1, 0x446, 0x1, 0x447, 0x1, 0x448, 0x1, 0x44b, 0x1, 0x44d, 0x1, 0x44e, 0x1, 0xa689, 0x1,
+		0x4d9, 0x1, 0x456, 0x1, 0x458, 0x1, 0x4e9, 0x1, 0x4af, 0x1, 0x4cf, 0x1, 0x491, 0x1, 0x455, 0x1, 0x45f, 0x1,
+		0x4ab, 0x1, 0xa651, 0x1, 0x4b1, 0x1, 0x66e, 0x1, 0x6a1, 0x1, 0x66f, 0x2, 0x30, 0x2e, 0x2, 0x30, 0x2c, 0x2, 0x31,
+		0x2c, 0x2, 0x32, 0x2c, 0x2, 0x33, 0x2c, 0x2, 0x34, 0x2c, 0x2, 0x35, 0x2c, 0x2, 0x36, 0x2c, 0x2, 0x37, 0x2c, 0x2,
+		0x38, 0x2c, 0x2, 0x39, 0x2c, 0x3, 0x28, 0x41, 0x29, 0x3, 0x28, 0x42, 0x29, 0x3, 0x28, 0x43, 0x29, 0x3, 0x28,
+		0x44, 0x29, 0x3, 0x28, 0x45, 0x29, 0x3, 0x28, 0x46, 0x29, 0x3, 0x28, 0x47, 0x29, 0x3, 0x28, 0x48, 0x29, 0x3,
+		0x28, 0x49, 0x29, 0x3, 0x28, 0x4a, 0x29, 0x3, 0x28, 0x4b, 0x29, 0x3, 0x28, 0x4c, 0x29, 0x3, 0x28, 0x4d, 0x29,
+		0x3, 0x28, 0x4e, 0x29, 0x3, 0x28, 0x4f, 0x29, 0x3, 0x28, 0x50, 0x29, 0x3, 0x28, 0x51, 0x29, 0x3, 0x28, 0x52,
+		0x29, 0x3, 0x28, 0x53, 0x29, 0x3, 0x28, 0x54, 0x29, 0x3, 0x28, 0x55, 0x29, 0x3, 0x28, 0x56, 0x29, 0x3, 0x28,
+		0x57, 0x29, 0x3, 0x28, 0x58, 0x29, 0x3, 0x28, 0x59, 0x29, 0x3, 0x28, 0x5a, 0x29, 0x3, 0x3014, 0x53, 0x3015, 0x2,
+		0x43, 0x44, 0x2, 0x57, 0x5a, 0x2, 0x48, 0x56, 0x2, 0x53, 0x44, 0x2, 0x53, 0x53, 0x3, 0x50, 0x50, 0x56, 0x2,
+		0x57, 0x43, 0x2, 0x4d, 0x43, 0x2, 0x4d, 0x44, 0x2, 0x4d, 0x52, 0x2, 0x44, 0x4a, 0x2, 0x307b, 0x304b, 0x2,
+		0x30b3, 0x30b3, 0x1, 0x5b57, 0x1, 0x53cc, 0x1, 0x591a, 0x1, 0x89e3, 0x1, 0x4ea4, 0x1, 0x6620, 0x1, 0x7121, 0x1,
+		0x524d, 0x1, 0x5f8c, 0x1, 0x518d, 0x1, 0x65b0, 0x1, 0x521d, 0x1, 0x7d42, 0x1, 0x8ca9, 0x1, 0x58f0, 0x1, 0x5439,
+		0x1, 0x6f14, 0x1, 0x6295, 0x1, 0x6355, 0x1, 0x904a, 0x1, 0x6307, 0x1, 0x6253, 0x1, 0x7981, 0x1, 0x7a7a, 0x1,
+		0x5408, 0x1, 0x6e80, 0x1, 0x7533, 0x1, 0x5272, 0x1, 0x55b6, 0x1, 0x914d, 0x3, 0x3014, 0x672c, 0x3015, 0x3,
+		0x3014, 0x4e09, 0x3015, 0x3, 0x3014, 0x4e8c, 0x3015, 0x3, 0x3014, 0x5b89, 0x3015, 0x3, 0x3014, 0x70b9, 0x3015,
+		0x3, 0x3014, 0x6253, 0x3015, 0x3, 0x3014, 0x76d7, 0x3015, 0x3, 0x3014, 0x52dd, 0x3015, 0x3, 0x3014, 0x6557,
+		0x3015, 0x1, 0x5f97, 0x1, 0x53ef, 0x1, 0x4e3d, 0x1, 0x4e38, 0x1, 0x4e41, 0x1, 0x20122, 0x1, 0x4f60, 0x1, 0x4fbb,
+		0x1, 0x5002, 0x1, 0x507a, 0x1, 0x5099, 0x1, 0x50cf, 0x1, 0x349e, 0x1, 0x2063a, 0x1, 0x5154, 0x1, 0x5164, 0x1,
+		0x5177, 0x1, 0x2051c, 0x1, 0x34b9, 0x1, 0x5167, 0x1, 0x2054b, 0x1, 0x5197, 0x1, 0x51a4, 0x1, 0x4ecc, 0x1,
+		0x51ac, 0x1, 0x291df, 0x1, 0x5203, 0x1, 0x34df, 0x1, 0x523b, 0x1, 0x5246, 0x1, 0x5277, 0x1, 0x3515, 0x1, 0x5305,
+		0x1, 0x5306, 0x1, 0x5349, 0x1, 0x535a, 0x1, 0x5373, 0x1, 0x537d, 0x1, 0x537f, 0x1, 0x20a2c, 0x1, 0x7070, 0x1,
+		0x53ca, 0x1, 0x53df, 0x1, 0x20b63, 0x1, 0x53eb, 0x1, 0x53f1, 0x1, 0x5406, 0x1, 0x549e, 0x1, 0x5438, 0x1, 0x5448,
+		0x1, 0x5468, 0x1, 0x54a2, 0x1, 0x54f6, 0x1, 0x5510, 0x1, 0x5553, 0x1, 0x5563, 0x1, 0x5584, 0x1, 0x55ab, 0x1,
+		0x55b3, 0x1, 0x55c2, 0x1, 0x5716, 0x1, 0x5717, 0x1, 0x5651, 0x1, 0x5674, 0x1, 0x58ee, 0x1, 0x57ce, 0x1, 0x57f4,
+		0x1, 0x580d, 0x1, 0x578b, 0x1, 0x5832, 0x1, 0x5831, 0x1, 0x58ac, 0x1, 0x214e4, 0x1, 0x58f2, 0x1, 0x58f7, 0x1,
+		0x5906, 0x1, 0x5922, 0x1, 0x5962, 0x1, 0x216a8, 0x1, 0x216ea, 0x1, 0x59ec, 0x1, 0x5a1b, 0x1, 0x5a27, 0x1,
+		0x59d8, 0x1, 0x5a66, 0x1, 0x36ee, 0x1, 0x36fc, 0x1, 0x5b08, 0x1, 0x5b3e, 0x1, 0x219c8, 0x1, 0x5bc3, 0x1, 0x5bd8,
+		0x1, 0x5bf3, 0x1, 0x21b18, 0x1, 0x5bff, 0x1, 0x5c06, 0x1, 0x5f53, 0x1, 0x3781, 0x1, 0x5c60, 0x1, 0x5cc0, 0x1,
+		0x5c8d, 0x1, 0x21de4, 0x1, 0x5d43, 0x1, 0x21de6, 0x1, 0x5d6e, 0x1, 0x5d6b, 0x1, 0x5d7c, 0x1, 0x5de1, 0x1,
+		0x5de2, 0x1, 0x382f, 0x1, 0x5dfd, 0x1, 0x5e28, 0x1, 0x5e3d, 0x1, 0x5e69, 0x1, 0x3862, 0x1, 0x22183, 0x1, 0x387c,
+		0x1, 0x5eb0, 0x1, 0x5eb3, 0x1, 0x5eb6, 0x1, 0x2a392, 0x1, 0x22331, 0x1, 0x8201, 0x1, 0x5f22, 0x1, 0x38c7, 0x1,
+		0x232b8, 0x1, 0x261da, 0x1, 0x5f62, 0x1, 0x5f6b, 0x1, 0x38e3, 0x1, 0x5f9a, 0x1, 0x5fcd, 0x1, 0x5fd7, 0x1,
+		0x5ff9, 0x1, 0x6081, 0x1, 0x393a, 0x1, 0x391c, 0x1, 0x226d4, 0x1, 0x60c7, 0x1, 0x6148, 0x1, 0x614c, 0x1, 0x617a,
+		0x1, 0x61b2, 0x1, 0x61a4, 0x1, 0x61af, 0x1, 0x61de, 0x1, 0x6210, 0x1, 0x621b, 0x1, 0x625d, 0x1, 0x62b1, 0x1,
+		0x62d4, 0x1, 0x6350, 0x1, 0x22b0c, 0x1, 0x633d, 0x1, 0x62fc, 0x1, 0x6368, 0x1, 0x6383, 0x1, 0x63e4, 0x1,
+		0x22bf1, 0x1, 0x6422, 0x1, 0x63c5, 0x1, 0x63a9, 0x1, 0x3a2e, 0x1, 0x6469, 0x1, 0x647e, 0x1, 0x649d, 0x1, 0x6477,
+		0x1, 0x3a6c, 0x1, 0x656c, 0x1, 0x2300a, 0x1, 0x65e3, 0x1, 0x66f8, 0x1, 0x6649, 0x1, 0x3b19, 0x1, 0x3b08, 0x1,
+		0x3ae4, 0x1, 0x5192, 0x1, 0x5195, 0x1, 0x6700, 0x1, 0x669c, 0x1, 0x80ad, 0x1, 0x43d9, 0x1, 0x6721, 0x1, 0x675e,
+		0x1, 0x6753, 0x1, 0x233c3, 0x1, 0x3b49, 0x1, 0x67fa, 0x1, 0x6785, 0x1, 0x6852, 0x1, 0x2346d, 0x1, 0x688e, 0x1,
+		0x681f, 0x1, 0x6914, 0x1, 0x6942, 0x1, 0x69a3, 0x1, 0x69ea, 0x1, 0x6aa8, 0x1, 0x236a3, 0x1, 0x6adb, 0x1, 0x3c18,
+		0x1, 0x6b21, 0x1, 0x238a7, 0x1, 0x6b54, 0x1, 0x3c4e, 0x1, 0x6b72, 0x1, 0x6b9f, 0x1, 0x6bbb, 0x1, 0x23a8d, 0x1,
+		0x21d0b, 0x1, 0x23afa, 0x1, 0x6c4e, 0x1, 0x23cbc, 0x1, 0x6cbf, 0x1, 0x6ccd, 0x1, 0x6c67, 0x1, 0x6d16, 0x1,
+		0x6d3e, 0x1, 0x6d69, 0x1, 0x6d78, 0x1, 0x6d85, 0x1, 0x23d1e, 0x1, 0x6d34, 0x1, 0x6e2f, 0x1, 0x6e6e, 0x1, 0x3d33,
+		0x1, 0x6ec7, 0x1, 0x23ed1, 0x1, 0x6df9, 0x1, 0x6f6e, 0x1, 0x23f5e, 0x1, 0x23f8e, 0x1, 0x6fc6, 0x1, 0x7039, 0x1,
+		0x701b, 0x1, 0x3d96, 0x1, 0x704a, 0x1, 0x707d, 0x1, 0x7077, 0x1, 0x70ad, 0x1, 0x20525, 0x1, 0x7145, 0x1,
+		0x24263, 0x1, 0x719c, 0x1, 0x243ab, 0x1, 0x7228, 0x1, 0x7250, 0x1, 0x24608, 0x1, 0x7280, 0x1, 0x7295, 0x1,
+		0x24735, 0x1, 0x24814, 0x1, 0x737a, 0x1, 0x738b, 0x1, 0x3eac, 0x1, 0x73a5, 0x1, 0x3eb8, 0x1, 0x7447, 0x1,
+		0x745c, 0x1, 0x7485, 0x1, 0x74ca, 0x1, 0x3f1b, 0x1, 0x7524, 0x1, 0x24c36, 0x1, 0x753e, 0x1, 0x24c92, 0x1,
+		0x2219f, 0x1, 0x7610, 0x1, 0x24fa1, 0x1, 0x24fb8, 0x1, 0x25044, 0x1, 0x3ffc, 0x1, 0x4008, 0x1, 0x250f3, 0x1,
+		0x250f2, 0x1, 0x25119, 0x1, 0x25133, 0x1, 0x771e, 0x1, 0x771f, 0x1, 0x778b, 0x1, 0x4046, 0x1, 0x4096, 0x1,
+		0x2541d, 0x1, 0x784e, 0x1, 0x40e3, 0x1, 0x25626, 0x1, 0x2569a, 0x1, 0x256c5, 0x1, 0x79eb, 0x1, 0x412f, 0x1,
+		0x7a4a, 0x1, 0x7a4f, 0x1, 0x2597c, 0x1, 0x25aa7, 0x1, 0x7aee, 0x1, 0x4202, 0x1, 0x25bab, 0x1, 0x7bc6, 0x1,
+		0x7bc9, 0x1, 0x4227, 0x1, 0x25c80, 0x1, 0x7cd2, 0x1, 0x42a0, 0x1, 0x7ce8, 0x1, 0x7ce3, 0x1, 0x7d00, 0x1,
+		0x25f86, 0x1, 0x7d63, 0x1, 0x4301, 0x1, 0x7dc7, 0x1, 0x7e02, 0x1, 0x7e45, 0x1, 0x4334, 0x1, 0x26228, 0x1,
+		0x26247, 0x1, 0x4359, 0x1, 0x262d9, 0x1, 0x7f7a, 0x1, 0x2633e, 0x1, 0x7f95, 0x1, 0x7ffa, 0x1, 0x264da, 0x1,
+		0x26523, 0x1, 0x8060, 0x1, 0x265a8, 0x1, 0x8070, 0x1, 0x2335f, 0x1, 0x43d5, 0x1, 0x80b2, 0x1, 0x8103, 0x1,
+		0x440b, 0x1, 0x813e, 0x1, 0x5ab5, 0x1, 0x267a7, 0x1, 0x267b5, 0x1, 0x23393, 0x1, 0x2339c, 0x1, 0x8204, 0x1,
+		0x8f9e, 0x1, 0x446b, 0x1, 0x8291, 0x1, 0x828b, 0x1, 0x829d, 0x1, 0x52b3, 0x1, 0x82b1, 0x1, 0x82b3, 0x1, 0x82bd,
+		0x1, 0x82e6, 0x1, 0x26b3c, 0x1, 0x831d, 0x1, 0x8363, 0x1, 0x83ad, 0x1, 0x8323, 0x1, 0x83bd, 0x1, 0x83e7, 0x1,
+		0x8353, 0x1, 0x83ca, 0x1, 0x83cc, 0x1, 0x83dc, 0x1, 0x26c36, 0x1, 0x26d6b, 0x1, 0x26cd5, 0x1, 0x452b, 0x1,
+		0x84f1, 0x1, 0x84f3, 0x1, 0x8516, 0x1, 0x273ca, 0x1, 0x8564, 0x1, 0x26f2c, 0x1, 0x455d, 0x1, 0x4561, 0x1,
+		0x26fb1, 0x1, 0x270d2, 0x1, 0x456b, 0x1, 0x8650, 0x1, 0x8667, 0x1, 0x8669, 0x1, 0x86a9, 0x1, 0x8688, 0x1,
+		0x870e, 0x1, 0x86e2, 0x1, 0x8728, 0x1, 0x876b, 0x1, 0x8786, 0x1, 0x45d7, 0x1, 0x87e1, 0x1, 0x8801, 0x1, 0x45f9,
+		0x1, 0x8860, 0x1, 0x27667, 0x1, 0x88d7, 0x1, 0x88de, 0x1, 0x4635, 0x1, 0x88fa, 0x1, 0x34bb, 0x1, 0x278ae, 0x1,
+		0x27966, 0x1, 0x46be, 0x1, 0x46c7, 0x1, 0x8aa0, 0x1, 0x27ca8, 0x1, 0x8cab, 0x1, 0x8cc1, 0x1, 0x8d1b, 0x1,
+		0x8d77, 0x1, 0x27f2f, 0x1, 0x20804, 0x1, 0x8dcb, 0x1, 0x8dbc, 0x1, 0x8df0, 0x1, 0x208de, 0x1, 0x8ed4, 0x1,
+		0x285d2, 0x1, 0x285ed, 0x1, 0x9094, 0x1, 0x90f1, 0x1, 0x9111, 0x1, 0x2872e, 0x1, 0x911b, 0x1, 0x9238, 0x1,
+		0x92d7, 0x1, 0x92d8, 0x1, 0x927c, 0x1, 0x93f9, 0x1, 0x9415, 0x1, 0x28bfa, 0x1, 0x958b, 0x1, 0x4995, 0x1, 0x95b7,
+		0x1, 0x28d77, 0x1, 0x49e6, 0x1, 0x96c3, 0x1, 0x5db2, 0x1, 0x9723, 0x1, 0x29145, 0x1, 0x2921a, 0x1, 0x4a6e, 0x1,
+		0x4a76, 0x1, 0x97e0, 0x1, 0x2940a, 0x1, 0x4ab2, 0x1, 0x29496, 0x1, 0x9829, 0x1, 0x295b6, 0x1, 0x98e2, 0x1,
+		0x4b33, 0x1, 0x9929, 0x1, 0x99a7, 0x1, 0x99c2, 0x1, 0x99fe, 0x1, 0x4bce, 0x1, 0x29b30, 0x1, 0x9c40, 0x1, 0x9cfd,
+		0x1, 0x4cce, 0x1, 0x4ced, 0x1, 0x9d67, 0x1, 0x2a0ce, 0x1, 0x4cf8, 0x1, 0x2a105, 0x1, 0x2a20e, 0x1, 0x2a291, 0x1,
+		0x4d56, 0x1, 0x9efe, 0x1, 0x9f05, 0x1, 0x9f0f, 0x1, 0x9f16, 0x1, 0x2a600
+	};
+
+	// primary composites except hangul syllables, keys are first << 21 | second in ascending order
+	inline constexpr uint64_t kCompositionKeys[941] = {
+		0x7800338, 0x7a00338, 0x7c00338, 0x8200300, 0x8200301, 0x8200302, 0x8200303, 0x8200304, 0x8200306, 0x8200307,
+		0x8200308, 0x8200309, 0x820030a, 0x820030c, 0x820030f, 0x8200311, 0x8200323, 0x8200325, 0x8200328, 0x8400307,
+		0x8400323, 0x8400331, 0x8600301, 0x8600302, 0x8600307, 0x860030c, 0x8600327, 0x8800307, 0x880030c, 0x8800323,
+		0x8800327, 0x880032d, 0x8800331, 0x8a00300, 0x8a00301, 0x8a00302, 0x8a00303, 0x8a00304, 0x8a00306, 0x8a00307,
+		0x8a00308, 0x8a00309, 0x8a0030c, 0x8a0030f, 0x8a00311, 0x8a00323, 0x8a00327, 0x8a00328, 0x8a0032d, 0x8a00330,
+		0x8c00307, 0x8e00301, 0x8e00302, 0x8e00304, 0x8e00306, 0x8e00307, 0x8e0030c, 0x8e00327, 0x9000302, 0x9000307,
+		0x9000308, 0x900030c, 0x9000323, 0x9000327, 0x900032e, 0x9200300, 0x9200301, 0x9200302, 0x9200303, 0x9200304,
+		0x9200306, 0x9200307, 0x9200308, 0x9200309, 0x920030c, 0x920030f, 0x9200311, 0x9200323, 0x9200328, 0x9200330,
+		0x9400302, 0x9600301, 0x960030c, 0x9600323, 0x9600327, 0x9600331, 0x9800301, 0x980030c, 0x9800323, 0x9800327,
+		0x980032d, 0x9800331, 0x9a00301, 0x9a00307, 0x9a00323, 0x9c00300, 0x9c00301, 0x9c00303, 0x9c00307, 0x9c0030c,
+		0x9c00323, 0x9c00327, 0x9c0032d, 0x9c00331, 0x9e00300, 0x9e00301, 0x9e00302, 0x9e00303, 0x9e00304, 0x9e00306,
+		0x9e00307, 0x9e00308, 0x9e00309, 0x9e0030b, 0x9e0030c, 0x9e0030f, 0x9e00311, 0x9e0031b, 0x9e00323, 0x9e00328,
+		0xa000301, 0xa000307, 0xa400301, 0xa400307, 0xa40030c, 0xa40030f, 0xa400311, 0xa400323, 0xa400327, 0xa400331,
+		0xa600301, 0xa600302, 0xa600307, 0xa60030c, 0xa600323, 0xa600326, 0xa600327, 0xa800307, 0xa80030c, 0xa800323,
+		0xa800326, 0xa800327, 0xa80032d, 0xa800331, 0xaa00300, 0xaa00301, 0xaa00302, 0xaa00303, 0xaa00304, 0xaa00306,
+		0xaa00308, 0xaa00309, 0xaa0030a, 0xaa0030b, 0xaa0030c, 0xaa0030f, 0xaa00311, 0xaa0031b, 0xaa00323, 0xaa00324,
+		0xaa00328, 0xaa0032d, 0xaa00330, 0xac00303, 0xac00323, 0xae00300, 0xae00301, 0xae00302, 0xae00307, 0xae00308,
+		0xae00323, 0xb000307, 0xb000308, 0xb200300, 0xb200301, 0xb200302, 0xb200303, 0xb200304, 0xb200307, 0xb200308,
+		0xb200309, 0xb200323, 0xb400301, 0xb400302, 0xb400307, 0xb40030c, 0xb400323, 0xb400331, 0xc200300, 0xc200301,
+		0xc200302, 0xc200303, 0xc200304, 0xc200306, 0xc200307, 0xc200308, 0xc200309, 0xc20030a, 0xc20030c, 0xc20030f,
+		0xc200311, 0xc200323, 0xc200325, 0xc200328, 0xc400307, 0xc400323, 0xc400331, 0xc600301, 0xc600302, 0xc600307,
+		0xc60030c, 0xc600327, 0xc800307, 0xc80030c, 0xc800323, 0xc800327, 0xc80032d, 0xc800331, 0xca00300, 0xca00301,
+		0xca00302, 0xca00303, 0xca00304, 0xca00306, 0xca00307, 0xca00308, 0xca00309, 0xca0030c, 0xca0030f, 0xca00311,
+		0xca00323, 0xca00327, 0xca00328, 0xca0032d, 0xca00330, 0xcc00307, 0xce00301, 0xce00302, 0xce00304, 0xce00306,
+		0xce00307, 0xce0030c, 0xce00327, 0xd000302, 0xd000307, 0xd000308, 0xd00030c, 0xd000323, 0xd000327, 0xd00032e,
+		0xd000331, 0xd200300, 0xd200301, 0xd200302, 0xd200303, 0xd200304, 0xd200306, 0xd200308, 0xd200309, 0xd20030c,
+		0xd20030f, 0xd200311, 0xd200323, 0xd200328, 0xd200330, 0xd400302, 0xd40030c, 0xd600301, 0xd60030c, 0xd600323,
+		0xd600327, 0xd600331, 0xd800301, 0xd80030c, 0xd800323, 0xd800327, 0xd80032d, 0xd800331, 0xda00301, 0xda00307,
+		0xda00323, 0xdc00300, 0xdc00301, 0xdc00303, 0xdc00307, 0xdc0030c, 0xdc00323, 0xdc00327, 0xdc0032d, 0xdc00331,
+		0xde00300, 0xde00301, 0xde00302, 0xde00303, 0xde00304, 0xde00306, 0xde00307, 0xde00308, 0xde00309, 0xde0030b,
+		0xde0030c, 0xde0030f, 0xde00311, 0xde0031b, 0xde00323, 0xde00328, 0xe000301, 0xe000307, 0xe400301, 0xe400307,
+		0xe40030c, 0xe40030f, 0xe400311, 0xe400323, 0xe400327, 0xe400331, 0xe600301, 0xe600302, 0xe600307, 0xe60030c,
+		0xe600323, 0xe600326, 0xe600327, 0xe800307, 0xe800308, 0xe80030c, 0xe800323, 0xe800326, 0xe800327, 0xe80032d,
+		0xe800331, 0xea00300, 0xea00301, 0xea00302, 0xea00303, 0xea00304, 0xea00306, 0xea00308, 0xea00309, 0xea0030a,
+		0xea0030b, 0xea0030c, 0xea0030f, 0xea00311, 0xea0031b, 0xea00323, 0xea00324, 0xea00328, 0xea0032d, 0xea00330,
+		0xec00303, 0xec00323, 0xee00300, 0xee00301, 0xee00302, 0xee00307, 0xee00308, 0xee0030a, 0xee00323, 0xf000307,
+		0xf000308, 0xf200300, 0xf200301, 0xf200302, 0xf200303, 0xf200304, 0xf200307, 0xf200308, 0xf200309, 0xf20030a,
+		0xf200323, 0xf400301, 0xf400302, 0xf400307, 0xf40030c, 0xf400323, 0xf400331, 0x15000300, 0x15000301, 0x15000342,
+		0x18400300, 0x18400301, 0x18400303, 0x18400309, 0x18800304, 0x18a00301, 0x18c00301, 0x18c00304, 0x18e00301,
+		0x19400300, 0x19400301, 0x19400303, 0x19400309, 0x19e00301, 0x1a800300, 0x1a800301, 0x1a800303, 0x1a800309,
+		0x1aa00301, 0x1aa00304, 0x1aa00308, 0x1ac00304, 0x1b000301, 0x1b800300, 0x1b800301, 0x1b800304, 0x1b80030c,
+		0x1c400300, 0x1c400301, 0x1c400303, 0x1c400309, 0x1c800304, 0x1ca00301, 0x1cc00301, 0x1cc00304, 0x1ce00301,
+		0x1d400300, 0x1d400301, 0x1d400303, 0x1d400309, 0x1de00301, 0x1e800300, 0x1e800301, 0x1e800303, 0x1e800309,
+		0x1ea00301, 0x1ea00304, 0x1ea00308, 0x1ec00304, 0x1f000301, 0x1f800300, 0x1f800301, 0x1f800304, 0x1f80030c,
+		0x20400300, 0x20400301, 0x20400303, 0x20400309, 0x20600300, 0x20600301, 0x20600303, 0x20600309, 0x22400300,
+		0x22400301, 0x22600300, 0x22600301, 0x29800300, 0x29800301, 0x29a00300, 0x29a00301, 0x2b400307, 0x2b600307,
+		0x2c000307, 0x2c200307, 0x2d000301, 0x2d200301, 0x2d400308, 0x2d600308, 0x2fe00307, 0x34000300, 0x34000301,
+		0x34000303, 0x34000309, 0x34000323, 0x34200300, 0x34200301, 0x34200303, 0x34200309, 0x34200323, 0x35e00300,
+		0x35e00301, 0x35e00303, 0x35e00309, 0x35e00323, 0x36000300, 0x36000301, 0x36000303, 0x36000309, 0x36000323,
+		0x36e0030c, 0x3d400304, 0x3d600304, 0x44c00304, 0x44e00304, 0x45000306, 0x45200306, 0x45c00304, 0x45e00304,
+		0x5240030c, 0x72200300, 0x72200301, 0x72200304, 0x72200306, 0x72200313, 0x72200314, 0x72200345, 0x72a00300,
+		0x72a00301, 0x72a00313, 0x72a00314, 0x72e00300, 0x72e00301, 0x72e00313, 0x72e00314, 0x72e00345, 0x73200300,
+		0x73200301, 0x73200304, 0x73200306, 0x73200308, 0x73200313, 0x73200314, 0x73e00300, 0x73e00301, 0x73e00313,
+		0x73e00314, 0x74200314, 0x74a00300, 0x74a00301, 0x74a00304, 0x74a00306, 0x74a00308, 0x74a00314, 0x75200300,
+		0x75200301, 0x75200313, 0x75200314, 0x75200345, 0x75800345, 0x75c00345, 0x76200300, 0x76200301, 0x76200304,
+		0x76200306, 0x76200313, 0x76200314, 0x76200342, 0x76200345, 0x76a00300, 0x76a00301, 0x76a00313, 0x76a00314,
+		0x76e00300, 0x76e00301, 0x76e00313, 0x76e00314, 0x76e00342, 0x76e00345, 0x77200300, 0x77200301, 0x77200304,
+		0x77200306, 0x77200308, 0x77200313, 0x77200314, 0x77200342, 0x77e00300, 0x77e00301, 0x77e00313, 0x77e00314,
+		0x78200313, 0x78200314, 0x78a00300, 0x78a00301, 0x78a00304, 0x78a00306, 0x78a00308, 0x78a00313, 0x78a00314,
+		0x78a00342, 0x79200300, 0x79200301, 0x79200313, 0x79200314, 0x79200342, 0x79200345, 0x79400300, 0x79400301,
+		0x79400342, 0x79600300, 0x79600301, 0x79600342, 0x79c00345, 0x7a400301, 0x7a400308, 0x80c00308, 0x82000306,
+		0x82000308, 0x82600301, 0x82a00300, 0x82a00306, 0x82a00308, 0x82c00306, 0x82c00308, 0x82e00308, 0x83000300,
+		0x83000304, 0x83000306, 0x83000308, 0x83400301, 0x83c00308, 0x84600304, 0x84600306, 0x84600308, 0x8460030b,
+		0x84e00308, 0x85600308, 0x85a00308, 0x86000306, 0x86000308, 0x86600301, 0x86a00300, 0x86a00306, 0x86a00308,
+		0x86c00306, 0x86c00308, 0x86e00308, 0x87000300, 0x87000304, 0x87000306, 0x87000308, 0x87400301, 0x87c00308,
+		0x88600304, 0x88600306, 0x88600308, 0x8860030b, 0x88e00308, 0x89600308, 0x89a00308, 0x8ac00308, 0x8e80030f,
+		0x8ea0030f, 0x9b000308, 0x9b200308, 0x9d000308, 0x9d200308, 0xc4e00653, 0xc4e00654, 0xc4e00655, 0xc9000654,
+		0xc9400654, 0xd8200654, 0xda400654, 0xdaa00654, 0x12500093c, 0x12600093c, 0x12660093c, 0x138e009be, 0x138e009d7,
+		0x168e00b3e, 0x168e00b56, 0x168e00b57, 0x172400bd7, 0x178c00bbe, 0x178c00bd7, 0x178e00bbe, 0x188c00c56,
+		0x197e00cd5, 0x198c00cc2, 0x198c00cd5, 0x198c00cd6, 0x199400cd5, 0x1a8c00d3e, 0x1a8c00d57, 0x1a8e00d3e,
+		0x1bb200dca, 0x1bb200dcf, 0x1bb200ddf, 0x1bb800dca, 0x204a0102e, 0x360a01b35, 0x360e01b35, 0x361201b35,
+		0x361601b35, 0x361a01b35, 0x362201b35, 0x367401b35, 0x367801b35, 0x367c01b35, 0x367e01b35, 0x368401b35,
+		0x3c6c00304, 0x3c6e00304, 0x3cb400304, 0x3cb600304, 0x3cc400307, 0x3cc600307, 0x3d4000302, 0x3d4000306,
+		0x3d4200302, 0x3d4200306, 0x3d7000302, 0x3d7200302, 0x3d9800302, 0x3d9a00302, 0x3e0000300, 0x3e0000301,
+		0x3e0000342, 0x3e0000345, 0x3e0200300, 0x3e0200301, 0x3e0200342, 0x3e0200345, 0x3e0400345, 0x3e0600345,
+		0x3e0800345, 0x3e0a00345, 0x3e0c00345, 0x3e0e00345, 0x3e1000300, 0x3e1000301, 0x3e1000342, 0x3e1000345,
+		0x3e1200300, 0x3e1200301, 0x3e1200342, 0x3e1200345, 0x3e1400345, 0x3e1600345, 0x3e1800345, 0x3e1a00345,
+		0x3e1c00345, 0x3e1e00345, 0x3e2000300, 0x3e2000301, 0x3e2200300, 0x3e2200301, 0x3e3000300, 0x3e3000301,
+		0x3e3200300, 0x3e3200301, 0x3e4000300, 0x3e4000301, 0x3e4000342, 0x3e4000345, 0x3e4200300, 0x3e4200301,
+		0x3e4200342, 0x3e4200345, 0x3e4400345, 0x3e4600345, 0x3e4800345, 0x3e4a00345, 0x3e4c00345, 0x3e4e00345,
+		0x3e5000300, 0x3e5000301, 0x3e5000342, 0x3e5000345, 0x3e5200300, 0x3e5200301, 0x3e5200342, 0x3e5200345,
+		0x3e5400345, 0x3e5600345, 0x3e5800345, 0x3e5a00345, 0x3e5c00345, 0x3e5e00345, 0x3e6000300, 0x3e6000301,
+		0x3e6000342, 0x3e6200300, 0x3e6200301, 0x3e6200342, 0x3e7000300, 0x3e7000301, 0x3e7000342, 0x3e7200300,
+		0x3e7200301, 0x3e7200342, 0x3e8000300, 0x3e8000301, 0x3e8200300, 0x3e8200301, 0x3e9000300, 0x3e9000301,
+		0x3e9200300, 0x3e9200301, 0x3ea000300, 0x3ea000301, 0x3ea000342, 0x3ea200300, 0x3ea200301, 0x3ea200342,
+		0x3eb200300, 0x3eb200301, 0x3eb200342, 0x3ec000300, 0x3ec000301, 0x3ec000342, 0x3ec000345, 0x3ec200300,
+		0x3ec200301, 0x3ec200342, 0x3ec200345, 0x3ec400345, 0x3ec600345, 0x3ec800345, 0x3eca00345, 0x3ecc00345,
+		0x3ece00345, 0x3ed000300, 0x3ed000301, 0x3ed000342, 0x3ed000345, 0x3ed200300, 0x3ed200301, 0x3ed200342,
+		0x3ed200345, 0x3ed400345, 0x3ed600345, 0x3ed800345, 0x3eda00345, 0x3edc00345, 0x3ede00345, 0x3ee000345,
+		0x3ee800345, 0x3ef800345, 0x3f6c00345, 0x3f7e00300, 0x3f7e00301, 0x3f7e00342, 0x3f8c00345, 0x3fec00345,
+		0x3ffc00300, 0x3ffc00301, 0x3ffc00342, 0x432000338, 0x432400338, 0x432800338, 0x43a000338, 0x43a400338,
+		0x43a800338, 0x440600338, 0x441000338, 0x441600338, 0x444600338, 0x444a00338, 0x447800338, 0x448600338,
+		0x448a00338, 0x449000338, 0x449a00338, 0x44c200338, 0x44c800338, 0x44ca00338, 0x44e400338, 0x44e600338,
+		0x44ec00338, 0x44ee00338, 0x44f400338, 0x44f600338, 0x44f800338, 0x44fa00338, 0x450400338, 0x450600338,
+		0x450c00338, 0x450e00338, 0x452200338, 0x452400338, 0x454400338, 0x455000338, 0x455200338, 0x455600338,
+		0x456400338, 0x456600338, 0x456800338, 0x456a00338, 0x608c03099, 0x609603099, 0x609a03099, 0x609e03099,
+		0x60a203099, 0x60a603099, 0x60aa03099, 0x60ae03099, 0x60b203099, 0x60b603099, 0x60ba03099, 0x60be03099,
+		0x60c203099, 0x60c803099, 0x60cc03099, 0x60d003099, 0x60de03099, 0x60de0309a, 0x60e403099, 0x60e40309a,
+		0x60ea03099, 0x60ea0309a, 0x60f003099, 0x60f00309a, 0x60f603099, 0x60f60309a, 0x613a03099, 0x614c03099,
+		0x615603099, 0x615a03099, 0x615e03099, 0x616203099, 0x616603099, 0x616a03099, 0x616e03099, 0x617203099,
+		0x617603099, 0x617a03099, 0x617e03099, 0x618203099, 0x618803099, 0x618c03099, 0x619003099, 0x619e03099,
+		0x619e0309a, 0x61a403099, 0x61a40309a, 0x61aa03099, 0x61aa0309a, 0x61b003099, 0x61b00309a, 0x61b603099,
+		0x61b60309a, 0x61de03099, 0x61e003099, 0x61e203099, 0x61e403099, 0x61fa03099, 0x22132110ba, 0x22136110ba,
+		0x2214a110ba, 0x2226211127, 0x2226411127, 0x2268e1133e, 0x2268e11357, 0x22972114b0, 0x22972114ba, 0x22972114bd,
+		0x22b70115af, 0x22b72115af, 0x2326a11930
+	};
+
+	inline constexpr char32_t kCompositionValues[941] = {
+		0x226e, 0x2260, 0x226f, 0xc0, 0xc1, 0xc2, 0xc3, 0x100, 0x102, 0x226, 0xc4, 0x1ea2, 0xc5, 0x1cd, 0x200, 0x202,
+		0x1ea0, 0x1e00, 0x104, 0x1e02, 0x1e04, 0x1e06, 0x106, 0x108, 0x10a, 0x10c, 0xc7, 0x1e0a, 0x10e, 0x1e0c, 0x1e10,
+		0x1e12, 0x1e0e, 0xc8, 0xc9, 0xca, 0x1ebc, 0x112, 0x114, 0x116, 0xcb, 0x1eba, 0x11a, 0x204, 0x206, 0x1eb8, 0x228,
+		0x118, 0x1e18, 0x1e1a, 0x1e1e, 0x1f4, 0x11c, 0x1e20, 0x11e, 0x120, 0x1e6, 0x122, 0x124, 0x1e22, 0x1e26, 0x21e,
+		0x1e24, 0x1e28, 0x1e2a, 0xcc, 0xcd, 0xce, 0x128, 0x12a, 0x12c, 0x130, 0xcf, 0x1ec8, 0x1cf, 0x208, 0x20a, 0x1eca,
+		0x12e, 0x1e2c, 0x134, 0x1e30, 0x1e8, 0x1e32, 0x136, 0x1e34, 0x139, 0x13d, 0x1e36, 0x13b, 0x1e3c, 0x1e3a, 0x1e3e,
+		0x1e40, 0x1e42, 0x1f8, 0x143, 0xd1, 0x1e44, 0x147, 0x1e46, 0x145, 0x1e4a, 0x1e48, 0xd2, 0xd3, 0xd4, 0xd5, 0x14c,
+		0x14e, 0x22e, 0xd6, 0x1ece, 0x150, 0x1d1, 0x20c, 0x20e, 0x1a0, 0x1ecc, 0x1ea, 0x1e54, 0x1e56, 0x154, 0x1e58,
+		0x158, 0x210, 0x212, 0x1e5a, 0x156, 0x1e5e, 0x15a, 0x15c, 0x1e60, 0x160, 0x1e62, 0x218, 0x15e, 0x1e6a, 0x164,
+		0x1e6c, 0x21a, 0x162, 0x1e70, 0x1e6e, 0xd9, 0xda, 0xdb, 0x168, 0x16a, 0x16c, 0xdc, 0x1ee6, 0x16e, 0x170, 0x1d3,
+		0x214, 0x216, 0x1af, 0x1ee4, 0x1e72, 0x172, 0x1e76, 0x1e74, 0x1e7c, 0x1e7e, 0x1e80, 0x1e82, 0x174, 0x1e86,
+		0x1e84, 0x1e88, 0x1e8a, 0x1e8c, 0x1ef2, 0xdd, 0x176, 0x1ef8, 0x232, 0x1e8e, 0x178, 0x1ef6, 0x1ef4, 0x179,
+		0x1e90, 0x17b, 0x17d, 0x1e92, 0x1e94, 0xe0, 0xe1, 0xe2, 0xe3, 0x101, 0x103, 0x227, 0xe4, 0x1ea3, 0xe5, 0x1ce,
+		0x201, 0x203, 0x1ea1, 0x1e01, 0x105, 0x1e03, 0x1e05, 0x1e07, 0x107, 0x109, 0x10b, 0x10d, 0xe7, 0x1e0b, 0x10f,
+		0x1e0d, 0x1e11, 0x1e13, 0x1e0f, 0xe8, 0xe9, 0xea, 0x1ebd, 0x113, 0x115, 0x117, 0xeb, 0x1ebb, 0x11b, 0x205,
+		0x207, 0x1eb9, 0x229, 0x119, 0x1e19, 0x1e1b, 0x1e1f, 0x1f5, 0x11d, 0x1e21, 0x11f, 0x121, 0x1e7, 0x123, 0x125,
+		0x1e23, 0x1e27, 0x21f, 0x1e25, 0x1e29, 0x1e2b, 0x1e96, 0xec, 0xed, 0xee, 0x129, 0x12b, 0x12d, 0xef, 0x1ec9,
+		0x1d0, 0x209, 0x20b, 0x1ecb, 0x12f, 0x1e2d, 0x135, 0x1f0, 0x1e31, 0x1e9, 0x1e33, 0x137, 0x1e35, 0x13a, 0x13e,
+		0x1e37, 0x13c, 0x1e3d, 0x1e3b, 0x1e3f, 0x1e41, 0x1e43, 0x1f9, 0x144, 0xf1, 0x1e45, 0x148, 0x1e47, 0x146, 0x1e4b,
+		0x1e49, 0xf2, 0xf3, 0xf4, 0xf5, 0x14d, 0x14f, 0x22f, 0xf6, 0x1ecf, 0x151, 0x1d2, 0x20d, 0x20f, 0x1a1, 0x1ecd,
+		0x1eb, 0x1e55, 0x1e57, 0x155, 0x1e59, 0x159, 0x211, 0x213, 0x1e5b, 0x157, 0x1e5f, 0x15b, 0x15d, 0x1e61, 0x161,
+		0x1e63, 0x219, 0x15f, 0x1e6b, 0x1e97, 0x165, 0x1e6d, 0x21b, 0x163, 0x1e71, 0x1e6f, 0xf9, 0xfa, 0xfb, 0x169,
+		0x16b, 0x16d, 0xfc, 0x1ee7, 0x16f, 0x171, 0x1d4, 0x215, 0x217, 0x1b0, 0x1ee5, 0x1e73, 0x173, 0x1e77, 0x1e75,
+		0x1e7d, 0x1e7f, 0x1e81, 0x1e83, 0x175, 0x1e87, 0x1e85, 0x1e98, 0x1e89, 0x1e8b, 0x1e8d, 0x1ef3, 0xfd, 0x177,
+		0x1ef9, 0x233, 0x1e8f, 0xff, 0x1ef7, 0x1e99, 0x1ef5, 0x17a, 0x1e91, 0x17c, 0x17e, 0x1e93, 0x1e95, 0x1fed, 0x385,
+		0x1fc1, 0x1ea6, 0x1ea4, 0x1eaa, 0x1ea8, 0x1de, 0x1fa, 0x1fc, 0x1e2, 0x1e08, 0x1ec0, 0x1ebe, 0x1ec4, 0x1ec2,
+		0x1e2e, 0x1ed2, 0x1ed0, 0x1ed6, 0x1ed4, 0x1e4c, 0x22c, 0x1e4e, 0x22a, 0x1fe, 0x1db, 0x1d7, 0x1d5, 0x1d9, 0x1ea7,
+		0x1ea5, 0x1eab, 0x1ea9, 0x1df, 0x1fb, 0x1fd, 0x1e3, 0x1e09, 0x1ec1, 0x1ebf, 0x1ec5, 0x1ec3, 0x1e2f, 0x1ed3,
+		0x1ed1, 0x1ed7, 0x1ed5, 0x1e4d, 0x22d, 0x1e4f, 0x22b, 0x1ff, 0x1dc, 0x1d8, 0x1d6, 0x1da, 0x1eb0, 0x1eae, 0x1eb4,
+		0x1eb2, 0x1eb1, 0x1eaf, 0x1eb5, 0x1eb3, 0x1e14, 0x1e16, 0x1e15, 0x1e17, 0x1e50, 0x1e52, 0x1e51, 0x1e53, 0x1e64,
+		0x1e65, 0x1e66, 0x1e67, 0x1e78, 0x1e79, 0x1e7a, 0x1e7b, 0x1e9b, 0x1edc, 0x1eda, 0x1ee0, 0x1ede, 0x1ee2, 0x1edd,
+		0x1edb, 0x1ee1, 0x1edf, 0x1ee3, 0x1eea, 0x1ee8, 0x1eee, 0x1eec, 0x1ef0, 0x1eeb, 0x1ee9, 0x1eef, 0x1eed, 0x1ef1,
+		0x1ee, 0x1ec, 0x1ed, 0x1e0, 0x1e1, 0x1e1c, 0x1e1d, 0x230, 0x231, 0x1ef, 0x1fba, 0x386, 0x1fb9, 0x1fb8, 0x1f08,
+		0x1f09, 0x1fbc, 0x1fc8, 0x388, 0x1f18, 0x1f19, 0x1fca, 0x389, 0x1f28, 0x1f29, 0x1fcc, 0x1fda, 0x38a, 0x1fd9,
+		0x1fd8, 0x3aa, 0x1f38, 0x1f39, 0x1ff8, 0x38c, 0x1f48, 0x1f49, 0x1fec, 0x1fea, 0x38e, 0x1fe9, 0x1fe8, 0x3ab,
+		0x1f59, 0x1ffa, 0x38f, 0x1f68, 0x1f69, 0x1ffc, 0x1fb4, 0x1fc4, 0x1f70, 0x3ac, 0x1fb1, 0x1fb0, 0x1f00, 0x1f01,
+		0x1fb6, 0x1fb3, 0x1f72, 0x3ad, 0x1f10, 0x1f11, 0x1f74, 0x3ae, 0x1f20, 0x1f21, 0x1fc6, 0x1fc3, 0x1f76, 0x3af,
+		0x1fd1, 0x1fd0, 0x3ca, 0x1f30, 0x1f31, 0x1fd6, 0x1f78, 0x3cc, 0x1f40, 0x1f41, 0x1fe4, 0x1fe5, 0x1f7a, 0x3cd,
+		0x1fe1, 0x1fe0, 0x3cb, 0x1f50, 0x1f51, 0x1fe6, 0x1f7c, 0x3ce, 0x1f60, 0x1f61, 0x1ff6, 0x1ff3, 0x1fd2, 0x390,
+		0x1fd7, 0x1fe2, 0x3b0, 0x1fe7, 0x1ff4, 0x3d3, 0x3d4, 0x407, 0x4d0, 0x4d2, 0x403, 0x400, 0x4d6, 0x401, 0x4c1,
+		0x4dc, 0x4de, 0x40d, 0x4e2, 0x419, 0x4e4, 0x40c, 0x4e6, 0x4ee, 0x40e, 0x4f0, 0x4f2, 0x4f4, 0x4f8, 0x4ec, 0x4d1,
+		0x4d3, 0x453, 0x450, 0x4d7, 0x451, 0x4c2, 0x4dd, 0x4df, 0x45d, 0x4e3, 0x439, 0x4e5, 0x45c, 0x4e7, 0x4ef, 0x45e,
+		0x4f1, 0x4f3, 0x4f5, 0x4f9, 0x4ed, 0x457, 0x476, 0x477, 0x4da, 0x4db, 0x4ea, 0x4eb, 0x622, 0x623, 0x625, 0x624,
+		0x626, 0x6c2, 0x6d3, 0x6c0, 0x929, 0x931, 0x934, 0x9cb, 0x9cc, 0xb4b, 0xb48, 0xb4c, 0xb94, 0xbca, 0xbcc, 0xbcb,
+		0xc48, 0xcc0, 0xcca, 0xcc7, 0xcc8, 0xccb, 0xd4a, 0xd4c, 0xd4b, 0xdda, 0xddc, 0xdde, 0xddd, 0x1026, 0x1b06,
+		0x1b08, 0x1b0a, 0x1b0c, 0x1b0e, 0x1b12, 0x1b3b, 0x1b3d, 0x1b40, 0x1b41, 0x1b43, 0x1e38, 0x1e39, 0x1e5c, 0x1e5d,
+		0x1e68, 0x1e69, 0x1eac, 0x1eb6, 0x1ead, 0x1eb7, 0x1ec6, 0x1ec7, 0x1ed8, 0x1ed9, 0x1f02, 0x1f04, 0x1f06, 0x1f80,
+		0x1f03, 0x1f05, 0x1f07, 0x1f81, 0x1f82, 0x1f83, 0x1f84, 0x1f85, 0x1f86, 0x1f87, 0x1f0a, 0x1f0c, 0x1f0e, 0x1f88,
+		0x1f0b, 0x1f0d, 0x1f0f, 0x1f89, 0x1f8a, 0x1f8b, 0x1f8c, 0x1f8d, 0x1f8e, 0x1f8f, 0x1f12, 0x1f14, 0x1f13, 0x1f15,
+		0x1f1a, 0x1f1c, 0x1f1b, 0x1f1d, 0x1f22, 0x1f24, 0x1f26, 0x1f90, 0x1f23, 0x1f25, 0x1f27, 0x1f91, 0x1f92, 0x1f93,
+		0x1f94, 0x1f95, 0x1f96, 0x1f97, 0x1f2a, 0x1f2c, 0x1f2e, 0x1f98, 0x1f2b, 0x1f2d, 0x1f2f, 0x1f99, 0x1f9a, 0x1f9b,
+		0x1f9c, 0x1f9d, 0x1f9e, 0x1f9f, 0x1f32, 0x1f34, 0x1f36, 0x1f33, 0x1f35, 0x1f37, 0x1f3a, 0x1f3c, 0x1f3e, 0x1f3b,
+		0x1f3d, 0x1f3f, 0x1f42, 0x1f44, 0x1f43, 0x1f45, 0x1f4a, 0x1f4c, 0x1f4b, 0x1f4d, 0x1f52, 0x1f54, 0x1f56, 0x1f53,
+		0x1f55, 0x1f57, 0x1f5b, 0x1f5d, 0x1f5f, 0x1f62, 0x1f64, 0x1f66, 0x1fa0, 0x1f63, 0x1f65, 0x1f67, 0x1fa1, 0x1fa2,
+		0x1fa3, 0x1fa4, 0x1fa5, 0x1fa6, 0x1fa7, 0x1f6a, 0x1f6c, 0x1f6e, 0x1fa8, 0x1f6b, 0x1f6d, 0x1f6f, 0x1fa9, 0x1faa,
+		0x1fab, 0x1fac, 0x1fad, 0x1fae, 0x1faf, 0x1fb2, 0x1fc2, 0x1ff2, 0x1fb7, 0x1fcd, 0x1fce, 0x1fcf, 0x1fc7, 0x1ff7,
+		0x1fdd, 0x1fde, 0x1fdf, 0x219a, 0x219b, 0x21ae, 0x21cd, 0x21cf, 0x21ce, 0x2204, 0x2209, 0x220c, 0x2224, 0x2226,
+		0x2241, 0x2244, 0x2247, 0x2249, 0x226d, 0x2262, 0x2270, 0x2271, 0x2274, 0x2275, 0x2278, 0x2279, 0x2280, 0x2281,
+		0x22e0, 0x22e1, 0x2284, 0x2285, 0x2288, 0x2289, 0x22e2, 0x22e3, 0x22ac, 0x22ad, 0x22ae, 0x22af, 0x22ea, 0x22eb,
+		0x22ec, 0x22ed, 0x3094, 0x304c, 0x304e, 0x3050, 0x3052, 0x3054, 0x3056, 0x3058, 0x305a, 0x305c, 0x305e, 0x3060,
+		0x3062, 0x3065, 0x3067, 0x3069, 0x3070, 0x3071, 0x3073, 0x3074, 0x3076, 0x3077, 0x3079, 0x307a, 0x307c, 0x307d,
+		0x309e, 0x30f4, 0x30ac, 0x30ae, 0x30b0, 0x30b2, 0x30b4, 0x30b6, 0x30b8, 0x30ba, 0x30bc, 0x30be, 0x30c0, 0x30c2,
+		0x30c5, 0x30c7, 0x30c9, 0x30d0, 0x30d1, 0x30d3, 0x30d4, 0x30d6, 0x30d7, 0x30d9, 0x30da, 0x30dc, 0x30dd, 0x30f7,
+		0x30f8, 0x30f9, 0x30fa, 0x30fe, 0x1109a, 0x1109c, 0x110ab, 0x1112e, 0x1112f, 0x1134b, 0x1134c, 0x114bc, 0x114bb,
+		0x114be, 0x115ba, 0x115bb, 0x11938
+	};
+}
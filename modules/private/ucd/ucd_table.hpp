@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace u8lib::ucd
+{
+	//! @brief per code point property values in two stages, stage1 maps the block of a code point (ch >> Shift) to the
+	//!        index of its values in stage2, blocks with identical values are stored once
+	//! @note tables are generated by tools/ucd/gen_ucd_tables.cpp, code points from kLimit on share default_value
+	template<typename T, unsigned Shift, size_t Stage1Size, size_t Stage2Size>
+	struct two_stage_table {
+		static constexpr char32_t kLimit = static_cast<char32_t>(Stage1Size) << Shift;
+		static constexpr char32_t kBlockMask = (char32_t{1} << Shift) - 1;
+
+		T default_value;
+		uint16_t stage1[Stage1Size];
+		T stage2[Stage2Size];
+
+		constexpr T lookup(char32_t ch) const noexcept {
+			if (ch >= kLimit) {
+				return default_value;
+			}
+			return stage2[static_cast<size_t>(stage1[ch >> Shift]) << Shift | (ch & kBlockMask)];
+		}
+	};
+}
@@ -0,0 +1,624 @@
+#include "pch.hpp"
+
+#include <u8lib/string.hpp>
+#include <u8lib/unicode.hpp>
+
+#include "simd/case_mapping.hpp"
+#include "simd/grapheme.hpp"
+#include "ucd/case_tables.hpp"
+#include "ucd/grapheme_tables.hpp"
+#include "ucd/normalization_tables.hpp"
+#include "ucd/property_tables.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace u8lib
+{
+	namespace
+	{
+		// hangul syllables are composed and decomposed arithmetically, see section 3.12 of the Unicode standard
+		constexpr char32_t kHangulSBase = 0xAC00;
+		constexpr char32_t kHangulLBase = 0x1100;
+		constexpr char32_t kHangulVBase = 0x1161;
+		constexpr char32_t kHangulTBase = 0x11A7;
+		constexpr char32_t kHangulLCount = 19;
+		constexpr char32_t kHangulVCount = 21;
+		constexpr char32_t kHangulTCount = 28;
+		constexpr char32_t kHangulNCount = kHangulVCount * kHangulTCount;
+		constexpr char32_t kHangulSCount = kHangulLCount * kHangulNCount;
+
+		struct normalization_traits {
+			bool compose;
+			bool compat;
+			// quick check flags of ucd::kNormalizationProps
+			uint16_t no;
+			uint16_t maybe;
+		};
+
+		constexpr normalization_traits traits_of(normalization_form form) noexcept {
+			switch (form) {
+				case normalization_form::nfd:
+					return {false, false, ucd::kNfdNo, 0};
+				case normalization_form::nfkc:
+					return {true, true, ucd::kNfkcNo, ucd::kNfkcMaybe};
+				case normalization_form::nfkd:
+					return {false, true, ucd::kNfkdNo, 0};
+				default:
+					return {true, false, ucd::kNfcNo, ucd::kNfcMaybe};
+			}
+		}
+
+		uint8_t combining_class(char32_t ch) noexcept {
+			return static_cast<uint8_t>(ucd::kNormalizationProps.lookup(ch));
+		}
+
+		// nothing before a starter the quick check accepts interacts with it or what follows
+		bool is_normalization_boundary(uint16_t props, const normalization_traits& traits) noexcept {
+			return !(props & (0xFF | traits.no | traits.maybe));
+		}
+
+		// code points of one segment, kept on the stack unless the segment is unusually long
+		class segment_buffer {
+		public:
+			segment_buffer() = default;
+			segment_buffer(const segment_buffer&) = delete;
+			segment_buffer& operator=(const segment_buffer&) = delete;
+
+			char32_t* data() noexcept {
+				return data_;
+			}
+			size_t size() const noexcept {
+				return size_;
+			}
+			void clear() noexcept {
+				size_ = 0;
+			}
+			void shrink(size_t size) noexcept {
+				assert(size <= size_);
+				size_ = size;
+			}
+			void push_back(char32_t ch) {
+				if (size_ == capacity_) {
+					std::vector<char32_t> heap(capacity_ * 2);
+					std::copy_n(data_, size_, heap.data());
+					heap_.swap(heap);
+					data_ = heap_.data();
+					capacity_ = heap_.size();
+				}
+				data_[size_++] = ch;
+			}
+
+		private:
+			static constexpr size_t kInlineSize = 32;
+
+			char32_t inline_[kInlineSize];
+			std::vector<char32_t> heap_;
+			char32_t* data_ = inline_;
+			size_t size_ = 0;
+			size_t capacity_ = kInlineSize;
+		};
+
+		// append ch, then move it in front of the non-starters of a higher combining class (canonical ordering)
+		void push_ordered(segment_buffer& buffer, char32_t ch) {
+			buffer.push_back(ch);
+			const uint8_t cc = combining_class(ch);
+			if (!cc) {
+				return;
+			}
+			char32_t* const data = buffer.data();
+			size_t i = buffer.size() - 1;
+			for (; i > 0 && combining_class(data[i - 1]) > cc; --i) {
+				data[i] = data[i - 1];
+			}
+			data[i] = ch;
+		}
+
+		void decompose(char32_t ch, bool compat, segment_buffer& buffer) {
+			if (ch - kHangulSBase < kHangulSCount) {
+				const char32_t index = ch - kHangulSBase;
+				buffer.push_back(kHangulLBase + index / kHangulNCount);
+				buffer.push_back(kHangulVBase + index % kHangulNCount / kHangulTCount);
+				if (index % kHangulTCount) {
+					buffer.push_back(kHangulTBase + index % kHangulTCount);
+				}
+				return;
+			}
+
+			const uint16_t index = compat ? ucd::kCompatDecomposition.lookup(ch) : ucd::kCanonicalDecomposition.lookup(ch);
+			if (!index) {
+				push_ordered(buffer, ch);
+				return;
+			}
+			const char32_t* const mapping = ucd::kDecompositionPool + index;
+			for (char32_t i = 1; i <= mapping[0]; ++i) {
+				push_ordered(buffer, mapping[i]);
+			}
+		}
+
+		// return: primary composite of first and second, 0 if there is none
+		char32_t compose_pair(char32_t first, char32_t second) noexcept {
+			if (first - kHangulLBase < kHangulLCount && second - kHangulVBase < kHangulVCount) {
+				return kHangulSBase + ((first - kHangulLBase) * kHangulVCount + second - kHangulVBase) * kHangulTCount;
+			}
+			if (first - kHangulSBase < kHangulSCount && (first - kHangulSBase) % kHangulTCount == 0 &&
+			    second - kHangulTBase - 1 < kHangulTCount - 1) {
+				return first + (second - kHangulTBase);
+			}
+
+			const uint64_t key = static_cast<uint64_t>(first) << 21 | second;
+			const uint64_t* const keys_end = std::end(ucd::kCompositionKeys);
+			const uint64_t* const iter = std::lower_bound(std::begin(ucd::kCompositionKeys), keys_end, key);
+			if (iter == keys_end || *iter != key) {
+				return 0;
+			}
+			return ucd::kCompositionValues[iter - std::begin(ucd::kCompositionKeys)];
+		}
+
+		// canonical composition of a decomposed segment, a code point composes with the last starter unless a code
+		// point in between is a starter or shares or exceeds its combining class
+		void compose(segment_buffer& buffer) noexcept {
+			const size_t size = buffer.size();
+			if (!size) {
+				return;
+			}
+
+			char32_t* const data = buffer.data();
+			size_t starter = combining_class(data[0]) ? SIZE_MAX : 0;
+			uint8_t last_class = 0;
+			size_t written = 1;
+			for (size_t i = 1; i < size; ++i) {
+				const char32_t ch = data[i];
+				const uint8_t cc = combining_class(ch);
+				if (starter != SIZE_MAX && (last_class == 0 || last_class < cc)) {
+					if (const char32_t composite = compose_pair(data[starter], ch)) {
+						data[starter] = composite;
+						continue;
+					}
+				}
+				if (!cc) {
+					starter = written;
+				}
+				last_class = cc;
+				data[written++] = ch;
+			}
+			buffer.shrink(written);
+		}
+
+		// decode [first, last) into buffer in the form of traits
+		void normalize_segment(const char8_t* first, const char8_t* last, const normalization_traits& traits, segment_buffer& buffer) {
+			buffer.clear();
+			while (first < last) {
+				char32_t ch;
+				// an ill-formed subpart decodes to U+FFFD
+				first = decode_utf(first, last, ch).next_ptr_;
+				decompose(ch, traits.compat, buffer);
+			}
+			if (traits.compose) {
+				compose(buffer);
+			}
+		}
+
+		// return: index of the first boundary, ascii code unit or ill-formed subpart from index on
+		size_t find_segment_end(const char8_t* seq, size_t size, size_t index, const normalization_traits& traits) noexcept {
+			while (index < size && seq[index] >= 0x80) {
+				char32_t ch;
+				const auto [next, is_usv] = decode_utf(seq + index, seq + size, ch);
+				if (!is_usv || is_normalization_boundary(ucd::kNormalizationProps.lookup(ch), traits)) {
+					break;
+				}
+				index = static_cast<size_t>(next - seq);
+			}
+			return index;
+		}
+
+		// walk seq with the quick check, ascii runs are skipped with utf8_ascii_prefix. on_segment(start, end) gets every
+		// segment the quick check cannot accept, from the boundary before the offending code point to the next one,
+		// the walk stops once it returns false
+		// return: false if on_segment stopped the walk
+		template<typename OnSegment>
+		bool scan_segments(const char8_t* seq, size_t size, const normalization_traits& traits, OnSegment&& on_segment) {
+			size_t i = utf8_ascii_prefix(seq, size);
+			// start of the segment the code point at i belongs to
+			size_t segment_start = i ? i - 1 : 0;
+			uint8_t last_class = 0;
+			while (i < size) {
+				if (seq[i] < 0x80) {
+					i += utf8_ascii_prefix(seq + i, size - i);
+					segment_start = i - 1;
+					last_class = 0;
+					continue;
+				}
+
+				char32_t ch;
+				const auto [next, is_usv] = decode_utf(seq + i, seq + size, ch);
+				// an ill-formed subpart stands for U+FFFD, a boundary the quick check rejects
+				const uint16_t props = is_usv ? ucd::kNormalizationProps.lookup(ch) : 0;
+				const auto cc = static_cast<uint8_t>(props);
+				if (is_normalization_boundary(props, traits)) {
+					segment_start = i;
+				}
+				i = static_cast<size_t>(next - seq);
+
+				if (!is_usv || (props & (traits.no | traits.maybe)) || (cc && last_class > cc)) {
+					const size_t segment_end = find_segment_end(seq, size, i, traits);
+					if (!on_segment(segment_start, segment_end)) {
+						return false;
+					}
+					i = segment_start = segment_end;
+					last_class = 0;
+					continue;
+				}
+				last_class = cc;
+			}
+			return true;
+		}
+	}
+
+	// normalization
+	bool utf8_is_normalized(const char8_t* seq, size_t size, normalization_form form) {
+		const normalization_traits traits = traits_of(form);
+		segment_buffer buffer;
+		return scan_segments(seq, size, traits, [&](size_t start, size_t end) {
+			normalize_segment(seq + start, seq + end, traits, buffer);
+			char8_t units[4];
+			for (size_t i = 0; i < buffer.size(); ++i) {
+				const size_t count = utf8_encode(buffer.data()[i], units);
+				if (end - start < count || !std::equal(units, units + count, seq + start)) {
+					return false;
+				}
+				start += count;
+			}
+			return start == end;
+		});
+	}
+
+	void utf8_normalize(const char8_t* seq, size_t size, normalization_form form, u8string& out) {
+		const normalization_traits traits = traits_of(form);
+		segment_buffer buffer;
+		size_t copied = 0;
+		out.reserve(out.size() + size);
+		scan_segments(seq, size, traits, [&](size_t start, size_t end) {
+			out.append(u8string_view(seq + copied, start - copied));
+			normalize_segment(seq + start, seq + end, traits, buffer);
+
+			char8_t units[128];
+			size_t count = 0;
+			for (size_t i = 0; i < buffer.size(); ++i) {
+				if (count + 4 > std::size(units)) {
+					out.append(u8string_view(units, count));
+					count = 0;
+				}
+				count += utf8_encode(buffer.data()[i], units + count);
+			}
+			out.append(u8string_view(units, count));
+			copied = end;
+			return true;
+		});
+		out.append(u8string_view(seq + copied, size - copied));
+	}
+}
+
+// case mapping
+namespace u8lib
+{
+	namespace
+	{
+		enum class case_mapping {
+			lower,
+			upper,
+			fold,
+		};
+
+		template<bool StopAtNonAscii>
+		size_t ascii_case_map(const char8_t* seq, size_t size, char8_t* dst, char8_t first) noexcept {
+#if U8LIB_SIMD_NATIVE
+			return simd::ascii_case_map<simd::native_u8, StopAtNonAscii>(seq, size, dst, first);
+#else
+			return simd::ascii_case_map_scalar<StopAtNonAscii>(seq, size, dst, first);
+#endif
+		}
+
+		// return: code units written to dst
+		size_t case_map_code_point(char32_t ch, case_mapping mapping, char8_t* dst) noexcept {
+			const size_t record = ucd::kCaseMappingIndex.lookup(ch);
+			switch (mapping) {
+				case case_mapping::lower:
+					return utf8_encode(static_cast<char32_t>(ch + ucd::kLowercaseDelta[record]), dst);
+				case case_mapping::upper:
+					return utf8_encode(static_cast<char32_t>(ch + ucd::kUppercaseDelta[record]), dst);
+				default:
+					break;
+			}
+			if (record < ucd::kFirstFullCaseFolding) {
+				return utf8_encode(static_cast<char32_t>(ch + ucd::kCaseFoldingDelta[record]), dst);
+			}
+			size_t written = 0;
+			for (const char32_t folded : ucd::kFullCaseFoldings[record - ucd::kFirstFullCaseFolding]) {
+				if (!folded) {
+					break;
+				}
+				written += utf8_encode(folded, dst + written);
+			}
+			return written;
+		}
+
+		// map seq chunk by chunk through a stack buffer, ascii runs go through the vector kernel
+		void utf8_case_map(const char8_t* seq, size_t size, case_mapping mapping, u8string& out) {
+			constexpr size_t kChunkSize = 1024;
+			// a code point starting in a chunk is mapped whole, so a chunk reads up to 3 code units past its end
+			char8_t buffer[(kChunkSize + 3) * ucd::kMaxCaseMappingExpansion];
+			// a lone bad unit becomes the 3 units of U+FFFD, the buffer bound relies on that fitting the expansion
+			static_assert(ucd::kMaxCaseMappingExpansion >= 3, "U+FFFD replacement must fit the case mapping expansion");
+			const char8_t ascii_first = mapping == case_mapping::upper ? u8'a' : u8'A';
+
+			out.reserve(out.size() + size);
+			size_t i = 0;
+			while (i < size) {
+				const size_t chunk_end = std::min(size, i + kChunkSize);
+				size_t written = 0;
+				while (i < chunk_end) {
+					const size_t ascii = ascii_case_map<true>(seq + i, chunk_end - i, buffer + written, ascii_first);
+					i += ascii;
+					written += ascii;
+					while (i < chunk_end && seq[i] >= 0x80) {
+						char32_t ch;
+						// an ill-formed subpart decodes to U+FFFD, which maps to itself
+						const auto [next, is_usv] = decode_utf(seq + i, seq + size, ch);
+						written += case_map_code_point(ch, mapping, buffer + written);
+						i = static_cast<size_t>(next - seq);
+					}
+				}
+				out.append(u8string_view(buffer, written));
+			}
+		}
+	}
+
+	void ascii_to_lower(const char8_t* seq, size_t size, char8_t* dst) noexcept {
+		ascii_case_map<false>(seq, size, dst, u8'A');
+	}
+
+	void ascii_to_upper(const char8_t* seq, size_t size, char8_t* dst) noexcept {
+		ascii_case_map<false>(seq, size, dst, u8'a');
+	}
+
+	void utf8_to_lower(const char8_t* seq, size_t size, u8string& out) {
+		utf8_case_map(seq, size, case_mapping::lower, out);
+	}
+
+	void utf8_to_upper(const char8_t* seq, size_t size, u8string& out) {
+		utf8_case_map(seq, size, case_mapping::upper, out);
+	}
+
+	void utf8_case_fold(const char8_t* seq, size_t size, u8string& out) {
+		utf8_case_map(seq, size, case_mapping::fold, out);
+	}
+}
+
+// grapheme clusters
+namespace u8lib
+{
+	namespace
+	{
+		using ucd::grapheme_break;
+
+		struct grapheme_props {
+			grapheme_break value;
+			bool is_extended_pictographic;
+		};
+
+		grapheme_props grapheme_props_of(char32_t ch) noexcept {
+			const uint8_t props = ucd::kGraphemeBreakProps.lookup(ch);
+			return {static_cast<grapheme_break>(props & ucd::kGraphemeBreakMask), (props & ucd::kExtendedPictographic) != 0};
+		}
+
+		bool is_control_or_newline(grapheme_break value) noexcept {
+			return value == grapheme_break::control || value == grapheme_break::cr || value == grapheme_break::lf;
+		}
+
+		// context of the code points before the pair a boundary is looked for
+		struct grapheme_context {
+			// the text ends with \p{Extended_Pictographic} Extend* ZWJ (GB11)
+			bool emoji_zwj = false;
+			// the text ends with \p{Extended_Pictographic} Extend*
+			bool emoji = false;
+			// regional indicators ending the text (GB12, GB13)
+			size_t regional_indicators = 0;
+
+			void push(grapheme_props props) noexcept {
+				emoji_zwj = emoji && props.value == grapheme_break::zwj;
+				emoji = props.is_extended_pictographic || (emoji && props.value == grapheme_break::extend);
+				regional_indicators = props.value == grapheme_break::regional_indicator ? regional_indicators + 1 : 0;
+			}
+		};
+
+		// UAX #29 rules GB3 to GB13, context holds left already
+		bool is_grapheme_boundary(grapheme_break left, grapheme_props right, const grapheme_context& context) noexcept {
+			if (left == grapheme_break::cr && right.value == grapheme_break::lf) {
+				return false; // GB3 CR x LF
+			}
+			if (is_control_or_newline(left) || is_control_or_newline(right.value)) {
+				return true; // GB4 (Control | CR | LF) %, GB5 % (Control | CR | LF)
+			}
+			switch (left) {
+				case grapheme_break::l:
+					if (right.value == grapheme_break::l || right.value == grapheme_break::v || right.value == grapheme_break::lv ||
+					    right.value == grapheme_break::lvt) {
+						return false; // GB6 L x (L | V | LV | LVT)
+					}
+					break;
+				case grapheme_break::lv:
+				case grapheme_break::v:
+					if (right.value == grapheme_break::v || right.value == grapheme_break::t) {
+						return false; // GB7 (LV | V) x (V | T)
+					}
+					break;
+				case grapheme_break::lvt:
+				case grapheme_break::t:
+					if (right.value == grapheme_break::t) {
+						return false; // GB8 (LVT | T) x T
+					}
+					break;
+				case grapheme_break::prepend:
+					return false; // GB9b Prepend x
+				default:
+					break;
+			}
+			if (right.value == grapheme_break::extend || right.value == grapheme_break::zwj || right.value == grapheme_break::spacing_mark) {
+				return false; // GB9 x (Extend | ZWJ), GB9a x SpacingMark
+			}
+			if (context.emoji_zwj && right.is_extended_pictographic) {
+				return false; // GB11 \p{Extended_Pictographic} Extend* ZWJ x \p{Extended_Pictographic}
+			}
+			if (right.value == grapheme_break::regional_indicator && context.regional_indicators % 2 != 0) {
+				return false; // GB12, GB13 RI pairs
+			}
+			return true; // GB999 Any % Any
+		}
+
+		// first: receives the first code point of the cluster
+		// return: end of the cluster starting at index
+		size_t find_grapheme_end(const char8_t* seq, size_t size, size_t index, char32_t& first) noexcept {
+			char32_t ch;
+			auto decoded = decode_utf(seq + index, seq + size, ch);
+			first = ch;
+			grapheme_props left = grapheme_props_of(ch);
+			grapheme_context context;
+			context.push(left);
+			size_t next = static_cast<size_t>(decoded.next_ptr_ - seq);
+			while (next < size) {
+				decoded = decode_utf(seq + next, seq + size, ch);
+				const grapheme_props right = grapheme_props_of(ch);
+				if (is_grapheme_boundary(left.value, right, context)) {
+					return next;
+				}
+				context.push(right);
+				left = right;
+				next = static_cast<size_t>(decoded.next_ptr_ - seq);
+			}
+			return size;
+		}
+
+		size_t count_crlf(const char8_t* seq, size_t size) noexcept {
+#if U8LIB_SIMD_NATIVE
+			return simd::count_crlf<simd::native_u8>(seq, size);
+#else
+			return simd::count_crlf_scalar(seq, size);
+#endif
+		}
+
+		// return: end of the ascii run from index whose code units are clusters of their own but CR LF, the last ascii
+		// code unit before a non-ascii one may start a cluster with it, so may CR before it
+		size_t ascii_cluster_run_end(const char8_t* seq, size_t size, size_t index) noexcept {
+			size_t run_end = index + utf8_ascii_prefix(seq + index, size - index);
+			if (run_end < size && run_end > index) {
+				--run_end;
+				if (run_end > index && seq[run_end - 1] == u8'\r' && seq[run_end] == u8'\n') {
+					--run_end;
+				}
+			}
+			return run_end;
+		}
+
+		// estimated width of [format.string.std], a cluster is as wide as its first code point
+		size_t estimated_width(char32_t ch) noexcept {
+			return (ucd::kCharacterProps.lookup(ch) & ucd::kWideEstimate) ? 2 : 1;
+		}
+	}
+
+	size_t utf8_next_grapheme(const char8_t* seq, size_t size, size_t index) noexcept {
+		assert(index < size);
+		// an ascii code unit followed by another one is a cluster of its own but CR LF
+		if (seq[index] < 0x80 && (index + 1 == size || seq[index + 1] < 0x80)) {
+			return index + 1 + (index + 1 < size && seq[index] == u8'\r' && seq[index + 1] == u8'\n');
+		}
+		char32_t first;
+		return find_grapheme_end(seq, size, index, first);
+	}
+
+	size_t utf8_grapheme_count(const char8_t* seq, size_t size) noexcept {
+		size_t count = 0;
+		size_t i = 0;
+		while (i < size) {
+			const size_t run_end = ascii_cluster_run_end(seq, size, i);
+			count += run_end - i - count_crlf(seq + i, run_end - i);
+			i = run_end;
+			if (i == size) {
+				break;
+			}
+			char32_t first;
+			i = find_grapheme_end(seq, size, i, first);
+			++count;
+		}
+		return count;
+	}
+
+	size_t utf8_display_width(const char8_t* seq, size_t size) noexcept {
+		size_t width = 0;
+		size_t i = 0;
+		while (i < size) {
+			// one column per ascii cluster
+			const size_t run_end = ascii_cluster_run_end(seq, size, i);
+			width += run_end - i - count_crlf(seq + i, run_end - i);
+			i = run_end;
+			if (i == size) {
+				break;
+			}
+			char32_t first;
+			i = find_grapheme_end(seq, size, i, first);
+			width += estimated_width(first);
+		}
+		return width;
+	}
+
+	size_t utf8_width_prefix(const char8_t* seq, size_t size, size_t max_width) noexcept {
+		size_t width = 0;
+		size_t i = 0;
+		while (i < size) {
+			const size_t run_end = ascii_cluster_run_end(seq, size, i);
+			const size_t run_width = run_end - i - count_crlf(seq + i, run_end - i);
+			if (width + run_width > max_width) {
+				// the run ends the prefix, step its clusters up to the remaining columns
+				for (; width < max_width; ++width) {
+					i += 1 + (i + 1 < run_end && seq[i] == u8'\r' && seq[i + 1] == u8'\n');
+				}
+				return i;
+			}
+			width += run_width;
+			i = run_end;
+			if (i == size) {
+				break;
+			}
+			char32_t first;
+			const size_t next = find_grapheme_end(seq, size, i, first);
+			width += estimated_width(first);
+			if (width > max_width) {
+				return i;
+			}
+			i = next;
+		}
+		return size;
+	}
+}
+
+// character properties
+namespace u8lib
+{
+	unicode_general_category general_category(char32_t ch) noexcept {
+		return static_cast<unicode_general_category>(ucd::kCharacterProps.lookup(ch) & ucd::kGeneralCategoryMask);
+	}
+
+	unicode_east_asian_width east_asian_width(char32_t ch) noexcept {
+		return static_cast<unicode_east_asian_width>(ucd::kCharacterProps.lookup(ch) >> ucd::kEastAsianWidthShift &
+		                                              ucd::kEastAsianWidthMask);
+	}
+
+	bool is_whitespace(char32_t ch) noexcept {
+		return (ucd::kCharacterProps.lookup(ch) & ucd::kWhiteSpace) != 0;
+	}
+
+	bool is_alphabetic(char32_t ch) noexcept {
+		return (ucd::kCharacterProps.lookup(ch) & ucd::kAlphabetic) != 0;
+	}
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <bit>
 #include <cassert>
 #include <concepts>
 
@@ -172,17 +173,8 @@ namespace u8lib
 	}
 
 	constexpr uint64_t utf8_seq_len(char8_t ch) {
-		if (ch == 0) {
-			return 1;
-		}
-
-		constexpr char8_t mask = static_cast<char8_t>(0b1000'0000);
-		uint32_t size = 0;
-		uint8_t v = ch;
-		while (v & mask) {
-			++size;
-			v <<= 1;
-		}
+		// the leading ones tell the length
+		const uint64_t size = std::countl_one(static_cast<uint8_t>(ch));
 
 		// 10xx'xxxx => trailing
 		// 0xxx'xxxx => 1-byte
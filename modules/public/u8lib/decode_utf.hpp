@@ -1,6 +1,9 @@
 #pragma once
 
+#include <array>
+#include <bit>
 #include <cassert>
+#include <cstdint>
 
 namespace u8lib
 {
@@ -11,113 +14,99 @@ namespace u8lib
 		// Unicode.
 	};
 
+	// shift based utf-8 dfa, every state is a bit offset into the 64-bit row of the next byte, the row holds the next
+	// state at that offset, so one transition is a table load and a shift
+	namespace internal
+	{
+		inline constexpr uint32_t kUtf8Accept = 0;    // between sequences
+		inline constexpr uint32_t kUtf8Reject = 6;    // ill-formed, the byte is not part of the sequence
+		inline constexpr uint32_t kUtf8Tail1 = 12;    // one 80..BF left
+		inline constexpr uint32_t kUtf8Tail2 = 18;    // two 80..BF left
+		inline constexpr uint32_t kUtf8Tail3 = 24;    // three 80..BF left
+		inline constexpr uint32_t kUtf8AfterE0 = 30;  // A0..BF, then one 80..BF (no overlong)
+		inline constexpr uint32_t kUtf8AfterED = 36;  // 80..9F, then one 80..BF (no surrogate)
+		inline constexpr uint32_t kUtf8AfterF0 = 42;  // 90..BF, then two 80..BF (no overlong)
+		inline constexpr uint32_t kUtf8AfterF4 = 48;  // 80..8F, then two 80..BF (no value above U+10FFFF)
+
+		consteval std::array<uint64_t, 256> make_utf8_dfa() {
+			// every transition rejects unless set below
+			uint64_t reject_all = 0;
+			for (uint32_t state = kUtf8Accept; state <= kUtf8AfterF4; state += 6) {
+				reject_all |= static_cast<uint64_t>(kUtf8Reject) << state;
+			}
+			std::array<uint64_t, 256> rows{};
+			rows.fill(reject_all);
+			const auto set = [&rows](uint32_t first, uint32_t last, uint32_t state, uint32_t next) {
+				for (uint32_t ch = first; ch <= last; ++ch) {
+					rows[ch] = (rows[ch] & ~(uint64_t{63} << state)) | static_cast<uint64_t>(next) << state;
+				}
+			};
+
+			// leading bytes
+			set(0x00, 0x7F, kUtf8Accept, kUtf8Accept);
+			set(0xC2, 0xDF, kUtf8Accept, kUtf8Tail1);
+			set(0xE0, 0xE0, kUtf8Accept, kUtf8AfterE0);
+			set(0xE1, 0xEC, kUtf8Accept, kUtf8Tail2);
+			set(0xED, 0xED, kUtf8Accept, kUtf8AfterED);
+			set(0xEE, 0xEF, kUtf8Accept, kUtf8Tail2);
+			set(0xF0, 0xF0, kUtf8Accept, kUtf8AfterF0);
+			set(0xF1, 0xF3, kUtf8Accept, kUtf8Tail3);
+			set(0xF4, 0xF4, kUtf8Accept, kUtf8AfterF4);
+
+			// trailing bytes
+			set(0x80, 0xBF, kUtf8Tail1, kUtf8Accept);
+			set(0x80, 0xBF, kUtf8Tail2, kUtf8Tail1);
+			set(0x80, 0xBF, kUtf8Tail3, kUtf8Tail2);
+			set(0xA0, 0xBF, kUtf8AfterE0, kUtf8Tail1);
+			set(0x80, 0x9F, kUtf8AfterED, kUtf8Tail1);
+			set(0x90, 0xBF, kUtf8AfterF0, kUtf8Tail2);
+			set(0x80, 0x8F, kUtf8AfterF4, kUtf8Tail2);
+			return rows;
+		}
+
+		inline constexpr std::array<uint64_t, 256> kUtf8Dfa = make_utf8_dfa();
+
+		constexpr uint32_t utf8_dfa_next(uint32_t state, char8_t ch) noexcept {
+			return static_cast<uint32_t>(kUtf8Dfa[ch] >> state) & 63;
+		}
+	}
+
 	constexpr decode_result decode_utf(const char8_t* first, const char8_t* last, char32_t& value) noexcept {
 		assert(first < last);
 		// Decode a UTF-8 encoded codepoint starting at first and not exceeding last, returning
 		// one past the end of the character decoded. Any invalid codepoints will result in
-		// value == U+FFFD and _Decode_utf will return one past the
+		// value == U+FFFD and decode_utf will return one past the
 		// maximal subpart of the ill-formed subsequence. So, most invalid UTF-8 will result in
 		// one U+FFFD for each byte of invalid data. Truncated but otherwise valid UTF-8 may
 		// result in one U+FFFD for more than one input byte.
-		value = static_cast<char32_t>(static_cast<unsigned char>(*first));
-
-		// All UTF-8 text is at least one byte.
-		// The zero extended values of the "prefix" bytes for
-		// a multi-byte sequence are the lowest numeric value (in two's complement)
-		// that any leading byte could have for a code unit of that size, so
-		// we just sum the comparisons to get the number of trailing bytes.
-		int num_bytes;
-		if (value <= 0x7F) {
+		const char8_t lead = *first;
+		if (lead <= 0x7F) {
+			value = lead;
 			return {first + 1, true};
 		}
-		if (value >= 0xC2 && value <= 0xDF) {
-			num_bytes = 2;
-		} else if (value >= 0xE0 && value <= 0xEF) {
-			num_bytes = 3;
-		} else if (value >= 0xF0 && value <= 0xF4) {
-			num_bytes = 4;
-		} else {
+
+		uint32_t state = internal::utf8_dfa_next(internal::kUtf8Accept, lead);
+		if (state == internal::kUtf8Reject) {
 			// definitely not valid
 			value = 0xFFFD;
 			return {first + 1, false};
 		}
 
-		if (first + 1 == last) {
-			// We got a multibyte sequence and the next byte is off the end, we need
-			// to check just the next byte here since we need to look for overlong sequences.
-			// We want to return one past the end of a truncated sequence if everything is
-			// otherwise valid, so we can't check if first + num_bytes is off the end.
-			value = 0xFFFD;
-			return {last, false};
-		}
-
-		switch (value) {
-			case 0xE0:
-				// we know first[1] is in range because we just checked above,
-				// and a leader of 0xE0 implies num_bytes == 3
-				if (static_cast<unsigned char>(first[1]) < 0xA0) {
-					// note, we just increment forward one-byte,
-					// even though num_bytes would imply the next
-					// codepoint starts at first + 2, this is because
-					// we don't consume trailing bytes of ill-formed subsequences
-					value = 0xFFFD;
-					return {first + 1, false};
-				}
-				break;
-			case 0xED:
-				if (static_cast<unsigned char>(first[1]) > 0x9F) {
-					value = 0xFFFD;
-					return {first + 1, false};
-				}
-				break;
-			case 0xF0:
-				if (static_cast<unsigned char>(first[1]) < 0x90) {
-					value = 0xFFFD;
-					return {first + 1, false};
-				}
-				break;
-			case 0xF4:
-				if (static_cast<unsigned char>(first[1]) > 0x8F) {
-					value = 0xFFFD;
-					return {first + 1, false};
-				}
-				break;
-			default:
-				break;
-		}
-
-		// mask out the "value bits" in the leading byte,
-		// for one-byte codepoints there is no leader,
-		// two-byte codepoints have the same number of value
-		// bits as trailing bytes (including the leading zero)
-		switch (num_bytes) {
-			case 2:
-				value &= 0b1'1111u;
-				break;
-			case 3:
-				value &= 0b1111u;
-				break;
-			case 4:
-				value &= 0b111u;
-				break;
-			default:
-				break;
-		}
-
-		for (int idx = 1; idx < num_bytes; ++idx) {
-			if (
-				first + idx >= last ||
-				static_cast<unsigned char>(first[idx]) < 0x80 ||
-				static_cast<unsigned char>(first[idx]) > 0xBF
-			) {
-				// truncated sequence
+		// a valid leading byte 11..10xxxxx keeps (7 - leading ones) value bits
+		char32_t result = lead & (0x7Fu >> std::countl_one(static_cast<uint8_t>(lead)));
+		const char8_t* cur = first + 1;
+		do {
+			// the dfa rejects exactly the bytes that end the maximal subpart, they are not consumed
+			if (cur == last || (state = internal::utf8_dfa_next(state, *cur)) == internal::kUtf8Reject) {
 				value = 0xFFFD;
-				return {first + idx, false};
+				return {cur, false};
 			}
-			// we know we're always in range due to the above check.
-			value = (value << 6) | (static_cast<unsigned char>(first[idx]) & 0b11'1111u);
-		}
-		return {first + num_bytes, true};
+			result = (result << 6) | (*cur & 0b11'1111u);
+			++cur;
+		} while (state != internal::kUtf8Accept);
+
+		value = result;
+		return {cur, true};
 	}
 
 	constexpr int utf8_code_units_in_next_character(const char8_t* const first, const char8_t* const last) noexcept {
@@ -0,0 +1,73 @@
+#pragma once
+
+// bom
+namespace u8lib
+{
+	constexpr bom_info sniff_bom(const uint8_t* data, size_t size) noexcept {
+		// utf-32le first, its mark starts with the utf-16le one
+		if (size >= 4 && data[0] == 0xFF && data[1] == 0xFE && data[2] == 0x00 && data[3] == 0x00) {
+			return {text_encoding::utf32le, 4};
+		}
+		if (size >= 4 && data[0] == 0x00 && data[1] == 0x00 && data[2] == 0xFE && data[3] == 0xFF) {
+			return {text_encoding::utf32be, 4};
+		}
+		if (size >= 3 && data[0] == 0xEF && data[1] == 0xBB && data[2] == 0xBF) {
+			return {text_encoding::utf8, 3};
+		}
+		if (size >= 2 && data[0] == 0xFF && data[1] == 0xFE) {
+			return {text_encoding::utf16le, 2};
+		}
+		if (size >= 2 && data[0] == 0xFE && data[1] == 0xFF) {
+			return {text_encoding::utf16be, 2};
+		}
+		return {text_encoding::utf8, 0};
+	}
+}
+
+// ctor & dtor
+namespace u8lib
+{
+	inline mapped_text::mapped_text(const char8_t* filename) {
+		open(filename);
+	}
+
+	inline mapped_text::~mapped_text() {
+		close();
+	}
+}
+
+// open & close
+namespace u8lib
+{
+	inline bool mapped_text::is_open() const noexcept {
+		return is_open_;
+	}
+}
+
+// getter
+namespace u8lib
+{
+	inline text_encoding mapped_text::encoding() const noexcept {
+		return bom_.encoding;
+	}
+
+	inline mapped_text::size_type mapped_text::bom_size() const noexcept {
+		return bom_.size;
+	}
+
+	inline const uint8_t* mapped_text::bytes() const noexcept {
+		return data_;
+	}
+
+	inline mapped_text::size_type mapped_text::byte_size() const noexcept {
+		return size_;
+	}
+
+	inline bool mapped_text::is_zero_copy() const noexcept {
+		return bom_.encoding == text_encoding::utf8;
+	}
+
+	inline mapped_text::size_type mapped_text::transcoded_capacity() const noexcept {
+		return text_.capacity();
+	}
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+// ctor & dtor
+namespace u8lib
+{
+	inline multi_searcher::multi_searcher(std::initializer_list<u8string_view> patterns)
+		: multi_searcher(std::span<const u8string_view>(patterns.begin(), patterns.size())) {
+	}
+}
+
+// getter
+namespace u8lib
+{
+	inline multi_searcher::size_type multi_searcher::pattern_count() const noexcept {
+		return pattern_sizes_.size();
+	}
+
+	inline multi_searcher::size_type multi_searcher::pattern_size(size_type pattern) const noexcept {
+		assert(pattern < pattern_sizes_.size() && "undefined behavior accessing out of patterns");
+		return pattern_sizes_[pattern];
+	}
+
+	inline multi_searcher::size_type multi_searcher::state_count() const noexcept {
+		return states_.size();
+	}
+}
+
+// search
+namespace u8lib
+{
+	template<std::invocable<size_t, size_t> F>
+	multi_searcher::size_type multi_searcher::find_each(u8string_view text, F&& func) const {
+		using EachFuncResultType = std::invoke_result_t<F, size_type, size_type>;
+
+		if (max_pattern_size_ == 0) {
+			return 0;
+		}
+		const char8_t* seq = text.data();
+		size_type count = 0;
+		uint32_t current = 0;
+		for (size_type i = 0; i < text.size(); ++i) {
+			current = next(current, seq[i]);
+
+			// every pattern ending here, from the state itself down its failure chain
+			for (uint32_t found = states_[current].output; found != kNoState; found = states_[states_[found].failure].output) {
+				const state& each = states_[found];
+				for (uint32_t j = 0; j < each.pattern_count; ++j) {
+					const uint32_t pattern = state_patterns_[each.pattern_begin + j];
+					const size_type offset = i + 1 - pattern_sizes_[pattern];
+					if (!on_boundaries(text, offset, i + 1)) {
+						continue;
+					}
+					++count;
+					if constexpr (std::is_same_v<EachFuncResultType, bool>) {
+						if (!func(static_cast<size_type>(pattern), offset)) {
+							return count;
+						}
+					} else {
+						func(static_cast<size_type>(pattern), offset);
+					}
+				}
+			}
+		}
+		return count;
+	}
+
+	inline std::optional<multi_searcher::match> multi_searcher::find_first_of_any(u8string_view text) const {
+		std::optional<match> result;
+		find_each(text, [&](size_type pattern, size_type offset) {
+			if (result) {
+				// a match ending here or later cannot start before max_pattern_size_ - 1 units back
+				if (offset + pattern_sizes_[pattern] >= result->offset + max_pattern_size_ + 1) {
+					return false;
+				}
+				if (offset > result->offset ||
+					(offset == result->offset && pattern_sizes_[pattern] <= pattern_sizes_[result->pattern])) {
+					return true;
+				}
+			}
+			result = match{pattern, offset};
+			return true;
+		});
+		return result;
+	}
+
+	inline std::vector<multi_searcher::match> multi_searcher::find_all(u8string_view text) const {
+		std::vector<match> result;
+		find_each(text, [&](size_type pattern, size_type offset) {
+			result.push_back({pattern, offset});
+		});
+		return result;
+	}
+
+	inline bool multi_searcher::contains_any(u8string_view text) const {
+		return find_each(text, [](size_type, size_type) { return false; }) != 0;
+	}
+
+	inline uint32_t multi_searcher::next(uint32_t from, char8_t byte) const noexcept {
+		// the root is dense, so the failure chain always ends in a dense row
+		while (from >= dense_states_) {
+			const state& each = states_[from];
+			const char8_t* bytes = edge_bytes_.data() + each.edge_begin;
+			for (uint32_t i = 0; i < each.edge_count && bytes[i] <= byte; ++i) {
+				if (bytes[i] == byte) {
+					return edge_targets_[each.edge_begin + i];
+				}
+			}
+			from = each.failure;
+		}
+		return dense_[from * 256 + byte];
+	}
+
+	inline bool multi_searcher::on_boundaries(u8string_view text, size_type offset, size_type end) noexcept {
+		auto is_continuation = [](char8_t byte) {
+			return (byte & 0xC0) == 0x80;
+		};
+		return !is_continuation(text.data()[offset]) && (end == text.size() || !is_continuation(text.data()[end]));
+	}
+}
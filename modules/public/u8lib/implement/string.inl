@@ -87,6 +87,18 @@ namespace u8lib
 	}
 }
 
+// 8-bit encodings
+namespace u8lib
+{
+	inline u8string u8string::from_latin1(std::string_view str) {
+		return from_latin1(str.data(), str.size());
+	}
+
+	inline u8string u8string::from_cp1252(std::string_view str) {
+		return from_cp1252(str.data(), str.size());
+	}
+}
+
 // ctor & dtor
 namespace u8lib
 {
@@ -163,12 +175,12 @@ namespace u8lib
 	inline std::reverse_iterator<u8string::const_pointer> u8string::rend() const noexcept { return std::reverse_iterator(begin()); }
 	inline std::reverse_iterator<u8string::const_pointer> u8string::crend() const noexcept { return std::reverse_iterator(begin()); }
 
-	inline u8string::cursor u8string::cursor_begin() { return cursor::Begin(data(), size()); }
-	inline u8string::cursor u8string::cursor_end() { return cursor::End(data(), size()); }
-	inline u8string::iterator u8string::iter() { return cursor::Begin(data(), size()).as_iter(); }
-	inline u8string::reverse_iterator u8string::iter_inv() { return cursor::End(data(), size()).as_iter_inv(); }
-	inline u8string::range_t u8string::range() { return cursor::Begin(data(), size()).as_range(); }
-	inline u8string::reverse_range u8string::range_inv() { return cursor::End(data(), size()).as_range_inv(); }
+	inline u8string::cursor u8string::cursor_begin() { return cursor::Begin(_cursor_data(), size()); }
+	inline u8string::cursor u8string::cursor_end() { return cursor::End(_cursor_data(), size()); }
+	inline u8string::iterator u8string::iter() { return cursor::Begin(_cursor_data(), size()).as_iter(); }
+	inline u8string::reverse_iterator u8string::iter_inv() { return cursor::End(_cursor_data(), size()).as_iter_inv(); }
+	inline u8string::range_t u8string::range() { return cursor::Begin(_cursor_data(), size()).as_range(); }
+	inline u8string::reverse_range u8string::range_inv() { return cursor::End(_cursor_data(), size()).as_range_inv(); }
 
 	inline u8string::const_cursor u8string::cursor_begin() const { return const_cursor::Begin(data(), size()); }
 	inline u8string::const_cursor u8string::cursor_end() const { return const_cursor::End(data(), size()); }
@@ -190,7 +202,7 @@ namespace u8lib
 	}
 
 	inline u8string::size_type u8string::text_length() const noexcept {
-		return u8string_view(*this).text_length();
+		return is_ascii() ? size() : u8string_view(*this).text_length();
 	}
 
 	inline u8string::size_type u8string::capacity() const noexcept {
@@ -211,7 +223,35 @@ namespace u8lib
 
 	template<is_char_v Char>
 	u8string::size_type u8string::to_size() const noexcept {
-		return u8string_view(*this).to_size<Char>();
+		return is_ascii() ? size() : u8string_view(*this).to_size<Char>();
+	}
+}
+
+// convert
+namespace u8lib
+{
+	inline u8string::size_type u8string::to_utf16(std::span<char16_t> out) const noexcept {
+		return u8string_view(*this).to_utf16(out);
+	}
+
+	inline u8string::size_type u8string::to_utf32(std::span<char32_t> out) const noexcept {
+		return u8string_view(*this).to_utf32(out);
+	}
+
+	inline std::u16string u8string::to_utf16() const {
+		return u8string_view(*this).to_utf16();
+	}
+
+	inline std::u32string u8string::to_utf32() const {
+		return u8string_view(*this).to_utf32();
+	}
+
+	inline u8string::size_type u8string::to_latin1(std::span<char> out, char replacement) const noexcept {
+		return u8string_view(*this).to_latin1(out, replacement);
+	}
+
+	inline std::string u8string::to_latin1(char replacement) const {
+		return u8string_view(*this).to_latin1(replacement);
 	}
 }
 
@@ -236,6 +276,12 @@ namespace u8lib
 	}
 
 	inline u8string::pointer u8string::data() noexcept {
+		// the caller may write anything through it
+		ascii_flag_ = 0;
+		return is_sso() ? sso_data_ : data_;
+	}
+
+	inline u8string::pointer u8string::_cursor_data() noexcept {
 		return is_sso() ? sso_data_ : data_;
 	}
 
@@ -299,6 +345,10 @@ namespace u8lib
 	}
 
 	inline UTF8Seq u8string::at_text(size_type index) const {
+		if (is_ascii()) {
+			assert(is_valid_index(index) && "undefined behavior accessing an empty string");
+			return UTF8Seq{data()[index]};
+		}
 		return u8string_view(*this).at_text(index);
 	}
 
@@ -314,16 +364,20 @@ namespace u8lib
 		return !sso_flag_;
 	}
 
+	inline bool u8string::is_ascii() const noexcept {
+		return ascii_flag_;
+	}
+
 	inline bool u8string::is_valid_index(size_type index) const noexcept {
 		return u8string_view(*this).is_valid_index(index);
 	}
 
 	inline u8string::size_type u8string::buffer_index_to_text(size_type index) const noexcept {
-		return u8string_view(*this).buffer_index_to_text(index);
+		return is_ascii() ? index : u8string_view(*this).buffer_index_to_text(index);
 	}
 
 	inline u8string::size_type u8string::text_index_to_buffer(size_type index) const noexcept {
-		return u8string_view(*this).text_index_to_buffer(index);
+		return is_ascii() ? index : u8string_view(*this).text_index_to_buffer(index);
 	}
 }
 
@@ -671,6 +725,101 @@ namespace u8lib
 	}
 }
 
+// validate
+namespace u8lib
+{
+	inline bool u8string::is_valid_utf8() const noexcept {
+		return u8string_view(*this).is_valid_utf8();
+	}
+
+	inline u8string::size_type u8string::validate_utf8() const noexcept {
+		return u8string_view(*this).validate_utf8();
+	}
+
+	// declared by u8string_view, defined here where u8string is complete
+	inline u8string u8string_view::sanitized() const {
+		u8string result{*this};
+		result.sanitize();
+		return result;
+	}
+}
+
+// normalization
+namespace u8lib
+{
+	inline bool u8string::is_normalized(normalization_form form) const {
+		// ascii text is in every normalization form
+		return is_ascii() || u8string_view(*this).is_normalized(form);
+	}
+
+	// declared by u8string_view, defined here where u8string is complete
+	inline u8string u8string_view::normalized(normalization_form form) const {
+		u8string result;
+		utf8_normalize(data(), size(), form, result);
+		return result;
+	}
+}
+
+// case mapping
+namespace u8lib
+{
+	inline u8string u8string::ToLower() const {
+		return u8string_view(*this).to_lower();
+	}
+
+	inline u8string u8string::ToUpper() const {
+		return u8string_view(*this).to_upper();
+	}
+
+	inline u8string u8string::CaseFold() const {
+		return u8string_view(*this).case_fold();
+	}
+
+	// declared by u8string_view, defined here where u8string is complete
+	inline u8string u8string_view::to_lower() const {
+		u8string result;
+		utf8_to_lower(data(), size(), result);
+		return result;
+	}
+
+	inline u8string u8string_view::to_upper() const {
+		u8string result;
+		utf8_to_upper(data(), size(), result);
+		return result;
+	}
+
+	inline u8string u8string_view::case_fold() const {
+		u8string result;
+		utf8_case_fold(data(), size(), result);
+		return result;
+	}
+}
+
+// grapheme clusters
+namespace u8lib
+{
+	inline grapheme_range u8string::graphemes() const noexcept {
+		return u8string_view(*this).graphemes();
+	}
+
+	inline u8string::size_type u8string::grapheme_count() const noexcept {
+		return u8string_view(*this).grapheme_count();
+	}
+
+	inline u8string::size_type u8string::display_width() const noexcept {
+		return u8string_view(*this).display_width();
+	}
+
+	inline u8string& u8string::truncate_to_width(size_type width) {
+		// erase() needs a valid index, a string that already fits is left alone
+		const size_type prefix = u8string_view(*this).truncate_to_width(width).size();
+		if (prefix < size()) {
+			erase(prefix);
+		}
+		return *this;
+	}
+}
+
 // split
 namespace u8lib
 {
@@ -693,6 +842,14 @@ namespace u8lib
 	u8string::size_type u8string::split_each(F&& func, UTF8Seq delimiter, bool cull_empty, size_type limit) const {
 		return u8string_view(*this).split(std::forward<F>(func), delimiter, cull_empty, limit);
 	}
+
+	inline split_range u8string::split_view(u8string_view delimiter, bool cull_empty, size_type limit) const noexcept {
+		return u8string_view(*this).split_view(delimiter, cull_empty, limit);
+	}
+
+	inline split_range u8string::split_view(const searcher& delimiter, bool cull_empty, size_type limit) const noexcept {
+		return u8string_view(*this).split_view(delimiter, cull_empty, limit);
+	}
 }
 
 // misc
@@ -72,7 +72,7 @@ namespace u8lib
 {
 	constexpr bool u8string_view::empty() const noexcept { return data_.empty(); }
 	constexpr u8string_view::size_type u8string_view::length() const noexcept { return data_.length(); }
-	constexpr u8string_view::size_type u8string_view::text_length() const noexcept { return empty() ? 0 : utf8_code_point_index(data(), size(), size() - 1) + 1; }
+	constexpr u8string_view::size_type u8string_view::text_length() const noexcept { return utf8_text_length(data(), size()); }
 	constexpr u8string_view::size_type u8string_view::size() const noexcept { return data_.size(); }
 	constexpr u8string_view::size_type u8string_view::max_size() const noexcept { return data_.max_size(); }
 
@@ -81,36 +81,87 @@ namespace u8lib
 		if constexpr (sizeof(Char) == sizeof(char8_t)) {
 			return size();
 		} else if constexpr (sizeof(Char) == sizeof(char16_t)) {
-			if (empty()) {
-				return 0;
-			}
+			return utf8_to_utf16_size(data(), size());
+		} else if constexpr (sizeof(Char) == sizeof(char32_t)) {
+			return utf8_to_utf32_size(data(), size());
+		} else {
+			std::unreachable();
+		}
+	}
+}
 
-			using Cursor = UTF8Cursor<true>;
+// convert
+namespace u8lib
+{
+	constexpr u8string_view::size_type u8string_view::to_utf16(std::span<char16_t> out) const noexcept {
+		// every utf-8 code unit yields at most one utf-16 code unit
+		if (out.size() >= size()) {
+			return utf8_to_utf16(data(), size(), out.data());
+		}
 
-			size_type utf16_len = 0;
-			for (UTF8Seq utf8_seq: Cursor{data(), size(), 0}.as_range()) {
-				if (utf8_seq.is_valid()) {
-					utf16_len += utf8_seq.to_utf16_len();
-				} else {
-					utf16_len += 1;
-				}
+		size_type written = 0;
+		for (const_pointer first = begin(), last = end(); first != last;) {
+			char32_t ch;
+			const_pointer next = decode_utf(first, last, ch).next_ptr_;
+			if (written + utf16_seq_len(ch) > out.size()) {
+				break;
 			}
+			written += utf16_encode(ch, out.data() + written);
+			first = next;
+		}
+		return written;
+	}
 
-			return utf16_len;
-		} else if constexpr (sizeof(Char) == sizeof(char32_t)) {
-			if (empty()) {
-				return 0;
-			}
+	constexpr u8string_view::size_type u8string_view::to_utf32(std::span<char32_t> out) const noexcept {
+		if (out.size() >= size()) {
+			return utf8_to_utf32(data(), size(), out.data());
+		}
 
-			using Cursor = UTF8Cursor<true>;
-			size_type utf32_len = 0;
-			for ([[maybe_unused]] UTF8Seq utf8_seq: Cursor{data(), size(), 0}.as_range()) {
-				utf32_len += 1;
-			}
-			return utf32_len;
-		} else {
-			std::unreachable();
+		size_type written = 0;
+		for (const_pointer first = begin(), last = end(); first != last && written < out.size(); ++written) {
+			first = decode_utf(first, last, out[written]).next_ptr_;
 		}
+		return written;
+	}
+
+	constexpr std::u16string u8string_view::to_utf16() const {
+		std::u16string result;
+		result.resize_and_overwrite(to_size<char16_t>(), [this](char16_t* buffer, size_type) {
+			return utf8_to_utf16(data(), size(), buffer);
+		});
+		return result;
+	}
+
+	constexpr std::u32string u8string_view::to_utf32() const {
+		std::u32string result;
+		result.resize_and_overwrite(to_size<char32_t>(), [this](char32_t* buffer, size_type) {
+			return utf8_to_utf32(data(), size(), buffer);
+		});
+		return result;
+	}
+
+	constexpr u8string_view::size_type u8string_view::to_latin1(std::span<char> out, char replacement) const noexcept {
+		if (out.size() >= size()) {
+			return utf8_to_latin1(data(), size(), out.data(), replacement);
+		}
+
+		size_type written = 0;
+		for (const_pointer first = begin(), last = end(); first != last && written < out.size(); ++written) {
+			char32_t ch;
+			const auto [next, is_usv] = decode_utf(first, last, ch);
+			out[written] = is_usv && ch <= 0xFF ? static_cast<char>(ch) : replacement;
+			first = next;
+		}
+		return written;
+	}
+
+	constexpr std::string u8string_view::to_latin1(char replacement) const {
+		// one code unit per code point, so size() always fits and saves measuring first
+		std::string result;
+		result.resize_and_overwrite(size(), [this, replacement](char* buffer, size_type) {
+			return utf8_to_latin1(data(), size(), buffer, replacement);
+		});
+		return result;
 	}
 }
 
@@ -146,11 +197,11 @@ namespace u8lib
 	}
 
 	constexpr u8string_view::size_type u8string_view::buffer_index_to_text(size_type index) const noexcept {
-		return utf8_code_point_index(data(), size(), index);
+		return utf8_buffer_index_to_text(data(), size(), index);
 	}
 
 	constexpr u8string_view::size_type u8string_view::text_index_to_buffer(size_type index) const noexcept {
-		return utf8_code_unit_index(data(), size(), index);
+		return utf8_text_index_to_buffer(data(), size(), index);
 	}
 }
 
@@ -267,7 +318,7 @@ namespace u8lib
 namespace u8lib
 {
 	constexpr bool u8string_view::contains(u8string_view sv) const noexcept {
-		return data_.contains(sv.data_);
+		return utf8_find(data(), size(), sv.data(), sv.size()) != npos;
 	}
 
 	constexpr bool u8string_view::contains(value_type ch) const noexcept {
@@ -281,18 +332,12 @@ namespace u8lib
 		return false;
 	}
 
+	constexpr bool u8string_view::contains(const searcher& pattern) const noexcept {
+		return pattern.find(data(), size()) != npos;
+	}
+
 	constexpr u8string_view::size_type u8string_view::count(u8string_view pattern) const {
-		auto find_view{*this};
-		size_type result = 0;
-		while (true) {
-			if (const auto find_result = find_view.find(pattern)) {
-				++result;
-				find_view = find_view.subview(find_result + pattern.size());
-			} else {
-				break;
-			}
-		}
-		return result;
+		return utf8_count(data(), size(), pattern.data(), pattern.size());
 	}
 
 	constexpr u8string_view::size_type u8string_view::count(UTF8Seq seq) const {
@@ -301,18 +346,17 @@ namespace u8lib
 		}
 		return 0;
 	}
+
+	constexpr u8string_view::size_type u8string_view::count(const searcher& pattern) const noexcept {
+		return pattern.count(data(), size());
+	}
 }
 
 // find
 namespace u8lib
 {
+	// single units go through std::u8string_view, the rest forward to the view overloads
 #define U8LIB_FIND(name)	\
-	constexpr u8string_view::const_data_reference u8string_view::name(u8string_view v, size_type pos) const noexcept {	\
-		if (const auto index = data_.name(v.data_, pos); index != npos) {	\
-			return {data(), index};	\
-		}	\
-		return {};	\
-	}	\
 	constexpr u8string_view::const_data_reference u8string_view::name(value_type ch, size_type pos) const noexcept {	\
 		if (const auto index = data_.name(ch, pos); index != npos) {	\
 			return {data(), index};	\
@@ -320,10 +364,7 @@ namespace u8lib
 		return {};	\
 	}	\
 	constexpr u8string_view::const_data_reference u8string_view::name(const_pointer s, size_type pos, size_type count) const {	\
-		if (const auto index = data_.name(s, pos, count); index != npos) {	\
-			return {data(), index};	\
-		}	\
-		return {};	\
+		return name(u8string_view{s, count}, pos);	\
 	}	\
 	constexpr u8string_view::const_data_reference u8string_view::name(UTF8Seq pattern, size_type pos) const {	\
 		if (pattern.is_valid()) {	\
@@ -340,6 +381,83 @@ namespace u8lib
 	U8LIB_FIND(find_last_not_of)
 
 #undef U8LIB_FIND
+
+	// substrings go through utf8_find/utf8_rfind, which partition and split share
+	constexpr u8string_view::const_data_reference u8string_view::find(u8string_view v, size_type pos) const noexcept {
+		if (pos <= size()) {
+			if (const auto index = utf8_find(data() + pos, size() - pos, v.data(), v.size()); index != npos) {
+				return {data(), pos + index};
+			}
+		}
+		return {};
+	}
+
+	constexpr u8string_view::const_data_reference u8string_view::find(const searcher& pattern, size_type pos) const noexcept {
+		if (pos <= size()) {
+			if (const auto index = pattern.find(data() + pos, size() - pos); index != npos) {
+				return {data(), pos + index};
+			}
+		}
+		return {};
+	}
+
+	// the occurrence starts at or before pos, so only the first pos + v.size() units are searched
+	constexpr u8string_view::const_data_reference u8string_view::rfind(u8string_view v, size_type pos) const noexcept {
+		if (v.size() <= size()) {
+			const size_type length = (pos < size() - v.size() ? pos : size() - v.size()) + v.size();
+			if (const auto index = utf8_rfind(data(), length, v.data(), v.size()); index != npos) {
+				return {data(), index};
+			}
+		}
+		return {};
+	}
+
+	constexpr u8string_view::const_data_reference u8string_view::rfind(const rsearcher& pattern, size_type pos) const noexcept {
+		const size_type needle_size = pattern.needle().size();
+		if (needle_size <= size()) {
+			const size_type length = (pos < size() - needle_size ? pos : size() - needle_size) + needle_size;
+			if (const auto index = pattern.find(data(), length); index != npos) {
+				return {data(), index};
+			}
+		}
+		return {};
+	}
+
+	// byte sets go through utf8_find_first_of and co, see search.hpp
+	constexpr u8string_view::const_data_reference u8string_view::find_first_of(u8string_view v, size_type pos) const noexcept {
+		if (pos < size()) {
+			if (const auto index = utf8_find_first_of(data() + pos, size() - pos, v.data(), v.size()); index != npos) {
+				return {data(), pos + index};
+			}
+		}
+		return {};
+	}
+
+	constexpr u8string_view::const_data_reference u8string_view::find_first_not_of(u8string_view v, size_type pos) const noexcept {
+		if (pos < size()) {
+			if (const auto index = utf8_find_first_not_of(data() + pos, size() - pos, v.data(), v.size()); index != npos) {
+				return {data(), pos + index};
+			}
+		}
+		return {};
+	}
+
+	// the unit is at or before pos, so only the first pos + 1 units are searched
+	constexpr u8string_view::const_data_reference u8string_view::find_last_of(u8string_view v, size_type pos) const noexcept {
+		const size_type length = pos < size() ? pos + 1 : size();
+		if (const auto index = utf8_find_last_of(data(), length, v.data(), v.size()); index != npos) {
+			return {data(), index};
+		}
+		return {};
+	}
+
+	constexpr u8string_view::const_data_reference u8string_view::find_last_not_of(u8string_view v, size_type pos) const noexcept {
+		const size_type length = pos < size() ? pos + 1 : size();
+		if (const auto index = utf8_find_last_not_of(data(), length, v.data(), v.size()); index != npos) {
+			return {data(), index};
+		}
+		return {};
+	}
 }
 
 // partition
@@ -362,6 +480,18 @@ namespace u8lib
 		}
 		return {*this, {}, {}};
 	}
+
+	constexpr std::array<u8string_view, 3> u8string_view::partition(const searcher& delimiter) const {
+		if (auto found = find(delimiter)) {
+			const size_type delimiter_size = delimiter.needle().size();
+			return {
+				subview(0, found),
+				subview(found, delimiter_size),
+				subview(found + delimiter_size)
+			};
+		}
+		return {*this, {}, {}};
+	}
 }
 
 // trim
@@ -371,6 +501,8 @@ namespace u8lib
 		return trim_start(characters).trim_end(characters);
 	}
 
+	// an ascii set only matches single-unit code points, so the code points to trim are a run of set bytes. other sets
+	// reject a code point on its first unit before looking for it in characters
 	constexpr u8string_view u8string_view::trim_start(u8string_view characters) const {
 		if (empty()) {
 			return {};
@@ -380,8 +512,17 @@ namespace u8lib
 			return {*this};
 		}
 
+		const internal::byte_set set{characters.data(), characters.size()};
+		if (set.is_ascii()) {
+			if (const auto found = find_first_not_of(characters)) {
+				return subview(found);
+			}
+			return {};
+		}
+
 		for (auto cursor = cursor_begin(); !cursor.reach_end(); cursor.move_next()) {
-			if (!characters.contains(cursor.ref())) {
+			const value_type head = data()[cursor.index()];
+			if (!set.contains(head) || (head >= 0x80 && !characters.contains(cursor.ref()))) {
 				return subview(cursor.index());
 			}
 		}
@@ -396,8 +537,17 @@ namespace u8lib
 			return {*this};
 		}
 
+		const internal::byte_set set{characters.data(), characters.size()};
+		if (set.is_ascii()) {
+			if (const auto found = find_last_not_of(characters)) {
+				return subview(0, found + 1);
+			}
+			return {};
+		}
+
 		for (auto cursor = cursor_end(); !cursor.reach_begin(); cursor.move_prev()) {
-			if (!characters.contains(cursor.ref())) {
+			const value_type head = data()[cursor.index()];
+			if (!set.contains(head) || (head >= 0x80 && !characters.contains(cursor.ref()))) {
 				return subview(0, cursor.index() + cursor.seq_len());
 			}
 		}
@@ -456,11 +606,32 @@ namespace u8lib
 	}
 }
 
+// validate
+namespace u8lib
+{
+	constexpr bool u8string_view::is_valid_utf8() const noexcept {
+		return utf8_is_valid(data(), size());
+	}
+
+	constexpr u8string_view::size_type u8string_view::validate_utf8() const noexcept {
+		const size_type valid_size = utf8_validate(data(), size());
+		return valid_size == size() ? npos : valid_size;
+	}
+}
+
+// normalization
+namespace u8lib
+{
+	inline bool u8string_view::is_normalized(normalization_form form) const {
+		return utf8_is_normalized(data(), size(), form);
+	}
+}
+
 // split
 namespace u8lib
 {
-	template<internal::CanAdd<u8string_view> Buffer>
-	constexpr u8string_view::size_type u8string_view::split(Buffer& out, u8string_view delimiter, bool cull_empty, size_type limit) const {
+	template<typename Delimiter, typename Buffer>
+	constexpr u8string_view::size_type u8string_view::split_impl(Buffer& out, const Delimiter& delimiter, bool cull_empty, size_type limit) const {
 		u8string_view each_view{*this};
 		size_type count = 0;
 		while (true) {
@@ -498,18 +669,8 @@ namespace u8lib
 		return count;
 	}
 
-	template<internal::CanAdd<u8string_view> Buffer>
-	constexpr u8string_view::size_type u8string_view::split(Buffer& out, UTF8Seq delimiter, bool cull_empty, size_type limit) const {
-		return this->split(
-			out,
-			delimiter.is_valid() ? u8string_view{delimiter.data, delimiter.len} : u8string_view{},
-			cull_empty,
-			limit
-		);
-	}
-
-	template<std::invocable<u8string_view> F>
-	constexpr u8string_view::size_type u8string_view::split_each(F&& func, u8string_view delimiter, bool cull_empty, size_type limit) const {
+	template<typename Delimiter, typename F>
+	constexpr u8string_view::size_type u8string_view::split_each_impl(F&& func, const Delimiter& delimiter, bool cull_empty, size_type limit) const {
 		using EachFuncResultType = std::invoke_result_t<F, const u8string_view&>;
 
 		u8string_view each_view{*this};
@@ -545,6 +706,26 @@ namespace u8lib
 		return count;
 	}
 
+	template<internal::CanAdd<u8string_view> Buffer>
+	constexpr u8string_view::size_type u8string_view::split(Buffer& out, u8string_view delimiter, bool cull_empty, size_type limit) const {
+		return split_impl(out, delimiter, cull_empty, limit);
+	}
+
+	template<internal::CanAdd<u8string_view> Buffer>
+	constexpr u8string_view::size_type u8string_view::split(Buffer& out, UTF8Seq delimiter, bool cull_empty, size_type limit) const {
+		return this->split(
+			out,
+			delimiter.is_valid() ? u8string_view{delimiter.data, delimiter.len} : u8string_view{},
+			cull_empty,
+			limit
+		);
+	}
+
+	template<std::invocable<u8string_view> F>
+	constexpr u8string_view::size_type u8string_view::split_each(F&& func, u8string_view delimiter, bool cull_empty, size_type limit) const {
+		return split_each_impl(std::forward<F>(func), delimiter, cull_empty, limit);
+	}
+
 	template<std::invocable<u8string_view> F>
 	constexpr u8string_view::size_type u8string_view::split_each(F&& func, UTF8Seq delimiter, bool cull_empty, size_type limit) const {
 		return this->split_each(
@@ -554,6 +735,169 @@ namespace u8lib
 			limit
 		);
 	}
+
+	template<internal::CanAdd<u8string_view> Buffer>
+	constexpr u8string_view::size_type u8string_view::split(Buffer& out, const searcher& delimiter, bool cull_empty, size_type limit) const {
+		return split_impl(out, delimiter, cull_empty, limit);
+	}
+
+	template<std::invocable<u8string_view> F>
+	constexpr u8string_view::size_type u8string_view::split_each(F&& func, const searcher& delimiter, bool cull_empty, size_type limit) const {
+		return split_each_impl(std::forward<F>(func), delimiter, cull_empty, limit);
+	}
+
+	constexpr split_range u8string_view::split_view(u8string_view delimiter, bool cull_empty, size_type limit) const noexcept {
+		return split_range(*this, searcher(delimiter.view()), cull_empty, limit);
+	}
+
+	constexpr split_range u8string_view::split_view(const searcher& delimiter, bool cull_empty, size_type limit) const noexcept {
+		return split_range(*this, delimiter, cull_empty, limit);
+	}
+
+	// same steps as split_each: a piece ends at the next delimiter, empty pieces may be culled, and nothing follows a
+	// delimiter at the very end or the limit-th piece
+	constexpr split_iterator::split_iterator(const split_range* range) noexcept
+		: range_(range)
+		, rest_(range->view_.data())
+		, rest_size_(range->view_.size())
+		, has_rest_(true) {
+		++*this;
+	}
+
+	constexpr split_iterator& split_iterator::operator++() noexcept {
+		const searcher& delimiter = range_->delimiter_;
+		const size_t delimiter_size = delimiter.needle().size();
+		while (has_rest_) {
+			const size_t index = delimiter_size != 0 ? delimiter.find(rest_, rest_size_) : searcher::npos;
+			if (index == searcher::npos) {
+				piece_ = {rest_, rest_size_};
+				has_rest_ = false;
+			} else {
+				piece_ = {rest_, index};
+				rest_ += index + delimiter_size;
+				rest_size_ -= index + delimiter_size;
+				if (rest_size_ == 0) {
+					has_rest_ = false;
+				}
+			}
+
+			// the limit is checked after culled pieces too
+			const bool yielded = !range_->cull_empty_ || !piece_.empty();
+			if (yielded) {
+				++count_;
+			}
+			if (range_->limit_ != split_range::npos && count_ >= range_->limit_) {
+				has_rest_ = false;
+			}
+			if (yielded) {
+				return *this;
+			}
+		}
+		// past the last piece
+		range_ = nullptr;
+		return *this;
+	}
+
+	constexpr split_iterator split_iterator::operator++(int) noexcept {
+		const auto old = *this;
+		++*this;
+		return old;
+	}
+
+	constexpr split_iterator::value_type split_iterator::operator*() const noexcept {
+		return piece_;
+	}
+
+	constexpr bool split_iterator::operator==(std::default_sentinel_t) const noexcept {
+		return range_ == nullptr;
+	}
+
+	constexpr bool split_iterator::operator==(const split_iterator& other) const noexcept {
+		return range_ == other.range_ && (range_ == nullptr || piece_.data() == other.piece_.data());
+	}
+
+	constexpr split_range::split_range(u8string_view view, const searcher& delimiter, bool cull_empty, size_type limit) noexcept
+		: view_(view)
+		, delimiter_(delimiter)
+		, cull_empty_(cull_empty)
+		, limit_(limit) {
+	}
+
+	constexpr split_iterator split_range::begin() const noexcept {
+		return split_iterator(this);
+	}
+
+	constexpr std::default_sentinel_t split_range::end() const noexcept {
+		return std::default_sentinel;
+	}
+}
+
+// grapheme clusters
+namespace u8lib
+{
+	inline grapheme_range u8string_view::graphemes() const noexcept {
+		return grapheme_range(*this);
+	}
+
+	inline u8string_view::size_type u8string_view::grapheme_count() const noexcept {
+		return utf8_grapheme_count(data(), size());
+	}
+
+	inline u8string_view::size_type u8string_view::display_width() const noexcept {
+		return utf8_display_width(data(), size());
+	}
+
+	inline u8string_view u8string_view::truncate_to_width(size_type width) const noexcept {
+		return u8string_view(data(), utf8_width_prefix(data(), size(), width));
+	}
+
+	inline grapheme_iterator::grapheme_iterator(const char8_t* first, const char8_t* last) noexcept
+		: first_(first)
+		, last_(last)
+		, next_(first == last ? last : first + utf8_next_grapheme(first, static_cast<size_t>(last - first), 0)) {
+	}
+
+	inline grapheme_iterator& grapheme_iterator::operator++() noexcept {
+		first_ = next_;
+		if (first_ != last_) {
+			next_ = first_ + utf8_next_grapheme(first_, static_cast<size_t>(last_ - first_), 0);
+		}
+		return *this;
+	}
+
+	inline grapheme_iterator grapheme_iterator::operator++(int) noexcept {
+		const auto old = *this;
+		++*this;
+		return old;
+	}
+
+	constexpr grapheme_iterator::value_type grapheme_iterator::operator*() const noexcept {
+		return {first_, static_cast<size_t>(next_ - first_)};
+	}
+
+	constexpr const char8_t* grapheme_iterator::position() const noexcept {
+		return first_;
+	}
+
+	constexpr bool grapheme_iterator::operator==(std::default_sentinel_t) const noexcept {
+		return first_ == last_;
+	}
+
+	constexpr bool grapheme_iterator::operator==(const grapheme_iterator& other) const noexcept {
+		return first_ == other.first_;
+	}
+
+	constexpr grapheme_range::grapheme_range(u8string_view view) noexcept
+		: view_(view) {
+	}
+
+	inline grapheme_iterator grapheme_range::begin() const noexcept {
+		return {view_.data(), view_.data() + view_.size()};
+	}
+
+	constexpr std::default_sentinel_t grapheme_range::end() const noexcept {
+		return std::default_sentinel;
+	}
 }
 
 // misc
@@ -0,0 +1,61 @@
+#pragma once
+
+// ctor & dtor
+namespace u8lib
+{
+	inline u8text_index::u8text_index(size_type stride) : stride_(stride) {
+		assert(stride > 0 && "stride must be positive");
+	}
+
+	inline u8text_index::u8text_index(u8string_view text, size_type stride) : text_(text), stride_(stride) {
+		assert(stride > 0 && "stride must be positive");
+	}
+}
+
+// build
+namespace u8lib
+{
+	inline void u8text_index::reset(u8string_view text) {
+		text_ = text;
+		text_length_ = 0;
+		samples_.clear();
+	}
+
+	inline void u8text_index::clear() {
+		reset({});
+	}
+
+	inline bool u8text_index::is_built() const noexcept {
+		return !samples_.empty();
+	}
+}
+
+// getter
+namespace u8lib
+{
+	inline u8string_view u8text_index::text() const noexcept {
+		return text_;
+	}
+
+	inline u8text_index::size_type u8text_index::stride() const noexcept {
+		return stride_;
+	}
+}
+
+// lookup
+namespace u8lib
+{
+	inline u8text_index::size_type u8text_index::text_length() const {
+		build();
+		return text_length_;
+	}
+
+	inline UTF8Seq u8text_index::at_text_index(size_type index) const {
+		assert(index < text_length() && "undefined behavior accessing out of text");
+		return text_.at_text(text_index_to_buffer(index));
+	}
+
+	inline UTF8Seq u8text_index::last_text_index(size_type index) const {
+		return at_text_index(text_length() - index - 1);
+	}
+}
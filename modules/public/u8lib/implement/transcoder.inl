@@ -0,0 +1,222 @@
+#pragma once
+
+// transcode
+namespace u8lib
+{
+	template<typename From, typename To>
+	constexpr typename utf_transcoder<From, To>::result utf_transcoder<From, To>::transcode(std::span<const From> input, std::span<To> output) noexcept {
+		const From* in = input.data();
+		const From* const in_end = in + input.size();
+		To* out = output.data();
+		To* const out_end = out + output.size();
+
+		// finish the pending sequence with the head of input
+		if constexpr (!std::is_same_v<From, char32_t>) {
+			if (_pending_size) {
+				char32_t ch;
+				size_type taken;
+				if constexpr (std::is_same_v<From, char8_t>) {
+					char8_t buffer[4];
+					size_type len = _pending_size;
+					std::char_traits<char8_t>::copy(buffer, _pending, len);
+					const size_type extra = std::min<size_type>(4 - len, input.size());
+					std::char_traits<char8_t>::copy(buffer + len, in, extra);
+					len += extra;
+
+					const auto [next, is_usv] = decode_utf(buffer, buffer + len, ch);
+					if (next == buffer + len && !is_usv) {
+						// still cut, input is too short to finish it
+						std::char_traits<char8_t>::copy(_pending, buffer, len);
+						_pending_size = static_cast<uint8_t>(len);
+						return {input.size(), 0};
+					}
+					taken = static_cast<size_type>(next - buffer) - _pending_size;
+				} else {
+					static_assert(std::is_same_v<From, char16_t>, "only utf-8 and utf-16 keep pending code units");
+					if (in == in_end) {
+						return {0, 0};
+					}
+					// an unpaired leading surrogate leaves the next code unit alone
+					const bool paired = utf16_is_trailing_surrogate(*in);
+					ch = paired ? ((_pending[0] & kUtf16SurrogateMask) << 10 | (*in & kUtf16SurrogateMask)) + kSMPBaseCodePoint : 0xFFFD;
+					taken = paired ? 1 : 0;
+				}
+
+				if (!_encode_one(ch, out, out_end)) {
+					return {0, 0};
+				}
+				in += taken;
+				_pending_size = 0;
+			}
+		}
+
+		const From* const complete_end = in_end - _incomplete_tail(in, in_end);
+		while (in != complete_end) {
+			const auto rest = static_cast<size_type>(complete_end - in);
+			size_type count = std::min(rest, static_cast<size_type>(out_end - out) / kMaxExpansion);
+			if (count == rest || count >= kBulkMinSize) {
+				count = count == rest ? count : _adjust_to_boundary(in, count);
+				if (count) {
+					out += _transcode_bulk(in, count, out);
+					in += count;
+					continue;
+				}
+			}
+
+			// output is almost full, go one code point at a time until it is
+			char32_t ch;
+			const From* const next = _decode_one(in, complete_end, ch);
+			if (!_encode_one(ch, out, out_end)) {
+				break;
+			}
+			in = next;
+		}
+
+		if (in == complete_end && complete_end != in_end) {
+			const auto tail = static_cast<size_type>(in_end - complete_end);
+			std::char_traits<From>::copy(_pending, complete_end, tail);
+			_pending_size = static_cast<uint8_t>(tail);
+			in = in_end;
+		}
+		return {static_cast<size_type>(in - input.data()), static_cast<size_type>(out - output.data())};
+	}
+
+	template<typename From, typename To>
+	constexpr typename utf_transcoder<From, To>::size_type utf_transcoder<From, To>::finish(std::span<To> output) noexcept {
+		if (!_pending_size) {
+			return 0;
+		}
+
+		To* out = output.data();
+		if (!_encode_one(0xFFFD, out, out + output.size())) {
+			return 0;
+		}
+		_pending_size = 0;
+		return static_cast<size_type>(out - output.data());
+	}
+}
+
+// state
+namespace u8lib
+{
+	template<typename From, typename To>
+	constexpr bool utf_transcoder<From, To>::has_pending() const noexcept {
+		return _pending_size;
+	}
+
+	template<typename From, typename To>
+	constexpr typename utf_transcoder<From, To>::size_type utf_transcoder<From, To>::pending_size() const noexcept {
+		return _pending_size;
+	}
+
+	template<typename From, typename To>
+	constexpr void utf_transcoder<From, To>::reset() noexcept {
+		_pending_size = 0;
+	}
+}
+
+// helpers
+namespace u8lib
+{
+	template<typename From, typename To>
+	constexpr typename utf_transcoder<From, To>::size_type utf_transcoder<From, To>::_incomplete_tail(const From* first, const From* last) noexcept {
+		if constexpr (std::is_same_v<From, char8_t>) {
+			// only a valid leading byte within the last 3 code units can start a cut sequence
+			for (size_type back = 1; back <= 3 && back <= static_cast<size_type>(last - first); ++back) {
+				const char8_t ch = last[-static_cast<ptrdiff_t>(back)];
+				if (ch < 0x80) {
+					return 0;
+				}
+				if (ch >= 0xC0) {
+					if (internal::utf8_dfa_next(internal::kUtf8Accept, ch) == internal::kUtf8Reject) {
+						return 0;
+					}
+					char32_t value;
+					const auto [next, is_usv] = decode_utf(last - back, last, value);
+					return next == last && !is_usv ? back : 0;
+				}
+			}
+			return 0;
+		} else if constexpr (std::is_same_v<From, char16_t>) {
+			return first != last && utf16_is_leading_surrogate(last[-1]) ? 1 : 0;
+		} else {
+			return 0;
+		}
+	}
+
+	template<typename From, typename To>
+	constexpr typename utf_transcoder<From, To>::size_type utf_transcoder<From, To>::_adjust_to_boundary(const From* first, size_type count) noexcept {
+		if constexpr (std::is_same_v<From, char8_t>) {
+			// a leading byte takes at most 3 trailing bytes, so a 4th trailing byte in a row starts over
+			for (size_type back = 0; back <= 3 && back <= count; ++back) {
+				if ((first[count - back] & 0xC0) != 0x80) {
+					return count - back;
+				}
+			}
+			return count;
+		} else if constexpr (std::is_same_v<From, char16_t>) {
+			return utf16_is_leading_surrogate(first[count - 1]) && utf16_is_trailing_surrogate(first[count]) ? count - 1 : count;
+		} else {
+			return count;
+		}
+	}
+
+	template<typename From, typename To>
+	constexpr typename utf_transcoder<From, To>::size_type utf_transcoder<From, To>::_transcode_bulk(const From* first, size_type count, To* dst) noexcept {
+		if constexpr (std::is_same_v<To, char8_t>) {
+			if constexpr (std::is_same_v<From, char16_t>) {
+				return utf16_to_utf8(first, count, dst);
+			} else {
+				return utf32_to_utf8(first, count, dst);
+			}
+		} else if constexpr (std::is_same_v<From, char8_t>) {
+			if constexpr (std::is_same_v<To, char16_t>) {
+				return utf8_to_utf16(first, count, dst);
+			} else {
+				return utf8_to_utf32(first, count, dst);
+			}
+		} else {
+			// utf-16 <=> utf-32
+			To* const dst_begin = dst;
+			for (const From* last = first + count; first != last;) {
+				char32_t ch;
+				first = _decode_one(first, last, ch);
+				_encode_one(ch, dst, dst + 2);
+			}
+			return static_cast<size_type>(dst - dst_begin);
+		}
+	}
+
+	template<typename From, typename To>
+	constexpr const From* utf_transcoder<From, To>::_decode_one(const From* first, const From* last, char32_t& ch) noexcept {
+		if constexpr (std::is_same_v<From, char8_t>) {
+			return decode_utf(first, last, ch).next_ptr_;
+		} else if constexpr (std::is_same_v<From, char16_t>) {
+			return first + utf16_decode(first, static_cast<size_type>(last - first), 0, ch);
+		} else {
+			ch = is_unicode_scalar_value(*first) ? *first : 0xFFFD;
+			return first + 1;
+		}
+	}
+
+	template<typename From, typename To>
+	constexpr bool utf_transcoder<From, To>::_encode_one(char32_t ch, To*& dst, To* dst_end) noexcept {
+		if constexpr (std::is_same_v<To, char8_t>) {
+			if (static_cast<uint64_t>(dst_end - dst) < utf8_seq_len(ch)) {
+				return false;
+			}
+			dst += utf8_encode(ch, dst);
+		} else if constexpr (std::is_same_v<To, char16_t>) {
+			if (static_cast<uint64_t>(dst_end - dst) < utf16_seq_len(ch)) {
+				return false;
+			}
+			dst += utf16_encode(ch, dst);
+		} else {
+			if (dst == dst_end) {
+				return false;
+			}
+			*dst++ = ch;
+		}
+		return true;
+	}
+}
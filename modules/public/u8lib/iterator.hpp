@@ -3,6 +3,7 @@
 #include "algorithm.hpp"
 #include "container.hpp"
 #include "decode_utf.hpp"
+#include "transcode.hpp"
 
 #include <string>
 #include <iterator>
@@ -303,22 +304,9 @@ namespace u8lib
 		if constexpr (sizeof(Char) == sizeof(char8_t)) {
 			return len;
 		} else if constexpr (sizeof(Char) == sizeof(char16_t)) {
-			// parse utf8 str len
-			size_t utf8_len = 0;
-			for (UTF16Seq utf16_seq: UTF16Cursor<true>{reinterpret_cast<const char16_t*>(str), len, 0}.as_range()) {
-				if (utf16_seq.is_valid()) {
-					utf8_len += utf16_seq.to_utf8_len();
-				} else {
-					utf8_len += 1;
-				}
-			}
-			return utf8_len;
+			return utf16_to_utf8_size(reinterpret_cast<const char16_t*>(str), len);
 		} else if constexpr (sizeof(Char) == sizeof(char32_t)) {
-			size_t utf8_len = 0;
-			for (size_t i = 0; i < len; ++i) {
-				utf8_len += utf8_seq_len(reinterpret_cast<const char32_t*>(str)[i]);
-			}
-			return utf8_len;
+			return utf32_to_utf8_size(reinterpret_cast<const char32_t*>(str), len);
 		} else {
 			return 0;
 		}
@@ -326,32 +314,36 @@ namespace u8lib
 
 	template<is_char_v Char>
 	constexpr size_t text_size(const Char* str) {
-		return text_length(str, std::char_traits<Char>::length(str));
+		return text_size(str, std::char_traits<Char>::length(str));
 	}
 
+	//! @return upper bound of text_size(str, len), lets callers transcode without measuring first
 	template<is_char_v Char>
-	constexpr void parse_to_utf8(const Char* str, size_t len, char8_t* dst) {
+	constexpr size_t max_text_size(size_t len) {
+		if constexpr (sizeof(Char) == sizeof(char8_t)) {
+			return len;
+		} else if constexpr (sizeof(Char) == sizeof(char16_t)) {
+			// a surrogate pair takes 4 bytes for 2 units, every other unit takes at most 3
+			return len * 3;
+		} else if constexpr (sizeof(Char) == sizeof(char32_t)) {
+			return len * 4;
+		} else {
+			return 0;
+		}
+	}
+
+	//! @return byte size written to dst, dst must hold text_size(str, len) or max_text_size<Char>(len) bytes
+	template<is_char_v Char>
+	constexpr size_t parse_to_utf8(const Char* str, size_t len, char8_t* dst) {
 		if constexpr (sizeof(Char) == sizeof(char8_t)) {
 			std::char_traits<char8_t>::copy(dst, reinterpret_cast<const char8_t*>(str), len);
+			return len;
 		} else if constexpr (sizeof(Char) == sizeof(char16_t)) {
-			size_t write_index = 0;
-			for (UTF16Seq utf16_seq: UTF16Cursor<true>{reinterpret_cast<const char16_t*>(str), len, 0}.as_range()) {
-				if (utf16_seq.is_valid()) {
-					UTF8Seq utf8_seq = utf16_seq;
-					std::char_traits<char8_t>::copy(dst + write_index, utf8_seq.data, utf8_seq.len);
-					write_index += utf8_seq.len;
-				} else {
-					std::char_traits<char8_t>::copy(dst + write_index, reinterpret_cast<char8_t*>(&utf16_seq.bad_data), 1);
-					++write_index;
-				}
-			}
+			return utf16_to_utf8(reinterpret_cast<const char16_t*>(str), len, dst);
 		} else if constexpr (sizeof(Char) == sizeof(char32_t)) {
-			size_t write_index = 0;
-			for (size_t i = 0; i < len; ++i) {
-				UTF8Seq utf8_seq = reinterpret_cast<const char32_t*>(str)[i];
-				std::char_traits<char8_t>::copy(dst + write_index, utf8_seq.data, utf8_seq.len);
-				write_index += utf8_seq.len;
-			}
+			return utf32_to_utf8(reinterpret_cast<const char32_t*>(str), len, dst);
+		} else {
+			return 0;
 		}
 	}
 }
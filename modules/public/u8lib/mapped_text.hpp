@@ -0,0 +1,82 @@
+#pragma once
+
+#include "config.hpp"
+#include "string.hpp"
+
+#include <cstdint>
+
+namespace u8lib
+{
+	enum class text_encoding : uint8_t {
+		utf8,
+		utf16le,
+		utf16be,
+		utf32le,
+		utf32be
+	};
+
+	struct bom_info {
+		text_encoding encoding;
+		uint8_t size; // bytes taken by the byte order mark, 0 if there is none
+	};
+
+	// detect the encoding from a leading byte order mark, text without one is taken as utf-8
+	constexpr bom_info sniff_bom(const uint8_t* data, size_t size) noexcept;
+
+	//! @brief read-only memory mapping of a text file, utf-8 content is viewed in place without a copy,
+	//!        utf-16 and utf-32 content is transcoded into an owned u8string on the first text() call
+	//! @note text() of a transcoded file mutates internal state, do not call it concurrently before the first call returned
+	class mapped_text {
+	public:
+		using size_type = size_t;
+
+		//==================> ctor & dtor <==================
+
+		mapped_text() noexcept = default;
+		explicit mapped_text(const char8_t* filename);
+		~mapped_text();
+
+		mapped_text(const mapped_text&) = delete;
+		mapped_text& operator=(const mapped_text&) = delete;
+		U8LIB_API mapped_text(mapped_text&& other) noexcept;
+		U8LIB_API mapped_text& operator=(mapped_text&& other) noexcept;
+
+		//==================> open & close <==================
+
+		// map the whole file, return false if it cannot be opened or mapped
+		U8LIB_API bool open(const char8_t* filename);
+		U8LIB_API void close() noexcept;
+		bool is_open() const noexcept;
+
+		//==================> getter <==================
+
+		text_encoding encoding() const noexcept;
+		// size of the byte order mark, 0 if the file has none
+		size_type bom_size() const noexcept;
+		// raw file content, byte order mark included
+		const uint8_t* bytes() const noexcept;
+		size_type byte_size() const noexcept;
+		// true if text() views the mapping itself
+		bool is_zero_copy() const noexcept;
+		// capacity of the owned transcoded copy, u8string::SSOCapacity if nothing is held on the heap
+		size_type transcoded_capacity() const noexcept;
+
+		//==================> text <==================
+
+		// file content without the byte order mark, transcoded to utf-8 if needed
+		// ill-formed utf-16/utf-32 becomes U+FFFD, an odd trailing byte counts as one ill-formed code unit
+		U8LIB_API u8string_view text() const;
+
+	private:
+		void _transcode() const;
+
+		const uint8_t* data_ = nullptr;
+		size_type size_ = 0;
+		bom_info bom_ = {text_encoding::utf8, 0};
+		bool is_open_ = false;
+		mutable bool transcoded_ = false;
+		mutable u8string text_;
+	};
+}
+
+#include "implement/mapped_text.inl"
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "config.hpp"
+#include "string_view.hpp"
+
+#include <concepts>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace u8lib
+{
+	//! @brief Aho-Corasick automaton over the bytes of a set of patterns, every occurrence of every pattern is found
+	//!        in a single pass over the text
+	//! @note states are numbered breadth first, the shallow ones get a dense transition row of 256 entries and the
+	//!       deeper ones a sorted edge list next to their failure link
+	//! @note a match is only reported if it neither starts on a continuation byte of the text nor is followed by one,
+	//!       so it never cuts a code point of well-formed text. empty patterns never match
+	class multi_searcher {
+	public:
+		using size_type = size_t;
+
+		static constexpr size_type npos = static_cast<size_type>(-1);
+		// depth of the states that get a dense transition row
+		static constexpr size_type kDenseDepth = 2;
+
+		struct match {
+			// index of the pattern in the list the searcher was built from
+			size_type pattern;
+			size_type offset;
+
+			constexpr bool operator==(const match& rhs) const noexcept = default;
+		};
+
+		//==================> ctor & dtor <==================
+
+		multi_searcher() = default;
+		U8LIB_API explicit multi_searcher(std::span<const u8string_view> patterns);
+		multi_searcher(std::initializer_list<u8string_view> patterns);
+
+		//==================> getter <==================
+
+		size_type pattern_count() const noexcept;
+		size_type pattern_size(size_type pattern) const noexcept;
+		size_type state_count() const noexcept;
+
+		//==================> search <==================
+
+		// func(pattern, offset) for every match, ordered by end offset and from the longest pattern on for the same
+		// end, overlapping matches included. if func returns bool, false stops the search
+		// return: matches reported
+		template<std::invocable<size_t, size_t> F>
+		size_type find_each(u8string_view text, F&& func) const;
+		// return: the match starting first, the longest pattern for the same offset
+		std::optional<match> find_first_of_any(u8string_view text) const;
+		// return: every match, see find_each
+		std::vector<match> find_all(u8string_view text) const;
+		bool contains_any(u8string_view text) const;
+
+	private:
+		static constexpr uint32_t kNoState = static_cast<uint32_t>(-1);
+
+		struct state {
+			uint32_t failure = 0;
+			// nearest state on the failure chain, itself included, that ends a pattern
+			uint32_t output = kNoState;
+			// [edge_begin, edge_begin + edge_count) in edge_bytes_ and edge_targets_, sorted by byte
+			uint32_t edge_begin = 0;
+			uint32_t edge_count = 0;
+			// patterns ending exactly here, [pattern_begin, pattern_begin + pattern_count) in state_patterns_
+			uint32_t pattern_begin = 0;
+			uint32_t pattern_count = 0;
+		};
+
+		uint32_t next(uint32_t from, char8_t byte) const noexcept;
+		// neither text[offset] nor text[end] is a continuation byte
+		static bool on_boundaries(u8string_view text, size_type offset, size_type end) noexcept;
+
+		std::vector<state> states_;
+		// dense_states_ rows of 256 transitions, failures already resolved
+		std::vector<uint32_t> dense_;
+		size_type dense_states_ = 0;
+		std::vector<char8_t> edge_bytes_;
+		std::vector<uint32_t> edge_targets_;
+		std::vector<uint32_t> state_patterns_;
+		std::vector<size_type> pattern_sizes_;
+		size_type max_pattern_size_ = 0;
+	};
+}
+
+#include "implement/multi_searcher.inl"
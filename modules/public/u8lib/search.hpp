@@ -0,0 +1,466 @@
+#pragma once
+
+#include "config.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace u8lib
+{
+	//==================> substring search <==================
+	// byte-wise, a well-formed needle is only ever found at code point boundaries of a well-formed seq
+	// return: index of the first occurrence of needle in seq, npos if there is none, an empty needle is found at 0
+	constexpr size_t utf8_find(const char8_t* seq, size_t size, const char8_t* needle, size_t needle_size) noexcept;
+	// return: index of the last occurrence of needle in seq, npos if there is none, an empty needle is found at size
+	constexpr size_t utf8_rfind(const char8_t* seq, size_t size, const char8_t* needle, size_t needle_size) noexcept;
+	// return: non-overlapping occurrences of needle in seq, 0 for an empty needle
+	constexpr size_t utf8_count(const char8_t* seq, size_t size, const char8_t* needle, size_t needle_size) noexcept;
+
+	//==================> byte sets <==================
+	// every byte of set is a member on its own, the way std::u8string_view::find_first_of reads it
+	// return: index of the first byte of seq in set, npos if there is none
+	constexpr size_t utf8_find_first_of(const char8_t* seq, size_t size, const char8_t* set, size_t set_size) noexcept;
+	// return: index of the first byte of seq not in set, npos if there is none
+	constexpr size_t utf8_find_first_not_of(const char8_t* seq, size_t size, const char8_t* set, size_t set_size) noexcept;
+	// return: index of the last byte of seq in set, npos if there is none
+	constexpr size_t utf8_find_last_of(const char8_t* seq, size_t size, const char8_t* set, size_t set_size) noexcept;
+	// return: index of the last byte of seq not in set, npos if there is none
+	constexpr size_t utf8_find_last_not_of(const char8_t* seq, size_t size, const char8_t* set, size_t set_size) noexcept;
+
+	//==================> searcher <==================
+	// a needle preprocessed once and searched in any number of haystacks, the strategy depends on its length:
+	//   1 byte          memchr
+	//   up to 32 bytes  first/last byte filter in vector registers, see utf8_find
+	//   up to 256 bytes Horspool, skips on the byte under the end of the needle
+	//   longer          Two-Way with the same skip, linear in the worst case
+	// the needle is not copied and must outlive the searcher
+	// kReverse searches from the end, every step runs on the mirrored needle and haystack
+	template<bool kReverse>
+	class basic_searcher {
+	public:
+		enum class strategy : uint8_t {
+			empty,
+			byte,
+			filter,
+			horspool,
+			two_way,
+		};
+
+		static constexpr size_t npos = std::u8string_view::npos;
+		static constexpr size_t kFilterMaxSize = 32;
+		static constexpr size_t kHorspoolMaxSize = 256;
+
+		constexpr basic_searcher() noexcept = default;
+		constexpr explicit basic_searcher(std::u8string_view needle) noexcept;
+		constexpr basic_searcher(const char8_t* needle, size_t needle_size) noexcept;
+
+		constexpr std::u8string_view needle() const noexcept { return needle_; }
+		constexpr strategy algorithm() const noexcept { return strategy_; }
+
+		// return: index of the first occurrence in seq, of the last one when kReverse, npos if there is none
+		constexpr size_t find(const char8_t* seq, size_t size) const noexcept;
+		// return: non-overlapping occurrences in seq, 0 for an empty needle
+		constexpr size_t count(const char8_t* seq, size_t size) const noexcept;
+
+	private:
+		// i-th byte of the needle, from the end when kReverse
+		constexpr char8_t needle_at(size_t i) const noexcept;
+		static constexpr char8_t seq_at(const char8_t* seq, size_t size, size_t i) noexcept;
+		// needle bytes [first, last) against the window at pos
+		constexpr bool matches(const char8_t* seq, size_t size, size_t pos, size_t first, size_t last) const noexcept;
+		constexpr void prepare_two_way() noexcept;
+		constexpr size_t horspool_find(const char8_t* seq, size_t size) const noexcept;
+		constexpr size_t two_way_find(const char8_t* seq, size_t size) const noexcept;
+
+		std::u8string_view needle_;
+		strategy strategy_ = strategy::empty;
+		// distance from the last occurrence of a byte to the end of the needle, 0 for the last byte, capped at 255
+		std::array<uint8_t, 256> shift_{};
+		// horspool: shift when the last byte matches but the rest does not
+		size_t last_shift_ = 0;
+		// two-way: critical factorization, period and the prefix known to match after a shift by the period
+		size_t critical_ = 0;
+		size_t period_ = 0;
+		size_t memory_ = 0;
+	};
+
+	using searcher = basic_searcher<false>;
+	using rsearcher = basic_searcher<true>;
+}
+
+namespace u8lib::internal
+{
+	inline constexpr size_t kSearchNpos = std::u8string_view::npos;
+
+	// runtime kernel for needles of 2 bytes or more that fit in seq, candidates matching the first and the last byte
+	// of needle are filtered in vector registers
+	U8LIB_API size_t utf8_find_simd(const char8_t* seq, size_t size, const char8_t* needle, size_t needle_size) noexcept;
+	U8LIB_API size_t utf8_rfind_simd(const char8_t* seq, size_t size, const char8_t* needle, size_t needle_size) noexcept;
+
+	constexpr size_t utf8_find_scalar(const char8_t* seq, size_t size, const char8_t* needle, size_t needle_size) noexcept {
+		return std::u8string_view(seq, size).find(std::u8string_view(needle, needle_size));
+	}
+
+	constexpr size_t utf8_rfind_scalar(const char8_t* seq, size_t size, const char8_t* needle, size_t needle_size) noexcept {
+		return std::u8string_view(seq, size).rfind(std::u8string_view(needle, needle_size));
+	}
+
+	// 256-bit membership, built once per call instead of scanning the set for every byte
+	struct byte_set {
+		std::array<uint64_t, 4> bits{};
+
+		constexpr byte_set() noexcept = default;
+		constexpr byte_set(const char8_t* set, size_t set_size) noexcept {
+			for (size_t i = 0; i < set_size; ++i) {
+				add(set[i]);
+			}
+		}
+
+		constexpr void add(char8_t byte) noexcept {
+			bits[byte >> 6] |= uint64_t{1} << (byte & 63);
+		}
+		constexpr bool contains(char8_t byte) const noexcept {
+			return (bits[byte >> 6] >> (byte & 63)) & 1;
+		}
+		constexpr bool is_ascii() const noexcept {
+			return (bits[2] | bits[3]) == 0;
+		}
+	};
+
+	// runtime kernels for seq of 16 bytes or more, member selects bytes in set or out of it
+	U8LIB_API size_t utf8_find_byte_set_simd(const char8_t* seq, size_t size, const char8_t* set, size_t set_size, bool member) noexcept;
+	U8LIB_API size_t utf8_rfind_byte_set_simd(const char8_t* seq, size_t size, const char8_t* set, size_t set_size, bool member) noexcept;
+
+	constexpr size_t utf8_find_byte_set_scalar(const char8_t* seq, size_t size, const char8_t* set, size_t set_size, bool member) noexcept {
+		const byte_set bytes{set, set_size};
+		for (size_t i = 0; i < size; ++i) {
+			if (bytes.contains(seq[i]) == member) {
+				return i;
+			}
+		}
+		return kSearchNpos;
+	}
+
+	constexpr size_t utf8_rfind_byte_set_scalar(const char8_t* seq, size_t size, const char8_t* set, size_t set_size, bool member) noexcept {
+		const byte_set bytes{set, set_size};
+		for (size_t i = size; i > 0; --i) {
+			if (bytes.contains(seq[i - 1]) == member) {
+				return i - 1;
+			}
+		}
+		return kSearchNpos;
+	}
+
+	constexpr size_t utf8_find_byte_set(const char8_t* seq, size_t size, const char8_t* set, size_t set_size, bool member) noexcept {
+		if !consteval {
+			if (size >= 16) {
+				return utf8_find_byte_set_simd(seq, size, set, set_size, member);
+			}
+		}
+		return utf8_find_byte_set_scalar(seq, size, set, set_size, member);
+	}
+
+	constexpr size_t utf8_rfind_byte_set(const char8_t* seq, size_t size, const char8_t* set, size_t set_size, bool member) noexcept {
+		if !consteval {
+			if (size >= 16) {
+				return utf8_rfind_byte_set_simd(seq, size, set, set_size, member);
+			}
+		}
+		return utf8_rfind_byte_set_scalar(seq, size, set, set_size, member);
+	}
+}
+
+namespace u8lib
+{
+	constexpr size_t utf8_find(const char8_t* seq, size_t size, const char8_t* needle, size_t needle_size) noexcept {
+		if !consteval {
+			if (needle_size >= 2 && needle_size <= size) {
+				return internal::utf8_find_simd(seq, size, needle, needle_size);
+			}
+		}
+		return internal::utf8_find_scalar(seq, size, needle, needle_size);
+	}
+
+	constexpr size_t utf8_rfind(const char8_t* seq, size_t size, const char8_t* needle, size_t needle_size) noexcept {
+		if !consteval {
+			if (needle_size >= 2 && needle_size <= size) {
+				return internal::utf8_rfind_simd(seq, size, needle, needle_size);
+			}
+		}
+		return internal::utf8_rfind_scalar(seq, size, needle, needle_size);
+	}
+
+	constexpr size_t utf8_find_first_of(const char8_t* seq, size_t size, const char8_t* set, size_t set_size) noexcept {
+		// a single byte is memchr
+		if (set_size == 1) {
+			return std::u8string_view(seq, size).find(set[0]);
+		}
+		return internal::utf8_find_byte_set(seq, size, set, set_size, true);
+	}
+
+	constexpr size_t utf8_find_first_not_of(const char8_t* seq, size_t size, const char8_t* set, size_t set_size) noexcept {
+		return internal::utf8_find_byte_set(seq, size, set, set_size, false);
+	}
+
+	constexpr size_t utf8_find_last_of(const char8_t* seq, size_t size, const char8_t* set, size_t set_size) noexcept {
+		if (set_size == 1) {
+			return std::u8string_view(seq, size).rfind(set[0]);
+		}
+		return internal::utf8_rfind_byte_set(seq, size, set, set_size, true);
+	}
+
+	constexpr size_t utf8_find_last_not_of(const char8_t* seq, size_t size, const char8_t* set, size_t set_size) noexcept {
+		return internal::utf8_rfind_byte_set(seq, size, set, set_size, false);
+	}
+
+	constexpr size_t utf8_count(const char8_t* seq, size_t size, const char8_t* needle, size_t needle_size) noexcept {
+		if (needle_size == 0) {
+			return 0;
+		}
+		size_t result = 0;
+		for (size_t i = 0; needle_size <= size - i; ++result) {
+			const size_t index = utf8_find(seq + i, size - i, needle, needle_size);
+			if (index == internal::kSearchNpos) {
+				break;
+			}
+			i += index + needle_size;
+		}
+		return result;
+	}
+}
+
+// searcher
+namespace u8lib
+{
+	template<bool kReverse>
+	constexpr basic_searcher<kReverse>::basic_searcher(std::u8string_view needle) noexcept
+		: needle_(needle) {
+		const size_t size = needle_.size();
+		if (size == 0) {
+			strategy_ = strategy::empty;
+			return;
+		}
+		if (size == 1) {
+			strategy_ = strategy::byte;
+			return;
+		}
+		if (size <= kFilterMaxSize) {
+			strategy_ = strategy::filter;
+			return;
+		}
+
+		shift_.fill(static_cast<uint8_t>(size < 255 ? size : 255));
+		for (size_t i = 0; i < size; ++i) {
+			const size_t distance = size - 1 - i;
+			shift_[needle_at(i)] = static_cast<uint8_t>(distance < 255 ? distance : 255);
+		}
+		if (size <= kHorspoolMaxSize) {
+			strategy_ = strategy::horspool;
+			last_shift_ = size;
+			for (size_t i = 0; i + 1 < size; ++i) {
+				if (needle_at(i) == needle_at(size - 1)) {
+					last_shift_ = size - 1 - i;
+				}
+			}
+		} else {
+			strategy_ = strategy::two_way;
+			prepare_two_way();
+		}
+	}
+
+	template<bool kReverse>
+	constexpr basic_searcher<kReverse>::basic_searcher(const char8_t* needle, size_t needle_size) noexcept
+		: basic_searcher(std::u8string_view(needle, needle_size)) {
+	}
+
+	template<bool kReverse>
+	constexpr size_t basic_searcher<kReverse>::find(const char8_t* seq, size_t size) const noexcept {
+		size_t index = npos;
+		switch (strategy_) {
+			case strategy::empty:
+				return kReverse ? size : 0;
+			case strategy::byte:
+				if constexpr (kReverse) {
+					return std::u8string_view(seq, size).rfind(needle_[0]);
+				} else {
+					return std::u8string_view(seq, size).find(needle_[0]);
+				}
+			case strategy::filter:
+				if constexpr (kReverse) {
+					return utf8_rfind(seq, size, needle_.data(), needle_.size());
+				} else {
+					return utf8_find(seq, size, needle_.data(), needle_.size());
+				}
+			case strategy::horspool:
+				index = horspool_find(seq, size);
+				break;
+			case strategy::two_way:
+				index = two_way_find(seq, size);
+				break;
+		}
+		if constexpr (kReverse) {
+			// back from the mirrored haystack
+			if (index != npos) {
+				index = size - needle_.size() - index;
+			}
+		}
+		return index;
+	}
+
+	template<bool kReverse>
+	constexpr size_t basic_searcher<kReverse>::count(const char8_t* seq, size_t size) const noexcept {
+		if (needle_.empty()) {
+			return 0;
+		}
+		size_t result = 0;
+		for (size_t index = find(seq, size); index != npos; index = find(seq, size)) {
+			++result;
+			if constexpr (kReverse) {
+				size = index;
+			} else {
+				seq += index + needle_.size();
+				size -= index + needle_.size();
+			}
+		}
+		return result;
+	}
+
+	template<bool kReverse>
+	constexpr char8_t basic_searcher<kReverse>::needle_at(size_t i) const noexcept {
+		if constexpr (kReverse) {
+			return needle_[needle_.size() - 1 - i];
+		} else {
+			return needle_[i];
+		}
+	}
+
+	template<bool kReverse>
+	constexpr char8_t basic_searcher<kReverse>::seq_at(const char8_t* seq, size_t size, size_t i) noexcept {
+		if constexpr (kReverse) {
+			return seq[size - 1 - i];
+		} else {
+			return seq[i];
+		}
+	}
+
+	template<bool kReverse>
+	constexpr bool basic_searcher<kReverse>::matches(const char8_t* seq, size_t size, size_t pos, size_t first, size_t last) const noexcept {
+		const size_t count = last - first;
+		if constexpr (kReverse) {
+			// both ranges are contiguous once mirrored back
+			pos = size - pos - needle_.size();
+			first = needle_.size() - last;
+		}
+		return std::char_traits<char8_t>::compare(seq + pos + first, needle_.data() + first, count) == 0;
+	}
+
+	// Crochemore-Perrin, the critical position is the later start of the maximal suffixes for both byte orders
+	template<bool kReverse>
+	constexpr void basic_searcher<kReverse>::prepare_two_way() noexcept {
+		const size_t size = needle_.size();
+		auto maximal_suffix = [&](bool greater, size_t& period) {
+			// starts at npos + 1, that is 0
+			size_t suffix = npos;
+			size_t candidate = 0;
+			size_t offset = 1;
+			period = 1;
+			while (candidate + offset < size) {
+				const char8_t a = needle_at(suffix + offset);
+				const char8_t b = needle_at(candidate + offset);
+				if (a == b) {
+					if (offset == period) {
+						candidate += period;
+						offset = 1;
+					} else {
+						++offset;
+					}
+				} else if (greater ? a > b : a < b) {
+					candidate += offset;
+					offset = 1;
+					period = candidate - suffix;
+				} else {
+					suffix = candidate++;
+					offset = 1;
+					period = 1;
+				}
+			}
+			return suffix + 1;
+		};
+
+		size_t less_period = 0;
+		size_t greater_period = 0;
+		const size_t less_start = maximal_suffix(false, less_period);
+		const size_t greater_start = maximal_suffix(true, greater_period);
+		critical_ = greater_start >= less_start ? greater_start : less_start;
+		period_ = greater_start >= less_start ? greater_period : less_period;
+
+		// a periodic needle keeps the prefix that still matches after a shift by the period
+		bool periodic = true;
+		for (size_t i = 0; i < critical_; ++i) {
+			if (needle_at(i) != needle_at(i + period_)) {
+				periodic = false;
+				break;
+			}
+		}
+		if (periodic) {
+			memory_ = size - period_;
+		} else {
+			memory_ = 0;
+			period_ = critical_ > size - critical_ + 1 ? critical_ : size - critical_ + 1;
+		}
+	}
+
+	template<bool kReverse>
+	constexpr size_t basic_searcher<kReverse>::horspool_find(const char8_t* seq, size_t size) const noexcept {
+		const size_t last = needle_.size() - 1;
+		for (size_t pos = 0; pos + last < size;) {
+			const size_t shift = shift_[seq_at(seq, size, pos + last)];
+			if (shift != 0) {
+				pos += shift;
+			} else if (matches(seq, size, pos, 0, last)) {
+				return pos;
+			} else {
+				pos += last_shift_;
+			}
+		}
+		return npos;
+	}
+
+	template<bool kReverse>
+	constexpr size_t basic_searcher<kReverse>::two_way_find(const char8_t* seq, size_t size) const noexcept {
+		const size_t needle_size = needle_.size();
+		size_t memory = 0;
+		for (size_t pos = 0; pos + needle_size <= size;) {
+			if (const size_t shift = shift_[seq_at(seq, size, pos + needle_size - 1)]; shift != 0) {
+				pos += shift > memory ? shift : memory;
+				memory = 0;
+				continue;
+			}
+
+			// right half, from the critical position on
+			size_t i = critical_ > memory ? critical_ : memory;
+			while (i < needle_size && needle_at(i) == seq_at(seq, size, pos + i)) {
+				++i;
+			}
+			if (i < needle_size) {
+				pos += i - critical_ + 1;
+				memory = 0;
+				continue;
+			}
+
+			// left half, down to what the last shift kept
+			i = critical_;
+			while (i > memory && needle_at(i - 1) == seq_at(seq, size, pos + i - 1)) {
+				--i;
+			}
+			if (i <= memory) {
+				return pos;
+			}
+			pos += period_;
+			memory = memory_;
+		}
+		return npos;
+	}
+}
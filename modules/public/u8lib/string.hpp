@@ -48,13 +48,21 @@ namespace u8lib
 
 		static_assert(SSOBufferSize % 4 == 0, "SSOSize must be 4n - 1");
 		static_assert(SSOBufferSize > sizeof(size_type) * 2 + sizeof(pointer), "SSOSize must be larger than heap data size");
-		static_assert(SSOBufferSize < 128, "SSOBufferSize must be less than 127"); // sso_size_ max
+		static_assert(SSOBufferSize < 64, "SSOBufferSize must be less than 63"); // sso_size_ max
 
 		//==================> join <==================
 
 		template<typename... Args> static u8string concat(Args&&... string_or_view);
 		template<typename Container> static u8string join(const Container& container, u8string_view separator, bool skip_empty = true, u8string_view trim_chs = {});
 
+		//==================> 8-bit encodings <==================
+
+		// every byte is one code point, bytes 0x80-0x9F of windows-1252 map through internal::kCp1252C1Table
+		U8LIB_API static u8string from_latin1(const char* str, size_type count);
+		U8LIB_API static u8string from_cp1252(const char* str, size_type count);
+		static u8string from_latin1(std::string_view str);
+		static u8string from_cp1252(std::string_view str);
+
 		//==================> ctor & dtor <==================
 
 		U8LIB_API u8string();
@@ -161,6 +169,15 @@ namespace u8lib
 		size_type max_size() const noexcept;
 		template<is_char_v Char> size_type to_size() const noexcept;
 
+		//==================> convert <==================
+
+		size_type to_utf16(std::span<char16_t> out) const noexcept;
+		size_type to_utf32(std::span<char32_t> out) const noexcept;
+		std::u16string to_utf16() const;
+		std::u32string to_utf32() const;
+		size_type to_latin1(std::span<char> out, char replacement = '?') const noexcept;
+		std::string to_latin1(char replacement = '?') const;
+
 		//==================> data access <==================
 
 		reference at(size_type pos);
@@ -190,6 +207,9 @@ namespace u8lib
 		UTF8Seq last_text(size_type index) const;
 		bool is_sso() const noexcept;
 		bool is_heap() const noexcept;
+		// every code unit is known to be ascii, text operations then work on code units directly
+		// writable access (data(), operator[], begin(), ...) drops the knowledge, cursors and ranges only read and keep it
+		bool is_ascii() const noexcept;
 		bool is_valid_index(size_type index) const noexcept;
 		size_type buffer_index_to_text(size_type index) const noexcept;
 		size_type text_index_to_buffer(size_type index) const noexcept;
@@ -369,6 +389,41 @@ namespace u8lib
 		u8string TrimInvalidStart() const;
 		u8string TrimInvalidEnd() const;
 
+		//==================> validate <==================
+
+		bool is_valid_utf8() const noexcept;
+		size_type validate_utf8() const noexcept;
+		// replace every maximal ill-formed subpart with U+FFFD, valid text is left untouched without allocating
+		U8LIB_API u8string& sanitize();
+
+		//==================> normalization <==================
+
+		bool is_normalized(normalization_form form = normalization_form::nfc) const;
+		// text already in form is left untouched without allocating
+		U8LIB_API u8string& normalize(normalization_form form = normalization_form::nfc);
+
+		//==================> case mapping <==================
+
+		// ascii text is mapped in place, see utf8_to_lower and utf8_case_fold for the rest
+		U8LIB_API u8string& to_lower();
+		U8LIB_API u8string& to_upper();
+		U8LIB_API u8string& case_fold();
+
+		u8string ToLower() const;
+		u8string ToUpper() const;
+		u8string CaseFold() const;
+
+		//==================> grapheme clusters <==================
+
+		grapheme_range graphemes() const noexcept;
+		size_type grapheme_count() const noexcept;
+
+		//==================> display width <==================
+
+		size_type display_width() const noexcept;
+		// keep the longest prefix taking at most width columns
+		u8string& truncate_to_width(size_type width);
+
 		//==================> split <==================
 
 		template<internal::CanAdd<u8string_view> Buffer>
@@ -383,6 +438,10 @@ namespace u8lib
 		template<std::invocable<u8string_view> F>
 		size_type split_each(F&& func, UTF8Seq delimiter, bool cull_empty = false, size_type limit = npos) const;
 
+		// see u8string_view::split_view
+		split_range split_view(u8string_view delimiter, bool cull_empty = false, size_type limit = npos) const noexcept;
+		split_range split_view(const searcher& delimiter, bool cull_empty = false, size_type limit = npos) const noexcept;
+
 		//==================> misc <==================
 
 		U8LIB_API void reserve(size_type new_cap);
@@ -396,6 +455,9 @@ namespace u8lib
 	private:
 		friend struct StringHelper;
 
+		// data() for the cursors, which never write through it, so the ascii flag is kept
+		pointer _cursor_data() noexcept;
+
 		union {
 			struct {
 				pointer data_;
@@ -406,7 +468,8 @@ namespace u8lib
 			struct {
 				value_type sso_data_[SSOSize];
 				uint8_t sso_flag_: 1;
-				uint8_t sso_size_: 7;
+				uint8_t ascii_flag_: 1; // also valid in heap mode, the heap data never reaches the last byte
+				uint8_t sso_size_: 6;
 			};
 
 			uint8_t buffer_[SSOBufferSize];
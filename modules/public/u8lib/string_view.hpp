@@ -4,9 +4,19 @@
 
 #include "base.hpp"
 #include "iterator.hpp"
+#include "search.hpp"
+#include "transcode.hpp"
+#include "unicode.hpp"
+
+#include <ranges>
+#include <span>
 
 namespace u8lib
 {
+	class u8string;
+	class grapheme_range;
+	class split_range;
+
 	/*!
 	 * @note
 	 *		1.Not support constexpr char operation \n
@@ -107,6 +117,18 @@ namespace u8lib
 		constexpr size_type max_size() const noexcept;
 		template<is_char_v Char> constexpr size_type to_size() const noexcept;
 
+		//==================> convert <==================
+
+		// ill-formed subparts are written as U+FFFD, to_size<Char>() gives the required size
+		// return: code units written, stops before the first code point that doesn't fit in out
+		constexpr size_type to_utf16(std::span<char16_t> out) const noexcept;
+		constexpr size_type to_utf32(std::span<char32_t> out) const noexcept;
+		constexpr std::u16string to_utf16() const;
+		constexpr std::u32string to_utf32() const;
+		// code points above U+00FF are written as replacement too, one code unit per code point
+		constexpr size_type to_latin1(std::span<char> out, char replacement = '?') const noexcept;
+		constexpr std::string to_latin1(char replacement = '?') const;
+
 		//==================> data access <==================
 
 		constexpr const_reference at(size_type pos) const;
@@ -167,9 +189,11 @@ namespace u8lib
 		constexpr bool contains(u8string_view sv) const noexcept;
 		constexpr bool contains(value_type ch) const noexcept;
 		constexpr bool contains(UTF8Seq seq) const;
+		constexpr bool contains(const searcher& pattern) const noexcept;
 
 		constexpr size_type count(u8string_view pattern) const;
 		constexpr size_type count(UTF8Seq seq) const;
+		constexpr size_type count(const searcher& pattern) const noexcept;
 
 		//==================> find <==================
 
@@ -177,6 +201,7 @@ namespace u8lib
 		constexpr const_data_reference find(value_type ch, size_type pos = 0) const noexcept;
 		constexpr const_data_reference find(UTF8Seq pattern, size_type pos = 0) const;
 		constexpr const_data_reference find(const_pointer s, size_type pos, size_type count) const;
+		constexpr const_data_reference find(const searcher& pattern, size_type pos = 0) const noexcept;
 
 		constexpr const_data_reference find_first_of(u8string_view v, size_type pos = 0) const noexcept;
 		constexpr const_data_reference find_first_of(value_type ch, size_type pos = 0) const noexcept;
@@ -192,6 +217,7 @@ namespace u8lib
 		constexpr const_data_reference rfind(value_type ch, size_type pos = npos) const noexcept;
 		constexpr const_data_reference rfind(UTF8Seq pattern, size_type pos = npos) const;
 		constexpr const_data_reference rfind(const_pointer s, size_type pos, size_type count) const;
+		constexpr const_data_reference rfind(const rsearcher& pattern, size_type pos = npos) const noexcept;
 
 		constexpr const_data_reference find_last_of(u8string_view v, size_type pos = npos) const noexcept;
 		constexpr const_data_reference find_last_of(value_type ch, size_type pos = npos) const noexcept;
@@ -207,6 +233,7 @@ namespace u8lib
 
 		constexpr std::array<u8string_view, 3> partition(u8string_view delimiter) const;
 		constexpr std::array<u8string_view, 3> partition(UTF8Seq delimiter) const;
+		constexpr std::array<u8string_view, 3> partition(const searcher& delimiter) const;
 
 		//==================> trim <==================
 
@@ -220,6 +247,42 @@ namespace u8lib
 		constexpr u8string_view trim_invalid_start() const;
 		constexpr u8string_view trim_invalid_end() const;
 
+		//==================> validate <==================
+
+		constexpr bool is_valid_utf8() const noexcept;
+		// return: index of the first code unit that is not part of a well-formed sequence, npos if the view is valid
+		constexpr size_type validate_utf8() const noexcept;
+		// copy with every maximal ill-formed subpart replaced by U+FFFD, the same way decode_utf reports them
+		u8string sanitized() const;
+
+		//==================> normalization <==================
+
+		// quick check first, see utf8_is_normalized
+		bool is_normalized(normalization_form form = normalization_form::nfc) const;
+		// copy in form, every maximal ill-formed subpart is replaced by U+FFFD
+		u8string normalized(normalization_form form = normalization_form::nfc) const;
+
+		//==================> case mapping <==================
+
+		// copies with the simple case mappings applied, see utf8_to_lower
+		u8string to_lower() const;
+		u8string to_upper() const;
+		// copy with the full case folding applied, see utf8_case_fold
+		u8string case_fold() const;
+
+		//==================> grapheme clusters <==================
+
+		// extended grapheme clusters of UAX #29 as subviews, see utf8_next_grapheme
+		grapheme_range graphemes() const noexcept;
+		size_type grapheme_count() const noexcept;
+
+		//==================> display width <==================
+
+		// columns the view takes in a terminal, see utf8_display_width
+		size_type display_width() const noexcept;
+		// return: the longest prefix taking at most width columns, grapheme clusters are never split
+		u8string_view truncate_to_width(size_type width) const noexcept;
+
 		//==================> split <==================
 
 		template<internal::CanAdd<u8string_view> Buffer>
@@ -234,15 +297,123 @@ namespace u8lib
 		template<std::invocable<u8string_view> F>
 		constexpr size_type split_each(F&& func, UTF8Seq delimiter, bool cull_empty = false, size_type limit = npos) const;
 
+		template<internal::CanAdd<u8string_view> Buffer>
+		constexpr size_type split(Buffer& out, const searcher& delimiter, bool cull_empty = false, size_type limit = npos) const;
+
+		template<std::invocable<u8string_view> F>
+		constexpr size_type split_each(F&& func, const searcher& delimiter, bool cull_empty = false, size_type limit = npos) const;
+
+		// lazy range of the pieces split_each yields, the delimiter is not copied and an empty one never matches
+		constexpr split_range split_view(u8string_view delimiter, bool cull_empty = false, size_type limit = npos) const noexcept;
+		constexpr split_range split_view(const searcher& delimiter, bool cull_empty = false, size_type limit = npos) const noexcept;
+
 		//==================> misc <==================
 
 		constexpr void swap(u8string_view& v) noexcept;
 		constexpr size_type copy(pointer dest, size_type count, size_type pos = 0) const;
 
 	private:
+		// shared by the delimiter overloads, Delimiter is anything partition takes
+		template<typename Delimiter, typename Buffer>
+		constexpr size_type split_impl(Buffer& out, const Delimiter& delimiter, bool cull_empty, size_type limit) const;
+		template<typename Delimiter, typename F>
+		constexpr size_type split_each_impl(F&& func, const Delimiter& delimiter, bool cull_empty, size_type limit) const;
+
 		std::u8string_view data_;
 	};
 
+	//! @brief forward iterator over the extended grapheme clusters of a view
+	class grapheme_iterator {
+	public:
+		using value_type = u8string_view;
+		using difference_type = ptrdiff_t;
+
+		constexpr grapheme_iterator() = default;
+		grapheme_iterator(const char8_t* first, const char8_t* last) noexcept;
+
+		grapheme_iterator& operator++() noexcept;
+		grapheme_iterator operator++(int) noexcept;
+		constexpr value_type operator*() const noexcept;
+		constexpr const char8_t* position() const noexcept;
+
+		constexpr bool operator==(std::default_sentinel_t) const noexcept;
+		constexpr bool operator==(const grapheme_iterator& other) const noexcept;
+
+	private:
+		const char8_t* first_ = nullptr;
+		const char8_t* last_ = nullptr;
+		// end of the cluster starting at first_
+		const char8_t* next_ = nullptr;
+	};
+
+	class grapheme_range {
+	public:
+		constexpr grapheme_range() = default;
+		constexpr explicit grapheme_range(u8string_view view) noexcept;
+
+		grapheme_iterator begin() const noexcept;
+		constexpr std::default_sentinel_t end() const noexcept;
+
+	private:
+		u8string_view view_;
+	};
+
+	//! @brief forward iterator over the pieces of a split_range, refers to its range
+	class split_iterator {
+	public:
+		using value_type = u8string_view;
+		using difference_type = ptrdiff_t;
+		using iterator_concept = std::forward_iterator_tag;
+
+		constexpr split_iterator() = default;
+		constexpr explicit split_iterator(const split_range* range) noexcept;
+
+		constexpr split_iterator& operator++() noexcept;
+		constexpr split_iterator operator++(int) noexcept;
+		constexpr value_type operator*() const noexcept;
+
+		constexpr bool operator==(std::default_sentinel_t) const noexcept;
+		constexpr bool operator==(const split_iterator& other) const noexcept;
+
+	private:
+		const split_range* range_ = nullptr;
+		u8string_view piece_;
+		// text after the delimiter that ended piece_, has_rest_ is false once piece_ is the last one
+		const char8_t* rest_ = nullptr;
+		size_t rest_size_ = 0;
+		bool has_rest_ = false;
+		size_t count_ = 0;
+	};
+
+	//! @brief the pieces of a view split by a delimiter, found one at a time with a searcher prepared once, so nothing
+	//!        is allocated and single-byte delimiters go through memchr
+	class split_range : public std::ranges::view_interface<split_range> {
+	public:
+		using size_type = size_t;
+
+		static constexpr size_type npos = static_cast<size_type>(-1);
+
+		constexpr split_range() = default;
+		constexpr split_range(u8string_view view, const searcher& delimiter, bool cull_empty = false, size_type limit = npos) noexcept;
+
+		constexpr split_iterator begin() const noexcept;
+		constexpr std::default_sentinel_t end() const noexcept;
+
+	private:
+		friend class split_iterator;
+
+		u8string_view view_;
+		searcher delimiter_;
+		bool cull_empty_ = false;
+		size_type limit_ = npos;
+	};
+
+	// view of a u8, u, U or L string literal transcoded to utf-8 at compile time, into a static null terminated array.
+	// ill-formed code units become U+FFFD like at runtime
+	// usage: constexpr u8string_view message = literal<L"file not found">;
+	template<internal::literal_source Source>
+	inline constexpr u8string_view literal{internal::kUtf8Literal<Source>.data, internal::kUtf8Literal<Source>.size};
+
 	template<>
 	struct formatter<u8string_view> : formatter<std::u8string_view> {
 		using base = formatter<std::u8string_view>;
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "config.hpp"
+#include "string_view.hpp"
+
+#include <vector>
+
+namespace u8lib
+{
+	//! @brief samples the buffer offset of every stride-th code point of a text, so that conversions between
+	//!        text index and buffer index walk at most stride code points instead of the whole text
+	//! @note the index refers to the viewed text, call reset() after the text is mutated or reallocated
+	//! @note samples are built lazily by the first lookup, so const lookups mutate the index and an index shared
+	//!       between threads needs external synchronization unless build() was called before sharing it
+	class u8text_index {
+	public:
+		using size_type = size_t;
+
+		static constexpr size_type kDefaultStride = 128;
+
+		//==================> ctor & dtor <==================
+
+		explicit u8text_index(size_type stride = kDefaultStride);
+		explicit u8text_index(u8string_view text, size_type stride = kDefaultStride);
+
+		//==================> build <==================
+
+		// drop samples and refer to text, samples are rebuilt on next lookup
+		void reset(u8string_view text);
+		// drop samples and the text
+		void clear();
+		// build samples if not built yet, lookups call it on demand. not thread safe, see the class note
+		U8LIB_API void build() const;
+		bool is_built() const noexcept;
+
+		//==================> getter <==================
+
+		u8string_view text() const noexcept;
+		size_type stride() const noexcept;
+
+		//==================> lookup <==================
+
+		// same as u8string_view::text_length()
+		size_type text_length() const;
+		// same as u8string_view::buffer_index_to_text()
+		U8LIB_API size_type buffer_index_to_text(size_type index) const;
+		// same as u8string_view::text_index_to_buffer()
+		U8LIB_API size_type text_index_to_buffer(size_type index) const;
+		// sequence of the index-th code point
+		UTF8Seq at_text_index(size_type index) const;
+		// sequence of the index-th code point from the end
+		UTF8Seq last_text_index(size_type index) const;
+
+	private:
+		u8string_view text_;
+		size_type stride_;
+		mutable size_type text_length_ = 0;
+		// samples_[i] is the buffer offset of code point i * stride_, empty if not built
+		mutable std::vector<size_type> samples_;
+	};
+}
+
+#include "implement/text_index.inl"
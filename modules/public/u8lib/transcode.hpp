@@ -0,0 +1,621 @@
+#pragma once
+
+#include "config.hpp"
+#include "algorithm.hpp"
+#include "decode_utf.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace u8lib
+{
+	//==================> utf-8 <==================
+	// return: length of the longest ascii prefix, equals size if every code unit is ascii
+	constexpr size_t utf8_ascii_prefix(const char8_t* seq, size_t size) noexcept;
+	// return: whether every code unit is ascii
+	constexpr bool utf8_is_ascii(const char8_t* seq, size_t size) noexcept;
+	// return: length of the longest well-formed utf-8 prefix, equals size if the whole sequence is valid
+	constexpr size_t utf8_validate(const char8_t* seq, size_t size) noexcept;
+	// return: whether the whole sequence is well-formed utf-8
+	constexpr bool utf8_is_valid(const char8_t* seq, size_t size) noexcept;
+	// return: size of seq with every maximal ill-formed subpart replaced by U+FFFD, equals size if seq is valid
+	constexpr size_t utf8_sanitized_size(const char8_t* seq, size_t size) noexcept;
+	// dst must hold utf8_sanitized_size(seq, size) code units, or 3 * size to sanitize in a single pass without sizing
+	// first, return: code units written to dst
+	constexpr size_t utf8_sanitize(const char8_t* seq, size_t size, char8_t* dst) noexcept;
+	// ch must be a unicode scalar value, return: code units written to dst (1-4)
+	constexpr size_t utf8_encode(char32_t ch, char8_t* dst) noexcept;
+	// return: utf-16 size of seq, every maximal ill-formed subpart is counted as U+FFFD
+	constexpr size_t utf8_to_utf16_size(const char8_t* seq, size_t size) noexcept;
+	// dst must hold utf8_to_utf16_size(seq, size) code units, return: code units written to dst
+	constexpr size_t utf8_to_utf16(const char8_t* seq, size_t size, char16_t* dst) noexcept;
+	// return: code points in seq, every maximal ill-formed subpart is counted as U+FFFD
+	constexpr size_t utf8_to_utf32_size(const char8_t* seq, size_t size) noexcept;
+	// dst must hold utf8_to_utf32_size(seq, size) code units, return: code units written to dst
+	constexpr size_t utf8_to_utf32(const char8_t* seq, size_t size, char32_t* dst) noexcept;
+	// step from index like UTF8Cursor (an ill-formed code unit counts as one code point), until index reaches end or
+	// max_count code points are passed, return: code points passed, index is left at the head of the next one
+	constexpr size_t utf8_walk(const char8_t* seq, size_t size, size_t end, size_t max_count, size_t& index) noexcept;
+	// return: code points in seq, stepping like UTF8Cursor
+	constexpr size_t utf8_text_length(const char8_t* seq, size_t size) noexcept;
+	// index < size, return: index of the code point that seq[index] belongs to
+	constexpr size_t utf8_buffer_index_to_text(const char8_t* seq, size_t size, size_t index) noexcept;
+	// index <= utf8_text_length(seq, size), return: code unit offset of the index-th code point
+	constexpr size_t utf8_text_index_to_buffer(const char8_t* seq, size_t size, size_t index) noexcept;
+
+	//==================> utf-16 <==================
+	// decode the code point at seq[index], unpaired surrogates decode to U+FFFD
+	// return: index of the next code point
+	constexpr size_t utf16_decode(const char16_t* seq, size_t size, size_t index, char32_t& value) noexcept;
+	// ch must be a unicode scalar value, return: code units written to dst (1-2)
+	constexpr size_t utf16_encode(char32_t ch, char16_t* dst) noexcept;
+	// return: length of the longest prefix without unpaired surrogates, equals size if the whole sequence is valid
+	constexpr size_t utf16_validate(const char16_t* seq, size_t size) noexcept;
+	// return: whether seq has no unpaired surrogate
+	constexpr bool utf16_is_valid(const char16_t* seq, size_t size) noexcept;
+	// copy seq to dst (which may be seq) with every unpaired surrogate replaced by U+FFFD, so that wtf-16 becomes
+	// utf-16 of the same size, return: code units written to dst
+	constexpr size_t utf16_sanitize(const char16_t* seq, size_t size, char16_t* dst) noexcept;
+	// return: utf-8 size of seq, unpaired surrogates are counted as U+FFFD
+	constexpr size_t utf16_to_utf8_size(const char16_t* seq, size_t size) noexcept;
+	// dst must hold utf16_to_utf8_size(seq, size) code units, return: code units written to dst
+	constexpr size_t utf16_to_utf8(const char16_t* seq, size_t size, char8_t* dst) noexcept;
+
+	//==================> utf-32 <==================
+	// is ch a code point outside the surrogate range
+	constexpr bool is_unicode_scalar_value(char32_t ch) noexcept;
+	// return: utf-8 size of seq, surrogates and values above U+10FFFF are counted as U+FFFD
+	constexpr size_t utf32_to_utf8_size(const char32_t* seq, size_t size) noexcept;
+	// dst must hold utf32_to_utf8_size(seq, size) code units, return: code units written to dst
+	constexpr size_t utf32_to_utf8(const char32_t* seq, size_t size, char8_t* dst) noexcept;
+
+	//==================> latin-1 <==================
+	// return: utf-8 size of seq, every byte above 0x7F takes 2 code units
+	constexpr size_t latin1_to_utf8_size(const char* seq, size_t size) noexcept;
+	// dst must hold latin1_to_utf8_size(seq, size) code units, return: code units written to dst
+	constexpr size_t latin1_to_utf8(const char* seq, size_t size, char8_t* dst) noexcept;
+	// code points above U+00FF and maximal ill-formed subparts are written as replacement
+	// dst must hold utf8_to_utf32_size(seq, size) (at most size) code units, return: code units written to dst
+	constexpr size_t utf8_to_latin1(const char8_t* seq, size_t size, char* dst, char replacement = '?') noexcept;
+
+	//==================> windows-1252 <==================
+	// return: utf-8 size of seq, bytes 0x80-0x9F take 2 or 3 code units, see internal::kCp1252C1Table
+	constexpr size_t cp1252_to_utf8_size(const char* seq, size_t size) noexcept;
+	// dst must hold cp1252_to_utf8_size(seq, size) code units, return: code units written to dst
+	constexpr size_t cp1252_to_utf8(const char* seq, size_t size, char8_t* dst) noexcept;
+}
+
+namespace u8lib::internal
+{
+	// runtime kernels, dispatched to the widest instruction set the library was built with
+	U8LIB_API size_t utf8_ascii_prefix_simd(const char8_t* seq, size_t size) noexcept;
+	U8LIB_API size_t utf8_validate_simd(const char8_t* seq, size_t size) noexcept;
+	U8LIB_API size_t utf8_to_utf16_size_simd(const char8_t* seq, size_t size) noexcept;
+	U8LIB_API size_t utf8_to_utf16_simd(const char8_t* seq, size_t size, char16_t* dst) noexcept;
+	U8LIB_API size_t utf8_to_utf32_size_simd(const char8_t* seq, size_t size) noexcept;
+	U8LIB_API size_t utf8_to_utf32_simd(const char8_t* seq, size_t size, char32_t* dst) noexcept;
+	U8LIB_API size_t utf8_walk_simd(const char8_t* seq, size_t size, size_t end, size_t max_count, size_t& index) noexcept;
+	U8LIB_API size_t utf16_validate_simd(const char16_t* seq, size_t size) noexcept;
+	U8LIB_API size_t utf16_to_utf8_size_simd(const char16_t* seq, size_t size) noexcept;
+	U8LIB_API size_t utf16_to_utf8_simd(const char16_t* seq, size_t size, char8_t* dst) noexcept;
+	U8LIB_API size_t utf32_to_utf8_size_simd(const char32_t* seq, size_t size) noexcept;
+	U8LIB_API size_t utf32_to_utf8_simd(const char32_t* seq, size_t size, char8_t* dst) noexcept;
+	U8LIB_API size_t latin1_to_utf8_size_simd(const char* seq, size_t size) noexcept;
+	U8LIB_API size_t latin1_to_utf8_simd(const char* seq, size_t size, char8_t* dst) noexcept;
+	U8LIB_API size_t utf8_to_latin1_simd(const char8_t* seq, size_t size, char* dst, char replacement) noexcept;
+	U8LIB_API size_t cp1252_to_utf8_size_simd(const char* seq, size_t size) noexcept;
+	U8LIB_API size_t cp1252_to_utf8_simd(const char* seq, size_t size, char8_t* dst) noexcept;
+
+	// windows-1252 code points of bytes 0x80-0x9F, the 5 bytes windows leaves undefined keep their C1 control
+	inline constexpr char16_t kCp1252C1Table[32] = {
+		0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+		0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+	};
+
+	constexpr char32_t cp1252_decode(char ch) noexcept {
+		const auto byte = static_cast<uint8_t>(ch);
+		return byte - 0x80u < 0x20u ? kCp1252C1Table[byte - 0x80] : byte;
+	}
+
+	constexpr size_t utf8_ascii_prefix_scalar(const char8_t* seq, size_t size) noexcept {
+		size_t i = 0;
+		while (i < size && seq[i] < 0x80) {
+			++i;
+		}
+		return i;
+	}
+
+	constexpr size_t utf8_validate_scalar(const char8_t* seq, size_t size) noexcept {
+		const char8_t* first = seq;
+		const char8_t* const last = seq + size;
+		while (first != last) {
+			if (*first < 0x80) {
+				++first;
+				continue;
+			}
+
+			char32_t ch;
+			const auto [next, is_usv] = decode_utf(first, last, ch);
+			if (!is_usv) {
+				break;
+			}
+			first = next;
+		}
+		return static_cast<size_t>(first - seq);
+	}
+
+	constexpr size_t utf8_to_utf16_size_scalar(const char8_t* seq, size_t size) noexcept {
+		size_t result = 0;
+		for (const char8_t *first = seq, *last = seq + size; first != last;) {
+			char32_t ch;
+			first = decode_utf(first, last, ch).next_ptr_;
+			result += utf16_seq_len(ch);
+		}
+		return result;
+	}
+
+	constexpr size_t utf8_to_utf16_scalar(const char8_t* seq, size_t size, char16_t* dst) noexcept {
+		size_t written = 0;
+		for (const char8_t *first = seq, *last = seq + size; first != last;) {
+			char32_t ch;
+			first = decode_utf(first, last, ch).next_ptr_;
+			written += utf16_encode(ch, dst + written);
+		}
+		return written;
+	}
+
+	constexpr size_t utf8_to_utf32_size_scalar(const char8_t* seq, size_t size) noexcept {
+		size_t result = 0;
+		for (const char8_t *first = seq, *last = seq + size; first != last; ++result) {
+			char32_t ch;
+			first = decode_utf(first, last, ch).next_ptr_;
+		}
+		return result;
+	}
+
+	constexpr size_t utf8_to_utf32_scalar(const char8_t* seq, size_t size, char32_t* dst) noexcept {
+		size_t written = 0;
+		for (const char8_t *first = seq, *last = seq + size; first != last; ++written) {
+			first = decode_utf(first, last, dst[written]).next_ptr_;
+		}
+		return written;
+	}
+
+	constexpr size_t utf8_walk_scalar(const char8_t* seq, size_t size, size_t end, size_t max_count, size_t& index) noexcept {
+		size_t count = 0;
+		while (index < end && count < max_count) {
+			const auto seq_len = utf8_seq_len(seq[index]);
+			index += seq_len && index + seq_len <= size ? seq_len : 1;
+			++count;
+		}
+		return count;
+	}
+
+	constexpr size_t utf16_to_utf8_size_scalar(const char16_t* seq, size_t size) noexcept {
+		size_t result = 0;
+		for (size_t i = 0; i < size;) {
+			char32_t ch;
+			i = utf16_decode(seq, size, i, ch);
+			result += utf8_seq_len(ch);
+		}
+		return result;
+	}
+
+	constexpr size_t utf16_validate_scalar(const char16_t* seq, size_t size) noexcept {
+		for (size_t i = 0; i < size; ++i) {
+			if (utf16_is_surrogate(seq[i])) {
+				if (!utf16_is_leading_surrogate(seq[i]) || i + 1 == size || !utf16_is_trailing_surrogate(seq[i + 1])) {
+					return i;
+				}
+				++i;
+			}
+		}
+		return size;
+	}
+
+	constexpr size_t utf16_to_utf8_scalar(const char16_t* seq, size_t size, char8_t* dst) noexcept {
+		size_t written = 0;
+		for (size_t i = 0; i < size;) {
+			char32_t ch;
+			i = utf16_decode(seq, size, i, ch);
+			written += utf8_encode(ch, dst + written);
+		}
+		return written;
+	}
+
+	constexpr size_t utf32_to_utf8_size_scalar(const char32_t* seq, size_t size) noexcept {
+		size_t result = 0;
+		for (size_t i = 0; i < size; ++i) {
+			result += is_unicode_scalar_value(seq[i]) ? utf8_seq_len(seq[i]) : 3;
+		}
+		return result;
+	}
+
+	constexpr size_t utf32_to_utf8_scalar(const char32_t* seq, size_t size, char8_t* dst) noexcept {
+		size_t written = 0;
+		for (size_t i = 0; i < size; ++i) {
+			written += utf8_encode(is_unicode_scalar_value(seq[i]) ? seq[i] : 0xFFFD, dst + written);
+		}
+		return written;
+	}
+
+	constexpr size_t latin1_to_utf8_size_scalar(const char* seq, size_t size) noexcept {
+		size_t result = size;
+		for (size_t i = 0; i < size; ++i) {
+			result += static_cast<uint8_t>(seq[i]) >> 7;
+		}
+		return result;
+	}
+
+	constexpr size_t latin1_to_utf8_scalar(const char* seq, size_t size, char8_t* dst) noexcept {
+		size_t written = 0;
+		for (size_t i = 0; i < size; ++i) {
+			const auto ch = static_cast<uint8_t>(seq[i]);
+			if (ch < 0x80) {
+				dst[written++] = ch;
+			} else {
+				dst[written++] = static_cast<char8_t>(0xC0 | (ch >> 6));
+				dst[written++] = static_cast<char8_t>(0x80 | (ch & 0x3F));
+			}
+		}
+		return written;
+	}
+
+	constexpr size_t utf8_to_latin1_scalar(const char8_t* seq, size_t size, char* dst, char replacement) noexcept {
+		size_t written = 0;
+		for (const char8_t *first = seq, *last = seq + size; first != last; ++written) {
+			if (*first < 0x80) {
+				dst[written] = static_cast<char>(*first++);
+				continue;
+			}
+			char32_t ch;
+			const auto [next, is_usv] = decode_utf(first, last, ch);
+			dst[written] = is_usv && ch <= 0xFF ? static_cast<char>(ch) : replacement;
+			first = next;
+		}
+		return written;
+	}
+
+	constexpr size_t cp1252_to_utf8_size_scalar(const char* seq, size_t size) noexcept {
+		size_t result = 0;
+		for (size_t i = 0; i < size; ++i) {
+			result += utf8_seq_len(cp1252_decode(seq[i]));
+		}
+		return result;
+	}
+
+	constexpr size_t cp1252_to_utf8_scalar(const char* seq, size_t size, char8_t* dst) noexcept {
+		size_t written = 0;
+		for (size_t i = 0; i < size; ++i) {
+			written += utf8_encode(cp1252_decode(seq[i]), dst + written);
+		}
+		return written;
+	}
+}
+
+namespace u8lib
+{
+	//==================> utf-8 <==================
+	constexpr size_t utf8_ascii_prefix(const char8_t* seq, size_t size) noexcept {
+		if !consteval {
+			return internal::utf8_ascii_prefix_simd(seq, size);
+		}
+		return internal::utf8_ascii_prefix_scalar(seq, size);
+	}
+
+	constexpr bool utf8_is_ascii(const char8_t* seq, size_t size) noexcept {
+		return utf8_ascii_prefix(seq, size) == size;
+	}
+
+	constexpr size_t utf8_validate(const char8_t* seq, size_t size) noexcept {
+		if !consteval {
+			return internal::utf8_validate_simd(seq, size);
+		}
+		return internal::utf8_validate_scalar(seq, size);
+	}
+
+	constexpr bool utf8_is_valid(const char8_t* seq, size_t size) noexcept {
+		return utf8_validate(seq, size) == size;
+	}
+
+	// valid runs are found by the vector validator, only the ill-formed subparts between them are decoded
+	constexpr size_t utf8_sanitized_size(const char8_t* seq, size_t size) noexcept {
+		size_t result = 0;
+		for (const char8_t *first = seq, *last = seq + size; first != last;) {
+			const size_t valid_size = utf8_validate(first, static_cast<size_t>(last - first));
+			result += valid_size;
+			first += valid_size;
+			if (first != last) {
+				char32_t ch;
+				first = decode_utf(first, last, ch).next_ptr_;
+				result += 3;
+			}
+		}
+		return result;
+	}
+
+	constexpr size_t utf8_sanitize(const char8_t* seq, size_t size, char8_t* dst) noexcept {
+		size_t written = 0;
+		for (const char8_t *first = seq, *last = seq + size; first != last;) {
+			const size_t valid_size = utf8_validate(first, static_cast<size_t>(last - first));
+			std::char_traits<char8_t>::copy(dst + written, first, valid_size);
+			written += valid_size;
+			first += valid_size;
+			if (first != last) {
+				char32_t ch;
+				first = decode_utf(first, last, ch).next_ptr_;
+				written += utf8_encode(0xFFFD, dst + written);
+			}
+		}
+		return written;
+	}
+
+	constexpr size_t utf8_encode(char32_t ch, char8_t* dst) noexcept {
+		if (ch <= utf8_maximum_code_point(1)) {
+			dst[0] = static_cast<char8_t>(ch);
+			return 1;
+		}
+		if (ch <= utf8_maximum_code_point(2)) {
+			dst[0] = static_cast<char8_t>((ch >> 6) | 0xC0);
+			dst[1] = static_cast<char8_t>((ch & utf8_mask(0)) | 0x80);
+			return 2;
+		}
+		if (ch <= utf8_maximum_code_point(3)) {
+			dst[0] = static_cast<char8_t>((ch >> 12) | 0xE0);
+			dst[1] = static_cast<char8_t>(((ch >> 6) & utf8_mask(0)) | 0x80);
+			dst[2] = static_cast<char8_t>((ch & utf8_mask(0)) | 0x80);
+			return 3;
+		}
+		dst[0] = static_cast<char8_t>((ch >> 18) | 0xF0);
+		dst[1] = static_cast<char8_t>(((ch >> 12) & utf8_mask(0)) | 0x80);
+		dst[2] = static_cast<char8_t>(((ch >> 6) & utf8_mask(0)) | 0x80);
+		dst[3] = static_cast<char8_t>((ch & utf8_mask(0)) | 0x80);
+		return 4;
+	}
+
+	constexpr size_t utf8_to_utf16_size(const char8_t* seq, size_t size) noexcept {
+		if !consteval {
+			return internal::utf8_to_utf16_size_simd(seq, size);
+		}
+		return internal::utf8_to_utf16_size_scalar(seq, size);
+	}
+
+	constexpr size_t utf8_to_utf16(const char8_t* seq, size_t size, char16_t* dst) noexcept {
+		if !consteval {
+			return internal::utf8_to_utf16_simd(seq, size, dst);
+		}
+		return internal::utf8_to_utf16_scalar(seq, size, dst);
+	}
+
+	constexpr size_t utf8_to_utf32_size(const char8_t* seq, size_t size) noexcept {
+		if !consteval {
+			return internal::utf8_to_utf32_size_simd(seq, size);
+		}
+		return internal::utf8_to_utf32_size_scalar(seq, size);
+	}
+
+	constexpr size_t utf8_to_utf32(const char8_t* seq, size_t size, char32_t* dst) noexcept {
+		if !consteval {
+			return internal::utf8_to_utf32_simd(seq, size, dst);
+		}
+		return internal::utf8_to_utf32_scalar(seq, size, dst);
+	}
+
+	constexpr size_t utf8_walk(const char8_t* seq, size_t size, size_t end, size_t max_count, size_t& index) noexcept {
+		if !consteval {
+			return internal::utf8_walk_simd(seq, size, end, max_count, index);
+		}
+		return internal::utf8_walk_scalar(seq, size, end, max_count, index);
+	}
+
+	constexpr size_t utf8_text_length(const char8_t* seq, size_t size) noexcept {
+		size_t index = 0;
+		return utf8_walk(seq, size, size, SIZE_MAX, index);
+	}
+
+	constexpr size_t utf8_buffer_index_to_text(const char8_t* seq, size_t size, size_t index) noexcept {
+		assert(index < size);
+
+		// count the code points starting at or before index
+		size_t cur_idx = 0;
+		return utf8_walk(seq, size, index + 1, SIZE_MAX, cur_idx) - 1;
+	}
+
+	constexpr size_t utf8_text_index_to_buffer(const char8_t* seq, size_t size, size_t index) noexcept {
+		size_t cur_idx = 0;
+		[[maybe_unused]] const size_t count = utf8_walk(seq, size, size, index, cur_idx);
+		assert(count == index && "invalid code point index");
+		return cur_idx;
+	}
+
+	//==================> utf-16 <==================
+	constexpr size_t utf16_decode(const char16_t* seq, size_t size, size_t index, char32_t& value) noexcept {
+		assert(index < size);
+
+		const char16_t ch = seq[index];
+		if (!utf16_is_surrogate(ch)) {
+			value = ch;
+			return index + 1;
+		}
+		if (utf16_is_leading_surrogate(ch) && index + 1 < size && utf16_is_trailing_surrogate(seq[index + 1])) {
+			value = ((ch & kUtf16SurrogateMask) << 10) + (seq[index + 1] & kUtf16SurrogateMask) + kSMPBaseCodePoint;
+			return index + 2;
+		}
+		value = 0xFFFD;
+		return index + 1;
+	}
+
+	constexpr size_t utf16_encode(char32_t ch, char16_t* dst) noexcept {
+		if (ch <= kBMPMaxCodePoint) {
+			dst[0] = static_cast<char16_t>(ch);
+			return 1;
+		}
+		dst[0] = static_cast<char16_t>(((ch - kSMPBaseCodePoint) >> 10) + kUtf16LeadingSurrogateHeader);
+		dst[1] = static_cast<char16_t>((ch & kUtf16SurrogateMask) + kUtf16TrailingSurrogateHeader);
+		return 2;
+	}
+
+	constexpr size_t utf16_validate(const char16_t* seq, size_t size) noexcept {
+		if !consteval {
+			return internal::utf16_validate_simd(seq, size);
+		}
+		return internal::utf16_validate_scalar(seq, size);
+	}
+
+	constexpr bool utf16_is_valid(const char16_t* seq, size_t size) noexcept {
+		return utf16_validate(seq, size) == size;
+	}
+
+	// valid runs are found by the vector validator, every unit between them is an unpaired surrogate
+	constexpr size_t utf16_sanitize(const char16_t* seq, size_t size, char16_t* dst) noexcept {
+		size_t i = 0;
+		while (i != size) {
+			const size_t valid_size = utf16_validate(seq + i, size - i);
+			if (dst != seq) {
+				std::char_traits<char16_t>::copy(dst + i, seq + i, valid_size);
+			}
+			i += valid_size;
+			if (i != size) {
+				dst[i++] = 0xFFFD;
+			}
+		}
+		return size;
+	}
+
+	constexpr size_t utf16_to_utf8_size(const char16_t* seq, size_t size) noexcept {
+		if !consteval {
+			return internal::utf16_to_utf8_size_simd(seq, size);
+		}
+		return internal::utf16_to_utf8_size_scalar(seq, size);
+	}
+
+	constexpr size_t utf16_to_utf8(const char16_t* seq, size_t size, char8_t* dst) noexcept {
+		if !consteval {
+			return internal::utf16_to_utf8_simd(seq, size, dst);
+		}
+		return internal::utf16_to_utf8_scalar(seq, size, dst);
+	}
+
+	//==================> utf-32 <==================
+	constexpr bool is_unicode_scalar_value(char32_t ch) noexcept {
+		return ch < kUtf16LeadingSurrogateMin || (ch > kUtf16TrailingSurrogateMax && ch <= 0x10FFFF);
+	}
+
+	constexpr size_t utf32_to_utf8_size(const char32_t* seq, size_t size) noexcept {
+		if !consteval {
+			return internal::utf32_to_utf8_size_simd(seq, size);
+		}
+		return internal::utf32_to_utf8_size_scalar(seq, size);
+	}
+
+	constexpr size_t utf32_to_utf8(const char32_t* seq, size_t size, char8_t* dst) noexcept {
+		if !consteval {
+			return internal::utf32_to_utf8_simd(seq, size, dst);
+		}
+		return internal::utf32_to_utf8_scalar(seq, size, dst);
+	}
+
+	//==================> latin-1 <==================
+	constexpr size_t latin1_to_utf8_size(const char* seq, size_t size) noexcept {
+		if !consteval {
+			return internal::latin1_to_utf8_size_simd(seq, size);
+		}
+		return internal::latin1_to_utf8_size_scalar(seq, size);
+	}
+
+	constexpr size_t latin1_to_utf8(const char* seq, size_t size, char8_t* dst) noexcept {
+		if !consteval {
+			return internal::latin1_to_utf8_simd(seq, size, dst);
+		}
+		return internal::latin1_to_utf8_scalar(seq, size, dst);
+	}
+
+	constexpr size_t utf8_to_latin1(const char8_t* seq, size_t size, char* dst, char replacement) noexcept {
+		if !consteval {
+			return internal::utf8_to_latin1_simd(seq, size, dst, replacement);
+		}
+		return internal::utf8_to_latin1_scalar(seq, size, dst, replacement);
+	}
+
+	//==================> windows-1252 <==================
+	constexpr size_t cp1252_to_utf8_size(const char* seq, size_t size) noexcept {
+		if !consteval {
+			return internal::cp1252_to_utf8_size_simd(seq, size);
+		}
+		return internal::cp1252_to_utf8_size_scalar(seq, size);
+	}
+
+	constexpr size_t cp1252_to_utf8(const char* seq, size_t size, char8_t* dst) noexcept {
+		if !consteval {
+			return internal::cp1252_to_utf8_simd(seq, size, dst);
+		}
+		return internal::cp1252_to_utf8_scalar(seq, size, dst);
+	}
+}
+
+// literals
+namespace u8lib::internal
+{
+	//! @brief a string literal as a template argument, see u8lib::literal
+	template<typename CharT, size_t N>
+	struct literal_source {
+		using char_type = CharT;
+		static constexpr size_t size = N - 1;
+
+		CharT data[N]{};
+
+		consteval literal_source(const CharT (&str)[N]) noexcept {
+			for (size_t i = 0; i < N; ++i) {
+				data[i] = str[i];
+			}
+		}
+	};
+
+	// wchar_t is utf-16 where it is 2 bytes wide, utf-32 otherwise
+	template<typename CharT>
+	using literal_unit_t = std::conditional_t<std::is_same_v<CharT, wchar_t>,
+		std::conditional_t<sizeof(wchar_t) == sizeof(char16_t), char16_t, char32_t>, CharT>;
+
+	//! @brief null terminated utf-8 code units
+	template<size_t Size>
+	struct utf8_literal {
+		static constexpr size_t size = Size;
+
+		char8_t data[Size + 1]{};
+	};
+
+	// transcode Source into dst, or only measure it if dst is null, return: utf-8 size
+	template<literal_source Source>
+	consteval size_t transcode_literal(char8_t* dst) {
+		using unit_type = literal_unit_t<typename decltype(Source)::char_type>;
+		// copied unit by unit, a wchar_t array cannot be read as char16_t or char32_t during constant evaluation
+		unit_type units[Source.size + 1]{};
+		for (size_t i = 0; i < Source.size; ++i) {
+			units[i] = static_cast<unit_type>(Source.data[i]);
+		}
+		if constexpr (std::is_same_v<unit_type, char8_t>) {
+			for (size_t i = 0; dst && i < Source.size; ++i) {
+				dst[i] = units[i];
+			}
+			return Source.size;
+		} else if constexpr (std::is_same_v<unit_type, char16_t>) {
+			return dst ? utf16_to_utf8(units, Source.size, dst) : utf16_to_utf8_size(units, Source.size);
+		} else {
+			static_assert(std::is_same_v<unit_type, char32_t>, "literal needs a u8, u, U or L string literal");
+			return dst ? utf32_to_utf8(units, Source.size, dst) : utf32_to_utf8_size(units, Source.size);
+		}
+	}
+
+	template<literal_source Source>
+	consteval auto make_utf8_literal() {
+		utf8_literal<transcode_literal<Source>(nullptr)> result;
+		transcode_literal<Source>(result.data);
+		return result;
+	}
+
+	// one static array per literal, shared by every use
+	template<literal_source Source>
+	inline constexpr auto kUtf8Literal = make_utf8_literal<Source>();
+}
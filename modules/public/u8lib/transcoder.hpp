@@ -0,0 +1,74 @@
+#pragma once
+
+#include "transcode.hpp"
+
+#include <algorithm>
+#include <span>
+#include <type_traits>
+
+namespace u8lib
+{
+	//! @brief chunked utf-8/utf-16/utf-32 transcoding, the input may be cut anywhere between calls, a sequence cut by
+	//!        the end of a chunk is kept (up to 3 utf-8 code units or a leading surrogate) and finished by the next one
+	//! @note output equals the whole-input transcode functions, ill-formed input becomes U+FFFD the same way
+	template<typename From, typename To>
+	class utf_transcoder {
+		static_assert(is_any_of_v<From, char8_t, char16_t, char32_t>, "From must be char8_t, char16_t or char32_t");
+		static_assert(is_any_of_v<To, char8_t, char16_t, char32_t>, "To must be char8_t, char16_t or char32_t");
+		static_assert(!std::is_same_v<From, To>, "From and To must be different encodings");
+
+	public:
+		using from_type = From;
+		using to_type = To;
+		using size_type = size_t;
+
+		struct result {
+			size_type read;    // input code units consumed, including the ones kept as pending
+			size_type written; // output code units written
+		};
+
+		static constexpr size_type kMaxPending = std::is_same_v<From, char8_t> ? 3 : 1;
+
+		//==================> transcode <==================
+
+		// transcode as much of input as output holds, output is only cut between code points
+		// input is read to the end unless output fills up, call again with the unread rest in that case
+		constexpr result transcode(std::span<const From> input, std::span<To> output) noexcept;
+		// end of stream, write U+FFFD for a pending incomplete sequence
+		// return: code units written, 0 with has_pending() still set if output is too small
+		constexpr size_type finish(std::span<To> output) noexcept;
+
+		//==================> state <==================
+
+		constexpr bool has_pending() const noexcept;
+		constexpr size_type pending_size() const noexcept;
+		constexpr void reset() noexcept;
+
+	private:
+		// worst case output code units per input code unit
+		static constexpr size_type kMaxExpansion =
+			std::is_same_v<To, char8_t> ? (std::is_same_v<From, char16_t> ? 3 : 4) :
+			std::is_same_v<To, char16_t> ? (std::is_same_v<From, char8_t> ? 1 : 2) :
+			1;
+		// below this many input code units a vector kernel call costs more than it saves
+		static constexpr size_type kBulkMinSize = 32;
+
+		static constexpr size_type _incomplete_tail(const From* first, const From* last) noexcept;
+		static constexpr size_type _adjust_to_boundary(const From* first, size_type count) noexcept;
+		static constexpr size_type _transcode_bulk(const From* first, size_type count, To* dst) noexcept;
+		static constexpr const From* _decode_one(const From* first, const From* last, char32_t& ch) noexcept;
+		static constexpr bool _encode_one(char32_t ch, To*& dst, To* dst_end) noexcept;
+
+		From _pending[kMaxPending] = {};
+		uint8_t _pending_size = 0;
+	};
+
+	using utf8_to_utf16_transcoder = utf_transcoder<char8_t, char16_t>;
+	using utf8_to_utf32_transcoder = utf_transcoder<char8_t, char32_t>;
+	using utf16_to_utf8_transcoder = utf_transcoder<char16_t, char8_t>;
+	using utf16_to_utf32_transcoder = utf_transcoder<char16_t, char32_t>;
+	using utf32_to_utf8_transcoder = utf_transcoder<char32_t, char8_t>;
+	using utf32_to_utf16_transcoder = utf_transcoder<char32_t, char16_t>;
+}
+
+#include "implement/transcoder.inl"
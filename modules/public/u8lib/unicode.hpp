@@ -0,0 +1,113 @@
+#pragma once
+
+#include "config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace u8lib
+{
+	class u8string;
+
+	//==================> normalization <==================
+
+	// unicode normalization forms, see UAX #15
+	enum class normalization_form : uint8_t {
+		nfc,
+		nfd,
+		nfkc,
+		nfkd,
+	};
+
+	// quick check of UAX #15, only the segments it cannot decide are normalized to compare, on the stack unless they
+	// are unusually long. ill-formed utf-8 is never normalized
+	// return: whether seq is in form
+	U8LIB_API bool utf8_is_normalized(const char8_t* seq, size_t size, normalization_form form);
+	// append seq in form to out, every maximal ill-formed subpart is replaced by U+FFFD
+	U8LIB_API void utf8_normalize(const char8_t* seq, size_t size, normalization_form form, u8string& out);
+
+	//==================> case mapping <==================
+
+	// ascii letters only, every other code unit is copied, dst may be seq
+	U8LIB_API void ascii_to_lower(const char8_t* seq, size_t size, char8_t* dst) noexcept;
+	U8LIB_API void ascii_to_upper(const char8_t* seq, size_t size, char8_t* dst) noexcept;
+	// append seq with the simple case mappings of UnicodeData.txt applied to out, a code point keeps mapping to one
+	// code point but may change its utf-8 size. every maximal ill-formed subpart is replaced by U+FFFD
+	U8LIB_API void utf8_to_lower(const char8_t* seq, size_t size, u8string& out);
+	U8LIB_API void utf8_to_upper(const char8_t* seq, size_t size, u8string& out);
+	// like utf8_to_lower with the full case folding of CaseFolding.txt (statuses C and F), for caseless matching,
+	// "ß" folds to "ss"
+	U8LIB_API void utf8_case_fold(const char8_t* seq, size_t size, u8string& out);
+
+	//==================> grapheme clusters <==================
+
+	// extended grapheme clusters of UAX #29 for Unicode 15.0 without tailoring, so Indic conjuncts like U+0931 U+094D
+	// U+0925 break after the virama where ICU keeps them together. an ill-formed subpart stands for U+FFFD
+	// return: end of the cluster starting at index, index must be below size
+	U8LIB_API size_t utf8_next_grapheme(const char8_t* seq, size_t size, size_t index) noexcept;
+	// return: grapheme clusters in seq
+	U8LIB_API size_t utf8_grapheme_count(const char8_t* seq, size_t size) noexcept;
+
+	//==================> display width <==================
+
+	// estimated width of [format.string.std], the one the formatter pads and truncates by: a grapheme cluster takes
+	// two columns if its first code point is East_Asian_Width W or F or an emoji, else one
+	// return: columns seq takes
+	U8LIB_API size_t utf8_display_width(const char8_t* seq, size_t size) noexcept;
+	// return: size of the longest prefix of seq taking at most max_width columns, clusters are never split
+	U8LIB_API size_t utf8_width_prefix(const char8_t* seq, size_t size, size_t max_width) noexcept;
+
+	//==================> character properties <==================
+
+	// values of the General_Category property, see UAX #44
+	enum class unicode_general_category : uint8_t {
+		uppercase_letter,      // Lu
+		lowercase_letter,      // Ll
+		titlecase_letter,      // Lt
+		modifier_letter,       // Lm
+		other_letter,          // Lo
+		nonspacing_mark,       // Mn
+		spacing_mark,          // Mc
+		enclosing_mark,        // Me
+		decimal_number,        // Nd
+		letter_number,         // Nl
+		other_number,          // No
+		connector_punctuation, // Pc
+		dash_punctuation,      // Pd
+		open_punctuation,      // Ps
+		close_punctuation,     // Pe
+		initial_punctuation,   // Pi
+		final_punctuation,     // Pf
+		other_punctuation,     // Po
+		math_symbol,           // Sm
+		currency_symbol,       // Sc
+		modifier_symbol,       // Sk
+		other_symbol,          // So
+		space_separator,       // Zs
+		line_separator,        // Zl
+		paragraph_separator,   // Zp
+		control,               // Cc
+		format,                // Cf
+		surrogate,             // Cs
+		private_use,           // Co
+		unassigned,            // Cn
+	};
+
+	// values of the East_Asian_Width property, see UAX #11
+	enum class unicode_east_asian_width : uint8_t {
+		neutral,
+		ambiguous,
+		halfwidth,
+		fullwidth,
+		narrow,
+		wide,
+	};
+
+	// properties of a code point, one lookup in a two-stage table each. ch above U+10FFFF is unassigned
+	U8LIB_API unicode_general_category general_category(char32_t ch) noexcept;
+	U8LIB_API unicode_east_asian_width east_asian_width(char32_t ch) noexcept;
+	// White_Space property of PropList.txt
+	U8LIB_API bool is_whitespace(char32_t ch) noexcept;
+	// Alphabetic property of DerivedCoreProperties.txt
+	U8LIB_API bool is_alphabetic(char32_t ch) noexcept;
+}
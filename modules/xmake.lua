@@ -10,6 +10,9 @@ do
     add_deps("compile-flags", { public = true })
     add_packages("mimalloc")
 
+    -- transcoding kernels pick sse4.2/avx2 code paths at compile time, see private/simd/simd.hpp
+    add_vectorexts("sse4.2")
+
     add_files("private/*.cpp")
     add_includedirs("public", { public = true })
     add_headerfiles("public/(**)")
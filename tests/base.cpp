@@ -1,6 +1,50 @@
 #include <doctest/doctest.h>
 
 #include <u8lib/iterator.hpp>
+#include <u8lib/transcode.hpp>
+
+#include <numeric>
+#include <random>
+#include <utility>
+
+namespace
+{
+	// random text for comparing the vector paths against the scalar ones. each round draws a rate for the first
+	// favored pieces, at the lowest rate it is made of nothing else, so pure runs reach the wide loops. up to
+	// max_damage code units are then overwritten by random bytes
+	struct random_text_options {
+		uint32_t seed = 42;
+		int rounds = 500;
+		size_t max_count = 80;
+		// every tenth round draws its count from long_count instead, if set
+		size_t long_count = 0;
+		size_t favored = 0;
+		size_t max_damage = 0;
+	};
+
+	// check(text, rng) for every round, rng is passed on for probes and further damage
+	template<typename String, typename Pieces, typename F>
+	void for_each_random_text(const random_text_options& options, const Pieces& pieces, F&& check) {
+		std::mt19937 rng{options.seed};
+		String str;
+		for (int round = 0; round < options.rounds; ++round) {
+			str.clear();
+			const size_t count = rng() % (options.long_count && round % 10 == 0 ? options.long_count : options.max_count);
+			const uint32_t rate = rng() % 4;
+			for (size_t i = 0; i < count; ++i) {
+				if (options.favored && rng() % 4 >= rate) {
+					str += pieces[rng() % options.favored];
+				} else {
+					str += pieces[options.favored + rng() % (std::size(pieces) - options.favored)];
+				}
+			}
+			for (size_t damage = rng() % (options.max_damage + 1); !str.empty() && damage; --damage) {
+				str[rng() % str.size()] = static_cast<typename String::value_type>(rng());
+			}
+			check(std::as_const(str), rng);
+		}
+	}
+}
 
 TEST_CASE("Test Unicode") {
 	using namespace u8lib;
@@ -37,6 +81,15 @@ TEST_CASE("Test Unicode") {
 		CHECK_EQ(utf8_seq_len(u32_len_1[0]), 1);
 
 		CHECK_EQ(utf8_seq_len(u8_len_4[1]), 0);
+		CHECK_EQ(utf8_seq_len(static_cast<char8_t>(0x7F)), 1);
+		CHECK_EQ(utf8_seq_len(static_cast<char8_t>(0x80)), 0);
+		CHECK_EQ(utf8_seq_len(static_cast<char8_t>(0xBF)), 0);
+		CHECK_EQ(utf8_seq_len(static_cast<char8_t>(0xC0)), 2);
+		CHECK_EQ(utf8_seq_len(static_cast<char8_t>(0xDF)), 2);
+		CHECK_EQ(utf8_seq_len(static_cast<char8_t>(0xE0)), 3);
+		CHECK_EQ(utf8_seq_len(static_cast<char8_t>(0xEF)), 3);
+		CHECK_EQ(utf8_seq_len(static_cast<char8_t>(0xF0)), 4);
+		CHECK_EQ(utf8_seq_len(static_cast<char8_t>(0xF7)), 4);
 		CHECK_EQ(utf8_seq_len(u16_len_4[1]), 4);
 
 		CHECK_EQ(utf8_seq_len(static_cast<char8_t>(0)), 1);
@@ -213,6 +266,75 @@ TEST_CASE("Test Unicode") {
 		}
 	}
 
+	SUBCASE("UTF-8 decode") {
+		struct decode_case {
+			const char8_t* seq;
+			size_t size;
+			char32_t value;
+			// units consumed, the maximal subpart for ill-formed input
+			size_t consumed;
+			bool is_usv;
+		};
+		const decode_case cases[] = {
+			{u8"G", 1, U'G', 1, true},
+			{u8"Ĝ", 2, U'Ĝ', 2, true},
+			{u8"鸡", 3, U'鸡', 3, true},
+			{u8"🐓", 4, U'🐓', 4, true},
+			{u8"\U0010FFFF", 4, 0x10FFFF, 4, true},
+			// overlong, surrogate and above U+10FFFF are rejected on the second byte
+			{u8"\xE0\x80\x80", 3, 0xFFFD, 1, false},
+			{u8"\xE0\x9F\xBF", 3, 0xFFFD, 1, false},
+			{u8"\xED\xA0\x80", 3, 0xFFFD, 1, false},
+			{u8"\xED\xBF\xBF", 3, 0xFFFD, 1, false},
+			{u8"\xF0\x80\x80\x80", 4, 0xFFFD, 1, false},
+			{u8"\xF0\x8F\xBF\xBF", 4, 0xFFFD, 1, false},
+			{u8"\xF4\x90\x80\x80", 4, 0xFFFD, 1, false},
+			// the lowest and highest second bytes still accepted
+			{u8"\xE0\xA0\x80", 3, 0x800, 3, true},
+			{u8"\xED\x9F\xBF", 3, 0xD7FF, 3, true},
+			{u8"\xF0\x90\x80\x80", 4, 0x10000, 4, true},
+			{u8"\xF4\x8F\xBF\xBF", 4, 0x10FFFF, 4, true},
+			// truncated at the end of input, the valid prefix is one subpart
+			{u8"\xE2\x82", 2, 0xFFFD, 2, false},
+			{u8"\xF0\x9F\x90", 3, 0xFFFD, 3, false},
+			{u8"\xF4", 1, 0xFFFD, 1, false},
+			// truncated by a byte that is not a continuation, which is not consumed
+			{u8"\xE2\x82G", 3, 0xFFFD, 2, false},
+			{u8"\xF0\x9F\x90G", 4, 0xFFFD, 3, false},
+			// lone continuation and bytes that never lead
+			{u8"\x80", 1, 0xFFFD, 1, false},
+			{u8"\xBF\x80", 2, 0xFFFD, 1, false},
+			{u8"\xC0\x80", 2, 0xFFFD, 1, false},
+			{u8"\xC1\xBF", 2, 0xFFFD, 1, false},
+			{u8"\xF5\x80\x80\x80", 4, 0xFFFD, 1, false},
+			{u8"\xFF", 1, 0xFFFD, 1, false},
+		};
+		for (const auto& each : cases) {
+			char32_t value = 0;
+			const auto [next, is_usv] = decode_utf(each.seq, each.seq + each.size, value);
+			CHECK_EQ(static_cast<uint32_t>(value), static_cast<uint32_t>(each.value));
+			CHECK_EQ(static_cast<size_t>(next - each.seq), each.consumed);
+			CHECK_EQ(is_usv, each.is_usv);
+		}
+
+		// one U+FFFD per maximal subpart across a whole sequence
+		{
+			const char8_t seq[] = u8"\xE0\x80G\xED\xA0\x80\xF0\x9F\x90鸡\x80";
+			const char32_t expected[] = {0xFFFD, 0xFFFD, U'G', 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, U'鸡', 0xFFFD};
+			const char8_t* cur = seq;
+			const char8_t* const end = seq + sizeof(seq) - 1;
+			size_t count = 0;
+			while (cur < end && count < std::size(expected)) {
+				char32_t value = 0;
+				cur = decode_utf(cur, end, value).next_ptr_;
+				CHECK_EQ(static_cast<uint32_t>(value), static_cast<uint32_t>(expected[count]));
+				++count;
+			}
+			CHECK_EQ(count, std::size(expected));
+			CHECK_EQ(cur, end);
+		}
+	}
+
 	SUBCASE("UTF-16 parse seq") {
 		// parse from different index
 		{
@@ -575,4 +697,358 @@ TEST_CASE("Test Unicode") {
 			}
 		}
 	}
+
+	SUBCASE("UTF-8 validate") {
+		static_assert(utf8_is_valid(u8"🐓鸡ĜG", 10));
+		static_assert(utf8_validate(u8"G\xC0\x80", 3) == 1);
+
+		// well-formed boundaries
+		const char8_t valid[] = u8"\u007F\u0080\u07FF\u0800\uD7FF\uE000\uFFFF\U00010000\U0010FFFF";
+		CHECK(utf8_is_valid(valid, sizeof(valid) - 1));
+		CHECK(utf8_is_valid(nullptr, 0));
+
+		// ill-formed sequences after an ascii prefix, the first bad unit is at the end of the prefix
+		const std::u8string_view bad_cases[] = {
+			u8"\x80",             // stray continuation
+			u8"\xC0\xAF",         // overlong 2
+			u8"\xC1\xBF",         // overlong 2
+			u8"\xE0\x9F\xBF",     // overlong 3
+			u8"\xF0\x8F\xBF\xBF", // overlong 4
+			u8"\xED\xA0\x80",     // surrogate
+			u8"\xF4\x90\x80\x80", // > U+10FFFF
+			u8"\xF5\x80\x80\x80", // bad lead
+			u8"\xFF",
+			u8"\xE4\xB8",         // truncated
+			u8"\xF0\x9F\x90",     // truncated
+			u8"\xC4G",            // too short
+			u8"\xA1\xE9\xB8\xA1", // too long
+		};
+		for (size_t prefix: {0, 5, 13, 15, 16, 29, 31, 32, 33, 63, 100}) {
+			for (auto bad: bad_cases) {
+				std::u8string str(prefix, u8'a');
+				str += bad;
+				str += u8"tail text to fill the next block ......";
+				CHECK_EQ(utf8_validate(str.data(), str.size()), prefix);
+				CHECK_FALSE(utf8_is_valid(str.data(), str.size()));
+			}
+		}
+
+		// truncated at the end of input, across every block position
+		for (size_t prefix = 0; prefix < 70; ++prefix) {
+			std::u8string str(prefix, u8'a');
+			str += u8"🐓";
+			CHECK_EQ(utf8_validate(str.data(), str.size()), str.size());
+			CHECK_EQ(utf8_validate(str.data(), str.size() - 1), prefix);
+			CHECK_EQ(utf8_validate(str.data(), str.size() - 3), prefix);
+		}
+
+		// random mutations must agree with the scalar decoder
+		const std::u8string_view pieces[] = {u8"a", u8"Ĝ", u8"鸡", u8"🐓", u8" ", u8"\uFFFD"};
+		for_each_random_text<std::u8string>({.seed = 42, .max_damage = 1}, pieces, [](const std::u8string& str, std::mt19937&) {
+			CHECK_EQ(utf8_validate(str.data(), str.size()), internal::utf8_validate_scalar(str.data(), str.size()));
+		});
+	}
+
+	SUBCASE("UTF-16 to UTF-8") {
+		static_assert(utf16_to_utf8_size(u"🐓鸡ĜG", 5) == 10);
+
+		const std::u16string_view text = u"🐓鸡ĜG This is a good text 🐓鸡ĜG";
+		const std::u8string_view expected = u8"🐓鸡ĜG This is a good text 🐓鸡ĜG";
+		char8_t buffer[64] = {};
+		CHECK_EQ(utf16_to_utf8_size(text.data(), text.size()), expected.size());
+		CHECK_EQ(utf16_to_utf8(text.data(), text.size(), buffer), expected.size());
+		CHECK_EQ(std::u8string_view(buffer, expected.size()), expected);
+
+		// unpaired surrogates become U+FFFD
+		const char16_t lone[] = {u'G', 0xDC01, 0xD801, u'G', 0xD801};
+		const std::u8string_view lone_expected = u8"G\uFFFD\uFFFDG\uFFFD";
+		CHECK_EQ(utf16_to_utf8_size(lone, 5), lone_expected.size());
+		CHECK_EQ(utf16_to_utf8(lone, 5, buffer), lone_expected.size());
+		CHECK_EQ(std::u8string_view(buffer, lone_expected.size()), lone_expected);
+
+		// vector blocks must agree with the scalar decoder, including pairs split by block edges
+		const char16_t units[] = {u'a', u'Ĝ', u'鸡', 0xFFFF, 0xD83D, 0xDC13, 0x7F, 0x80, 0x7FF, 0x800};
+		std::vector<char8_t> simd_out, scalar_out;
+		for_each_random_text<std::u16string>({.seed = 42, .max_count = 100, .favored = 4}, units, [&](const std::u16string& str, std::mt19937&) {
+			const size_t size = internal::utf16_to_utf8_size_scalar(str.data(), str.size());
+			simd_out.assign(size, 0);
+			scalar_out.assign(size, 0);
+			CHECK_EQ(utf16_to_utf8_size(str.data(), str.size()), size);
+			CHECK_EQ(utf16_to_utf8(str.data(), str.size(), simd_out.data()), size);
+			internal::utf16_to_utf8_scalar(str.data(), str.size(), scalar_out.data());
+			CHECK_EQ(simd_out, scalar_out);
+			CHECK(utf8_is_valid(simd_out.data(), simd_out.size()));
+		});
+	}
+
+	SUBCASE("UTF-16 validate & sanitize") {
+		static_assert(utf16_is_valid(u"🐓鸡ĜG", 5));
+		static_assert(utf16_validate(u"G\xDC01", 2) == 1);
+
+		const char16_t lone[] = {u'G', 0xDC01, 0xD801, u'G', 0xD83D, 0xDC13, 0xD801};
+		CHECK_EQ(utf16_validate(lone, 7), 1);
+		CHECK_EQ(utf16_validate(lone + 3, 3), 3);
+		CHECK_EQ(utf16_validate(lone + 3, 4), 3);
+		CHECK(utf16_is_valid(nullptr, 0));
+
+		char16_t buffer[8] = {};
+		CHECK_EQ(utf16_sanitize(lone, 7, buffer), 7);
+		CHECK_EQ(std::u16string_view(buffer, 7), u"G\uFFFD\uFFFDG🐓\uFFFD");
+		// in place
+		char16_t in_place[] = {0xDC01, u'a', 0xD801};
+		utf16_sanitize(in_place, 3, in_place);
+		CHECK_EQ(std::u16string_view(in_place, 3), u"\uFFFDa\uFFFD");
+
+		// a lone surrogate at every block position, and pairs split by block edges
+		for (size_t prefix = 0; prefix < 40; ++prefix) {
+			std::u16string str(prefix, u'a');
+			str += u"🐓";
+			str += std::u16string(40, u'b');
+			CHECK(utf16_is_valid(str.data(), str.size()));
+			CHECK_EQ(utf16_validate(str.data(), prefix + 1), prefix);
+			str[prefix + 1] = u'c';
+			CHECK_EQ(utf16_validate(str.data(), str.size()), prefix);
+			str[prefix] = u'c';
+			str[prefix + 1] = 0xDC13;
+			CHECK_EQ(utf16_validate(str.data(), str.size()), prefix + 1);
+		}
+
+		// vector blocks must agree with the scalar checks, sanitized text with the utf-8 transcoder
+		// pairs favored over the lone surrogates
+		const std::u16string_view pieces[] = {u"🐓", u"a", u"鸡", u"\xD83D", u"\xDC13"};
+		std::u16string sanitized;
+		std::vector<char8_t> from_wtf16, from_sanitized;
+		for_each_random_text<std::u16string>({.seed = 7, .max_count = 100, .favored = 1}, pieces, [&](const std::u16string& str, std::mt19937&) {
+			CHECK_EQ(utf16_validate(str.data(), str.size()), internal::utf16_validate_scalar(str.data(), str.size()));
+
+			sanitized.assign(str.size(), 0);
+			utf16_sanitize(str.data(), str.size(), sanitized.data());
+			CHECK(utf16_is_valid(sanitized.data(), sanitized.size()));
+			from_wtf16.assign(utf16_to_utf8_size(str.data(), str.size()), 0);
+			utf16_to_utf8(str.data(), str.size(), from_wtf16.data());
+			from_sanitized.assign(utf16_to_utf8_size(sanitized.data(), sanitized.size()), 0);
+			utf16_to_utf8(sanitized.data(), sanitized.size(), from_sanitized.data());
+			CHECK_EQ(from_wtf16, from_sanitized);
+			CHECK_EQ(from_wtf16.size(), internal::utf16_to_utf8_size_scalar(str.data(), str.size()));
+		});
+	}
+
+	SUBCASE("UTF-32 to UTF-8") {
+		static_assert(utf32_to_utf8_size(U"🐓鸡ĜG", 4) == 10);
+		static_assert(!is_unicode_scalar_value(0xD800) && !is_unicode_scalar_value(0x110000));
+
+		const std::u32string_view text = U"🐓鸡ĜG This is a good text 🐓鸡ĜG";
+		const std::u8string_view expected = u8"🐓鸡ĜG This is a good text 🐓鸡ĜG";
+		char8_t buffer[64] = {};
+		CHECK_EQ(utf32_to_utf8_size(text.data(), text.size()), expected.size());
+		CHECK_EQ(utf32_to_utf8(text.data(), text.size(), buffer), expected.size());
+		CHECK_EQ(std::u8string_view(buffer, expected.size()), expected);
+
+		// surrogates and out of range values become U+FFFD
+		const char32_t bad[] = {U'G', 0xD800, 0xDFFF, 0x110000, 0xFFFFFFFF, U'G'};
+		const std::u8string_view bad_expected = u8"G\uFFFD\uFFFD\uFFFD\uFFFDG";
+		CHECK_EQ(utf32_to_utf8_size(bad, 6), bad_expected.size());
+		CHECK_EQ(utf32_to_utf8(bad, 6, buffer), bad_expected.size());
+		CHECK_EQ(std::u8string_view(buffer, bad_expected.size()), bad_expected);
+
+		// vector blocks must agree with the scalar encoder
+		const char32_t code_points[] = {U'a', U'Ĝ', U'鸡', U'🐓', 0x7F, 0x80, 0x7FF, 0x800, 0xFFFF, 0x10000, 0x10FFFF, 0xD800, 0x110000, 0x80000000};
+		std::vector<char8_t> simd_out, scalar_out;
+		for_each_random_text<std::u32string>({.seed = 42, .max_count = 100, .favored = 1}, code_points, [&](const std::u32string& str, std::mt19937&) {
+			const size_t size = internal::utf32_to_utf8_size_scalar(str.data(), str.size());
+			simd_out.assign(size, 0);
+			scalar_out.assign(size, 0);
+			CHECK_EQ(utf32_to_utf8_size(str.data(), str.size()), size);
+			CHECK_EQ(utf32_to_utf8(str.data(), str.size(), simd_out.data()), size);
+			internal::utf32_to_utf8_scalar(str.data(), str.size(), scalar_out.data());
+			CHECK_EQ(simd_out, scalar_out);
+			CHECK(utf8_is_valid(simd_out.data(), simd_out.size()));
+		});
+	}
+
+	SUBCASE("UTF-8 to UTF-16 & UTF-32") {
+		static_assert(utf8_to_utf16_size(u8"🐓鸡ĜG", 10) == 5);
+		static_assert(utf8_to_utf32_size(u8"🐓鸡ĜG", 10) == 4);
+
+		const std::u8string_view text = u8"🐓鸡ĜG This is a good text 🐓鸡ĜG";
+		const std::u16string_view expected_16 = u"🐓鸡ĜG This is a good text 🐓鸡ĜG";
+		const std::u32string_view expected_32 = U"🐓鸡ĜG This is a good text 🐓鸡ĜG";
+		char16_t buffer_16[64] = {};
+		char32_t buffer_32[64] = {};
+		CHECK_EQ(utf8_to_utf16_size(text.data(), text.size()), expected_16.size());
+		CHECK_EQ(utf8_to_utf16(text.data(), text.size(), buffer_16), expected_16.size());
+		CHECK_EQ(std::u16string_view(buffer_16, expected_16.size()), expected_16);
+		CHECK_EQ(utf8_to_utf32_size(text.data(), text.size()), expected_32.size());
+		CHECK_EQ(utf8_to_utf32(text.data(), text.size(), buffer_32), expected_32.size());
+		CHECK_EQ(std::u32string_view(buffer_32, expected_32.size()), expected_32);
+
+		// one U+FFFD per maximal ill-formed subpart
+		const std::u8string_view bad = u8"G\xF0\x9F\x90G\xC0\xAF\xED\xA0\x80";
+		const std::u32string_view bad_expected = U"G\uFFFDG\uFFFD\uFFFD\uFFFD\uFFFD\uFFFD";
+		CHECK_EQ(utf8_to_utf32_size(bad.data(), bad.size()), bad_expected.size());
+		CHECK_EQ(utf8_to_utf32(bad.data(), bad.size(), buffer_32), bad_expected.size());
+		CHECK_EQ(std::u32string_view(buffer_32, bad_expected.size()), bad_expected);
+
+		// vector paths must agree with the scalar decoder
+		const std::u8string_view pieces[] = {u8"a", u8"Ĝ", u8"鸡", u8"🐓", u8"text "};
+		std::vector<char16_t> simd_16, scalar_16;
+		std::vector<char32_t> simd_32, scalar_32;
+		for_each_random_text<std::u8string>({.seed = 42, .favored = 1, .max_damage = 1}, pieces, [&](const std::u8string& str, std::mt19937&) {
+			const size_t size_16 = internal::utf8_to_utf16_size_scalar(str.data(), str.size());
+			simd_16.assign(size_16, 0);
+			scalar_16.assign(size_16, 0);
+			CHECK_EQ(utf8_to_utf16_size(str.data(), str.size()), size_16);
+			CHECK_EQ(utf8_to_utf16(str.data(), str.size(), simd_16.data()), size_16);
+			internal::utf8_to_utf16_scalar(str.data(), str.size(), scalar_16.data());
+			CHECK_EQ(simd_16, scalar_16);
+
+			const size_t size_32 = internal::utf8_to_utf32_size_scalar(str.data(), str.size());
+			simd_32.assign(size_32, 0);
+			scalar_32.assign(size_32, 0);
+			CHECK_EQ(utf8_to_utf32_size(str.data(), str.size()), size_32);
+			CHECK_EQ(utf8_to_utf32(str.data(), str.size(), simd_32.data()), size_32);
+			internal::utf8_to_utf32_scalar(str.data(), str.size(), scalar_32.data());
+			CHECK_EQ(simd_32, scalar_32);
+		});
+	}
+
+	SUBCASE("UTF-8 text length") {
+		static_assert(utf8_text_length(u8"🐓鸡ĜG", 10) == 4);
+		static_assert(utf8_buffer_index_to_text(u8"🐓鸡ĜG", 10, 5) == 1);
+		static_assert(utf8_text_index_to_buffer(u8"🐓鸡ĜG", 10, 3) == 9);
+
+		// a leading byte that fits takes its whole length, other ill-formed code units step one by one
+		const std::u8string_view bad = u8"G\x80\xE9\xB8G\xF0\x9F";
+		CHECK_EQ(utf8_text_length(bad.data(), bad.size()), 5);
+		CHECK_EQ(utf8_buffer_index_to_text(bad.data(), bad.size(), 4), 2);
+		CHECK_EQ(utf8_text_index_to_buffer(bad.data(), bad.size(), 4), 6);
+
+		// vector paths must step exactly like the cursor
+		const std::u8string_view pieces[] = {u8"a", u8"Ĝ", u8"鸡", u8"🐓", u8"text "};
+		const random_text_options options{.seed = 7, .rounds = 300, .max_count = 120, .long_count = 2000, .favored = 1, .max_damage = 2};
+		for_each_random_text<std::u8string>(options, pieces, [](const std::u8string& str, std::mt19937& rng) {
+			if (str.empty()) {
+				return;
+			}
+
+			const auto size = static_cast<uint32_t>(str.size());
+			const size_t length = utf8_code_point_index(str.data(), size, size - 1) + 1;
+			CHECK_EQ(utf8_text_length(str.data(), str.size()), length);
+			for (int probe = 0; probe < 8; ++probe) {
+				const size_t index = rng() % str.size();
+				CHECK_EQ(utf8_buffer_index_to_text(str.data(), str.size(), index), utf8_code_point_index(str.data(), size, index));
+				const size_t text_index = rng() % length;
+				CHECK_EQ(utf8_text_index_to_buffer(str.data(), str.size(), text_index), utf8_code_unit_index(str.data(), size, text_index));
+			}
+		});
+	}
+
+	SUBCASE("Latin-1 & Windows-1252") {
+		static_assert(latin1_to_utf8_size("G\xE9\xFF", 3) == 5);
+		static_assert(cp1252_to_utf8_size("G\x80\x81", 3) == 6);
+
+		const std::string_view latin1 = "caf\xE9 \xA9 \x80\xFF";
+		char8_t buffer[64] = {};
+		CHECK_EQ(latin1_to_utf8_size(latin1.data(), latin1.size()), 13);
+		CHECK_EQ(latin1_to_utf8(latin1.data(), latin1.size(), buffer), 13);
+		CHECK_EQ(std::u8string_view(buffer, 13), u8"café © \u0080ÿ");
+		CHECK_EQ(cp1252_to_utf8_size(latin1.data(), latin1.size()), 14);
+		CHECK_EQ(cp1252_to_utf8(latin1.data(), latin1.size(), buffer), 14);
+		CHECK_EQ(std::u8string_view(buffer, 14), u8"café © €ÿ");
+
+		// undefined windows-1252 bytes keep their C1 control
+		CHECK_EQ(cp1252_to_utf8("\x81\x8D\x9F", 3, buffer), 6);
+		CHECK_EQ(std::u8string_view(buffer, 6), u8"\u0081\u008DŸ");
+
+		// code points above U+00FF and ill-formed subparts are replaced
+		const std::u8string_view text = u8"café 鸡\xE9\xB8G🐓ÿ";
+		char latin1_buffer[64] = {};
+		CHECK_EQ(utf8_to_latin1(text.data(), text.size(), latin1_buffer), 10);
+		CHECK_EQ(std::string_view(latin1_buffer, 10), "caf\xE9 ??G?\xFF");
+		CHECK_EQ(utf8_to_latin1(text.data(), text.size(), latin1_buffer, '_'), 10);
+		CHECK_EQ(std::string_view(latin1_buffer, 10), "caf\xE9 __G_\xFF");
+
+		// dst sized exactly as documented, multibyte blocks leave fewer code units than bytes
+		for (const std::u8string_view mixed : {u8"鸡é鸡a鸡é鸡a鸡é鸡a鸡é鸡a鸡é鸡a鸡é鸡a鸡é鸡aé", u8"éaéaéaéaéaéaéa鸡a鸡a鸡a鸡a鸡a鸡a鸡a鸡"}) {
+			const size_t exact = utf8_to_utf32_size(mixed.data(), mixed.size());
+			CHECK_EQ(exact, 29);
+			std::vector<char> exact_buffer(exact);
+			CHECK_EQ(utf8_to_latin1(mixed.data(), mixed.size(), exact_buffer.data()), exact);
+			CHECK_EQ(exact_buffer[exact - 1], mixed.back() == u8'\xA9' ? '\xE9' : '?');
+		}
+
+		// vector blocks must agree with the scalar loops
+		// every byte, the ascii half favored
+		std::vector<char> bytes(256);
+		std::iota(bytes.begin(), bytes.end(), '\0');
+		std::vector<char8_t> simd_out, scalar_out;
+		std::vector<char> simd_back, scalar_back;
+		const random_text_options options{.seed = 1252, .max_count = 100, .long_count = 1000, .favored = 128};
+		for_each_random_text<std::string>(options, bytes, [&](const std::string& str, std::mt19937& rng) {
+
+			const size_t size = internal::latin1_to_utf8_size_scalar(str.data(), str.size());
+			simd_out.assign(size + 16, 0);
+			scalar_out.assign(size + 16, 0);
+			CHECK_EQ(latin1_to_utf8_size(str.data(), str.size()), size);
+			CHECK_EQ(latin1_to_utf8(str.data(), str.size(), simd_out.data()), size);
+			internal::latin1_to_utf8_scalar(str.data(), str.size(), scalar_out.data());
+			CHECK_EQ(simd_out, scalar_out);
+
+			// latin-1 round trips exactly
+			simd_back.assign(size, 0);
+			CHECK_EQ(utf8_to_latin1(simd_out.data(), size, simd_back.data()), str.size());
+			CHECK_EQ(std::string_view(simd_back.data(), str.size()), str);
+
+			const size_t cp_size = internal::cp1252_to_utf8_size_scalar(str.data(), str.size());
+			simd_out.assign(cp_size + 16, 0);
+			scalar_out.assign(cp_size + 16, 0);
+			CHECK_EQ(cp1252_to_utf8_size(str.data(), str.size()), cp_size);
+			CHECK_EQ(cp1252_to_utf8(str.data(), str.size(), simd_out.data()), cp_size);
+			internal::cp1252_to_utf8_scalar(str.data(), str.size(), scalar_out.data());
+			CHECK_EQ(simd_out, scalar_out);
+
+			// damaged utf-8 with code points outside latin-1
+			for (size_t bad_count = rng() % 4; cp_size && bad_count; --bad_count) {
+				simd_out[rng() % cp_size] = static_cast<char8_t>(rng());
+			}
+			simd_back.assign(cp_size, 0);
+			scalar_back.assign(cp_size, 0);
+			const size_t written = utf8_to_latin1(simd_out.data(), cp_size, simd_back.data());
+			CHECK_EQ(written, internal::utf8_to_latin1_scalar(simd_out.data(), cp_size, scalar_back.data(), '?'));
+			CHECK_EQ(written, utf8_to_utf32_size(simd_out.data(), cp_size));
+			simd_back.resize(written);
+			scalar_back.resize(written);
+			CHECK_EQ(simd_back, scalar_back);
+		});
+	}
+
+	SUBCASE("UTF-8 sanitize") {
+		static_assert(utf8_sanitized_size(u8"G\xE9\xB8G", 4) == 5);
+
+		// one U+FFFD per maximal ill-formed subpart, like decode_utf
+		const std::u8string_view bad = u8"G\xE9\xB8G\x80\x80\xF0\x9F\x90\xED\xA0\x80鸡\xF0\x9F";
+		const std::u8string_view expected = u8"G\uFFFDG\uFFFD\uFFFD\uFFFD\uFFFD\uFFFD\uFFFD鸡\uFFFD";
+		char8_t buffer[64] = {};
+		CHECK_EQ(utf8_sanitized_size(bad.data(), bad.size()), expected.size());
+		CHECK_EQ(utf8_sanitize(bad.data(), bad.size(), buffer), expected.size());
+		CHECK_EQ(std::u8string_view(buffer, expected.size()), expected);
+
+		// must agree with a round trip through utf-32
+		const std::u8string_view pieces[] = {u8"a", u8"Ĝ", u8"鸡", u8"🐓", u8"text "};
+		std::vector<char32_t> utf32;
+		std::vector<char8_t> expected_out, out;
+		const random_text_options options{.seed = 13, .rounds = 300, .long_count = 800, .max_damage = 3};
+		for_each_random_text<std::u8string>(options, pieces, [&](const std::u8string& str, std::mt19937&) {
+			utf32.resize(str.size());
+			utf32.resize(utf8_to_utf32(str.data(), str.size(), utf32.data()));
+			expected_out.resize(utf32.size() * 4);
+			expected_out.resize(utf32_to_utf8(utf32.data(), utf32.size(), expected_out.data()));
+
+			const size_t size = utf8_sanitized_size(str.data(), str.size());
+			out.assign(size, 0);
+			CHECK_EQ(size, expected_out.size());
+			CHECK_EQ(utf8_sanitize(str.data(), str.size(), out.data()), size);
+			CHECK_EQ(out, expected_out);
+		});
+	}
 }
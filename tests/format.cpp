@@ -70,4 +70,15 @@ TEST_CASE("sakura") {
 	CHECK_EQ(format(u8"{:*^6}", 'x'), u8"**x***");
 	CHECK_EQ(format(u8"{:6d}", c), u8"   120");
 	CHECK_EQ(format(u8"{:6}", true), u8"true  ");
+
+	// string width & precision
+	CHECK_EQ(format(u8"{:6}", u8"abc"), u8"abc   ");
+	CHECK_EQ(format(u8"{:.2}", u8"abcd"), u8"ab");
+	CHECK_EQ(format(u8"{:.3}", u8"ab\r\ncd"), u8"ab\r\n");
+	CHECK_EQ(format(u8"{:.3}", u8"abce\u0301f"), u8"abc");
+	CHECK_EQ(format(u8"{:.3}", u8"abe\u0301f"), u8"abe\u0301");
+	CHECK_EQ(format(u8"{:4}", u8"鸡a"), u8"鸡a ");
+	CHECK_EQ(format(u8"{:4}", u8"☕䷀"), u8"☕䷀");
+	CHECK_EQ(format(u8"{:.3}", u8"👍🏽ab"), u8"👍🏽a");
+	CHECK_EQ(format(u8"{:.4}", u8"😀😀\u200D😀x"), u8"😀😀\u200D😀");
 }
@@ -0,0 +1,170 @@
+#include <doctest/doctest.h>
+#include <u8lib/mapped_text.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace
+{
+	// write bytes into a temporary file removed on scope exit
+	struct temp_file {
+		explicit temp_file(const std::vector<uint8_t>& bytes) {
+			static int counter = 0;
+			path = std::filesystem::temp_directory_path() / ("u8lib_mapped_text_" + std::to_string(counter++) + ".txt");
+			FILE* fp = std::fopen(path.string().c_str(), "wb");
+			REQUIRE(fp);
+			if (!bytes.empty()) {
+				std::fwrite(bytes.data(), 1, bytes.size(), fp);
+			}
+			std::fclose(fp);
+		}
+		~temp_file() {
+			std::filesystem::remove(path);
+		}
+
+		std::u8string name() const {
+			return path.u8string();
+		}
+
+		std::filesystem::path path;
+	};
+
+	template<typename Char>
+	std::vector<uint8_t> encode_units(std::initializer_list<uint8_t> bom, std::basic_string_view<Char> text, bool big_endian) {
+		std::vector<uint8_t> bytes(bom);
+		for (const Char ch : text) {
+			for (size_t i = 0; i < sizeof(Char); ++i) {
+				const size_t shift = 8 * (big_endian ? sizeof(Char) - 1 - i : i);
+				bytes.push_back(static_cast<uint8_t>(static_cast<uint32_t>(ch) >> shift));
+			}
+		}
+		return bytes;
+	}
+}
+
+TEST_CASE("Test mapped_text") {
+	using namespace u8lib;
+
+	SUBCASE("sniff bom") {
+		constexpr uint8_t utf8[] = {0xEF, 0xBB, 0xBF, 'a'};
+		constexpr uint8_t utf16le[] = {0xFF, 0xFE, 'a', 0x00};
+		constexpr uint8_t utf16be[] = {0xFE, 0xFF};
+		constexpr uint8_t utf32le[] = {0xFF, 0xFE, 0x00, 0x00};
+		constexpr uint8_t utf32be[] = {0x00, 0x00, 0xFE, 0xFF};
+		constexpr uint8_t none[] = {0xEF, 0xBB};
+
+		static_assert(sniff_bom(utf8, 4).encoding == text_encoding::utf8 && sniff_bom(utf8, 4).size == 3);
+		CHECK_EQ(sniff_bom(utf16le, 4).encoding, text_encoding::utf16le);
+		CHECK_EQ(sniff_bom(utf16le, 4).size, 2);
+		CHECK_EQ(sniff_bom(utf16be, 2).encoding, text_encoding::utf16be);
+		CHECK_EQ(sniff_bom(utf32le, 4).encoding, text_encoding::utf32le);
+		CHECK_EQ(sniff_bom(utf32le, 4).size, 4);
+		CHECK_EQ(sniff_bom(utf32le, 3).encoding, text_encoding::utf16le);
+		CHECK_EQ(sniff_bom(utf32be, 4).encoding, text_encoding::utf32be);
+		CHECK_EQ(sniff_bom(none, 2).encoding, text_encoding::utf8);
+		CHECK_EQ(sniff_bom(none, 2).size, 0);
+		CHECK_EQ(sniff_bom(nullptr, 0).size, 0);
+	}
+
+	SUBCASE("utf-8") {
+		const std::u8string_view text = u8"G🐓鸡Ĝ\nline";
+		temp_file plain(std::vector<uint8_t>(text.begin(), text.end()));
+		mapped_text mapped(plain.name().c_str());
+		REQUIRE(mapped.is_open());
+		CHECK(mapped.is_zero_copy());
+		CHECK_EQ(mapped.encoding(), text_encoding::utf8);
+		CHECK_EQ(mapped.bom_size(), 0);
+		CHECK_EQ(mapped.text(), u8string_view(text.data(), text.size()));
+		CHECK_EQ(reinterpret_cast<const uint8_t*>(mapped.text().data()), mapped.bytes());
+
+		std::vector<uint8_t> bytes = {0xEF, 0xBB, 0xBF};
+		bytes.insert(bytes.end(), text.begin(), text.end());
+		temp_file with_bom(bytes);
+		CHECK(mapped.open(with_bom.name().c_str()));
+		CHECK_EQ(mapped.bom_size(), 3);
+		CHECK_EQ(mapped.byte_size(), text.size() + 3);
+		CHECK_EQ(mapped.text(), u8string_view(text.data(), text.size()));
+		CHECK_EQ(reinterpret_cast<const uint8_t*>(mapped.text().data()), mapped.bytes() + 3);
+	}
+
+	SUBCASE("utf-16 and utf-32") {
+		const std::u16string_view text16 = u"G🐓鸡Ĝ";
+		const std::u32string_view text32 = U"G🐓鸡Ĝ";
+		const u8string_view expected = u8"G🐓鸡Ĝ";
+
+		for (bool big_endian : {false, true}) {
+			temp_file utf16(encode_units(big_endian ? std::initializer_list<uint8_t>{0xFE, 0xFF} : std::initializer_list<uint8_t>{0xFF, 0xFE}, text16, big_endian));
+			mapped_text mapped16(utf16.name().c_str());
+			REQUIRE(mapped16.is_open());
+			CHECK_FALSE(mapped16.is_zero_copy());
+			CHECK_EQ(mapped16.encoding(), big_endian ? text_encoding::utf16be : text_encoding::utf16le);
+			CHECK_EQ(mapped16.text(), expected);
+			CHECK_EQ(mapped16.text().data(), mapped16.text().data());
+
+			temp_file utf32(encode_units(big_endian ? std::initializer_list<uint8_t>{0x00, 0x00, 0xFE, 0xFF} : std::initializer_list<uint8_t>{0xFF, 0xFE, 0x00, 0x00}, text32, big_endian));
+			mapped_text mapped32(utf32.name().c_str());
+			REQUIRE(mapped32.is_open());
+			CHECK_EQ(mapped32.encoding(), big_endian ? text_encoding::utf32be : text_encoding::utf32le);
+			CHECK_EQ(mapped32.text(), expected);
+		}
+
+		// long enough to cut sequences between chunks
+		std::u16string long_text;
+		std::u8string long_expected;
+		for (int i = 0; i < 3000; ++i) {
+			long_text += u"a🐓鸡";
+			long_expected += u8"a🐓鸡";
+		}
+		temp_file long_file(encode_units({0xFF, 0xFE}, std::u16string_view(long_text), false));
+		mapped_text long_mapped(long_file.name().c_str());
+		CHECK_EQ(long_mapped.text(), u8string_view(long_expected.data(), long_expected.size()));
+	}
+
+	SUBCASE("ill-formed") {
+		// unpaired surrogate, then an odd trailing byte
+		std::vector<uint8_t> bytes = encode_units({0xFF, 0xFE}, std::u16string_view(u"a\xD83D" u"b"), false);
+		bytes.push_back('c');
+		temp_file utf16(bytes);
+		mapped_text mapped(utf16.name().c_str());
+		CHECK_EQ(mapped.text(), u8"a�b�");
+
+		temp_file utf32(encode_units({0xFF, 0xFE, 0x00, 0x00}, std::u32string_view(U"a\x110000" U"b"), false));
+		mapped.open(utf32.name().c_str());
+		CHECK_EQ(mapped.text(), u8"a�b");
+	}
+
+	SUBCASE("open & close") {
+		mapped_text mapped;
+		CHECK_FALSE(mapped.is_open());
+		CHECK_FALSE(mapped.open(u8"u8lib_mapped_text_missing.txt"));
+		CHECK_FALSE(mapped.is_open());
+
+		temp_file empty(std::vector<uint8_t>{});
+		CHECK(mapped.open(empty.name().c_str()));
+		CHECK(mapped.is_open());
+		CHECK(mapped.text().empty());
+
+		temp_file utf16(encode_units({0xFF, 0xFE}, std::u16string_view(u"moved"), false));
+		mapped.open(utf16.name().c_str());
+		CHECK_EQ(mapped.text(), u8"moved");
+		mapped_text moved(std::move(mapped));
+		CHECK_FALSE(mapped.is_open());
+		CHECK_EQ(moved.text(), u8"moved");
+
+		mapped = std::move(moved);
+		CHECK_EQ(mapped.text(), u8"moved");
+		mapped.close();
+		CHECK_FALSE(mapped.is_open());
+		CHECK(mapped.text().empty());
+
+		// the transcoded copy is freed, not just emptied
+		temp_file long_utf16(encode_units({0xFF, 0xFE}, std::u16string_view(u"long enough to be transcoded onto the heap"), false));
+		mapped.open(long_utf16.name().c_str());
+		CHECK_EQ(mapped.text(), u8"long enough to be transcoded onto the heap");
+		CHECK_GT(mapped.transcoded_capacity(), u8string::SSOCapacity);
+		mapped.close();
+		CHECK_EQ(mapped.transcoded_capacity(), u8string::SSOCapacity);
+	}
+}
@@ -0,0 +1,114 @@
+#include <doctest/doctest.h>
+#include <u8lib/multi_searcher.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+
+TEST_CASE("Test multi_searcher") {
+	using namespace u8lib;
+	using match = multi_searcher::match;
+
+	SUBCASE("build") {
+		multi_searcher empty;
+		CHECK_EQ(empty.pattern_count(), 0);
+		CHECK_EQ(empty.find_each(u8"text", [](size_t, size_t) {}), 0);
+		CHECK_FALSE(empty.find_first_of_any(u8"text"));
+
+		multi_searcher searcher{u8"he", u8"she", u8"his", u8"hers", u8""};
+		CHECK_EQ(searcher.pattern_count(), 5);
+		CHECK_EQ(searcher.pattern_size(3), 4);
+		// root, h, s, he, hi, sh, her, his, she, hers
+		CHECK_EQ(searcher.state_count(), 10);
+	}
+
+	SUBCASE("matches") {
+		const multi_searcher searcher{u8"he", u8"she", u8"his", u8"hers", u8"", u8"he"};
+		const std::vector<match> ushers{{1, 1}, {0, 2}, {5, 2}, {3, 2}};
+		const std::vector<match> this_one{{2, 1}};
+		CHECK_EQ(searcher.find_all(u8"ushers"), ushers);
+		CHECK_EQ(searcher.find_all(u8"this"), this_one);
+		CHECK(searcher.find_all(u8"").empty());
+		CHECK(searcher.contains_any(u8"hiss"));
+		CHECK_FALSE(searcher.contains_any(u8"hhh"));
+
+		CHECK_EQ(searcher.find_first_of_any(u8"ushers")->pattern, 1);
+		CHECK_EQ(searcher.find_first_of_any(u8"xhershe")->pattern, 3);
+		CHECK_FALSE(searcher.find_first_of_any(u8"nothing to see"));
+
+		// stopping early
+		size_t seen = 0;
+		const size_t reported = searcher.find_each(u8"he he he", [&](size_t, size_t offset) {
+			++seen;
+			return offset < 3;
+		});
+		CHECK_EQ(reported, 3);
+		CHECK_EQ(seen, 3);
+	}
+
+	SUBCASE("code point boundaries") {
+		// the tail and the head of € alone, and a whole one
+		const multi_searcher searcher{u8"\x82\xAC", u8"\xE2\x82", u8"€", u8"🐓"};
+		const std::vector<match> whole{{2, 1}, {3, 5}};
+		const std::vector<match> after_tail{{2, 2}};
+		const std::vector<match> before_head{{2, 0}, {1, 3}};
+		CHECK_EQ(searcher.find_all(u8"a€b🐓"), whole);
+		CHECK_EQ(searcher.find_all(u8"\x82\xAC€"), after_tail);
+		CHECK_EQ(searcher.find_all(u8"€\xE2\x82"), before_head);
+	}
+
+	SUBCASE("agrees with naive search") {
+		const std::u8string letters[] = {u8"a", u8"b", u8"é", u8"鸡", u8"🐓"};
+		std::mt19937 rng{11};
+		auto random_text = [&](size_t count) {
+			std::u8string result;
+			for (size_t i = 0; i < count; ++i) {
+				result += letters[rng() % (2 + rng() % 4)];
+			}
+			return result;
+		};
+
+		for (int round = 0; round < 200; ++round) {
+			std::vector<std::u8string> storage;
+			const size_t pattern_count = 1 + rng() % (round % 10 ? 20 : 300);
+			for (size_t i = 0; i < pattern_count; ++i) {
+				storage.push_back(random_text(1 + rng() % 6));
+			}
+			std::vector<u8string_view> patterns;
+			for (const auto& each : storage) {
+				patterns.emplace_back(each.data(), each.size());
+			}
+			const multi_searcher searcher{patterns};
+			const std::u8string text = random_text(rng() % 300);
+
+			// by end offset, longer patterns first, then by index
+			std::vector<match> expected;
+			for (size_t end = 1; end <= text.size(); ++end) {
+				for (size_t size = end; size > 0; --size) {
+					for (size_t pattern = 0; pattern < patterns.size(); ++pattern) {
+						if (storage[pattern].size() == size && text.compare(end - size, size, storage[pattern]) == 0) {
+							expected.push_back({pattern, end - size});
+						}
+					}
+				}
+			}
+			std::vector<match> found = searcher.find_all({text.data(), text.size()});
+			// the order among equal patterns is by index
+			CHECK_EQ(found, expected);
+
+			std::optional<match> first;
+			for (const match& each : expected) {
+				if (!first || each.offset < first->offset ||
+					(each.offset == first->offset && storage[each.pattern].size() > storage[first->pattern].size())) {
+					first = each;
+				}
+			}
+			const auto found_first = searcher.find_first_of_any({text.data(), text.size()});
+			CHECK_EQ(found_first.has_value(), first.has_value());
+			if (first && found_first) {
+				CHECK_EQ(found_first->offset, first->offset);
+				CHECK_EQ(searcher.pattern_size(found_first->pattern), storage[first->pattern].size());
+			}
+		}
+	}
+}
@@ -0,0 +1,263 @@
+#include <doctest/doctest.h>
+#include <u8lib/search.hpp>
+#include <u8lib/string_view.hpp>
+
+#include <random>
+#include <string>
+
+TEST_CASE("Test search") {
+	using namespace u8lib;
+	constexpr size_t npos = u8string_view::npos;
+
+	SUBCASE("substring") {
+		static_assert(utf8_find(u8"a good text", 11, u8"text", 4) == 7);
+		static_assert(utf8_count(u8"abababa", 7, u8"aba", 3) == 2);
+
+		const std::u8string_view text = u8"This 🐓 is 🐓 a good 🐓 text 🐓, long enough for a couple of vector blocks";
+		CHECK_EQ(utf8_find(text.data(), text.size(), u8"🐓", 4), 5);
+		CHECK_EQ(utf8_find(text.data(), text.size(), u8"blocks", 6), text.size() - 6);
+		CHECK_EQ(utf8_find(text.data(), text.size(), u8"🐔", 4), npos);
+		CHECK_EQ(utf8_find(text.data(), text.size(), u8"", 0), 0);
+		CHECK_EQ(utf8_find(text.data(), 3, u8"This", 4), npos);
+		CHECK_EQ(utf8_count(text.data(), text.size(), u8"🐓", 4), 4);
+		CHECK_EQ(utf8_count(text.data(), text.size(), u8"", 0), 0);
+		CHECK_EQ(utf8_count(nullptr, 0, u8"ab", 2), 0);
+
+		// the first and the last byte match everywhere, only the middle tells
+		std::u8string haystack(200, u8'a');
+		haystack += u8"abba";
+		CHECK_EQ(utf8_find(haystack.data(), haystack.size(), u8"abba", 4), 200);
+		CHECK_EQ(utf8_find(haystack.data(), haystack.size(), u8"aaab", 4), 198);
+		CHECK_EQ(utf8_count(haystack.data(), haystack.size(), u8"aa", 2), 100);
+	}
+
+	SUBCASE("agrees with std") {
+		std::mt19937 rng{5};
+		for (int round = 0; round < 2000; ++round) {
+			// a small alphabet makes partial matches frequent
+			std::u8string haystack, needle;
+			const size_t size = rng() % (round % 10 ? 100 : 1000);
+			for (size_t i = 0; i < size; ++i) {
+				haystack += static_cast<char8_t>(u8'a' + rng() % 3);
+			}
+			const size_t needle_size = 1 + rng() % 40;
+			if (size && rng() % 2) {
+				const size_t pos = rng() % size;
+				needle = haystack.substr(pos, needle_size);
+			} else {
+				for (size_t i = 0; i < needle_size; ++i) {
+					needle += static_cast<char8_t>(u8'a' + rng() % 3);
+				}
+			}
+
+			const std::u8string_view view = haystack;
+			CHECK_EQ(utf8_find(haystack.data(), haystack.size(), needle.data(), needle.size()), view.find(needle));
+			size_t count = 0;
+			for (size_t pos = view.find(needle); pos != npos; pos = view.find(needle, pos + needle.size())) {
+				++count;
+			}
+			CHECK_EQ(utf8_count(haystack.data(), haystack.size(), needle.data(), needle.size()), count);
+			CHECK_EQ(utf8_rfind(haystack.data(), haystack.size(), needle.data(), needle.size()), view.rfind(needle));
+		}
+	}
+
+	SUBCASE("byte sets") {
+		static_assert(utf8_find_first_of(u8"key = value", 11, u8" =", 2) == 3);
+		static_assert(utf8_find_last_not_of(u8"value \t\r\n", 9, u8" \t\r\n", 4) == 4);
+
+		std::mt19937 rng{13};
+		for (int round = 0; round < 3000; ++round) {
+			// sets and text over a few ascii bytes, a few high bytes and the bytes of the nibble tables edges
+			const char8_t alphabet[] = {u8' ', u8'\t', u8',', u8'a', u8'z', 0x00, 0x0F, 0x7F, 0x80, 0x8F, 0xBF, 0xE9, 0xF0, 0xFF};
+			std::u8string text, set;
+			const size_t size = rng() % 100;
+			for (size_t i = 0; i < size; ++i) {
+				text += alphabet[rng() % std::size(alphabet)];
+			}
+			const size_t set_size = rng() % 6;
+			for (size_t i = 0; i < set_size; ++i) {
+				set += alphabet[rng() % std::size(alphabet)];
+			}
+
+			const std::u8string_view view = text;
+			CHECK_EQ(utf8_find_first_of(text.data(), size, set.data(), set_size), view.find_first_of(set));
+			CHECK_EQ(utf8_find_first_not_of(text.data(), size, set.data(), set_size), view.find_first_not_of(set));
+			CHECK_EQ(utf8_find_last_of(text.data(), size, set.data(), set_size), view.find_last_of(set));
+			CHECK_EQ(utf8_find_last_not_of(text.data(), size, set.data(), set_size), view.find_last_not_of(set));
+
+			const size_t pos = rng() % (size + 2);
+			const u8string_view u8view{text.data(), text.size()};
+			const u8string_view u8set{set.data(), set.size()};
+			const auto index_of = [](auto found) { return found ? static_cast<size_t>(found) : npos; };
+			CHECK_EQ(index_of(u8view.find_first_of(u8set, pos)), view.find_first_of(set, pos));
+			CHECK_EQ(index_of(u8view.find_first_not_of(u8set, pos)), view.find_first_not_of(set, pos));
+			CHECK_EQ(index_of(u8view.find_last_of(u8set, pos)), view.find_last_of(set, pos));
+			CHECK_EQ(index_of(u8view.find_last_not_of(u8set, pos)), view.find_last_not_of(set, pos));
+		}
+	}
+
+	SUBCASE("trim") {
+		const u8string_view text = u8" \t\r\n key, value;\t\r\n 鸡 \t\r\n";
+		CHECK_EQ(text.trim(u8" \t\r\n,;"), u8"key, value;\t\r\n 鸡");
+		CHECK_EQ(text.trim_start(u8" \t\r\n,;"), u8"key, value;\t\r\n 鸡 \t\r\n");
+		CHECK_EQ(text.trim_end(u8" \t\r\n鸡"), u8" \t\r\n key, value;");
+		CHECK_EQ(text.trim(u8" \t\r\nkey,valu;鸡"), u8"");
+		CHECK_EQ(u8string_view{u8"🐓🐔 🐓"}.trim(u8"🐓"), u8"🐔 ");
+		// the units of a code point are no set of their own
+		CHECK_EQ(u8string_view{u8"鸡"}.trim(u8"\xB8\xA1x"), u8"鸡");
+		CHECK_EQ(u8string_view{u8"x鸡x"}.trim(u8"x\xE9"), u8"鸡");
+
+		// against the code point loop
+		const std::u8string pieces[] = {u8" ", u8"\t", u8",", u8"a", u8"é", u8"鸡", u8"🐓"};
+		std::mt19937 rng{17};
+		for (int round = 0; round < 1000; ++round) {
+			std::u8string storage, set_storage;
+			const size_t size = rng() % 40;
+			for (size_t i = 0; i < size; ++i) {
+				storage += pieces[rng() % std::size(pieces)];
+			}
+			const size_t set_size = 1 + rng() % 3;
+			for (size_t i = 0; i < set_size; ++i) {
+				set_storage += pieces[rng() % (round % 2 ? 3 : std::size(pieces))];
+			}
+			const u8string_view view{storage.data(), storage.size()};
+			const u8string_view set{set_storage.data(), set_storage.size()};
+
+			size_t start = 0;
+			while (start < storage.size()) {
+				const size_t len = utf8_seq_len(storage[start]);
+				if (!set.contains(view.subview(start, len))) {
+					break;
+				}
+				start += len;
+			}
+			CHECK_EQ(view.trim_start(set), view.subview(start));
+			size_t end = storage.size();
+			while (end > 0) {
+				size_t begin = end - 1;
+				while ((storage[begin] & 0xC0) == 0x80) {
+					--begin;
+				}
+				if (!set.contains(view.subview(begin, end - begin))) {
+					break;
+				}
+				end = begin;
+			}
+			CHECK_EQ(view.trim_end(set), view.subview(0, end));
+		}
+	}
+
+	SUBCASE("searcher") {
+		static_assert(searcher{u8"text"}.find(u8"a good text", 11) == 7);
+		static_assert(rsearcher{u8"o"}.find(u8"a good text", 11) == 4);
+
+		CHECK_EQ(searcher{}.algorithm(), searcher::strategy::empty);
+		CHECK_EQ(searcher{u8"a"}.algorithm(), searcher::strategy::byte);
+		CHECK_EQ(searcher{std::u8string(32, u8'a')}.algorithm(), searcher::strategy::filter);
+		CHECK_EQ(searcher{std::u8string(33, u8'a')}.algorithm(), searcher::strategy::horspool);
+		CHECK_EQ(searcher{std::u8string(257, u8'a')}.algorithm(), searcher::strategy::two_way);
+
+		const std::u8string_view text = u8"🐓 one 🐓 two 🐓";
+		CHECK_EQ(searcher{}.find(text.data(), text.size()), 0);
+		CHECK_EQ(rsearcher{}.find(text.data(), text.size()), text.size());
+		CHECK_EQ(searcher{u8"🐓"}.find(text.data(), text.size()), 0);
+		CHECK_EQ(rsearcher{u8"🐓"}.find(text.data(), text.size()), text.size() - 4);
+		CHECK_EQ(searcher{u8"🐓"}.count(text.data(), text.size()), 3);
+		CHECK_EQ(rsearcher{u8"🐓"}.count(text.data(), text.size()), 3);
+		CHECK_EQ(searcher{u8"three"}.find(text.data(), text.size()), npos);
+		CHECK_EQ(searcher{u8"three"}.find(nullptr, 0), npos);
+	}
+
+	SUBCASE("searcher agrees with std") {
+		std::mt19937 rng{7};
+		for (int round = 0; round < 3000; ++round) {
+			// periodic needles over two letters are the hard cases for two-way
+			const int letters = 2 + round % 3;
+			std::u8string haystack, needle;
+			const size_t size = rng() % 2000;
+			for (size_t i = 0; i < size; ++i) {
+				haystack += static_cast<char8_t>(u8'a' + rng() % letters);
+			}
+			const size_t needle_size = round % 4 == 0 ? 1 + rng() % 40 : 1 + rng() % 400;
+			if (size && rng() % 2) {
+				needle = haystack.substr(rng() % size, needle_size);
+			} else {
+				const size_t period = 1 + rng() % 8;
+				for (size_t i = 0; i < needle_size; ++i) {
+					needle += i < period ? static_cast<char8_t>(u8'a' + rng() % letters) : needle[i - period];
+				}
+				if (rng() % 2) {
+					needle[rng() % needle_size] = static_cast<char8_t>(u8'a' + rng() % letters);
+				}
+			}
+
+			const std::u8string_view view = haystack;
+			const searcher forward{needle};
+			const rsearcher backward{needle};
+			CHECK_EQ(forward.find(haystack.data(), haystack.size()), view.find(needle));
+			CHECK_EQ(backward.find(haystack.data(), haystack.size()), view.rfind(needle));
+
+			size_t count = 0;
+			for (size_t pos = view.find(needle); pos != npos; pos = view.find(needle, pos + needle.size())) {
+				++count;
+			}
+			CHECK_EQ(forward.count(haystack.data(), haystack.size()), count);
+		}
+	}
+
+	SUBCASE("u8string_view") {
+		const u8string_view view = u8"key=value; key=other value; last key=🐓 value";
+		CHECK_EQ(view.find(u8"key"), 0);
+		CHECK_EQ(view.find(u8"key", 1), 11);
+		CHECK_EQ(view.find(u8"🐓", 0), 37);
+		CHECK_FALSE(view.find(u8"key", view.size()));
+		CHECK_FALSE(view.find(u8"key", view.size() + 1));
+		CHECK(view.find(u8"", view.size()));
+		CHECK(view.contains(u8"other"));
+		CHECK_FALSE(view.contains(u8"others"));
+		CHECK_EQ(view.count(u8"key="), 3);
+		CHECK_EQ(view.count(u8"value"), 3);
+
+		const auto [left, mid, right] = view.partition(u8"; ");
+		CHECK_EQ(left, u8"key=value");
+		CHECK_EQ(right, u8"key=other value; last key=🐓 value");
+
+		std::vector<u8string_view> parts;
+		view.split(parts, u8"; ");
+		CHECK_EQ(parts.size(), 3);
+		CHECK_EQ(parts[2], u8"last key=🐓 value");
+
+		CHECK_EQ(view.rfind(u8"key"), 33);
+		CHECK_EQ(view.rfind(u8"key", 32), 11);
+		CHECK_EQ(view.rfind(u8"key", 11), 11);
+		CHECK_FALSE(view.rfind(u8"value;;"));
+		CHECK(view.rfind(u8"", 3));
+	}
+
+	SUBCASE("u8string_view with searcher") {
+		const u8string_view view = u8"key=value; key=other value; last key=🐓 value";
+		const searcher key{u8"key="};
+		const searcher delimiter{u8"; "};
+		const rsearcher last_key{u8"key"};
+		CHECK_EQ(view.find(key), 0);
+		CHECK_EQ(view.find(key, 1), 11);
+		CHECK_FALSE(view.find(key, view.size() + 1));
+		CHECK_EQ(view.rfind(last_key), 33);
+		CHECK_EQ(view.rfind(last_key, 32), 11);
+		CHECK_EQ(view.rfind(last_key, 0), 0);
+		CHECK(view.contains(key));
+		CHECK_FALSE(view.contains(searcher{u8"others"}));
+		CHECK_EQ(view.count(key), 3);
+
+		const auto [left, mid, right] = view.partition(delimiter);
+		CHECK_EQ(left, u8"key=value");
+		CHECK_EQ(mid, u8"; ");
+
+		std::vector<u8string_view> parts;
+		CHECK_EQ(view.split(parts, delimiter), 3);
+		CHECK_EQ(parts[1], u8"key=other value");
+		size_t each = 0;
+		view.split_each([&](u8string_view part) { each += part.size(); }, delimiter);
+		CHECK_EQ(each, view.size() - 4);
+	}
+}
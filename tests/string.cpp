@@ -1420,6 +1420,121 @@ TEST_CASE("Test U8String") {
 		}
 	}
 
+	SUBCASE("validate") {
+		u8string str = long_literal;
+		CHECK(str.is_valid_utf8());
+		CHECK_EQ(str.validate_utf8(), u8string::npos);
+
+		str.append(u8"\xF0\x9F");
+		CHECK_FALSE(str.is_valid_utf8());
+		CHECK_EQ(str.validate_utf8(), long_literal.size());
+
+		str.trim_invalid_end();
+		CHECK(str.is_valid_utf8());
+
+		// valid text keeps its buffer
+		const auto* const buffer = str.c_str();
+		str.sanitize();
+		CHECK_EQ(str.c_str(), buffer);
+		CHECK_EQ(str, long_literal);
+
+		str.insert(4, u8"\xE9\xB8");
+		str.append(u8"\x80\xF0\x9F");
+		CHECK_EQ(u8string_view(str).sanitized(), u8string::concat(long_literal.subview(0, 4), u8"\uFFFD", long_literal.subview(4), u8"\uFFFD\uFFFD"));
+		str.sanitize();
+		CHECK(str.is_valid_utf8());
+		CHECK_FALSE(str.is_ascii());
+		CHECK_EQ(str.size(), long_literal.size() + 9);
+		CHECK_EQ(str.last_view(6), u8"\uFFFD\uFFFD");
+
+		u8string short_str = u8"a\xFF" u8"b";
+		short_str.sanitize();
+		CHECK(short_str.is_sso());
+		CHECK_EQ(short_str, u8"a\uFFFDb");
+
+		// every unit ill-formed fills the worst case reservation exactly
+		u8string all_bad(40, static_cast<char8_t>(0xFF));
+		all_bad.sanitize();
+		CHECK_EQ(all_bad.size(), 120);
+		CHECK(all_bad.is_valid_utf8());
+		CHECK_EQ(all_bad.last_view(3), u8"\uFFFD");
+
+		// the unused part of the worst case reservation is given back
+		u8string bad_head = u8string::concat(u8"\x80", long_literal);
+		bad_head.sanitize();
+		CHECK_EQ(bad_head, u8string::concat(u8"\uFFFD", long_literal));
+		CHECK_LE(bad_head.capacity(), 2 * bad_head.size());
+	}
+
+	SUBCASE("ascii flag") {
+		u8string str;
+		CHECK(str.is_ascii());
+
+		str.assign(u8"hello world, this is a long ascii text beyond sso");
+		CHECK(str.is_heap());
+		CHECK(str.is_ascii());
+		CHECK_EQ(str.text_length(), str.size());
+		CHECK_EQ(str.text_index_to_buffer(7), 7);
+		CHECK_EQ(str.buffer_index_to_text(7), 7);
+		CHECK_EQ(str.at_text(4), UTF8Seq{u8'o'});
+
+		str.append(u"!");
+		str.insert(0, 2, u8'>');
+		str.replace(0, 1, u8"<");
+		CHECK(str.is_ascii());
+
+		str.append(u8"鸡");
+		CHECK_FALSE(str.is_ascii());
+		CHECK_EQ(str.text_length(), str.size() - 2);
+		str.pop_back(3);
+		CHECK_FALSE(str.is_ascii());
+		str.clear();
+		CHECK(str.is_ascii());
+
+		str.assign(U"🐓");
+		CHECK_FALSE(str.is_ascii());
+		str.assign(u"ascii");
+		CHECK(str.is_ascii());
+		CHECK_EQ(u8string(3, u8'a').is_ascii(), true);
+		CHECK_EQ(u8string(3, static_cast<char8_t>(0xC0)).is_ascii(), false);
+
+		// cursors, iterators and ranges of a non-const string only read
+		str.assign(u8"hello world, this is a long ascii text beyond sso");
+		size_t count = 0;
+		for (const auto& seq : str.range()) {
+			count += seq.len;
+		}
+		for (const auto& seq : str.range_inv()) {
+			count += seq.len;
+		}
+		CHECK_EQ(count, 2 * str.size());
+		CHECK_EQ(str.cursor_begin().ref(), UTF8Seq{u8'h'});
+		CHECK_EQ(str.cursor_end().ref(), UTF8Seq{u8'o'});
+		CHECK_EQ(str.iter().ref(), UTF8Seq{u8'h'});
+		CHECK_EQ(str.iter_inv().ref(), UTF8Seq{u8'o'});
+		CHECK(str.is_ascii());
+		CHECK_EQ(str.text_length(), str.size());
+
+		// writable access may store anything
+		str = u8"ascii";
+		str.data()[0] = 0xE9;
+		CHECK_FALSE(str.is_ascii());
+		CHECK_EQ(str.text_length(), 3);
+		str = u8"ascii";
+		str[0] = u8'A';
+		CHECK_FALSE(str.is_ascii());
+
+		u8string other = u8"鸡";
+		str = u8"ascii";
+		str.swap(other);
+		CHECK_FALSE(str.is_ascii());
+		CHECK(other.is_ascii());
+		str.reserve(100);
+		CHECK_FALSE(str.is_ascii());
+		other.reserve(100);
+		CHECK(other.is_ascii());
+	}
+
 	SUBCASE("partition") {
 		// test split by view
 		{
@@ -1663,6 +1778,77 @@ TEST_CASE("Test U8String") {
 		CHECK_EQ(u8_str, reference_str);
 		CHECK_EQ(u16_str, reference_str);
 		CHECK_EQ(u32_str, reference_str);
+
+		// single pass transcoding: short text stays in sso, worst case reservation is given back
+		u8string short_u16_str = u"0123456789 ĜG 鸡";
+		CHECK(short_u16_str.is_sso());
+		CHECK_EQ(short_u16_str, u8"0123456789 ĜG 鸡");
+
+		std::u16string ascii_u16(1000, u'G');
+		u8string ascii_str = ascii_u16.c_str();
+		CHECK_EQ(ascii_str.size(), 1000);
+		CHECK_LT(ascii_str.capacity(), 2000);
+		ascii_str.insert(500, ascii_u16.c_str());
+		CHECK_EQ(ascii_str.size(), 2000);
+		CHECK_EQ(ascii_str, u8string(2000, u8'G'));
+		ascii_str.append(ascii_u16.c_str());
+		CHECK_EQ(ascii_str, u8string(3000, u8'G'));
+		ascii_str.insert(1, u"鸡");
+		CHECK_EQ(ascii_str.subview(0, 5), u8"G鸡G");
+		CHECK_EQ(ascii_str.size(), 3003);
+
+		CHECK_EQ(reference_str.to_utf16(), std::u16string_view{u16_c_str});
+		CHECK_EQ(reference_str.to_utf32(), std::u32string_view{u32_c_str});
+
+		// long utf-16 input through append/insert, with an unpaired surrogate
+		std::u16string long_u16;
+		u8string long_reference;
+		for (int i = 0; i < 16; ++i) {
+			long_u16 += u"鸡 text Ĝ 🐓 ";
+			long_reference.append(u8"鸡 text Ĝ 🐓 ");
+		}
+		u8string long_str = long_u16.c_str();
+		CHECK_EQ(long_str, long_reference);
+
+		const char16_t lone[] = {0xD83D, u'G', 0};
+		long_str.insert(0, lone);
+		long_str.append(lone);
+		CHECK_EQ(long_str.first_view(4), u8"\uFFFDG");
+		CHECK_EQ(long_str.last_view(4), u8"\uFFFDG");
+		CHECK(long_str.is_valid_utf8());
+	}
+
+	SUBCASE("8-bit encodings") {
+		u8string latin1_str = u8string::from_latin1("caf\xE9 \x80");
+		CHECK_EQ(latin1_str, u8"café \u0080");
+		CHECK(latin1_str.is_sso());
+		CHECK_FALSE(latin1_str.is_ascii());
+		CHECK_EQ(latin1_str.to_latin1(), "caf\xE9 \x80");
+
+		u8string cp1252_str = u8string::from_cp1252(std::string_view("\x93quoted\x94 \x80"));
+		CHECK_EQ(cp1252_str, u8"“quoted” €");
+		CHECK_EQ(cp1252_str.to_latin1(), "?quoted? ?");
+		CHECK_EQ(cp1252_str.to_latin1('*'), "*quoted* *");
+
+		u8string ascii_str = u8string::from_cp1252("ascii only");
+		CHECK(ascii_str.is_ascii());
+
+		// long input goes straight to the heap and gives the worst case reservation back
+		const std::string long_latin1(1000, '\xE9');
+		u8string long_str = u8string::from_latin1(long_latin1);
+		CHECK_EQ(long_str.size(), 2000);
+		CHECK_EQ(long_str.text_length(), 1000);
+		CHECK_EQ(long_str.to_latin1(), long_latin1);
+		const std::string long_ascii(1000, 'G');
+		u8string long_cp1252 = u8string::from_cp1252(long_ascii);
+		CHECK_EQ(long_cp1252, u8string(1000, u8'G'));
+		CHECK_LT(long_cp1252.capacity(), 2000);
+		CHECK(long_cp1252.is_ascii());
+
+		// a short span stops before the first code point that doesn't fit
+		char buffer[4];
+		CHECK_EQ(latin1_str.to_latin1(buffer), 4);
+		CHECK_EQ(std::string_view(buffer, 4), "caf\xE9");
 	}
 
 	SUBCASE("concat") {
@@ -271,6 +271,71 @@ TEST_CASE("Test u8string_view") {
 		CHECK_EQ(bad.trim_invalid_end(), trim_end);
 	}
 
+	SUBCASE("validate") {
+		u8string_view view{u8"🐓🐓🐓 This is a good text 🐓🐓🐓"};
+		u8string_view bad_start = view.subview(1);
+		u8string_view bad_end = view.subview(0, view.size() - 1);
+		u8string_view bad_mid{u8"good \xED\xA0\x80 text"};
+
+		CHECK(view.is_valid_utf8());
+		CHECK_EQ(view.validate_utf8(), u8string_view::npos);
+		CHECK(u8string_view{}.is_valid_utf8());
+
+		CHECK_FALSE(bad_start.is_valid_utf8());
+		CHECK_EQ(bad_start.validate_utf8(), 0);
+		CHECK_FALSE(bad_end.is_valid_utf8());
+		CHECK_EQ(bad_end.validate_utf8(), view.size() - 4);
+		CHECK_FALSE(bad_mid.is_valid_utf8());
+		CHECK_EQ(bad_mid.validate_utf8(), 5);
+	}
+
+	SUBCASE("convert") {
+		u8string_view view{u8"🐓鸡ĜG This is a good text 🐓鸡ĜG"};
+		std::u16string_view view_16{u"🐓鸡ĜG This is a good text 🐓鸡ĜG"};
+		std::u32string_view view_32{U"🐓鸡ĜG This is a good text 🐓鸡ĜG"};
+
+		CHECK_EQ(view.to_size<char16_t>(), view_16.size());
+		CHECK_EQ(view.to_size<char32_t>(), view_32.size());
+		CHECK_EQ(view.to_utf16(), view_16);
+		CHECK_EQ(view.to_utf32(), view_32);
+		CHECK(u8string_view{}.to_utf16().empty());
+
+		// span output stops before the first code point that doesn't fit
+		char16_t buffer_16[64] = {};
+		char32_t buffer_32[64] = {};
+		CHECK_EQ(view.to_utf16(buffer_16), view_16.size());
+		CHECK_EQ(std::u16string_view(buffer_16, view_16.size()), view_16);
+		CHECK_EQ(view.to_utf16(std::span{buffer_16, 3}), 3);
+		CHECK_EQ(view.to_utf16(std::span{buffer_16, 1}), 0);
+		CHECK_EQ(view.to_utf32(buffer_32), view_32.size());
+		CHECK_EQ(std::u32string_view(buffer_32, view_32.size()), view_32);
+		CHECK_EQ(view.to_utf32(std::span{buffer_32, 3}), 3);
+		CHECK_EQ(std::u32string_view(buffer_32, 3), U"🐓鸡Ĝ");
+
+		// ill-formed input
+		u8string_view bad = view.subview(1);
+		CHECK_EQ(bad.to_utf32().substr(0, 4), U"\uFFFD\uFFFD\uFFFD鸡");
+	}
+
+	SUBCASE("literal") {
+		constexpr u8string_view from_16 = literal<u"🐓鸡ĜG text">;
+		constexpr u8string_view from_32 = literal<U"🐓鸡ĜG text">;
+		constexpr u8string_view from_wide = literal<L"🐓鸡ĜG text">;
+		static_assert(from_16.size() == 15);
+		static_assert(from_16 == u8"🐓鸡ĜG text");
+		static_assert(from_32 == u8"🐓鸡ĜG text");
+		static_assert(from_wide == u8"🐓鸡ĜG text");
+		static_assert(literal<u8"as is"> == u8"as is");
+		static_assert(literal<u"">.empty());
+		// an unpaired surrogate transcodes like at runtime
+		static_assert(literal<u"a\xD800" u"b"> == u8"a\uFFFDb");
+
+		// one null terminated array per literal
+		CHECK_EQ(from_16.data()[from_16.size()], u8'\0');
+		CHECK_EQ(literal<u"🐓鸡ĜG text">.data(), from_16.data());
+		CHECK_EQ(from_wide.to_utf32(), std::u32string_view(U"🐓鸡ĜG text"));
+	}
+
 	SUBCASE("partition") {
 		SUBCASE("view partition") {
 			// util
@@ -432,6 +497,64 @@ TEST_CASE("Test u8string_view") {
 				3);
 			CHECK_EQ(count, 3);
 		}
+		SUBCASE("lazy split") {
+			static_assert(std::ranges::forward_range<split_range>);
+			static_assert(std::ranges::view<split_range>);
+
+			std::vector<u8string_view> result;
+			for (const u8string_view piece : view.split_view(split_view)) {
+				result.push_back(piece);
+			}
+			CHECK_EQ(result.size(), 5);
+			for (uint64_t i = 0; i < result.size(); ++i) {
+				CHECK_EQ(result[i], split_result[i]);
+			}
+
+			const searcher delimiter{split_view.view()};
+			result.clear();
+			for (const u8string_view piece : view.split_view(delimiter, true, 3)) {
+				result.push_back(piece);
+			}
+			CHECK_EQ(result.size(), 3);
+			for (uint64_t i = 0; i < result.size(); ++i) {
+				CHECK_EQ(result[i], split_result_cull_empty[i]);
+			}
+
+			// composes with the standard views
+			auto not_empty = [](u8string_view piece) { return !piece.empty(); };
+			auto first_two = view.split_view(split_view) | std::views::filter(not_empty) | std::views::drop(1) | std::views::take(2);
+			result.clear();
+			std::ranges::copy(first_two, std::back_inserter(result));
+			CHECK_EQ(result.size(), 2);
+			CHECK_EQ(result[0], u8" is ");
+			CHECK_EQ(result[1], u8" a good ");
+			CHECK_EQ(std::ranges::distance(u8string_view{u8"a,b,,c"}.split_view(u8",")), 4);
+			CHECK_EQ(u8string_view{u8"a,b"}.split_view(u8"").front(), u8"a,b");
+			CHECK(u8string_view{u8""}.split_view(u8",", true).empty());
+			// an empty view is one empty piece like with split_each, whatever its data pointer is
+			CHECK_EQ(std::ranges::distance(u8string_view{u8""}.split_view(u8",")), 1);
+			CHECK_EQ(std::ranges::distance(u8string_view{}.split_view(u8",")), 1);
+			CHECK_EQ(u8string_view{}.split_view(u8",").front(), u8"");
+			CHECK(u8string_view{}.split_view(u8",", true).empty());
+
+			// the same pieces split_each yields
+			const u8string_view texts[] = {u8string_view{}, u8"", u8",", u8",,", u8"a", u8"a,", u8",a", u8"a,,b,", u8"🐓,🐓🐓,,🐓", u8"::a::b:::c::"};
+			const u8string_view delimiters[] = {u8",", u8"🐓", u8"::", u8"a,"};
+			for (const u8string_view text : texts) {
+				for (const u8string_view each_delimiter : delimiters) {
+					for (const bool cull_empty : {false, true}) {
+						for (const size_t limit : {size_t{0}, size_t{1}, size_t{2}, u8string_view::npos}) {
+							std::vector<u8string_view> expected;
+							text.split(expected, each_delimiter, cull_empty, limit);
+							const auto pieces = text.split_view(each_delimiter, cull_empty, limit);
+							result.clear();
+							std::ranges::copy(pieces, std::back_inserter(result));
+							CHECK_EQ(result, expected);
+						}
+					}
+				}
+			}
+		}
 	}
 
 	SUBCASE("text index") {
@@ -0,0 +1,87 @@
+#include <doctest/doctest.h>
+#include <u8lib/text_index.hpp>
+#include <u8lib/string.hpp>
+
+#include <random>
+
+TEST_CASE("Test u8text_index") {
+	using namespace u8lib;
+
+	SUBCASE("build") {
+		u8text_index empty_index;
+		CHECK_FALSE(empty_index.is_built());
+		CHECK_EQ(empty_index.text_length(), 0);
+		CHECK(empty_index.is_built());
+		CHECK_EQ(empty_index.text_index_to_buffer(0), 0);
+
+		u8text_index index{u8"🐓鸡ĜG", 2};
+		CHECK_EQ(index.stride(), 2);
+		CHECK_FALSE(index.is_built());
+		index.build();
+		CHECK(index.is_built());
+		CHECK_EQ(index.text_length(), 4);
+
+		index.reset(u8"鸡G");
+		CHECK_FALSE(index.is_built());
+		CHECK_EQ(index.text_length(), 2);
+		index.clear();
+		CHECK(index.text().empty());
+		CHECK_EQ(index.text_length(), 0);
+	}
+
+	SUBCASE("lookup") {
+		constexpr UTF8Seq seq[] = {
+			{u8"🐓", 4},
+			{u8"鸡", 3},
+			{u8"Ĝ", 2},
+			{u8"G", 1},
+		};
+		u8text_index index{u8"🐓鸡ĜG", 2};
+
+		CHECK_EQ(index.buffer_index_to_text(0), 0);
+		CHECK_EQ(index.buffer_index_to_text(3), 0);
+		CHECK_EQ(index.buffer_index_to_text(4), 1);
+		CHECK_EQ(index.buffer_index_to_text(6), 1);
+		CHECK_EQ(index.buffer_index_to_text(7), 2);
+		CHECK_EQ(index.buffer_index_to_text(8), 2);
+		CHECK_EQ(index.buffer_index_to_text(9), 3);
+
+		CHECK_EQ(index.text_index_to_buffer(0), 0);
+		CHECK_EQ(index.text_index_to_buffer(1), 4);
+		CHECK_EQ(index.text_index_to_buffer(2), 7);
+		CHECK_EQ(index.text_index_to_buffer(3), 9);
+		CHECK_EQ(index.text_index_to_buffer(4), 10);
+
+		CHECK_EQ(index.at_text_index(0), seq[0]);
+		CHECK_EQ(index.at_text_index(2), seq[2]);
+		CHECK_EQ(index.last_text_index(0), seq[3]);
+		CHECK_EQ(index.last_text_index(2), seq[1]);
+	}
+
+	SUBCASE("match string view") {
+		std::mt19937 rng{11};
+		const u8string_view pieces[] = {u8"a", u8"Ĝ", u8"鸡", u8"🐓", u8"text "};
+		for (int round = 0; round < 50; ++round) {
+			u8string str;
+			const size_t count = rng() % 3000;
+			for (size_t i = 0; i < count; ++i) {
+				str.append(pieces[rng() % std::size(pieces)]);
+			}
+			for (size_t bad_count = rng() % 3; !str.empty() && bad_count; --bad_count) {
+				str.data()[rng() % str.size()] = static_cast<char8_t>(rng());
+			}
+
+			const u8string_view view = str;
+			const u8text_index index{view, 1 + rng() % 200};
+			const size_t length = view.text_length();
+			CHECK_EQ(index.text_length(), length);
+			CHECK_EQ(index.text_index_to_buffer(length), view.size());
+			for (int probe = 0; !view.empty() && probe < 20; ++probe) {
+				const size_t buffer_index = rng() % view.size();
+				CHECK_EQ(index.buffer_index_to_text(buffer_index), view.buffer_index_to_text(buffer_index));
+				const size_t text_index = rng() % length;
+				CHECK_EQ(index.text_index_to_buffer(text_index), view.text_index_to_buffer(text_index));
+			}
+		}
+	}
+}
@@ -0,0 +1,152 @@
+#include <doctest/doctest.h>
+#include <u8lib/transcoder.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+	// feed input in random chunks into random sized output windows
+	template<typename From, typename To>
+	std::basic_string<To> transcode_chunked(std::basic_string_view<From> input, std::mt19937& rng, size_t max_chunk, size_t max_window) {
+		u8lib::utf_transcoder<From, To> transcoder;
+		std::basic_string<To> result;
+		std::vector<To> window(max_window);
+		size_t pos = 0;
+		while (pos < input.size()) {
+			const size_t chunk = std::min<size_t>(input.size() - pos, 1 + rng() % max_chunk);
+			size_t read = 0;
+			while (read < chunk) {
+				const size_t window_size = 4 + rng() % (max_window - 3);
+				const auto [r, w] = transcoder.transcode(input.substr(pos + read, chunk - read), std::span<To>{window.data(), window_size});
+				result.append(window.data(), w);
+				read += r;
+			}
+			pos += chunk;
+		}
+		result.append(window.data(), transcoder.finish(window));
+		return result;
+	}
+}
+
+TEST_CASE("Test utf_transcoder") {
+	using namespace u8lib;
+
+	SUBCASE("utf-8 chunk boundary") {
+		const std::u8string_view text = u8"G🐓鸡Ĝ";
+		utf8_to_utf16_transcoder transcoder;
+		char16_t buffer[16];
+
+		// cut 🐓 after two code units
+		auto [read, written] = transcoder.transcode(text.substr(0, 3), buffer);
+		CHECK_EQ(read, 3);
+		CHECK_EQ(written, 1);
+		CHECK_EQ(transcoder.pending_size(), 2);
+
+		auto [read_2, written_2] = transcoder.transcode(text.substr(3, 1), std::span<char16_t>{buffer + written, 15});
+		CHECK_EQ(read_2, 1);
+		CHECK_EQ(written_2, 0);
+		CHECK_EQ(transcoder.pending_size(), 3);
+
+		auto [read_3, written_3] = transcoder.transcode(text.substr(4), std::span<char16_t>{buffer + 1, 15});
+		CHECK_EQ(read_3, text.size() - 4);
+		CHECK_EQ(written_3, 4);
+		CHECK_FALSE(transcoder.has_pending());
+		CHECK_EQ(std::u16string_view(buffer, 5), u"G🐓鸡Ĝ");
+	}
+
+	SUBCASE("utf-16 chunk boundary") {
+		const std::u16string_view text = u"G🐓";
+		utf16_to_utf8_transcoder transcoder;
+		char8_t buffer[16];
+
+		auto [read, written] = transcoder.transcode(text.substr(0, 2), buffer);
+		CHECK_EQ(read, 2);
+		CHECK_EQ(written, 1);
+		CHECK(transcoder.has_pending());
+		auto [read_2, written_2] = transcoder.transcode(text.substr(2), std::span<char8_t>{buffer + 1, 15});
+		CHECK_EQ(read_2, 1);
+		CHECK_EQ(written_2, 4);
+		CHECK_EQ(std::u8string_view(buffer, 5), u8"G🐓");
+
+		// unpaired at the end of stream
+		transcoder.transcode(text.substr(1, 1), buffer);
+		CHECK(transcoder.has_pending());
+		CHECK_EQ(transcoder.finish(std::span<char8_t>{buffer, 2}), 0);
+		CHECK_EQ(transcoder.finish(buffer), 3);
+		CHECK_EQ(std::u8string_view(buffer, 3), u8"�");
+		CHECK_FALSE(transcoder.has_pending());
+	}
+
+	SUBCASE("output full") {
+		const std::u32string_view text = U"🐓鸡ĜG";
+		utf32_to_utf8_transcoder transcoder;
+		char8_t buffer[16];
+
+		// never splits a code point
+		auto [read, written] = transcoder.transcode(text, std::span<char8_t>{buffer, 6});
+		CHECK_EQ(read, 1);
+		CHECK_EQ(written, 4);
+		auto [read_2, written_2] = transcoder.transcode(text.substr(read), std::span<char8_t>{buffer + written, 12});
+		CHECK_EQ(read_2, 3);
+		CHECK_EQ(std::u8string_view(buffer, written + written_2), u8"🐓鸡ĜG");
+	}
+
+	SUBCASE("match whole input") {
+		std::mt19937 rng{5};
+		const std::u8string_view pieces[] = {u8"a", u8"Ĝ", u8"鸡", u8"🐓", u8"text "};
+		for (int round = 0; round < 200; ++round) {
+			std::u8string str;
+			const size_t count = rng() % 300;
+			for (size_t i = 0; i < count; ++i) {
+				str += pieces[rng() % std::size(pieces)];
+			}
+			for (size_t bad_count = rng() % 4; !str.empty() && bad_count; --bad_count) {
+				str[rng() % str.size()] = static_cast<char8_t>(rng());
+			}
+			if (!str.empty() && rng() % 2) {
+				// cut sequence at the end of stream
+				str += u8"\xF0\x9F\x90";
+			}
+
+			std::u16string utf16(utf8_to_utf16_size(str.data(), str.size()), 0);
+			utf8_to_utf16(str.data(), str.size(), utf16.data());
+			std::u32string utf32(utf8_to_utf32_size(str.data(), str.size()), 0);
+			utf8_to_utf32(str.data(), str.size(), utf32.data());
+			if (!utf16.empty() && rng() % 2) {
+				// unpaired surrogates
+				utf16[rng() % utf16.size()] = static_cast<char16_t>(0xD800 + rng() % 0x800);
+				utf32[rng() % utf32.size()] = static_cast<char32_t>(0xD800 + rng() % 0x800);
+			}
+
+			const size_t max_chunk = 1 + rng() % 64;
+			const size_t max_window = 8 + rng() % 128;
+			const auto u8_view = std::u8string_view{str};
+			const auto u16_view = std::u16string_view{utf16};
+			const auto u32_view = std::u32string_view{utf32};
+
+			std::u16string expected_16(utf8_to_utf16_size(str.data(), str.size()), 0);
+			utf8_to_utf16(str.data(), str.size(), expected_16.data());
+			CHECK_EQ((transcode_chunked<char8_t, char16_t>(u8_view, rng, max_chunk, max_window)), expected_16);
+			std::u32string expected_32(utf8_to_utf32_size(str.data(), str.size()), 0);
+			utf8_to_utf32(str.data(), str.size(), expected_32.data());
+			CHECK_EQ((transcode_chunked<char8_t, char32_t>(u8_view, rng, max_chunk, max_window)), expected_32);
+
+			std::u8string expected_16_8(utf16_to_utf8_size(utf16.data(), utf16.size()), 0);
+			utf16_to_utf8(utf16.data(), utf16.size(), expected_16_8.data());
+			CHECK_EQ((transcode_chunked<char16_t, char8_t>(u16_view, rng, max_chunk, max_window)), expected_16_8);
+			std::u8string expected_32_8(utf32_to_utf8_size(utf32.data(), utf32.size()), 0);
+			utf32_to_utf8(utf32.data(), utf32.size(), expected_32_8.data());
+			CHECK_EQ((transcode_chunked<char32_t, char8_t>(u32_view, rng, max_chunk, max_window)), expected_32_8);
+
+			// utf-16 <=> utf-32 through the utf-8 results
+			std::u32string expected_16_32(utf8_to_utf32_size(expected_16_8.data(), expected_16_8.size()), 0);
+			utf8_to_utf32(expected_16_8.data(), expected_16_8.size(), expected_16_32.data());
+			CHECK_EQ((transcode_chunked<char16_t, char32_t>(u16_view, rng, max_chunk, max_window)), expected_16_32);
+			std::u16string expected_32_16(utf8_to_utf16_size(expected_32_8.data(), expected_32_8.size()), 0);
+			utf8_to_utf16(expected_32_8.data(), expected_32_8.size(), expected_32_16.data());
+			CHECK_EQ((transcode_chunked<char32_t, char16_t>(u32_view, rng, max_chunk, max_window)), expected_32_16);
+		}
+	}
+}
@@ -0,0 +1,288 @@
+#include <doctest/doctest.h>
+#include <u8lib/string.hpp>
+#include <u8lib/unicode.hpp>
+
+#include <vector>
+
+TEST_CASE("Test unicode") {
+	using namespace u8lib;
+
+	SUBCASE("normalization forms") {
+		struct test_case {
+			u8string_view source, nfc, nfd, nfkc, nfkd;
+		};
+		// rows of the UAX #15 examples and a few segments that need reordering or recomposition
+		const test_case cases[] = {
+			{u8"abc", u8"abc", u8"abc", u8"abc", u8"abc"},
+			{u8"é", u8"é", u8"é", u8"é", u8"é"},
+			{u8"é", u8"é", u8"é", u8"é", u8"é"},
+			{u8"Ḍ̇", u8"Ḍ̇", u8"Ḍ̇", u8"Ḍ̇", u8"Ḍ̇"},
+			{u8"Ḍ̇", u8"Ḍ̇", u8"Ḍ̇", u8"Ḍ̇", u8"Ḍ̇"},
+			{u8"Å", u8"Å", u8"Å", u8"Å", u8"Å"},
+			{u8"ﬁ", u8"ﬁ", u8"ﬁ", u8"fi", u8"fi"},
+			{u8"ẛ̣", u8"ẛ̣", u8"ẛ̣", u8"ṩ", u8"ṩ"},
+			{u8"각", u8"각", u8"각", u8"각", u8"각"},
+			{u8"각", u8"각", u8"각", u8"각", u8"각"},
+			{u8"́a", u8"́a", u8"́a", u8"́a", u8"́a"},
+			{u8"ạ̈́", u8"ạ̈́", u8"ạ̈́", u8"ạ̈́", u8"ạ̈́"},
+		};
+		for (const auto& [source, nfc, nfd, nfkc, nfkd] : cases) {
+			CHECK_EQ(source.normalized(normalization_form::nfc), nfc);
+			CHECK_EQ(source.normalized(normalization_form::nfd), nfd);
+			CHECK_EQ(source.normalized(normalization_form::nfkc), nfkc);
+			CHECK_EQ(source.normalized(normalization_form::nfkd), nfkd);
+
+			CHECK(nfc.is_normalized(normalization_form::nfc));
+			CHECK(nfd.is_normalized(normalization_form::nfd));
+			CHECK(nfkc.is_normalized(normalization_form::nfkc));
+			CHECK(nfkd.is_normalized(normalization_form::nfkd));
+			CHECK_EQ(source.is_normalized(normalization_form::nfc), source == nfc);
+			CHECK_EQ(source.is_normalized(normalization_form::nfd), source == nfd);
+			CHECK_EQ(source.is_normalized(normalization_form::nfkc), source == nfkc);
+			CHECK_EQ(source.is_normalized(normalization_form::nfkd), source == nfkd);
+		}
+	}
+
+	SUBCASE("quick check") {
+		// maybe code points are resolved against their segment
+		CHECK(u8string_view(u8"େ̀ା").is_normalized());
+		CHECK_FALSE(u8string_view(u8"ୋ").is_normalized());
+		CHECK(u8string_view(u8"ୋ").is_normalized());
+		// out of canonical order
+		CHECK_FALSE(u8string_view(u8"ạ́").is_normalized());
+		CHECK(u8string_view(u8"ạ́").is_normalized(normalization_form::nfd));
+		// ill-formed
+		CHECK_FALSE(u8string_view(u8"a\xFF").is_normalized());
+		CHECK_FALSE(u8string_view(u8"\xC3").is_normalized(normalization_form::nfd));
+		CHECK(u8string_view().is_normalized());
+
+		// long ascii runs around segments
+		u8string text;
+		for (int i = 0; i < 100; ++i) {
+			text += u8"The quick brown fox jumps over the lazy dog, café crème brûlée. ";
+		}
+		CHECK(text.is_normalized());
+		CHECK_FALSE(text.is_normalized(normalization_form::nfd));
+		CHECK(u8string_view(text).normalized(normalization_form::nfd).is_normalized(normalization_form::nfd));
+		CHECK_EQ(u8string_view(text).normalized(normalization_form::nfd).normalize(), text);
+	}
+
+	SUBCASE("ill-formed and long segments") {
+		CHECK_EQ(u8string_view(u8"a\xFF" u8"́b").normalized(), u8"a�́b");
+		CHECK_EQ(u8string_view(u8"e\xCC").normalized(normalization_form::nfd), u8"e�");
+
+		// longer than the on-stack segment buffer
+		u8string source = u8"a";
+		u8string expected = u8"ạ";
+		for (int i = 0; i < 100; ++i) {
+			source += u8"̣́";
+			expected += i ? u8"̣" : u8"";
+		}
+		for (int i = 0; i < 100; ++i) {
+			expected += u8"́";
+		}
+		CHECK_EQ(u8string_view(source).normalized(), expected);
+		CHECK(expected.is_normalized());
+	}
+
+	SUBCASE("u8string") {
+		u8string ascii = u8"plain ascii";
+		const auto* data = ascii.c_str();
+		CHECK(ascii.is_normalized(normalization_form::nfkd));
+		ascii.normalize(normalization_form::nfkd);
+		CHECK_EQ(ascii.c_str(), data);
+
+		u8string composed = u8"crème brûlée, long enough to live on the heap";
+		data = composed.c_str();
+		composed.normalize();
+		CHECK_EQ(composed.c_str(), data);
+
+		composed.normalize(normalization_form::nfd);
+		CHECK_EQ(composed, u8"crème brûlée, long enough to live on the heap");
+		composed.normalize(normalization_form::nfc);
+		CHECK_EQ(composed, u8"crème brûlée, long enough to live on the heap");
+
+		u8string compat = u8"ﬁx²";
+		compat.normalize(normalization_form::nfkc);
+		CHECK_EQ(compat, u8"fix2");
+		CHECK(compat.is_ascii());
+	}
+
+	SUBCASE("case mapping") {
+		CHECK_EQ(u8string_view(u8"Hello, World! 123").to_lower(), u8"hello, world! 123");
+		CHECK_EQ(u8string_view(u8"Hello, World! 123").to_upper(), u8"HELLO, WORLD! 123");
+		CHECK_EQ(u8string_view(u8"ΣΊΣΥΦΟΣ Straße ǅ").to_lower(), u8"σίσυφοσ straße ǆ");
+		CHECK_EQ(u8string_view(u8"σίσυφος straße ǆ").to_upper(), u8"ΣΊΣΥΦΟΣ STRAßE Ǆ");
+		CHECK_EQ(u8string_view(u8"Straße ΐ ﬃ ς").case_fold(), u8"strasse \u03B9\u0308\u0301 ffi σ");
+		CHECK_EQ(u8string_view(u8"İ").to_lower(), u8"i");
+		CHECK_EQ(u8string_view(u8"𐐀").to_lower(), u8"𐐨");
+
+		// the utf-8 size changes with the simple mappings too
+		CHECK_EQ(u8string_view(u8"ſ").to_upper(), u8"S");
+		CHECK_EQ(u8string_view(u8"Ⱥ").to_lower(), u8"ⱥ");
+		CHECK_EQ(u8string_view(u8"ȿ").to_upper(), u8"Ȿ");
+		CHECK_EQ(u8string_view(u8"K").case_fold(), u8"k");
+
+		CHECK_EQ(u8string_view(u8"A\xFF" u8"B").to_lower(), u8"a�b");
+		CHECK(u8string_view().to_upper().empty());
+
+		// ascii runs around the vector blocks and chunk boundaries
+		u8string mixed, lower, upper;
+		for (int i = 0; i < 500; ++i) {
+			mixed += u8"The Quick Brown Fox, ÀÉÎ, ſ, [@`{] ";
+			lower += u8"the quick brown fox, àéî, ſ, [@`{] ";
+			upper += u8"THE QUICK BROWN FOX, ÀÉÎ, S, [@`{] ";
+		}
+		CHECK_EQ(u8string_view(mixed).to_lower(), lower);
+		CHECK_EQ(mixed.ToUpper(), upper);
+		CHECK_EQ(mixed.CaseFold(), u8string_view(lower).to_upper().to_lower());
+	}
+
+	SUBCASE("in-place case mapping") {
+		u8string ascii = u8"Case-Insensitive Key, long enough to live on the heap";
+		const auto* data = ascii.c_str();
+		ascii.to_lower();
+		CHECK_EQ(ascii, u8"case-insensitive key, long enough to live on the heap");
+		CHECK_EQ(ascii.c_str(), data);
+		CHECK(ascii.is_ascii());
+		ascii.to_upper();
+		CHECK_EQ(ascii, u8"CASE-INSENSITIVE KEY, LONG ENOUGH TO LIVE ON THE HEAP");
+		ascii.case_fold();
+		CHECK_EQ(ascii, u8"case-insensitive key, long enough to live on the heap");
+
+		u8string text = u8"Maße";
+		text.to_upper();
+		CHECK_EQ(text, u8"MAßE");
+		text.case_fold();
+		CHECK_EQ(text, u8"masse");
+		CHECK_EQ(text.ToUpper(), u8"MASSE");
+		CHECK_EQ(text, u8"masse");
+	}
+
+	SUBCASE("grapheme clusters") {
+		static_assert(std::forward_iterator<grapheme_iterator>);
+		static_assert(std::sentinel_for<std::default_sentinel_t, grapheme_iterator>);
+
+		using cluster_list = std::vector<u8string_view>;
+		auto clusters = [](u8string_view view) {
+			cluster_list result;
+			for (const u8string_view cluster : view.graphemes()) {
+				result.push_back(cluster);
+			}
+			CHECK_EQ(view.grapheme_count(), result.size());
+			return result;
+		};
+
+		CHECK(clusters(u8"").empty());
+		CHECK_EQ(clusters(u8"ab\r\nc\n\r"), (cluster_list{u8"a", u8"b", u8"\r\n", u8"c", u8"\n", u8"\r"}));
+		// combining marks, hangul jamo, spacing marks and prepend
+		CHECK_EQ(clusters(u8"e\u0301\u0323x"), (cluster_list{u8"e\u0301\u0323", u8"x"}));
+		CHECK_EQ(clusters(u8"\u1100\u1161\u11A8\uAC00"), (cluster_list{u8"\u1100\u1161\u11A8", u8"\uAC00"}));
+		CHECK_EQ(clusters(u8"\u0915\u093F\u0600a"), (cluster_list{u8"\u0915\u093F", u8"\u0600a"}));
+		// untailored, no conjunct across the virama
+		CHECK_EQ(clusters(u8"\u0931\u094D\u0925"), (cluster_list{u8"\u0931\u094D", u8"\u0925"}));
+		// emoji zwj sequences, modifiers and regional indicator pairs
+		CHECK_EQ(clusters(u8"👩‍👩‍👧👍🏽🇨🇳🇺🇸🇫"), (cluster_list{u8"👩‍👩‍👧", u8"👍🏽", u8"🇨🇳", u8"🇺🇸", u8"🇫"}));
+		CHECK_EQ(clusters(u8"😀😀\u200D😀"), (cluster_list{u8"😀", u8"😀\u200D😀"}));
+		CHECK_EQ(clusters(u8"a\u200D😀"), (cluster_list{u8"a\u200D", u8"😀"}));
+		// ill-formed subparts stand for U+FFFD
+		CHECK_EQ(clusters(u8"\xFF\u0301" u8"b"), (cluster_list{u8"\xFF\u0301", u8"b"}));
+
+		// ascii runs with CR LF across the vector blocks
+		u8string text;
+		for (int i = 0; i < 100; ++i) {
+			text += u8"a line of ascii text\r\nnext e\u0301\r";
+		}
+		CHECK_EQ(text.grapheme_count(), 100 * 28);
+		size_t count = 0;
+		for (const u8string_view cluster : text.graphemes()) {
+			count += cluster.size() == 2 && cluster == u8"\r\n";
+		}
+		CHECK_EQ(count, 100);
+	}
+	SUBCASE("display width") {
+		CHECK_EQ(u8string_view().display_width(), 0);
+		CHECK_EQ(u8string_view(u8"plain ascii\r\n").display_width(), 12);
+		CHECK_EQ(u8string_view(u8"鸡a").display_width(), 3);
+		CHECK_EQ(u8string_view(u8"e\u0301x").display_width(), 2);
+		CHECK_EQ(u8string_view(u8"👩‍👩‍👧👍🏽🇨🇳").display_width(), 5);
+		CHECK_EQ(u8string_view(u8"ｱＡ☕䷀").display_width(), 7);
+
+		CHECK_EQ(u8string_view(u8"abcdef").truncate_to_width(4), u8"abcd");
+		CHECK_EQ(u8string_view(u8"ab\r\ncd").truncate_to_width(3), u8"ab\r\n");
+		CHECK_EQ(u8string_view(u8"abe\u0301f").truncate_to_width(3), u8"abe\u0301");
+		// a wide cluster is never split
+		CHECK_EQ(u8string_view(u8"a鸡b").truncate_to_width(2), u8"a");
+		CHECK_EQ(u8string_view(u8"a鸡b").truncate_to_width(3), u8"a鸡");
+		CHECK_EQ(u8string_view(u8"👍🏽ab").truncate_to_width(3), u8"👍🏽a");
+		CHECK_EQ(u8string_view(u8"abc").truncate_to_width(0), u8"");
+		CHECK_EQ(u8string_view(u8"abc").truncate_to_width(10), u8"abc");
+
+		// ascii runs across the vector blocks
+		u8string cell;
+		for (int i = 0; i < 50; ++i) {
+			cell += u8"a cell of a wide table\r\n鸡e\u0301 ";
+		}
+		CHECK_EQ(cell.display_width(), 50 * 27);
+		CHECK_EQ(cell.display_width(), u8string_view(cell).truncate_to_width(cell.display_width()).display_width());
+		for (size_t width : {0, 1, 22, 23, 24, 25, 700, 1349}) {
+			const u8string_view prefix = u8string_view(cell).truncate_to_width(width);
+			CHECK_LE(prefix.display_width(), width);
+			// one more cluster would not fit
+			const size_t next = prefix.size() + utf8_next_grapheme(cell.data() + prefix.size(), cell.size() - prefix.size(), 0);
+			CHECK_GT(u8string_view(cell.data(), next).display_width(), width);
+		}
+
+		cell.truncate_to_width(25);
+		CHECK_EQ(cell, u8"a cell of a wide table\r\n鸡");
+		cell.truncate_to_width(25);
+		CHECK_EQ(cell, u8"a cell of a wide table\r\n鸡");
+
+		// already fits, nothing is erased
+		u8string fits = u8"abc";
+		CHECK_EQ(fits.truncate_to_width(10), u8"abc");
+		CHECK_EQ(fits.truncate_to_width(3), u8"abc");
+		u8string empty;
+		CHECK(empty.truncate_to_width(0).empty());
+		CHECK(empty.truncate_to_width(10).empty());
+	}
+
+	SUBCASE("character properties") {
+		CHECK_EQ(general_category(U'A'), unicode_general_category::uppercase_letter);
+		CHECK_EQ(general_category(U'ǅ'), unicode_general_category::titlecase_letter);
+		CHECK_EQ(general_category(U'7'), unicode_general_category::decimal_number);
+		CHECK_EQ(general_category(U'\u0301'), unicode_general_category::nonspacing_mark);
+		CHECK_EQ(general_category(U'€'), unicode_general_category::currency_symbol);
+		CHECK_EQ(general_category(U'\u00A0'), unicode_general_category::space_separator);
+		CHECK_EQ(general_category(U'\u200D'), unicode_general_category::format);
+		CHECK_EQ(general_category(U'\n'), unicode_general_category::control);
+		CHECK_EQ(general_category(U'😀'), unicode_general_category::other_symbol);
+		CHECK_EQ(general_category(0xD800), unicode_general_category::surrogate);
+		CHECK_EQ(general_category(0x10FFFD), unicode_general_category::private_use);
+		CHECK_EQ(general_category(0x10FFFF), unicode_general_category::unassigned);
+		CHECK_EQ(general_category(0x110000), unicode_general_category::unassigned);
+
+		CHECK(is_whitespace(U' '));
+		CHECK(is_whitespace(U'\t'));
+		CHECK(is_whitespace(U'\u0085'));
+		CHECK(is_whitespace(U'\u3000'));
+		CHECK_FALSE(is_whitespace(U'\u200B'));
+		CHECK_FALSE(is_whitespace(U'x'));
+
+		CHECK(is_alphabetic(U'z'));
+		CHECK(is_alphabetic(U'ß'));
+		CHECK(is_alphabetic(U'鸡'));
+		CHECK(is_alphabetic(U'\u0345'));
+		CHECK_FALSE(is_alphabetic(U'1'));
+		CHECK_FALSE(is_alphabetic(U'_'));
+
+		CHECK_EQ(east_asian_width(U'a'), unicode_east_asian_width::narrow);
+		CHECK_EQ(east_asian_width(U'鸡'), unicode_east_asian_width::wide);
+		CHECK_EQ(east_asian_width(U'Ａ'), unicode_east_asian_width::fullwidth);
+		CHECK_EQ(east_asian_width(U'ｱ'), unicode_east_asian_width::halfwidth);
+		CHECK_EQ(east_asian_width(U'±'), unicode_east_asian_width::ambiguous);
+		CHECK_EQ(east_asian_width(U'\u0300'), unicode_east_asian_width::ambiguous);
+		CHECK_EQ(east_asian_width(U'ä'), unicode_east_asian_width::neutral);
+		CHECK_EQ(east_asian_width(0x20000), unicode_east_asian_width::wide);
+	}
+}
@@ -15,6 +15,12 @@ end
 TEST("base")
 TEST("string_view")
 TEST("string")
+TEST("text_index")
+TEST("transcoder")
+TEST("mapped_text")
+TEST("unicode")
+TEST("search")
+TEST("multi_searcher")
 TEST("format")
 TEST("guid")
 
@@ -0,0 +1,447 @@
+// Generates the unicode property tables of modules/private/ucd from the character database of ICU, so that the
+// tables follow the Unicode version of the ICU release used to run it.
+//
+// build: g++ -std=c++20 -O2 gen_ucd_tables.cpp -licuuc -o gen_ucd_tables
+// run:   ./gen_ucd_tables <repository>/modules/private/ucd
+
+#include <unicode/normalizer2.h>
+#include <unicode/uchar.h>
+#include <unicode/ustring.h>
+#include <unicode/unistr.h>
+#include <unicode/uversion.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+	constexpr char32_t kCodePointCount = 0x110000;
+	constexpr size_t kLineWidth = 120;
+
+	std::string header_comment() {
+		char icu_version[U_MAX_VERSION_STRING_LENGTH];
+		char unicode_version[U_MAX_VERSION_STRING_LENGTH];
+		UVersionInfo version;
+		u_getVersion(version);
+		u_versionToString(version, icu_version);
+		u_getUnicodeVersion(version);
+		u_versionToString(version, unicode_version);
+		return std::string("// Generated by tools/ucd/gen_ucd_tables.cpp from ICU ") + icu_version + " (Unicode " + unicode_version +
+		       "), do not edit.\n";
+	}
+
+	std::string hex(int64_t value) {
+		char buffer[24];
+		std::snprintf(buffer, sizeof(buffer), "%s0x%llx", value < 0 ? "-" : "", static_cast<unsigned long long>(value < 0 ? -value : value));
+		return buffer;
+	}
+
+	// comma separated values wrapped at kLineWidth, indented by two tabs
+	void write_values(std::ostream& out, const std::vector<int64_t>& values) {
+		std::string line;
+		for (size_t i = 0; i < values.size(); ++i) {
+			std::string item = hex(values[i]);
+			if (i + 1 != values.size()) {
+				item += ",";
+			}
+			if (!line.empty() && 8 + line.size() + 1 + item.size() > kLineWidth) {
+				out << "\t\t" << line << "\n";
+				line.clear();
+			}
+			line += line.empty() ? item : " " + item;
+		}
+		if (!line.empty()) {
+			out << "\t\t" << line << "\n";
+		}
+	}
+
+	void write_array(std::ostream& out, std::string_view type, std::string_view name, const std::vector<int64_t>& values) {
+		out << "\tinline constexpr " << type << " " << name << "[" << values.size() << "] = {\n";
+		write_values(out, values);
+		out << "\t};\n";
+	}
+
+	// split values into blocks of 1 << shift code points, identical blocks are stored once, the shift giving the
+	// smallest table is picked
+	void write_two_stage_table(std::ostream& out, std::string_view type, size_t type_size, std::string_view name,
+	                           const std::vector<int64_t>& values) {
+		const int64_t default_value = values[kCodePointCount - 1];
+		char32_t limit = kCodePointCount;
+		while (limit && values[limit - 1] == default_value) {
+			--limit;
+		}
+
+		unsigned best_shift = 0;
+		size_t best_size = SIZE_MAX;
+		std::vector<int64_t> best_stage1, best_stage2;
+		for (unsigned shift = 4; shift <= 10; ++shift) {
+			const char32_t block_size = char32_t{1} << shift;
+			const size_t block_count = (limit + block_size - 1) >> shift;
+			std::map<std::vector<int64_t>, int64_t> blocks;
+			std::vector<int64_t> stage1, stage2;
+			for (size_t block = 0; block < block_count; ++block) {
+				std::vector<int64_t> content(block_size, default_value);
+				for (char32_t i = 0; i < block_size && (block << shift) + i < kCodePointCount; ++i) {
+					content[i] = values[(block << shift) + i];
+				}
+				auto [iter, inserted] = blocks.try_emplace(content, blocks.size());
+				if (inserted) {
+					stage2.insert(stage2.end(), content.begin(), content.end());
+				}
+				stage1.push_back(iter->second);
+			}
+			const size_t size = stage1.size() * sizeof(uint16_t) + stage2.size() * type_size;
+			if (blocks.size() <= UINT16_MAX && size < best_size) {
+				best_shift = shift;
+				best_size = size;
+				best_stage1 = std::move(stage1);
+				best_stage2 = std::move(stage2);
+			}
+		}
+
+		out << "\tinline constexpr two_stage_table<" << type << ", " << best_shift << ", " << best_stage1.size() << ", "
+		    << best_stage2.size() << "> " << name << "{\n";
+		out << "\t\t" << hex(default_value) << ",\n";
+		out << "\t\t{\n";
+		write_values(out, best_stage1);
+		out << "\t\t},\n";
+		out << "\t\t{\n";
+		write_values(out, best_stage2);
+		out << "\t\t}\n";
+		out << "\t};\n";
+	}
+
+	bool write_file(const std::string& path, const std::string& content) {
+		std::ofstream file(path, std::ios::binary);
+		file << content;
+		return static_cast<bool>(file);
+	}
+
+	std::vector<char32_t> to_code_points(const icu::UnicodeString& str) {
+		std::vector<char32_t> result;
+		for (int32_t i = 0; i < str.length(); i = str.moveIndex32(i, 1)) {
+			result.push_back(static_cast<char32_t>(str.char32At(i)));
+		}
+		return result;
+	}
+
+	bool is_hangul_syllable(char32_t ch) {
+		return ch >= 0xAC00 && ch <= 0xD7A3;
+	}
+
+	//==================> normalization <==================
+
+	std::string normalization_tables() {
+		UErrorCode status = U_ZERO_ERROR;
+		const icu::Normalizer2* nfd = icu::Normalizer2::getNFDInstance(status);
+		const icu::Normalizer2* nfkd = icu::Normalizer2::getNFKDInstance(status);
+		const icu::Normalizer2* nfc = icu::Normalizer2::getNFCInstance(status);
+		if (U_FAILURE(status)) {
+			std::fprintf(stderr, "normalizer: %s\n", u_errorName(status));
+			std::exit(1);
+		}
+
+		std::vector<int64_t> props(kCodePointCount);
+		std::vector<int64_t> canonical(kCodePointCount), compat(kCodePointCount);
+		std::vector<int64_t> pool = {0};
+		std::map<std::vector<char32_t>, int64_t> pool_index;
+		auto add_to_pool = [&](const std::vector<char32_t>& seq) {
+			auto [iter, inserted] = pool_index.try_emplace(seq, pool.size());
+			if (inserted) {
+				pool.push_back(seq.size());
+				pool.insert(pool.end(), seq.begin(), seq.end());
+			}
+			return iter->second;
+		};
+
+		std::vector<std::pair<int64_t, char32_t>> compositions;
+		for (char32_t ch = 0; ch < kCodePointCount; ++ch) {
+			const auto c = static_cast<UChar32>(ch);
+			int64_t value = u_getCombiningClass(c);
+			value |= u_getIntPropertyValue(c, UCHAR_NFD_QUICK_CHECK) == UNORM_NO ? 0x100 : 0;
+			value |= u_getIntPropertyValue(c, UCHAR_NFC_QUICK_CHECK) == UNORM_NO ? 0x200 : 0;
+			value |= u_getIntPropertyValue(c, UCHAR_NFC_QUICK_CHECK) == UNORM_MAYBE ? 0x400 : 0;
+			value |= u_getIntPropertyValue(c, UCHAR_NFKD_QUICK_CHECK) == UNORM_NO ? 0x800 : 0;
+			value |= u_getIntPropertyValue(c, UCHAR_NFKC_QUICK_CHECK) == UNORM_NO ? 0x1000 : 0;
+			value |= u_getIntPropertyValue(c, UCHAR_NFKC_QUICK_CHECK) == UNORM_MAYBE ? 0x2000 : 0;
+			props[ch] = value;
+
+			if (is_hangul_syllable(ch) || (ch >= 0xD800 && ch <= 0xDFFF)) {
+				continue;
+			}
+			icu::UnicodeString decomposition;
+			if (nfd->getDecomposition(c, decomposition)) {
+				canonical[ch] = add_to_pool(to_code_points(decomposition));
+			}
+			if (nfkd->getDecomposition(c, decomposition)) {
+				compat[ch] = add_to_pool(to_code_points(decomposition));
+			}
+			if (nfc->getRawDecomposition(c, decomposition)) {
+				const auto pair = to_code_points(decomposition);
+				if (pair.size() == 2 && nfc->composePair(static_cast<UChar32>(pair[0]), static_cast<UChar32>(pair[1])) == c) {
+					compositions.emplace_back(static_cast<int64_t>(pair[0]) << 21 | pair[1], ch);
+				}
+			}
+		}
+		if (pool.size() > UINT16_MAX) {
+			std::fprintf(stderr, "decomposition pool exceeds 16-bit indices\n");
+			std::exit(1);
+		}
+		std::sort(compositions.begin(), compositions.end());
+
+		std::ostringstream out;
+		out << "#pragma once\n\n" << header_comment() << "\n#include \"ucd_table.hpp\"\n\nnamespace u8lib::ucd\n{\n";
+		out << "\t// kNormalizationProps: bits 0-7 hold the canonical combining class, the others the quick check values\n";
+		out << "\tinline constexpr uint16_t kNfdNo = 0x100;\n";
+		out << "\tinline constexpr uint16_t kNfcNo = 0x200;\n";
+		out << "\tinline constexpr uint16_t kNfcMaybe = 0x400;\n";
+		out << "\tinline constexpr uint16_t kNfkdNo = 0x800;\n";
+		out << "\tinline constexpr uint16_t kNfkcNo = 0x1000;\n";
+		out << "\tinline constexpr uint16_t kNfkcMaybe = 0x2000;\n\n";
+		write_two_stage_table(out, "uint16_t", 2, "kNormalizationProps", props);
+		out << "\n\t// index of the full decomposition in kDecompositionPool, 0 if the code point maps to itself\n";
+		out << "\t// hangul syllables are left to the algorithmic decomposition\n";
+		write_two_stage_table(out, "uint16_t", 2, "kCanonicalDecomposition", canonical);
+		out << "\n";
+		write_two_stage_table(out, "uint16_t", 2, "kCompatDecomposition", compat);
+		out << "\n\t// decompositions as a length followed by the code points\n";
+		write_array(out, "char32_t", "kDecompositionPool", pool);
+
+		std::vector<int64_t> keys, values;
+		for (const auto& [key, value]: compositions) {
+			keys.push_back(key);
+			values.push_back(value);
+		}
+		out << "\n\t// primary composites except hangul syllables, keys are first << 21 | second in ascending order\n";
+		write_array(out, "uint64_t", "kCompositionKeys", keys);
+		out << "\n";
+		write_array(out, "char32_t", "kCompositionValues", values);
+		out << "}\n";
+		return out.str();
+	}
+
+	//==================> case mapping <==================
+
+	size_t utf8_size(char32_t ch) {
+		return ch < 0x80 ? 1 : ch < 0x800 ? 2 : ch < 0x10000 ? 3 : 4;
+	}
+
+	std::string case_tables() {
+		struct case_record {
+			int64_t lower;
+			int64_t upper;
+			int64_t fold;
+			std::vector<char32_t> full_fold;
+			auto operator<=>(const case_record&) const = default;
+		};
+
+		// record 0 leaves a code point unchanged, full foldings get records after every simple one
+		std::map<case_record, int64_t> record_index = {{case_record{}, 0}};
+		std::vector<case_record> records = {case_record{}};
+		std::vector<case_record> full_records;
+		std::vector<std::pair<char32_t, case_record>> full_code_points;
+		std::vector<int64_t> index(kCodePointCount);
+		size_t max_expansion = 1;
+		for (char32_t ch = 0; ch < kCodePointCount; ++ch) {
+			const auto c = static_cast<UChar32>(ch);
+			case_record record;
+			record.lower = u_tolower(c) - c;
+			record.upper = u_toupper(c) - c;
+			record.fold = u_foldCase(c, U_FOLD_CASE_DEFAULT) - c;
+
+			UChar source[2], folded[8];
+			int32_t source_size = 0;
+			U16_APPEND_UNSAFE(source, source_size, c);
+			UErrorCode status = U_ZERO_ERROR;
+			const int32_t folded_size = u_strFoldCase(folded, 8, source, source_size, U_FOLD_CASE_DEFAULT, &status);
+			std::vector<char32_t> full = to_code_points(icu::UnicodeString(folded, folded_size));
+			if (full.size() > 1) {
+				record.full_fold = full;
+			}
+
+			size_t out_size = 0;
+			for (const char32_t folded_ch : full) {
+				out_size += utf8_size(folded_ch);
+			}
+			for (const size_t size : {out_size, utf8_size(ch + record.lower), utf8_size(ch + record.upper)}) {
+				max_expansion = std::max(max_expansion, (size + utf8_size(ch) - 1) / utf8_size(ch));
+			}
+
+			if (!record.full_fold.empty()) {
+				full_code_points.emplace_back(ch, record);
+				continue;
+			}
+			auto [iter, inserted] = record_index.try_emplace(record, records.size());
+			if (inserted) {
+				records.push_back(record);
+			}
+			index[ch] = iter->second;
+		}
+		const size_t first_full = records.size();
+		for (const auto& [ch, record]: full_code_points) {
+			auto [iter, inserted] = record_index.try_emplace(record, records.size());
+			if (inserted) {
+				records.push_back(record);
+			}
+			index[ch] = iter->second;
+		}
+
+		std::vector<int64_t> lower, upper, fold;
+		for (const case_record& record: records) {
+			lower.push_back(record.lower);
+			upper.push_back(record.upper);
+			fold.push_back(record.fold);
+		}
+
+		std::ostringstream out;
+		out << "#pragma once\n\n" << header_comment() << "\n#include \"ucd_table.hpp\"\n\nnamespace u8lib::ucd\n{\n";
+		out << "\t// utf-8 size of a mapped code point is at most kMaxCaseMappingExpansion times its own\n";
+		out << "\tinline constexpr size_t kMaxCaseMappingExpansion = " << max_expansion << ";\n\n";
+		out << "\t// record of the deltas below, records from kFirstFullCaseFolding on fold to more than one code point\n";
+		write_two_stage_table(out, records.size() <= 256 ? "uint8_t" : "uint16_t", records.size() <= 256 ? 1 : 2, "kCaseMappingIndex", index);
+		out << "\n\tinline constexpr size_t kFirstFullCaseFolding = " << first_full << ";\n\n";
+		out << "\t// simple case mappings and simple case folding as code point deltas\n";
+		write_array(out, "int32_t", "kLowercaseDelta", lower);
+		out << "\n";
+		write_array(out, "int32_t", "kUppercaseDelta", upper);
+		out << "\n";
+		write_array(out, "int32_t", "kCaseFoldingDelta", fold);
+
+		out << "\n\t// full case foldings of the records from kFirstFullCaseFolding on, padded with 0\n";
+		out << "\tinline constexpr char32_t kFullCaseFoldings[" << records.size() - first_full << "][3] = {\n";
+		for (size_t i = first_full; i < records.size(); ++i) {
+			std::vector<int64_t> values(records[i].full_fold.begin(), records[i].full_fold.end());
+			values.resize(3);
+			out << "\t\t{" << hex(values[0]) << ", " << hex(values[1]) << ", " << hex(values[2]) << "},\n";
+		}
+		out << "\t};\n";
+		out << "}\n";
+		return out.str();
+	}
+
+	//==================> grapheme clusters <==================
+
+	std::string grapheme_tables() {
+		std::vector<int64_t> props(kCodePointCount);
+		for (char32_t ch = 0; ch < kCodePointCount; ++ch) {
+			const auto c = static_cast<UChar32>(ch);
+			int64_t value = 0;
+			switch (u_getIntPropertyValue(c, UCHAR_GRAPHEME_CLUSTER_BREAK)) {
+				case U_GCB_CR: value = 1; break;
+				case U_GCB_LF: value = 2; break;
+				case U_GCB_CONTROL: value = 3; break;
+				case U_GCB_EXTEND: value = 4; break;
+				case U_GCB_ZWJ: value = 5; break;
+				case U_GCB_REGIONAL_INDICATOR: value = 6; break;
+				case U_GCB_PREPEND: value = 7; break;
+				case U_GCB_SPACING_MARK: value = 8; break;
+				case U_GCB_L: value = 9; break;
+				case U_GCB_V: value = 10; break;
+				case U_GCB_T: value = 11; break;
+				case U_GCB_LV: value = 12; break;
+				case U_GCB_LVT: value = 13; break;
+				default: break;
+			}
+			if (u_hasBinaryProperty(c, UCHAR_EXTENDED_PICTOGRAPHIC)) {
+				value |= 0x10;
+			}
+			props[ch] = value;
+		}
+
+		std::ostringstream out;
+		out << "#pragma once\n\n" << header_comment() << "\n#include \"ucd_table.hpp\"\n\nnamespace u8lib::ucd\n{\n";
+		out << "\t// values of the Grapheme_Cluster_Break property\n";
+		out << "\tenum class grapheme_break : uint8_t {\n";
+		for (const char* name: {"other", "cr", "lf", "control", "extend", "zwj", "regional_indicator", "prepend", "spacing_mark",
+		                        "l", "v", "t", "lv", "lvt"}) {
+			out << "\t\t" << name << ",\n";
+		}
+		out << "\t};\n\n";
+		out << "\t// kGraphemeBreakProps: bits 0-3 hold the grapheme_break value\n";
+		out << "\tinline constexpr uint8_t kGraphemeBreakMask = 0xf;\n";
+		out << "\tinline constexpr uint8_t kExtendedPictographic = 0x10;\n\n";
+		write_two_stage_table(out, "uint8_t", 1, "kGraphemeBreakProps", props);
+		out << "}\n";
+		return out.str();
+	}
+
+	//==================> character properties <==================
+
+	std::string property_tables() {
+		// in the order of u8lib::unicode_general_category
+		constexpr UCharCategory kCategories[] = {
+			U_UPPERCASE_LETTER, U_LOWERCASE_LETTER, U_TITLECASE_LETTER, U_MODIFIER_LETTER, U_OTHER_LETTER,
+			U_NON_SPACING_MARK, U_COMBINING_SPACING_MARK, U_ENCLOSING_MARK,
+			U_DECIMAL_DIGIT_NUMBER, U_LETTER_NUMBER, U_OTHER_NUMBER,
+			U_CONNECTOR_PUNCTUATION, U_DASH_PUNCTUATION, U_START_PUNCTUATION, U_END_PUNCTUATION,
+			U_INITIAL_PUNCTUATION, U_FINAL_PUNCTUATION, U_OTHER_PUNCTUATION,
+			U_MATH_SYMBOL, U_CURRENCY_SYMBOL, U_MODIFIER_SYMBOL, U_OTHER_SYMBOL,
+			U_SPACE_SEPARATOR, U_LINE_SEPARATOR, U_PARAGRAPH_SEPARATOR,
+			U_CONTROL_CHAR, U_FORMAT_CHAR, U_SURROGATE, U_PRIVATE_USE_CHAR, U_UNASSIGNED,
+		};
+		int64_t category_of[U_CHAR_CATEGORY_COUNT] = {};
+		for (size_t i = 0; i < std::size(kCategories); ++i) {
+			category_of[kCategories[i]] = static_cast<int64_t>(i);
+		}
+
+		std::vector<int64_t> props(kCodePointCount);
+		for (char32_t ch = 0; ch < kCodePointCount; ++ch) {
+			const auto c = static_cast<UChar32>(ch);
+			// UEastAsianWidth is in the order of u8lib::unicode_east_asian_width
+			int64_t value = category_of[u_charType(c)] | int64_t{u_getIntPropertyValue(c, UCHAR_EAST_ASIAN_WIDTH)} << 5;
+			if (u_hasBinaryProperty(c, UCHAR_WHITE_SPACE)) {
+				value |= 0x100;
+			}
+			if (u_hasBinaryProperty(c, UCHAR_ALPHABETIC)) {
+				value |= 0x200;
+			}
+			// estimated width of [format.string.std] as revised by P2675: East_Asian_Width W and F, with the
+			// yijing hexagram symbols and the pictographs, emoticons and supplemental symbols blocks
+			const auto width = u_getIntPropertyValue(c, UCHAR_EAST_ASIAN_WIDTH);
+			if (width == U_EA_WIDE || width == U_EA_FULLWIDTH || (ch >= 0x4DC0 && ch <= 0x4DFF) ||
+			    (ch >= 0x1F300 && ch <= 0x1F64F) || (ch >= 0x1F900 && ch <= 0x1F9FF)) {
+				value |= 0x400;
+			}
+			props[ch] = value;
+		}
+
+		std::ostringstream out;
+		out << "#pragma once\n\n" << header_comment() << "\n#include \"ucd_table.hpp\"\n\nnamespace u8lib::ucd\n{\n";
+		out << "\t// kCharacterProps: bits 0-4 hold the General_Category and bits 5-7 the East_Asian_Width, as values of\n";
+		out << "\t// unicode_general_category and unicode_east_asian_width\n";
+		out << "\tinline constexpr uint16_t kGeneralCategoryMask = 0x1f;\n";
+		out << "\tinline constexpr unsigned kEastAsianWidthShift = 5;\n";
+		out << "\tinline constexpr uint16_t kEastAsianWidthMask = 0x7;\n";
+		out << "\tinline constexpr uint16_t kWhiteSpace = 0x100;\n";
+		out << "\tinline constexpr uint16_t kAlphabetic = 0x200;\n";
+		out << "\t// estimated width 2 of std::format\n";
+		out << "\tinline constexpr uint16_t kWideEstimate = 0x400;\n\n";
+		write_two_stage_table(out, "uint16_t", 2, "kCharacterProps", props);
+		out << "}\n";
+		return out.str();
+	}
+}
+
+int main(int argc, char** argv) {
+	if (argc != 2) {
+		std::fprintf(stderr, "usage: %s <output directory>\n", argv[0]);
+		return 1;
+	}
+
+	const std::string dir = argv[1];
+	if (!write_file(dir + "/normalization_tables.hpp", normalization_tables()) ||
+	    !write_file(dir + "/case_tables.hpp", case_tables()) ||
+	    !write_file(dir + "/grapheme_tables.hpp", grapheme_tables()) ||
+	    !write_file(dir + "/property_tables.hpp", property_tables())) {
+		std::fprintf(stderr, "failed to write %s\n", dir.c_str());
+		return 1;
+	}
+	return 0;
+}